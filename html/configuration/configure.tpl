@@ -25,6 +25,11 @@ function saveValues() {
 	var motorTickInterval = document.getElementById("motor-tick-interval").value;
 	var accelerationDuration = document.getElementById("acceleration-duration").value;
 	var movementPause = document.getElementById("movement-pause").value;
+	var execTimeBudget = document.getElementById("exec-time-budget").value;
+	var telemetryRate = document.getElementById("telemetry-rate").value;
+	var hardwareTickInterval = document.getElementById("hardware-tick-interval").value;
+	var fullStepTravel = document.getElementById("full-step-travel").value;
+	var servoOverlap = document.getElementById("servo-overlap").value;
 	var struct = {"configuration": { 
 		"straightStepsLeft": parseInt(straightStepsLeft),
 		"straightStepsRight": parseInt(straightStepsRight),
@@ -36,7 +41,12 @@ function saveValues() {
 		"servoTickInterval": parseInt(servoTickInterval),
 		"motorTickInterval": parseInt(motorTickInterval),
 		"accelerationDuration": parseInt(accelerationDuration),
-		"movementPause": parseInt(movementPause)}};
+		"movementPause": parseInt(movementPause),
+		"execTimeBudget": parseInt(execTimeBudget),
+		"telemetryRate": parseInt(telemetryRate),
+		"hardwareTickInterval": parseInt(hardwareTickInterval),
+		"fullStepTravel": parseInt(fullStepTravel),
+		"servoOverlap": parseInt(servoOverlap)}};
 	var xhr = new XMLHttpRequest();
 	xhr.open('POST', '/configuration/setConfiguration.cgi');
 	xhr.onreadystatechange = function() {
@@ -76,6 +86,11 @@ document.addEventListener("DOMContentLoaded", function() {
 	var motorTickInterval = "%motorTickInterval%";
 	var accelerationDuration = "%accelerationDuration%";
 	var movementPause = "%movementPause%";
+	var execTimeBudget = "%execTimeBudget%";
+	var telemetryRate = "%telemetryRate%";
+	var hardwareTickInterval = "%hardwareTickInterval%";
+	var fullStepTravel = "%fullStepTravel%";
+	var servoOverlap = "%servoOverlap%";
 	if (isNaN(parseInt(straightStepsLeft))) {
 		straightStepsLeft = 1728;
 	}
@@ -109,6 +124,21 @@ document.addEventListener("DOMContentLoaded", function() {
 	if (isNaN(parseInt(movementPause))) {
 		movementPause = 201;
 	}
+	if (isNaN(parseInt(execTimeBudget))) {
+		execTimeBudget = 2000;
+	}
+	if (isNaN(parseInt(telemetryRate))) {
+		telemetryRate = 10;
+	}
+	if (isNaN(parseInt(hardwareTickInterval))) {
+		hardwareTickInterval = 0;
+	}
+	if (isNaN(parseInt(fullStepTravel))) {
+		fullStepTravel = 0;
+	}
+	if (isNaN(parseInt(servoOverlap))) {
+		servoOverlap = 0;
+	}
 	document.getElementById("left-straight").value = straightStepsLeft;
 	document.getElementById("right-straight").value = straightStepsRight;
 	document.getElementById("left-turn").value = turnStepsLeft;
@@ -120,6 +150,11 @@ document.addEventListener("DOMContentLoaded", function() {
 	document.getElementById("motor-tick-interval").value = motorTickInterval;
 	document.getElementById("acceleration-duration").value = accelerationDuration;
 	document.getElementById("movement-pause").value = movementPause;
+	document.getElementById("exec-time-budget").value = execTimeBudget;
+	document.getElementById("telemetry-rate").value = telemetryRate;
+	document.getElementById("hardware-tick-interval").value = hardwareTickInterval;
+	document.getElementById("full-step-travel").value = fullStepTravel;
+	document.getElementById("servo-overlap").value = servoOverlap;
 
 	attachUnsaved("left-straight");
 	attachUnsaved("right-straight");
@@ -132,6 +167,11 @@ document.addEventListener("DOMContentLoaded", function() {
 	attachUnsaved("motor-tick-interval");
 	attachUnsaved("acceleration-duration");
 	attachUnsaved("movement-pause");
+	attachUnsaved("exec-time-budget");
+	attachUnsaved("telemetry-rate");
+	attachUnsaved("hardware-tick-interval");
+	attachUnsaved("full-step-travel");
+	attachUnsaved("servo-overlap");
 });
 
 	</script>
@@ -158,6 +198,11 @@ document.addEventListener("DOMContentLoaded", function() {
 		<tr><td>Motor Tick Interval (ms)</td><td><input type="number" id="motor-tick-interval" min="0" max="2000" step="1" value"1"></td></tr>
 		<tr><td>Acceleration Duration (ticks)</td><td><input type="number" id="acceleration-duration" min="0" max="2000" step="1" value"199"></td></tr>
 		<tr><td>Movement Pause (ms)</td><td><input type="number" id="movement-pause" min="0" step="1" value"200"></td></tr>
+		<tr><td>Program Execution Budget (µs)</td><td><input type="number" id="exec-time-budget" min="1" max="20000" step="1" value"2000"></td></tr>
+		<tr><td>Program Status Update Rate (Hz)</td><td><input type="number" id="telemetry-rate" min="1" max="50" step="1" value"10"></td></tr>
+		<tr><td>Hardware Motor Tick Interval (µs, 0 for off, ignored whilst the servo PWM uses the hardware timer)</td><td><input type="number" id="hardware-tick-interval" min="0" max="10000" step="1" value"0"></td></tr>
+		<tr><td>Full Step Pen-Up Travel (1 for on, 0 for off, off by default)</td><td><input type="number" id="full-step-travel" min="0" max="1" step="1" value"0"></td></tr>
+		<tr><td>Move Pen Whilst Travelling (1 for on, 0 for off, off by default)</td><td><input type="number" id="servo-overlap" min="0" max="1" step="1" value"0"></td></tr>
 	</table>
 	<table>
 	<div id="unsaved" class="warning" style="display: none;">
@@ -15,7 +15,7 @@ ace.define('ace/mode/logo', function(require, exports, module) {
 				{token: "keyword.control", regex: "if|else|repeat|return|stop"},
 				{token: "keyword.other", regex: "to|end"},
 				{token: "storage.type", regex: "make"},
-				{token: "support.function", regex: "fd|forward|bk|back|lt|left|rt|right|pu|penup|pd|pendown"},
+				{token: "support.function", regex: "fd|forward|bk|back|lt|left|rt|right|arc|pu|penup|pd|pendown"},
 				{caseInsensitive : true }
             ]
         };
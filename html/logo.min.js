@@ -1 +1,32 @@
-(function(){function p(d,e,t){function r(i,o){if(!e[i]){if(!d[i]){var s="function"==typeof require&&require;if(!o&&s)return s(i,!0);if(n)return n(i,!0);var a=new Error("Cannot find module '"+i+"'");throw a.code="MODULE_NOT_FOUND",a}var c=e[i]={exports:{}};d[i][0].call(c.exports,function(t){var e=d[i][1][t];return r(e?e:t)},c,c.exports,p,d,e,t)}return e[i].exports}for(var n="function"==typeof require&&require,a=0;a<t.length;a++)r(t[a]);return r}return p})()({1:[function(e,t,o){function r(e){return n.Lexer.call(this,e),this._interp=new n.atn.LexerATNSimulator(this,p,a,new n.PredictionContextCache()),this}var n=e("antlr4/index"),p=new n.atn.ATNDeserializer().deserialize("\x03\u608B\uA72A\u8133\uB9ED\u417C\u3BE7\u7786\u5964\x02\x12w\b\x01\x04\x02\t\x02\x04\x03\t\x03\x04\x04\t\x04\x04\x05\t\x05\x04\x06\t\x06\x04\x07\t\x07\x04\b\t\b\x04\t\t\t\x04\n\t\n\x04\x0B\t\x0B\x04\f\t\f\x04\r\t\r\x04\x0E\t\x0E\x04\x0F\t\x0F\x04\x10\t\x10\x04\x11\t\x11\x03\x02\x03\x02\x03\x03\x03\x03\x03\x04\x03\x04\x03\x05\x03\x05\x03\x05\x03\x05\x03\x05\x03\x05\x03\x05\x03\x05\x03\x05\x03\x06\x03\x06\x03\x06\x03\x06\x03\x06\x03\x07\x03\x07\x03\x07\x03\x07\x03\x07\x03\b\x03\b\x03\b\x03\b\x03\b\x03\b\x03\b\x03\t\x03\t\x03\t\x03\t\x03\t\x03\t\x03\n\x03\n\x03\n\x03\n\x05\nN\n\n\x03\x0B\x03\x0B\x03\x0B\x03\x0B\x03\x0B\x03\f\x03\f\x03\f\x03\f\x03\f\x03\f\x03\f\x03\r\x03\r\x07\r^\n\r\f\r\x0E\ra\x0B\r\x03\x0E\x06\x0Ed\n\x0E\r\x0E\x0E\x0Ee\x03\x0F\x03\x0F\x07\x0Fj\n\x0F\f\x0F\x0E\x0Fm\x0B\x0F\x03\x10\x05\x10p\n\x10\x03\x10\x03\x10\x03\x11\x03\x11\x03\x11\x03\x11\x02\x02\x12\x03\x03\x05\x04\x07\x05\t\x06\x0B\x07\r\b\x0F\t\x11\n\x13\x0B\x15\f\x17\r\x19\x0E\x1B\x0F\x1D\x10\x1F\x11!\x12\x03\x02\b\x04\x02hhvv\x04\x02C\\c|\x07\x02//2;C\\aac|\x03\x022;\x04\x02\f\f\x0F\x0F\x04\x02\x0B\x0B\"\"\x02{\x02\x03\x03\x02\x02\x02\x02\x05\x03\x02\x02\x02\x02\x07\x03\x02\x02\x02\x02\t\x03\x02\x02\x02\x02\x0B\x03\x02\x02\x02\x02\r\x03\x02\x02\x02\x02\x0F\x03\x02\x02\x02\x02\x11\x03\x02\x02\x02\x02\x13\x03\x02\x02\x02\x02\x15\x03\x02\x02\x02\x02\x17\x03\x02\x02\x02\x02\x19\x03\x02\x02\x02\x02\x1B\x03\x02\x02\x02\x02\x1D\x03\x02\x02\x02\x02\x1F\x03\x02\x02\x02\x02!\x03\x02\x02\x02\x03#\x03\x02\x02\x02\x05%\x03\x02\x02\x02\x07'\x03\x02\x02\x02\t)\x03\x02\x02\x02\x0B2\x03\x02\x02\x02\r7\x03\x02\x02\x02\x0F<\x03\x02\x02\x02\x11C\x03\x02\x02\x02\x13I\x03\x02\x02\x02\x15O\x03\x02\x02\x02\x17T\x03\x02\x02\x02\x19[\x03\x02\x02\x02\x1Bc\x03\x02\x02\x02\x1Dg\x03\x02\x02\x02\x1Fo\x03\x02\x02\x02!s\x03\x02\x02\x02#$\x07<\x02\x02$\x04\x03\x02\x02\x02%&\x07?\x02\x02&\x06\x03\x02\x02\x02'(\x07.\x02\x02(\b\x03\x02\x02\x02)*\x070\x02\x02*+\x07i\x02\x02+,\x07n\x02\x02,-\x07q\x02\x02-.\x07d\x02\x02./\x07c\x02\x02/0\x07n\x02\x0201\x07u\x02\x021\n\x03\x02\x02\x0223\x070\x02\x0234\x07f\x02\x0245\x07g\x02\x0256\x07h\x02\x026\f\x03\x02\x02\x0278\x07c\x02\x0289\x07t\x02\x029:\x07i\x02\x02:;\x07u\x02\x02;\x0E\x03\x02\x02\x02<=\x07n\x02\x02=>\x07q\x02\x02>?\x07e\x02\x02?@\x07c\x02\x02@A\x07n\x02\x02AB\x07u\x02\x02B\x10\x03\x02\x02\x02CD\x07u\x02\x02DE\x07v\x02\x02EF\x07c\x02\x02FG\x07e\x02\x02GH\x07m\x02\x02H\x12\x03\x02\x02\x02IJ\x07d\x02\x02JK\x07t\x02\x02KM\x03\x02\x02\x02LN\t\x02\x02\x02ML\x03\x02\x02\x02MN\x03\x02\x02\x02N\x14\x03\x02\x02\x02OP\x07e\x02\x02PQ\x07c\x02\x02QR\x07n\x02\x02RS\x07n\x02\x02S\x16\x03\x02\x02\x02TU\x07>\x02\x02UV\x07o\x02\x02VW\x07c\x02\x02WX\x07k\x02\x02XY\x07p\x02\x02YZ\x07@\x02\x02Z\x18\x03\x02\x02\x02[_\t\x03\x02\x02\\^\t\x04\x02\x02]\\\x03\x02\x02\x02^a\x03\x02\x02\x02_]\x03\x02\x02\x02_`\x03\x02\x02\x02`\x1A\x03\x02\x02\x02a_\x03\x02\x02\x02bd\t\x05\x02\x02cb\x03\x02\x02\x02de\x03\x02\x02\x02ec\x03\x02\x02\x02ef\x03\x02\x02\x02f\x1C\x03\x02\x02\x02gk\x07=\x02\x02hj\n\x06\x02\x02ih\x03\x02\x02\x02jm\x03\x02\x02\x02ki\x03\x02\x02\x02kl\x03\x02\x02\x02l\x1E\x03\x02\x02\x02mk\x03\x02\x02\x02np\x07\x0F\x02\x02on\x03\x02\x02\x02op\x03\x02\x02\x02pq\x03\x02\x02\x02qr\x07\f\x02\x02r \x03\x02\x02\x02st\t\x07\x02\x02tu\x03\x02\x02\x02uv\b\x11\x02\x02v\"\x03\x02\x02\x02\b\x02M_eko\x03\b\x02\x02"),a=p.decisionToState.map(function(e,t){return new n.dfa.DFA(e,t)});r.prototype=Object.create(n.Lexer.prototype),r.prototype.constructor=r,Object.defineProperty(r.prototype,"atn",{get:function(){return p}}),r.EOF=n.Token.EOF,r.T__0=1,r.T__1=2,r.T__2=3,r.GLOBALS=4,r.DEF=5,r.ARGS=6,r.LOCALS=7,r.STACK=8,r.BRANCH=9,r.CALL=10,r.MAINID=11,r.ID=12,r.NUM=13,r.COMMENT=14,r.EOL=15,r.WS=16,r.prototype.channelNames=["DEFAULT_TOKEN_CHANNEL","HIDDEN"],r.prototype.modeNames=["DEFAULT_MODE"],r.prototype.literalNames=[null,"':'","'='","','","'.globals'","'.def'","'args'","'locals'","'stack'",null,"'call'","'<main>'"],r.prototype.symbolicNames=[null,null,null,null,"GLOBALS","DEF","ARGS","LOCALS","STACK","BRANCH","CALL","MAINID","ID","NUM","COMMENT","EOL","WS"],r.prototype.ruleNames=["T__0","T__1","T__2","GLOBALS","DEF","ARGS","LOCALS","STACK","BRANCH","CALL","MAINID","ID","NUM","COMMENT","EOL","WS"],r.prototype.grammarFileName="asm.g4",o.asmLexer=r},{"antlr4/index":49}],2:[function(e,t,o){function r(){return n.tree.ParseTreeListener.call(this),this}var n=e("antlr4/index");r.prototype=Object.create(n.tree.ParseTreeListener.prototype),r.prototype.constructor=r,r.prototype.enterProgram=function(){},r.prototype.exitProgram=function(){},r.prototype.enterDef=function(){},r.prototype.exitDef=function(){},r.prototype.enterLabel=function(){},r.prototype.exitLabel=function(){},r.prototype.enterInstrLine=function(){},r.prototype.exitInstrLine=function(){},r.prototype.enterAsmComment=function(){},r.prototype.exitAsmComment=function(){},r.prototype.enterBranch=function(){},r.prototype.exitBranch=function(){},r.prototype.enterCall=function(){},r.prototype.exitCall=function(){},r.prototype.enterOtherInstr=function(){},r.prototype.exitOtherInstr=function(){},r.prototype.enterComment=function(){},r.prototype.exitComment=function(){},o.asmListener=r},{"antlr4/index":49}],3:[function(e,t,o){function r(e){return T.Parser.call(this,e),this._interp=new T.atn.ParserATNSimulator(this,m,_,S),this.ruleNames=E,this.literalNames=f,this.symbolicNames=h,this}function n(e,t,o){return void 0===t&&(t=null),(void 0===o||null===o)&&(o=-1),T.ParserRuleContext.call(this,t,o),this.parser=e,this.ruleIndex=r.RULE_program,this}function p(e,t,o){return void 0===t&&(t=null),(void 0===o||null===o)&&(o=-1),T.ParserRuleContext.call(this,t,o),this.parser=e,this.ruleIndex=r.RULE_line,this}function a(e,t){return p.call(this,e),p.prototype.copyFrom.call(this,t),this}function i(e,t){return p.call(this,e),p.prototype.copyFrom.call(this,t),this}function s(e,t){return p.call(this,e),p.prototype.copyFrom.call(this,t),this}function d(e,t){return p.call(this,e),p.prototype.copyFrom.call(this,t),this}function c(e,t,o){return void 0===t&&(t=null),(void 0===o||null===o)&&(o=-1),T.ParserRuleContext.call(this,t,o),this.parser=e,this.ruleIndex=r.RULE_instr,this}function l(e,t){return c.call(this,e),c.prototype.copyFrom.call(this,t),this}function u(e,t){return c.call(this,e),c.prototype.copyFrom.call(this,t),this}function y(e,t){return c.call(this,e),c.prototype.copyFrom.call(this,t),this}function g(e,t,o){return void 0===t&&(t=null),(void 0===o||null===o)&&(o=-1),T.ParserRuleContext.call(this,t,o),this.parser=e,this.ruleIndex=r.RULE_comment,this}var T=e("antlr4/index"),x=e("./asmListener").asmListener,m=new T.atn.ATNDeserializer().deserialize("\x03\u608B\uA72A\u8133\uB9ED\u417C\u3BE7\u7786\u5964\x03\x12?\x04\x02\t\x02\x04\x03\t\x03\x04\x04\t\x04\x04\x05\t\x05\x03\x02\x03\x02\x03\x02\x03\x02\x07\x02\x0F\n\x02\f\x02\x0E\x02\x12\x0B\x02\x03\x02\x03\x02\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x05\x03*\n\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x05\x031\n\x03\x03\x04\x03\x04\x03\x04\x03\x04\x03\x04\x03\x04\x05\x049\n\x04\x05\x04;\n\x04\x03\x05\x03\x05\x03\x05\x02\x02\x06\x02\x04\x06\b\x02\x03\x03\x02\r\x0E\x02B\x02\n\x03\x02\x02\x02\x040\x03\x02\x02\x02\x06:\x03\x02\x02\x02\b<\x03\x02\x02\x02\n\x0B\x07\x06\x02\x02\x0B\f\x07\x0F\x02\x02\f\x10\x07\x11\x02\x02\r\x0F\x05\x04\x03\x02\x0E\r\x03\x02\x02\x02\x0F\x12\x03\x02\x02\x02\x10\x0E\x03\x02\x02\x02\x10\x11\x03\x02\x02\x02\x11\x13\x03\x02\x02\x02\x12\x10\x03\x02\x02\x02\x13\x14\x07\x02\x02\x03\x14\x03\x03\x02\x02\x02\x15\x16\x07\x07\x02\x02\x16\x17\t\x02\x02\x02\x17\x18\x07\x03\x02\x02\x18\x19\x07\b\x02\x02\x19\x1A\x07\x04\x02\x02\x1A\x1B\x07\x0F\x02\x02\x1B\x1C\x07\x05\x02\x02\x1C\x1D\x07\t\x02\x02\x1D\x1E\x07\x04\x02\x02\x1E\x1F\x07\x0F\x02\x02\x1F \x07\x05\x02\x02 !\x07\n\x02\x02!\"\x07\x04\x02\x02\"#\x07\x0F\x02\x02#1\x07\x11\x02\x02$%\x07\x0E\x02\x02%&\x07\x03\x02\x02&1\x07\x11\x02\x02')\x05\x06\x04\x02(*\x05\b\x05\x02)(\x03\x02\x02\x02)*\x03\x02\x02\x02*+\x03\x02\x02\x02+,\x07\x11\x02\x02,1\x03\x02\x02\x02-.\x05\b\x05\x02./\x07\x11\x02\x02/1\x03\x02\x02\x020\x15\x03\x02\x02\x020$\x03\x02\x02\x020'\x03\x02\x02\x020-\x03\x02\x02\x021\x05\x03\x02\x02\x0223\x07\x0B\x02\x023;\x07\x0E\x02\x0245\x07\f\x02\x025;\x07\x0E\x02\x0268\x07\x0E\x02\x0279\x07\x0F\x02\x0287\x03\x02\x02\x0289\x03\x02\x02\x029;\x03\x02\x02\x02:2\x03\x02\x02\x02:4\x03\x02\x02\x02:6\x03\x02\x02\x02;\x07\x03\x02\x02\x02<=\x07\x10\x02\x02=\t\x03\x02\x02\x02\x07\x10)08:"),_=m.decisionToState.map(function(e,t){return new T.dfa.DFA(e,t)}),S=new T.PredictionContextCache,f=[null,"':'","'='","','","'.globals'","'.def'","'args'","'locals'","'stack'",null,"'call'","'<main>'"],h=[null,null,null,null,"GLOBALS","DEF","ARGS","LOCALS","STACK","BRANCH","CALL","MAINID","ID","NUM","COMMENT","EOL","WS"],E=["program","line","instr","comment"];r.prototype=Object.create(T.Parser.prototype),r.prototype.constructor=r,Object.defineProperty(r.prototype,"atn",{get:function(){return m}}),r.EOF=T.Token.EOF,r.T__0=1,r.T__1=2,r.T__2=3,r.GLOBALS=4,r.DEF=5,r.ARGS=6,r.LOCALS=7,r.STACK=8,r.BRANCH=9,r.CALL=10,r.MAINID=11,r.ID=12,r.NUM=13,r.COMMENT=14,r.EOL=15,r.WS=16,r.RULE_program=0,r.RULE_line=1,r.RULE_instr=2,r.RULE_comment=3,n.prototype=Object.create(T.ParserRuleContext.prototype),n.prototype.constructor=n,n.prototype.GLOBALS=function(){return this.getToken(r.GLOBALS,0)},n.prototype.NUM=function(){return this.getToken(r.NUM,0)},n.prototype.EOL=function(){return this.getToken(r.EOL,0)},n.prototype.EOF=function(){return this.getToken(r.EOF,0)},n.prototype.line=function(e){return void 0===e&&(e=null),null===e?this.getTypedRuleContexts(p):this.getTypedRuleContext(p,e)},n.prototype.enterRule=function(e){e instanceof x&&e.enterProgram(this)},n.prototype.exitRule=function(e){e instanceof x&&e.exitProgram(this)},r.ProgramContext=n,r.prototype.program=function(){var e=new n(this,this._ctx,this.state);this.enterRule(e,0,r.RULE_program);var t=0;try{for(this.enterOuterAlt(e,1),this.state=8,this.match(r.GLOBALS),this.state=9,this.match(r.NUM),this.state=10,this.match(r.EOL),this.state=14,this._errHandler.sync(this),t=this._input.LA(1);0==(-32&t)&&0!=(1<<t&(1<<r.DEF|1<<r.BRANCH|1<<r.CALL|1<<r.ID|1<<r.COMMENT));)this.state=11,this.line(),this.state=16,this._errHandler.sync(this),t=this._input.LA(1);this.state=17,this.match(r.EOF)}catch(t){if(t instanceof T.error.RecognitionException)e.exception=t,this._errHandler.reportError(this,t),this._errHandler.recover(this,t);else throw t}finally{this.exitRule()}return e},p.prototype=Object.create(T.ParserRuleContext.prototype),p.prototype.constructor=p,p.prototype.copyFrom=function(e){T.ParserRuleContext.prototype.copyFrom.call(this,e)},a.prototype=Object.create(p.prototype),a.prototype.constructor=a,r.DefContext=a,a.prototype.DEF=function(){return this.getToken(r.DEF,0)},a.prototype.ARGS=function(){return this.getToken(r.ARGS,0)},a.prototype.NUM=function(e){return void 0===e&&(e=null),null===e?this.getTokens(r.NUM):this.getToken(r.NUM,e)},a.prototype.LOCALS=function(){return this.getToken(r.LOCALS,0)},a.prototype.STACK=function(){return this.getToken(r.STACK,0)},a.prototype.EOL=function(){return this.getToken(r.EOL,0)},a.prototype.ID=function(){return this.getToken(r.ID,0)},a.prototype.MAINID=function(){return this.getToken(r.MAINID,0)},a.prototype.enterRule=function(e){e instanceof x&&e.enterDef(this)},a.prototype.exitRule=function(e){e instanceof x&&e.exitDef(this)},i.prototype=Object.create(p.prototype),i.prototype.constructor=i,r.AsmCommentContext=i,i.prototype.comment=function(){return this.getTypedRuleContext(g,0)},i.prototype.EOL=function(){return this.getToken(r.EOL,0)},i.prototype.enterRule=function(e){e instanceof x&&e.enterAsmComment(this)},i.prototype.exitRule=function(e){e instanceof x&&e.exitAsmComment(this)},s.prototype=Object.create(p.prototype),s.prototype.constructor=s,r.LabelContext=s,s.prototype.ID=function(){return this.getToken(r.ID,0)},s.prototype.EOL=function(){return this.getToken(r.EOL,0)},s.prototype.enterRule=function(e){e instanceof x&&e.enterLabel(this)},s.prototype.exitRule=function(e){e instanceof x&&e.exitLabel(this)},d.prototype=Object.create(p.prototype),d.prototype.constructor=d,r.InstrLineContext=d,d.prototype.instr=function(){return this.getTypedRuleContext(c,0)},d.prototype.EOL=function(){return this.getToken(r.EOL,0)},d.prototype.comment=function(){return this.getTypedRuleContext(g,0)},d.prototype.enterRule=function(e){e instanceof x&&e.enterInstrLine(this)},d.prototype.exitRule=function(e){e instanceof x&&e.exitInstrLine(this)},r.LineContext=p,r.prototype.line=function(){var e=new p(this,this._ctx,this.state);this.enterRule(e,2,r.RULE_line);var t=0;try{this.state=46,this._errHandler.sync(this);var o=this._interp.adaptivePredict(this._input,2,this._ctx);1===o?(e=new a(this,e),this.enterOuterAlt(e,1),this.state=19,this.match(r.DEF),this.state=20,t=this._input.LA(1),t===r.MAINID||t===r.ID?(this._errHandler.reportMatch(this),this.consume()):this._errHandler.recoverInline(this),this.state=21,this.match(r.T__0),this.state=22,this.match(r.ARGS),this.state=23,this.match(r.T__1),this.state=24,this.match(r.NUM),this.state=25,this.match(r.T__2),this.state=26,this.match(r.LOCALS),this.state=27,this.match(r.T__1),this.state=28,this.match(r.NUM),this.state=29,this.match(r.T__2),this.state=30,this.match(r.STACK),this.state=31,this.match(r.T__1),this.state=32,this.match(r.NUM),this.state=33,this.match(r.EOL)):2===o?(e=new s(this,e),this.enterOuterAlt(e,2),this.state=34,this.match(r.ID),this.state=35,this.match(r.T__0),this.state=36,this.match(r.EOL)):3===o?(e=new d(this,e),this.enterOuterAlt(e,3),this.state=37,this.instr(),this.state=39,this._errHandler.sync(this),t=this._input.LA(1),t===r.COMMENT&&(this.state=38,this.comment()),this.state=41,this.match(r.EOL)):4===o?(e=new i(this,e),this.enterOuterAlt(e,4),this.state=43,this.comment(),this.state=44,this.match(r.EOL)):void 0}catch(t){if(t instanceof T.error.RecognitionException)e.exception=t,this._errHandler.reportError(this,t),this._errHandler.recover(this,t);else throw t}finally{this.exitRule()}return e},c.prototype=Object.create(T.ParserRuleContext.prototype),c.prototype.constructor=c,c.prototype.copyFrom=function(e){T.ParserRuleContext.prototype.copyFrom.call(this,e)},l.prototype=Object.create(c.prototype),l.prototype.constructor=l,r.OtherInstrContext=l,l.prototype.ID=function(){return this.getToken(r.ID,0)},l.prototype.NUM=function(){return this.getToken(r.NUM,0)},l.prototype.enterRule=function(e){e instanceof x&&e.enterOtherInstr(this)},l.prototype.exitRule=function(e){e instanceof x&&e.exitOtherInstr(this)},u.prototype=Object.create(c.prototype),u.prototype.constructor=u,r.CallContext=u,u.prototype.CALL=function(){return this.getToken(r.CALL,0)},u.prototype.ID=function(){return this.getToken(r.ID,0)},u.prototype.enterRule=function(e){e instanceof x&&e.enterCall(this)},u.prototype.exitRule=function(e){e instanceof x&&e.exitCall(this)},y.prototype=Object.create(c.prototype),y.prototype.constructor=y,r.BranchContext=y,y.prototype.BRANCH=function(){return this.getToken(r.BRANCH,0)},y.prototype.ID=function(){return this.getToken(r.ID,0)},y.prototype.enterRule=function(e){e instanceof x&&e.enterBranch(this)},y.prototype.exitRule=function(e){e instanceof x&&e.exitBranch(this)},r.InstrContext=c,r.prototype.instr=function(){var e=new c(this,this._ctx,this.state);this.enterRule(e,4,r.RULE_instr);var t=0;try{switch(this.state=56,this._errHandler.sync(this),this._input.LA(1)){case r.BRANCH:e=new y(this,e),this.enterOuterAlt(e,1),this.state=48,this.match(r.BRANCH),this.state=49,this.match(r.ID);break;case r.CALL:e=new u(this,e),this.enterOuterAlt(e,2),this.state=50,this.match(r.CALL),this.state=51,this.match(r.ID);break;case r.ID:e=new l(this,e),this.enterOuterAlt(e,3),this.state=52,this.match(r.ID),this.state=54,this._errHandler.sync(this),t=this._input.LA(1),t===r.NUM&&(this.state=53,this.match(r.NUM));break;default:throw new T.error.NoViableAltException(this);}}catch(t){if(t instanceof T.error.RecognitionException)e.exception=t,this._errHandler.reportError(this,t),this._errHandler.recover(this,t);else throw t}finally{this.exitRule()}return e},g.prototype=Object.create(T.ParserRuleContext.prototype),g.prototype.constructor=g,g.prototype.COMMENT=function(){return this.getToken(r.COMMENT,0)},g.prototype.enterRule=function(e){e instanceof x&&e.enterComment(this)},g.prototype.exitRule=function(e){e instanceof x&&e.exitComment(this)},r.CommentContext=g,r.prototype.comment=function(){var e=new g(this,this._ctx,this.state);this.enterRule(e,6,r.RULE_comment);try{this.enterOuterAlt(e,1),this.state=58,this.match(r.COMMENT)}catch(t){if(t instanceof T.error.RecognitionException)e.exception=t,this._errHandler.reportError(this,t),this._errHandler.recover(this,t);else throw t}finally{this.exitRule()}return e},o.asmParser=r},{"./asmListener":2,"antlr4/index":49}],4:[function(e){function t(e){return this._parent=e,this._variables=new Map,this._procedures=new Map,this._currentStackDepth=0,this._maxStackDepth=0,this}function o(){return this._procedures=[void 0],this._procedureMap=new Map,this._instructionMap=new Map,this._segments=[],this._segmentIndex=-1,this._currentSegment=void 0,this}function r(e){return y.call(this),this._scopes=void 0,this._globalScope=void 0,this._currentScope=void 0,this._exceptions=e,this._repeatDepth=0,this}function n(e,t){return y.call(this),this._scopes=e,this._currentScope=void 0,this._exceptions=t,this}function p(e,t){return y.call(this),this._scopes=t,this._globalScope=e,this._currentScope=void 0,this._asm=new o,this._frames=[],this._repeatDepth=0,this._labelNumber=-1,this}function a(){x.call(this),this._errors=[],this._codes=[],this._globalCount=0,this._nextFunctionId=0,this._currentFunctionName=void 0,this._functions=new Map,this._labels=new Map,this._unresolvedFunctions=[],this._unresolvedLabels=[],this._instrCodes=[["fd",1,0],["bk",2,0],["lt",3,0],["rt",4,0],["pu",5,0],["pd",6,0],["iadd",7,0],["isub",8,0],["imul",9,0],["idiv",10,0],["iconst_0",11,0],["iconst_1",12,0],["iconst_45",13,0],["iconst_90",14,0],["iconst",15,1],["iload_0",16,0],["iload_1",17,0],["iload_2",18,0],["iload",19,1],["istore_0",20,0],["istore_1",21,0],["istore_2",22,0],["istore",23,1],["gload_0",24,0],["gload_1",25,0],["gload_2",26,0],["gload",27,1],["gstore_0",28,0],["gstore_1",29,0],["gstore_2",30,0],["gstore",31,1],["ilt",32,0],["ile",33,0],["igt",34,0],["ige",35,0],["ieq",36,0],["ine",37,0],["call",38,1],["ret",39,0],["stop",40,0],["br",41,1],["brt",42,1],["brf",43,1],["fdraw",44,0],["bkraw",45,0],["ltraw",46,0],["rtraw",47,0],["wait",48,0]],this._instrMap=new Map;for(var e=0;e<this._instrCodes.length;e++)this._instrMap.set(this._instrCodes[e][0],{opcode:this._instrCodes[e][1],operands:this._instrCodes[e][2]})}function i(e){return m.call(this),this._errors=e,this}function s(e){var t=new c.InputStream(e),o=new l.logoLexer(t),p=new c.CommonTokenStream(o),a=new u.logoParser(p),s=[],d=new i(s);o.removeErrorListeners(),o.addErrorListener(d),a.removeErrorListeners(),a.addErrorListener(d),a.buildParseTrees=!0;var y=a.program(),g=new r(s);c.tree.ParseTreeWalker.DEFAULT.walk(g,y);var T=g.getGlobalScope(),x=g.getScopes(),m=new n(x,s);return c.tree.ParseTreeWalker.DEFAULT.walk(m,y),{parseTree:y,globalScope:T,scopes:x,exceptions:s}}var d=Math.max,c=e("antlr4/index"),l=e("./logoLexer"),u=e("./logoParser"),y=e("./logoListener").logoListener,g=e("./asmLexer"),T=e("./asmParser"),x=e("./asmListener").asmListener,m=c.error.ErrorListener;t.prototype.resolveLocalVariable=function(e){return this._variables.get(e)},t.prototype.resolveLocalProcedure=function(e){return this._procedures.get(e)},t.prototype.resolveVariable=function(e){var t=this.resolveLocalVariable(e);return void 0===t?void 0===this._parent?void 0:this._parent.resolveVariable(e):t},t.prototype.resolveProcedure=function(e){var t=this.resolveLocalProcedure(e);return void 0===t?void 0===this._parent?void 0:this._parent.resolveProcedure(e):t},t.prototype.defineVariable=function(e){return!(void 0!==this.resolveLocalVariable(e))&&(this._variables.set(e,{type:"variable",index:this._variables.size}),!0)},t.prototype.defineProcedure=function(e,t,o){return!(void 0!==this.resolveLocalProcedure(e))&&(this._procedures.set(e,{type:"procedure",paramCount:t,scope:o}),!0)},t.prototype.incrementStack=function(e,t){this._currentStackDepth+=e,this._maxStackDepth=d(this._maxStackDepth,this._currentStackDepth+t)},t.prototype.decrementStack=function(e,t){this._maxStackDepth=d(this._maxStackDepth,this._currentStackDepth+t),this._currentStackDepth-=e},t.prototype.getStackSize=function(){return this._maxStackDepth},t.prototype.getVariableCount=function(){return this._variables.size},t.prototype.nameAnonymousVariable=function(e,t){return"__Anon-"+e+"-"+t};o.prototype.pushSegment=function(){this._currentSegment=[],this._segmentIndex=this._segments.length,this._segments.push(this._currentSegment)},o.prototype.popSegment=function(){return this._segmentIndex--,this._currentSegment=0>this._segmentIndex?void 0:this._segments[this._segmentIndex],this._segments.pop()},o.prototype.insertSegment=function(e){for(var t=0;t<e.length;t++)this._currentSegment.push(e[t])},o.prototype.addProcedure=function(e,t,o,r){var n={name:e,paramCount:t,variableCount:o,stackSize:r};if(e===void 0)this._procedures[0]=n,this._procedureMap.set(void 0,0),this._currentSegment.push(".def <main>: args=0, locals="+n.variableCount+", stack="+n.stackSize);else{var p=this._procedures.length;this._procedures.push(n),this._procedureMap.set(e,p),this._currentSegment.push(".def "+e+": args="+n.paramCount+", locals="+n.variableCount+", stack="+n.stackSize)}},o.prototype.assignSegmentToProcedure=function(e,t){this._instructionMap.set(e,t)},o.prototype.getProcedureSegment=function(e){return this._instructionMap.get(e)},o.prototype.getProcedures=function(){var e=[],t;for(t of this._procedureMap.keys())e.push(t);return e},o.prototype.instrFd=function(){this._currentSegment.push("  fd")},o.prototype.instrBk=function(){this._currentSegment.push("  bk")},o.prototype.instrLt=function(){this._currentSegment.push("  lt")},o.prototype.instrRt=function(){this._currentSegment.push("  rt")},o.prototype.instrPu=function(){this._currentSegment.push("  pu")},o.prototype.instrPd=function(){this._currentSegment.push("  pd")},o.prototype.instrIAdd=function(){this._currentSegment.push("  iadd")},o.prototype.instrISub=function(){this._currentSegment.push("  isub")},o.prototype.instrIMul=function(){this._currentSegment.push("  imul")},o.prototype.instrIDiv=function(){this._currentSegment.push("  idiv")},o.prototype.instrIConst=function(e){switch(e){case 0:this._currentSegment.push("  iconst_0");break;case 1:this._currentSegment.push("  iconst_1");break;case 45:this._currentSegment.push("  iconst_45");break;case 90:this._currentSegment.push("  iconst_90");break;default:this._currentSegment.push("  iconst  "+e);}},o.prototype.instrILoad=function(e){switch(e){case 0:this._currentSegment.push("  iload_0");break;case 1:this._currentSegment.push("  iload_1");break;case 2:this._currentSegment.push("  iload_2");break;default:this._currentSegment.push("  iload  "+e);}},o.prototype.instrIStore=function(e){switch(e){case 0:this._currentSegment.push("  istore_0");break;case 1:this._currentSegment.push("  istore_1");break;case 2:this._currentSegment.push("  istore_2");break;default:this._currentSegment.push("  istore  "+e);}},o.prototype.instrGLoad=function(e){switch(e){case 0:this._currentSegment.push("  gload_0");break;case 1:this._currentSegment.push("  gload_1");break;case 2:this._currentSegment.push("  gload_2");break;default:this._currentSegment.push("  gload  "+e);}},o.prototype.instrGStore=function(e){switch(e){case 0:this._currentSegment.push("  gstore_0");break;case 1:this._currentSegment.push("  gstore_1");break;case 2:this._currentSegment.push("  gstore_2");break;default:this._currentSegment.push("  gstore  "+e);}},o.prototype.instrILt=function(){this._currentSegment.push("  ilt")},o.prototype.instrILe=function(){this._currentSegment.push("  ile")},o.prototype.instrIGt=function(){this._currentSegment.push("  igt")},o.prototype.instrIGe=function(){this._currentSegment.push("  ige")},o.prototype.instrIEq=function(){this._currentSegment.push("  ieq")},o.prototype.instrINe=function(){this._currentSegment.push("  ine")},o.prototype.label=function(e){this._currentSegment.push(e+":")},o.prototype.instrCall=function(e){this._currentSegment.push("  call  "+e)},o.prototype.instrRet=function(){this._currentSegment.push("  ret")},o.prototype.instrStop=function(){this._currentSegment.push("  stop")},o.prototype.instrBr=function(e){this._currentSegment.push("  br  "+e)},o.prototype.instrBrt=function(e){this._currentSegment.push("  brt  "+e)},o.prototype.instrBrf=function(e){this._currentSegment.push("  brf  "+e)},o.prototype.instrWait=function(){this._currentSegment.push("  wait")};r.prototype=Object.create(y.prototype),r.prototype.constructor=r,r.prototype.getGlobalScope=function(){return this._globalScope},r.prototype.getScopes=function(){return this._scopes},r.prototype.enterProgram=function(){this._globalScope=new t(void 0);var e=new t(this._globalScope);this._scopes=new Map,this._scopes.set(void 0,e),this._currentScope=e},r.prototype.enterProcedureDef=function(e){var o=e.STRING().getText(),r=e.paramDef().length;if(!this._currentScope.defineProcedure(o,r,this._currentScope)){var n=e.start,p=n.column+e.TO().getText().length+1;this._exceptions.push({line:n.line,col:p,message:"Duplicate procedure name \""+e.STRING().getText()+"\"."})}var a=new t(this._currentScope);this._scopes.set(o,a),this._currentScope=a},r.prototype.exitProcedureDef=function(){this._currentScope=this._currentScope._parent},r.prototype.exitParamDef=function(e){this._currentScope.defineVariable(e.STRING().getText())},r.prototype.exitMake=function(e){var t=e.STRING();t=null===t?"<undefined>":t.getText(),this._currentScope._parent==this._globalScope?this._globalScope.defineVariable(t):this._currentScope.defineVariable(t)},r.prototype.exitDeref=function(e){var t=e.STRING().getText();if(this._currentScope.resolveVariable(t)===void 0){var o=e.start;this._exceptions.push({line:o.line,col:o.column+1,message:"Unknown variable \""+t+"\"."})}},r.prototype.enterRepeat=function(){this._repeatDepth++;var e=this._currentScope.nameAnonymousVariable(this._repeatDepth,0);this._currentScope.defineVariable(e),e=this._currentScope.nameAnonymousVariable(this._repeatDepth,1),this._currentScope.defineVariable(e)},r.prototype.exitRepeat=function(){this._repeatDepth--};n.prototype=Object.create(y.prototype),n.prototype.constructor=n,n.prototype.incrementStack=function(e,t=0){this._currentScope.incrementStack(1,t)},n.prototype.decrementStack=function(e,t=1,o=0){this._currentScope.decrementStack(t,o)},n.prototype.enterProgram=function(){this._currentScope=this._scopes.get(void 0)},n.prototype.enterProcedureDef=function(e){var t=e.STRING().getText();this._currentScope=this._scopes.get(t)},n.prototype.exitProcedureDef=function(){this._currentScope=this._currentScope._parent},n.prototype.enterProcedureInvoke=function(e){var t=e.STRING().getText(),o=this._currentScope.resolveProcedure(t);if(o===void 0){var r=e.start;this._exceptions.push({line:r.line,col:r.column+1,message:"Unknown procedure name \""+t+"\"."})}else if(e.expr().length!==o.paramCount){var r=e.start;this._exceptions.push({line:r.line,col:r.column+1,message:"Incorrect parameter count for procedure \""+t+"\", "+e.expr().length+" instead of "+o.paramCount+"."})}},n.prototype.exitProcedureInvoke=function(e){var t=e.STRING().getText(),o=this._currentScope.resolveProcedure(t);o!==void 0&&this.decrementStack(e,o.paramCount)},n.prototype.exitIf=function(e){this.decrementStack(e)},n.prototype.exitFD=function(e){this.decrementStack(e)},n.prototype.exitBK=function(e){this.decrementStack(e)},n.prototype.exitLT=function(e){this.decrementStack(e)},n.prototype.exitRT=function(e){this.decrementStack(e)},n.prototype.exitMulDiv=function(e){this.decrementStack(e)},n.prototype.exitAddSub=function(e){this.decrementStack(e)},n.prototype.exitInt=function(e){this.incrementStack(e)},n.prototype.exitDeref=function(e){this.incrementStack(e)},n.prototype.exitComp=function(e){this.decrementStack(e)},n.prototype.exitMake=function(e){this.decrementStack(e)},n.prototype.exitRepeat=function(e){this.decrementStack(e,1,1)},n.prototype.exitNegate=function(e){this.incrementStack(e,2)};p.prototype=Object.create(y.prototype),p.prototype.constructor=p,p.prototype.getText=function(){var e=".globals "+this._globalScope.getVariableCount()+"\n",t=this._asm.getProcedures();for(var o in t)for(var r=this._asm.getProcedureSegment(t[o]),n=0;n<r.length;n++)e+=r[n]+"\n";return e},p.prototype.getNextLabelBase=function(e){return this._labelNumber++,e+"-"+this._labelNumber},p.prototype.enterProgram=function(){this._currentScope=this._scopes.get(void 0),this._asm.pushSegment(),this._asm.addProcedure(void 0,0,this._currentScope.getVariableCount(),this._currentScope.getStackSize())},p.prototype.enterProcedureDef=function(e){var t=e.STRING().getText();this._currentScope=this._scopes.get(t),this._asm.pushSegment(),this._asm.addProcedure(e.STRING().getText(),e.paramDef().length,this._currentScope.getVariableCount()-e.paramDef().length,this._currentScope.getStackSize())},p.prototype.exitProcedureDef=function(e){this._asm.instrRet(),this._currentScope=this._currentScope._parent,this._asm.assignSegmentToProcedure(e.STRING().getText(),this._asm.popSegment())},p.prototype.exitProgram=function(){this._asm.instrStop(),this._asm.assignSegmentToProcedure(void 0,this._asm.popSegment())},p.prototype.enterRepeat=function(){this._repeatDepth++,this._frames.push([])},p.prototype.exitRepeat=function(){var e=this._frames.pop();if(0<e.length){var t=this._currentScope.nameAnonymousVariable(this._repeatDepth,0),o=this._currentScope.resolveLocalVariable(t);this._asm.instrIStore(o.index),this._asm.instrIConst(0),t=this._currentScope.nameAnonymousVariable(this._repeatDepth,1);var r=this._currentScope.resolveLocalVariable(t);this._asm.instrIStore(r.index);var n=this.getNextLabelBase("repeat");this._asm.label(n+"-start"),this._asm.instrILoad(r.index),this._asm.instrILoad(o.index),this._asm.instrIGe(),this._asm.instrBrt(n+"-end"),this._asm.insertSegment(e[0]),this._asm.instrILoad(r.index),this._asm.instrIConst(1),this._asm.instrIAdd(),this._asm.instrIStore(r.index),this._asm.instrBr(n+"-start"),this._asm.label(n+"-end")}this._repeatDepth--},p.prototype.enterIf=function(){this._frames.push([])},p.prototype.exitIf=function(e){var t=this._frames.pop(),o=this.getNextLabelBase("if");this._asm.insertSegment(t[0]),this._asm.instrBrf(o+"-false"),this._asm.insertSegment(t[1]),null===e.ELSE()?this._asm.label(o+"-false"):(this._asm.instrBr(o+"-end"),this._asm.label(o+"-false"),this._asm.insertSegment(t[2]),this._asm.label(o+"-end"))},p.prototype.enterBlock=function(){this._asm.pushSegment()},p.prototype.exitBlock=function(){this._frames[this._frames.length-1].push(this._asm.popSegment())},p.prototype.enterCombine=function(){this._asm.pushSegment(),this._frames.push([])},p.prototype.exitCombine=function(e){var t=this._frames.pop();this._asm.insertSegment(t[0]);var o=this.getNextLabelBase("cmp"),r=!0;0<e.OR().length&&(r=!1);for(var n=1;n<t.length;n++)r?this._asm.instrBrf(o+"-fail"):this._asm.instrBrt(o+"-pass"),this._asm.insertSegment(t[n]);this._asm.instrBr(o+"-end"),r?(this._asm.label(o+"-fail"),this._asm.instrIConst(0)):(this._asm.label(o+"-pass"),this._asm.instrIConst(1)),this._asm.label(o+"-end"),this._frames[this._frames.length-1].push(this._asm.popSegment())},p.prototype.exitProcedureInvoke=function(e){var t=e.STRING().getText();this._asm.instrCall(t)},p.prototype.exitFD=function(){this._asm.instrFd()},p.prototype.exitBK=function(){this._asm.instrBk()},p.prototype.exitLT=function(){this._asm.instrLt()},p.prototype.exitRT=function(){this._asm.instrRt()},p.prototype.exitPU=function(){this._asm.instrPu()},p.prototype.exitPD=function(){this._asm.instrPd()},p.prototype.exitWait=function(){this._asm.instrWait()},p.prototype.exitMulDiv=function(e){null===e.MUL()?this._asm.instrIDiv():this._asm.instrIMul()},p.prototype.exitAddSub=function(e){null===e.ADD()?this._asm.instrISub():this._asm.instrIAdd()},p.prototype.exitInt=function(e){this._asm.instrIConst(parseInt(e.INTNUM().getText()))},p.prototype.exitDeref=function(e){var t=e.STRING().getText(),o=this._currentScope.resolveLocalVariable(t);o===void 0?(o=this._currentScope.resolveVariable(t),this._asm.instrGLoad(o.index)):this._asm.instrILoad(o.index)},p.prototype.exitNegate=function(){this._asm.instrIConst(-1),this._asm.instrIMul()},p.prototype.exitMake=function(e){var t=e.STRING().getText(),o=this._currentScope.resolveLocalVariable(t);o===void 0?(o=this._currentScope.resolveVariable(t),this._asm.instrGStore(o.index)):this._asm.instrIStore(o.index)},p.prototype.enterComp=function(){this._asm.pushSegment()},p.prototype.exitComp=function(e){switch(e.comparison().getText()){case"=":this._asm.instrIEq();break;case"!=":this._asm.instrINe();break;case"<":this._asm.instrILt();break;case"<=":this._asm.instrILe();break;case">":this._asm.instrIGt();break;case">=":this._asm.instrIGe();}this._frames[this._frames.length-1].push(this._asm.popSegment())},p.prototype.exitReturn=function(){this._asm.instrRet()},p.prototype.exitStop=function(){this._asm.instrStop()},a.prototype=Object.create(x.prototype),a.prototype.constructor=a,a.prototype.getBytecode=function(){var e=[];for(var[t,o]of this._functions)e.push({args:o.args,locals:o.locals,stack:o.stack,codes:o.codes});return{globals:this._globalCount,functions:e}},a.prototype.enterProgram=function(e){var t=parseInt(e.NUM().getText());if(255<t){var o=e.start;this._errors.push({line:o.line,col:o.column+1,message:"Global count cannot exceed 255."})}else this._globalCount=t},a.prototype.enterDef=function(e){var t=null===e.ID()?e.MAINID().getText():e.ID().getText();var o=this._nextFunctionId++,r=parseInt(e.NUM()[0].getText()),n=parseInt(e.NUM()[1].getText()),p=parseInt(e.NUM()[2].getText());this._currentFunctionName=t,this._codes=[],this._labels=new Map,this._functions.set(t,{id:o,args:r,locals:n,stack:p,codes:this._codes,labels:this._labels})},a.prototype.enterLabel=function(e){var t=e.ID().getText();this._labels.set(t,this._codes.length)},a.prototype.enterBranch=function(e){var t=e.BRANCH().getText(),o=e.ID().getText(),r=this._instrMap.get(t);if(r===void 0){var n=e.start;this._errors.push({line:n.line,col:n.column+1,message:"Unknown instruction: \""+t+"\"."})}else{this._codes.push(r.opcode);var p=this._labels.get(o);if(p===void 0){var n=e.start;this._unresolvedLabels.push({name:o,codes:this._codes,index:this._codes.length,fnName:this._currentFunctionName,line:n.line,col:n.column+1}),this._codes.push(0),this._codes.push(0),this._codes.push(0),this._codes.push(0)}else this._codes.push((4278190080&p)>>24),this._codes.push((16711680&p)>>16),this._codes.push((65280&p)>>8),this._codes.push(255&p)}},a.prototype.enterCall=function(e){var t=e.CALL().getText(),o=e.ID().getText(),r=this._instrMap.get(t);if(r===void 0){var n=e.start;this._errors.push({line:n.line,col:n.column+1,message:"Unknown instruction: \""+t+"\"."})}else{this._codes.push(r.opcode);var p=this._functions.get(o);if(p===void 0){var n=e.start;this._unresolvedFunctions.push({name:o,codes:this._codes,index:this._codes.length,line:n.line,col:n.column+1}),this._codes.push(0),this._codes.push(0),this._codes.push(0),this._codes.push(0)}else this._codes.push((4278190080&p.id)>>24),this._codes.push((16711680&p.id)>>16),this._codes.push((65280&p.id)>>8),this._codes.push(255&p.id)}},a.prototype.enterOtherInstr=function(e){var t=e.ID().getText(),o=this._instrMap.get(t);if(void 0===o){var r=e.start;this._errors.push({line:r.line,col:r.column+1,message:"Unknown instruction: \""+t+"\"."})}else if(this._codes.push(o.opcode),1==o.operands){var n=parseInt(e.NUM().getText());this._codes.push((4278190080&n)>>24),this._codes.push((16711680&n)>>16),this._codes.push((65280&n)>>8),this._codes.push(255&n)}},a.prototype.exitProgram=function(){for(var e=0;e<this._unresolvedFunctions.length;e++){var t=this._unresolvedFunctions[e],o=this._functions.get(t.name);o===void 0?this._errors.push({line:t.line,col:t.col,message:"Unknown function: \""+t.name+"\"."}):(t.codes[t.index]=(4278190080&o.id)>>24,t.codes[t.index+1]=(16711680&o.id)>>16,t.codes[t.index+2]=(65280&o.id)>>8,t.codes[t.index+3]=255&o.id)}for(var e=0;e<this._unresolvedLabels.length;e++){var t=this._unresolvedLabels[e],o=this._functions.get(t.fnName),r=o.labels.get(t.name);r===void 0?this._errors.push({line:t.line,col:label.col,message:"Unknown label: \""+t.name+"\"."}):(t.codes[t.index]=(4278190080&r)>>24,t.codes[t.index+1]=(16711680&r)>>16,t.codes[t.index+2]=(65280&r)>>8,t.codes[t.index+3]=255&r)}};i.prototype=Object.create(m.prototype),i.prototype.constructor=i,i.prototype.syntaxError=function(e,t,o,r,n){this._errors.push({line:o,col:r,message:n,type:"error"})},logo={},logo.verifyProgram=function(e){var t=s(e);return t.exceptions},logo.compileProgram=function(){var e=editor.getValue(),t=s(e);if(0===t.exceptions.length){var o=new p(t.globalScope,t.scopes);c.tree.ParseTreeWalker.DEFAULT.walk(o,t.parseTree);var r=o.getText();console.log(r);var n=new c.InputStream(r),i=new g.asmLexer(n),d=new c.CommonTokenStream(i),l=new T.asmParser(d);l.buildParseTrees=!0;var u=l.program(),y=new a;c.tree.ParseTreeWalker.DEFAULT.walk(y,u);var x=y.getBytecode();return{success:!0,bytecode:x}}return{success:!1,exceptions:t.exceptions}}},{"./asmLexer":1,"./asmListener":2,"./asmParser":3,"./logoLexer":5,"./logoListener":6,"./logoParser":7,"antlr4/index":49}],5:[function(e,t,o){function r(e){return n.Lexer.call(this,e),this._interp=new n.atn.LexerATNSimulator(this,p,a,new n.PredictionContextCache()),this}var n=e("antlr4/index"),p=new n.atn.ATNDeserializer().deserialize("\x03\u608B\uA72A\u8133\uB9ED\u417C\u3BE7\u7786\u5964\x02'\xF4\b\x01\x04\x02\t\x02\x04\x03\t\x03\x04\x04\t\x04\x04\x05\t\x05\x04\x06\t\x06\x04\x07\t\x07\x04\b\t\b\x04\t\t\t\x04\n\t\n\x04\x0B\t\x0B\x04\f\t\f\x04\r\t\r\x04\x0E\t\x0E\x04\x0F\t\x0F\x04\x10\t\x10\x04\x11\t\x11\x04\x12\t\x12\x04\x13\t\x13\x04\x14\t\x14\x04\x15\t\x15\x04\x16\t\x16\x04\x17\t\x17\x04\x18\t\x18\x04\x19\t\x19\x04\x1A\t\x1A\x04\x1B\t\x1B\x04\x1C\t\x1C\x04\x1D\t\x1D\x04\x1E\t\x1E\x04\x1F\t\x1F\x04 \t \x04!\t!\x04\"\t\"\x04#\t#\x04$\t$\x04%\t%\x04&\t&\x03\x02\x03\x02\x03\x03\x03\x03\x03\x04\x03\x04\x03\x05\x03\x05\x03\x06\x03\x06\x03\x07\x03\x07\x03\b\x03\b\x03\t\x03\t\x03\t\x03\n\x03\n\x03\x0B\x03\x0B\x03\x0B\x03\f\x03\f\x03\r\x03\r\x03\r\x03\x0E\x03\x0E\x03\x0E\x03\x0E\x03\x0E\x03\x0E\x03\x0E\x03\x0E\x05\x0Eq\n\x0E\x03\x0F\x03\x0F\x03\x0F\x03\x0F\x03\x0F\x03\x0F\x05\x0Fy\n\x0F\x03\x10\x03\x10\x03\x10\x03\x10\x03\x10\x03\x10\x05\x10\x81\n\x10\x03\x11\x03\x11\x03\x11\x03\x11\x03\x11\x03\x11\x03\x11\x05\x11\x8A\n\x11\x03\x12\x03\x12\x03\x12\x03\x12\x03\x12\x03\x12\x03\x12\x05\x12\x93\n\x12\x03\x13\x03\x13\x03\x13\x03\x13\x03\x13\x03\x13\x03\x13\x03\x13\x03\x13\x05\x13\x9E\n\x13\x03\x14\x03\x14\x03\x14\x03\x14\x03\x14\x03\x15\x03\x15\x03\x15\x03\x15\x03\x15\x03\x16\x03\x16\x03\x16\x03\x16\x03\x16\x03\x16\x03\x16\x03\x17\x03\x17\x03\x17\x03\x18\x03\x18\x03\x18\x03\x18\x03\x18\x03\x19\x03\x19\x03\x19\x03\x19\x03\x19\x03\x1A\x03\x1A\x03\x1A\x03\x1A\x03\x1A\x03\x1A\x03\x1A\x03\x1B\x03\x1B\x03\x1B\x03\x1C\x03\x1C\x03\x1C\x03\x1C\x03\x1D\x03\x1D\x03\x1D\x03\x1D\x03\x1E\x03\x1E\x03\x1E\x03\x1F\x03\x1F\x03 \x03 \x03!\x03!\x03\"\x03\"\x03#\x03#\x07#\xDD\n#\f#\x0E#\xE0\x0B#\x03$\x03$\x07$\xE4\n$\f$\x0E$\xE7\x0B$\x03%\x05%\xEA\n%\x03%\x06%\xED\n%\r%\x0E%\xEE\x03&\x03&\x03&\x03&\x02\x02'\x03\x03\x05\x04\x07\x05\t\x06\x0B\x07\r\b\x0F\t\x11\n\x13\x0B\x15\f\x17\r\x19\x0E\x1B\x0F\x1D\x10\x1F\x11!\x12#\x13%\x14'\x15)\x16+\x17-\x18/\x191\x1A3\x1B5\x1C7\x1D9\x1E;\x1F= ?!A\"C#E$G%I&K'\x03\x02\x1B\x04\x02HHhh\x04\x02FFff\x04\x02QQqq\x04\x02YYyy\x04\x02CCcc\x04\x02TTtt\x04\x02DDdd\x04\x02MMmm\x04\x02EEee\x04\x02NNnn\x04\x02VVvv\x04\x02GGgg\x04\x02KKkk\x04\x02IIii\x04\x02JJjj\x04\x02RRrr\x04\x02WWww\x04\x02PPpp\x04\x02OOoo\x04\x02UUuu\x04\x02\f\f\x0F\x0F\x04\x02C\\c|\x06\x022;C\\aac|\x03\x022;\x05\x02\x0B\f\x0F\x0F\"\"\x02\xFD\x02\x03\x03\x02\x02\x02\x02\x05\x03\x02\x02\x02\x02\x07\x03\x02\x02\x02\x02\t\x03\x02\x02\x02\x02\x0B\x03\x02\x02\x02\x02\r\x03\x02\x02\x02\x02\x0F\x03\x02\x02\x02\x02\x11\x03\x02\x02\x02\x02\x13\x03\x02\x02\x02\x02\x15\x03\x02\x02\x02\x02\x17\x03\x02\x02\x02\x02\x19\x03\x02\x02\x02\x02\x1B\x03\x02\x02\x02\x02\x1D\x03\x02\x02\x02\x02\x1F\x03\x02\x02\x02\x02!\x03\x02\x02\x02\x02#\x03\x02\x02\x02\x02%\x03\x02\x02\x02\x02'\x03\x02\x02\x02\x02)\x03\x02\x02\x02\x02+\x03\x02\x02\x02\x02-\x03\x02\x02\x02\x02/\x03\x02\x02\x02\x021\x03\x02\x02\x02\x023\x03\x02\x02\x02\x025\x03\x02\x02\x02\x027\x03\x02\x02\x02\x029\x03\x02\x02\x02\x02;\x03\x02\x02\x02\x02=\x03\x02\x02\x02\x02?\x03\x02\x02\x02\x02A\x03\x02\x02\x02\x02C\x03\x02\x02\x02\x02E\x03\x02\x02\x02\x02G\x03\x02\x02\x02\x02I\x03\x02\x02\x02\x02K\x03\x02\x02\x02\x03M\x03\x02\x02\x02\x05O\x03\x02\x02\x02\x07Q\x03\x02\x02\x02\tS\x03\x02\x02\x02\x0BU\x03\x02\x02\x02\rW\x03\x02\x02\x02\x0FY\x03\x02\x02\x02\x11[\x03\x02\x02\x02\x13^\x03\x02\x02\x02\x15`\x03\x02\x02\x02\x17c\x03\x02\x02\x02\x19e\x03\x02\x02\x02\x1Bp\x03\x02\x02\x02\x1Dx\x03\x02\x02\x02\x1F\x80\x03\x02\x02\x02!\x89\x03\x02\x02\x02#\x92\x03\x02\x02\x02%\x9D\x03\x02\x02\x02'\x9F\x03\x02\x02\x02)\xA4\x03\x02\x02\x02+\xA9\x03\x02\x02\x02-\xB0\x03\x02\x02\x02/\xB3\x03\x02\x02\x021\xB8\x03\x02\x02\x023\xBD\x03\x02\x02\x025\xC4\x03\x02\x02\x027\xC7\x03\x02\x02\x029\xCB\x03\x02\x02\x02;\xCF\x03\x02\x02\x02=\xD2\x03\x02\x02\x02?\xD4\x03\x02\x02\x02A\xD6\x03\x02\x02\x02C\xD8\x03\x02\x02\x02E\xDA\x03\x02\x02\x02G\xE1\x03\x02\x02\x02I\xE9\x03\x02\x02\x02K\xF0\x03\x02\x02\x02MN\x07$\x02\x02N\x04\x03\x02\x02\x02OP\x07<\x02\x02P\x06\x03\x02\x02\x02QR\x07]\x02\x02R\b\x03\x02\x02\x02ST\x07_\x02\x02T\n\x03\x02\x02\x02UV\x07*\x02\x02V\f\x03\x02\x02\x02WX\x07+\x02\x02X\x0E\x03\x02\x02\x02YZ\x07?\x02\x02Z\x10\x03\x02\x02\x02[\\\x07#\x02\x02\\]\x07?\x02\x02]\x12\x03\x02\x02\x02^_\x07>\x02\x02_\x14\x03\x02\x02\x02`a\x07>\x02\x02ab\x07?\x02\x02b\x16\x03\x02\x02\x02cd\x07@\x02\x02d\x18\x03\x02\x02\x02ef\x07@\x02\x02fg\x07?\x02\x02g\x1A\x03\x02\x02\x02hi\t\x02\x02\x02iq\t\x03\x02\x02jk\t\x02\x02\x02kl\t\x04\x02\x02lm\t\x05\x02\x02mn\t\x06\x02\x02no\t\x07\x02\x02oq\t\x03\x02\x02ph\x03\x02\x02\x02pj\x03\x02\x02\x02q\x1C\x03\x02\x02\x02rs\t\b\x02\x02sy\t\t\x02\x02tu\t\b\x02\x02uv\t\x06\x02\x02vw\t\n\x02\x02wy\t\t\x02\x02xr\x03\x02\x02\x02xt\x03\x02\x02\x02y\x1E\x03\x02\x02\x02z{\t\x0B\x02\x02{\x81\t\f\x02\x02|}\t\x0B\x02\x02}~\t\r\x02\x02~\x7F\t\x02\x02\x02\x7F\x81\t\f\x02\x02\x80z\x03\x02\x02\x02\x80|\x03\x02\x02\x02\x81 \x03\x02\x02\x02\x82\x83\t\x07\x02\x02\x83\x8A\t\f\x02\x02\x84\x85\t\x07\x02\x02\x85\x86\t\x0E\x02\x02\x86\x87\t\x0F\x02\x02\x87\x88\t\x10\x02\x02\x88\x8A\t\f\x02\x02\x89\x82\x03\x02\x02\x02\x89\x84\x03\x02\x02\x02\x8A\"\x03\x02\x02\x02\x8B\x8C\t\x11\x02\x02\x8C\x93\t\x12\x02\x02\x8D\x8E\t\x11\x02\x02\x8E\x8F\t\r\x02\x02\x8F\x90\t\x13\x02\x02\x90\x91\t\x12\x02\x02\x91\x93\t\x11\x02\x02\x92\x8B\x03\x02\x02\x02\x92\x8D\x03\x02\x02\x02\x93$\x03\x02\x02\x02\x94\x95\t\x11\x02\x02\x95\x9E\t\x03\x02\x02\x96\x97\t\x11\x02\x02\x97\x98\t\r\x02\x02\x98\x99\t\x13\x02\x02\x99\x9A\t\x03\x02\x02\x9A\x9B\t\x04\x02\x02\x9B\x9C\t\x05\x02\x02\x9C\x9E\t\x13\x02\x02\x9D\x94\x03\x02\x02\x02\x9D\x96\x03\x02\x02\x02\x9E&\x03\x02\x02\x02\x9F\xA0\t\x05\x02\x02\xA0\xA1\t\x06\x02\x02\xA1\xA2\t\x0E\x02\x02\xA2\xA3\t\f\x02\x02\xA3(\x03\x02\x02\x02\xA4\xA5\t\x14\x02\x02\xA5\xA6\t\x06\x02\x02\xA6\xA7\t\t\x02\x02\xA7\xA8\t\r\x02\x02\xA8*\x03\x02\x02\x02\xA9\xAA\t\x07\x02\x02\xAA\xAB\t\r\x02\x02\xAB\xAC\t\x11\x02\x02\xAC\xAD\t\r\x02\x02\xAD\xAE\t\x06\x02\x02\xAE\xAF\t\f\x02\x02\xAF,\x03\x02\x02\x02\xB0\xB1\t\x0E\x02\x02\xB1\xB2\t\x02\x02\x02\xB2.\x03\x02\x02\x02\xB3\xB4\t\r\x02\x02\xB4\xB5\t\x0B\x02\x02\xB5\xB6\t\x15\x02\x02\xB6\xB7\t\r\x02\x02\xB70\x03\x02\x02\x02\xB8\xB9\t\x15\x02\x02\xB9\xBA\t\f\x02\x02\xBA\xBB\t\x04\x02\x02\xBB\xBC\t\x11\x02\x02\xBC2\x03\x02\x02\x02\xBD\xBE\t\x07\x02\x02\xBE\xBF\t\r\x02\x02\xBF\xC0\t\f\x02\x02\xC0\xC1\t\x12\x02\x02\xC1\xC2\t\x07\x02\x02\xC2\xC3\t\x13\x02\x02\xC34\x03\x02\x02\x02\xC4\xC5\t\f\x02\x02\xC5\xC6\t\x04\x02\x02\xC66\x03\x02\x02\x02\xC7\xC8\t\r\x02\x02\xC8\xC9\t\x13\x02\x02\xC9\xCA\t\x03\x02\x02\xCA8\x03\x02\x02\x02\xCB\xCC\t\x06\x02\x02\xCC\xCD\t\x13\x02\x02\xCD\xCE\t\x03\x02\x02\xCE:\x03\x02\x02\x02\xCF\xD0\t\x04\x02\x02\xD0\xD1\t\x07\x02\x02\xD1<\x03\x02\x02\x02\xD2\xD3\x07,\x02\x02\xD3>\x03\x02\x02\x02\xD4\xD5\x071\x02\x02\xD5@\x03\x02\x02\x02\xD6\xD7\x07-\x02\x02\xD7B\x03\x02\x02\x02\xD8\xD9\x07/\x02\x02\xD9D\x03\x02\x02\x02\xDA\xDE\x07=\x02\x02\xDB\xDD\n\x16\x02\x02\xDC\xDB\x03\x02\x02\x02\xDD\xE0\x03\x02\x02\x02\xDE\xDC\x03\x02\x02\x02\xDE\xDF\x03\x02\x02\x02\xDFF\x03\x02\x02\x02\xE0\xDE\x03\x02\x02\x02\xE1\xE5\t\x17\x02\x02\xE2\xE4\t\x18\x02\x02\xE3\xE2\x03\x02\x02\x02\xE4\xE7\x03\x02\x02\x02\xE5\xE3\x03\x02\x02\x02\xE5\xE6\x03\x02\x02\x02\xE6H\x03\x02\x02\x02\xE7\xE5\x03\x02\x02\x02\xE8\xEA\x07/\x02\x02\xE9\xE8\x03\x02\x02\x02\xE9\xEA\x03\x02\x02\x02\xEA\xEC\x03\x02\x02\x02\xEB\xED\t\x19\x02\x02\xEC\xEB\x03\x02\x02\x02\xED\xEE\x03\x02\x02\x02\xEE\xEC\x03\x02\x02\x02\xEE\xEF\x03\x02\x02\x02\xEFJ\x03\x02\x02\x02\xF0\xF1\t\x1A\x02\x02\xF1\xF2\x03\x02\x02\x02\xF2\xF3\b&\x02\x02\xF3L\x03\x02\x02\x02\r\x02px\x80\x89\x92\x9D\xDE\xE5\xE9\xEE\x03\b\x02\x02"),a=p.decisionToState.map(function(e,t){return new n.dfa.DFA(e,t)});r.prototype=Object.create(n.Lexer.prototype),r.prototype.constructor=r,Object.defineProperty(r.prototype,"atn",{get:function(){return p}}),r.EOF=n.Token.EOF,r.T__0=1,r.T__1=2,r.T__2=3,r.T__3=4,r.T__4=5,r.T__5=6,r.T__6=7,r.T__7=8,r.T__8=9,r.T__9=10,r.T__10=11,r.T__11=12,r.FD=13,r.BK=14,r.LT=15,r.RT=16,r.PU=17,r.PD=18,r.WAIT=19,r.MAKE=20,r.REPEAT=21,r.IF=22,r.ELSE=23,r.STOP=24,r.RETURN=25,r.TO=26,r.END=27,r.AND=28,r.OR=29,r.MUL=30,r.DIV=31,r.ADD=32,r.SUB=33,r.COMMENT=34,r.STRING=35,r.INTNUM=36,r.WS=37,r.prototype.channelNames=["DEFAULT_TOKEN_CHANNEL","HIDDEN"],r.prototype.modeNames=["DEFAULT_MODE"],r.prototype.literalNames=[null,"'\"'","':'","'['","']'","'('","')'","'='","'!='","'<'","'<='","'>'","'>='",null,null,null,null,null,null,null,null,null,null,null,null,null,null,null,null,null,"'*'","'/'","'+'","'-'"],r.prototype.symbolicNames=[null,null,null,null,null,null,null,null,null,null,null,null,null,"FD","BK","LT","RT","PU","PD","WAIT","MAKE","REPEAT","IF","ELSE","STOP","RETURN","TO","END","AND","OR","MUL","DIV","ADD","SUB","COMMENT","STRING","INTNUM","WS"],r.prototype.ruleNames=["T__0","T__1","T__2","T__3","T__4","T__5","T__6","T__7","T__8","T__9","T__10","T__11","FD","BK","LT","RT","PU","PD","WAIT","MAKE","REPEAT","IF","ELSE","STOP","RETURN","TO","END","AND","OR","MUL","DIV","ADD","SUB","COMMENT","STRING","INTNUM","WS"],r.prototype.grammarFileName="logo.g4",o.logoLexer=r},{"antlr4/index":49}],6:[function(e,t,o){function r(){return n.tree.ParseTreeListener.call(this),this}var n=e("antlr4/index");r.prototype=Object.create(n.tree.ParseTreeListener.prototype),r.prototype.constructor=r,r.prototype.enterProgram=function(){},r.prototype.exitProgram=function(){},r.prototype.enterStatement=function(){},r.prototype.exitStatement=function(){},r.prototype.enterFD=function(){},r.prototype.exitFD=function(){},r.prototype.enterBK=function(){},r.prototype.exitBK=function(){},r.prototype.enterLT=function(){},r.prototype.exitLT=function(){},r.prototype.enterRT=function(){},r.prototype.exitRT=function(){},r.prototype.enterPU=function(){},r.prototype.exitPU=function(){},r.prototype.enterPD=function(){},r.prototype.exitPD=function(){},r.prototype.enterWait=function(){},r.prototype.exitWait=function(){},r.prototype.enterReturn=function(){},r.prototype.exitReturn=function(){},r.prototype.enterStop=function(){},r.prototype.exitStop=function(){},r.prototype.enterMake=function(){},r.prototype.exitMake=function(){},r.prototype.enterRepeat=function(){},r.prototype.exitRepeat=function(){},r.prototype.enterIf=function(){},r.prototype.exitIf=function(){},r.prototype.enterInvokeProc=function(){},r.prototype.exitInvokeProc=function(){},r.prototype.enterProcedureDef=function(){},r.prototype.exitProcedureDef=function(){},r.prototype.enterParamDef=function(){},r.prototype.exitParamDef=function(){},r.prototype.enterProcedureInvoke=function(){},r.prototype.exitProcedureInvoke=function(){},r.prototype.enterBlock=function(){},r.prototype.exitBlock=function(){},r.prototype.enterComp=function(){},r.prototype.exitComp=function(){},r.prototype.enterCombine=function(){},r.prototype.exitCombine=function(){},r.prototype.enterEq=function(){},r.prototype.exitEq=function(){},r.prototype.enterNotEq=function(){},r.prototype.exitNotEq=function(){},r.prototype.enterLessThan=function(){},r.prototype.exitLessThan=function(){},r.prototype.enterLessThanEq=function(){},r.prototype.exitLessThanEq=function(){},r.prototype.enterGreaterThan=function(){},r.prototype.exitGreaterThan=function(){},r.prototype.enterGreaterThanEq=function(){},r.prototype.exitGreaterThanEq=function(){},r.prototype.enterComment=function(){},r.prototype.exitComment=function(){},r.prototype.enterMulDiv=function(){},r.prototype.exitMulDiv=function(){},r.prototype.enterAddSub=function(){},r.prototype.exitAddSub=function(){},r.prototype.enterParens=function(){},r.prototype.exitParens=function(){},r.prototype.enterNegate=function(){},r.prototype.exitNegate=function(){},r.prototype.enterInt=function(){},r.prototype.exitInt=function(){},r.prototype.enterDeref=function(){},r.prototype.exitDeref=function(){},o.logoListener=r},{"antlr4/index":49}],7:[function(e,t,o){function r(e){return G.Parser.call(this,e),this._interp=new G.atn.ParserATNSimulator(this,q,W,Y),this.ruleNames=$,this.literalNames=w,this.symbolicNames=j,this}function n(e,t,o){return void 0===t&&(t=null),(void 0===o||null===o)&&(o=-1),G.ParserRuleContext.call(this,t,o),this.parser=e,this.ruleIndex=r.RULE_program,this}function p(e,t,o){return void 0===t&&(t=null),(void 0===o||null===o)&&(o=-1),G.ParserRuleContext.call(this,t,o),this.parser=e,this.ruleIndex=r.RULE_statement,this}function a(e,t,o){return void 0===t&&(t=null),(void 0===o||null===o)&&(o=-1),G.ParserRuleContext.call(this,t,o),this.parser=e,this.ruleIndex=r.RULE_command,this}function i(e,t){return a.call(this,e),a.prototype.copyFrom.call(this,t),this}function s(e,t){return a.call(this,e),a.prototype.copyFrom.call(this,t),this}function d(e,t){return a.call(this,e),a.prototype.copyFrom.call(this,t),this}function c(e,t){return a.call(this,e),a.prototype.copyFrom.call(this,t),this}function l(e,t){return a.call(this,e),a.prototype.copyFrom.call(this,t),this}function u(e,t){return a.call(this,e),a.prototype.copyFrom.call(this,t),this}function y(e,t){return a.call(this,e),a.prototype.copyFrom.call(this,t),this}function g(e,t){return a.call(this,e),a.prototype.copyFrom.call(this,t),this}function T(e,t){return a.call(this,e),a.prototype.copyFrom.call(this,t),this}function x(e,t){return a.call(this,e),a.prototype.copyFrom.call(this,t),this}function m(e,t){return a.call(this,e),a.prototype.copyFrom.call(this,t),this}function _(e,t){return a.call(this,e),a.prototype.copyFrom.call(this,t),this}function S(e,t){return a.call(this,e),a.prototype.copyFrom.call(this,t),this}function f(e,t,o){return void 0===t&&(t=null),(void 0===o||null===o)&&(o=-1),G.ParserRuleContext.call(this,t,o),this.parser=e,this.ruleIndex=r.RULE_procedureDef,this}function h(e,t,o){return void 0===t&&(t=null),(void 0===o||null===o)&&(o=-1),G.ParserRuleContext.call(this,t,o),this.parser=e,this.ruleIndex=r.RULE_paramDef,this}function E(e,t,o){return void 0===t&&(t=null),(void 0===o||null===o)&&(o=-1),G.ParserRuleContext.call(this,t,o),this.parser=e,this.ruleIndex=r.RULE_procedureInvoke,this}function A(e,t,o){return void 0===t&&(t=null),(void 0===o||null===o)&&(o=-1),G.ParserRuleContext.call(this,t,o),this.parser=e,this.ruleIndex=r.RULE_block,this}function C(e,t,o){return void 0===t&&(t=null),(void 0===o||null===o)&&(o=-1),G.ParserRuleContext.call(this,t,o),this.parser=e,this.ruleIndex=r.RULE_condition,this}function N(e,t){return C.call(this,e),C.prototype.copyFrom.call(this,t),this}function R(e,t){return C.call(this,e),C.prototype.copyFrom.call(this,t),this}function L(e,t,o){return void 0===t&&(t=null),(void 0===o||null===o)&&(o=-1),G.ParserRuleContext.call(this,t,o),this.parser=e,this.ruleIndex=r.RULE_comparison,this}function I(e,t){return L.call(this,e),L.prototype.copyFrom.call(this,t),this}function k(e,t){return L.call(this,e),L.prototype.copyFrom.call(this,t),this}function P(e,t){return L.call(this,e),L.prototype.copyFrom.call(this,t),this}function D(e,t){return L.call(this,e),L.prototype.copyFrom.call(this,t),this}function O(e,t){return L.call(this,e),L.prototype.copyFrom.call(this,t),this}function F(e,t){return L.call(this,e),L.prototype.copyFrom.call(this,t),this}function b(e,t,o){return void 0===t&&(t=null),(void 0===o||null===o)&&(o=-1),G.ParserRuleContext.call(this,t,o),this.parser=e,this.ruleIndex=r.RULE_comment,this}function v(e,t,o){return void 0===t&&(t=null),(void 0===o||null===o)&&(o=-1),G.ParserRuleContext.call(this,t,o),this.parser=e,this.ruleIndex=r.RULE_expr,this}function M(e,t){return v.call(this,e),v.prototype.copyFrom.call(this,t),this}function U(e,t){return v.call(this,e),v.prototype.copyFrom.call(this,t),this}function B(e,t){return v.call(this,e),v.prototype.copyFrom.call(this,t),this}function H(e,t){return v.call(this,e),v.prototype.copyFrom.call(this,t),this}function V(e,t){return v.call(this,e),v.prototype.copyFrom.call(this,t),this}function z(e,t){return v.call(this,e),v.prototype.copyFrom.call(this,t),this}var G=e("antlr4/index"),K=e("./logoListener").logoListener,q=new G.atn.ATNDeserializer().deserialize("\x03\u608B\uA72A\u8133\uB9ED\u417C\u3BE7\u7786\u5964\x03'\xAC\x04\x02\t\x02\x04\x03\t\x03\x04\x04\t\x04\x04\x05\t\x05\x04\x06\t\x06\x04\x07\t\x07\x04\b\t\b\x04\t\t\t\x04\n\t\n\x04\x0B\t\x0B\x04\f\t\f\x03\x02\x03\x02\x07\x02\x1B\n\x02\f\x02\x0E\x02\x1E\x0B\x02\x03\x02\x03\x02\x03\x03\x03\x03\x05\x03$\n\x03\x03\x04\x03\x04\x03\x04\x03\x04\x03\x04\x03\x04\x03\x04\x03\x04\x03\x04\x03\x04\x03\x04\x03\x04\x03\x04\x03\x04\x03\x04\x03\x04\x03\x04\x03\x04\x03\x04\x03\x04\x03\x04\x03\x04\x03\x04\x03\x04\x03\x04\x03\x04\x03\x04\x05\x04A\n\x04\x03\x04\x05\x04D\n\x04\x03\x05\x03\x05\x03\x05\x07\x05I\n\x05\f\x05\x0E\x05L\x0B\x05\x03\x05\x03\x05\x07\x05P\n\x05\f\x05\x0E\x05S\x0B\x05\x03\x05\x03\x05\x03\x06\x03\x06\x03\x06\x03\x07\x03\x07\x07\x07\\\n\x07\f\x07\x0E\x07_\x0B\x07\x03\b\x03\b\x05\bc\n\b\x03\b\x03\b\x03\b\x07\bh\n\b\f\b\x0E\bk\x0B\b\x03\b\x03\b\x03\t\x03\t\x03\t\x03\t\x03\t\x03\t\x03\t\x03\t\x03\t\x03\t\x06\ty\n\t\r\t\x0E\tz\x03\t\x03\t\x03\t\x03\t\x03\t\x03\t\x06\t\x83\n\t\r\t\x0E\t\x84\x03\t\x03\t\x05\t\x89\n\t\x03\n\x03\n\x03\n\x03\n\x03\n\x03\n\x05\n\x91\n\n\x03\x0B\x03\x0B\x03\f\x03\f\x03\f\x03\f\x03\f\x03\f\x03\f\x03\f\x03\f\x03\f\x05\f\x9F\n\f\x03\f\x03\f\x03\f\x03\f\x03\f\x03\f\x07\f\xA7\n\f\f\f\x0E\f\xAA\x0B\f\x03\f\x02\x03\x16\r\x02\x04\x06\b\n\f\x0E\x10\x12\x14\x16\x02\x04\x03\x02 !\x03\x02\"#\x02\xC5\x02\x1C\x03\x02\x02\x02\x04#\x03\x02\x02\x02\x06C\x03\x02\x02\x02\bE\x03\x02\x02\x02\nV\x03\x02\x02\x02\fY\x03\x02\x02\x02\x0E`\x03\x02\x02\x02\x10\x88\x03\x02\x02\x02\x12\x90\x03\x02\x02\x02\x14\x92\x03\x02\x02\x02\x16\x9E\x03\x02\x02\x02\x18\x1B\x05\x04\x03\x02\x19\x1B\x05\x14\x0B\x02\x1A\x18\x03\x02\x02\x02\x1A\x19\x03\x02\x02\x02\x1B\x1E\x03\x02\x02\x02\x1C\x1A\x03\x02\x02\x02\x1C\x1D\x03\x02\x02\x02\x1D\x1F\x03\x02\x02\x02\x1E\x1C\x03\x02\x02\x02\x1F \x07\x02\x02\x03 \x03\x03\x02\x02\x02!$\x05\x06\x04\x02\"$\x05\b\x05\x02#!\x03\x02\x02\x02#\"\x03\x02\x02\x02$\x05\x03\x02\x02\x02%&\x07\x0F\x02\x02&D\x05\x16\f\x02'(\x07\x10\x02\x02(D\x05\x16\f\x02)*\x07\x11\x02\x02*D\x05\x16\f\x02+,\x07\x12\x02\x02,D\x05\x16\f\x02-D\x07\x13\x02\x02.D\x07\x14\x02\x02/0\x07\x15\x02\x020D\x05\x16\f\x021D\x07\x1B\x02\x022D\x07\x1A\x02\x0234\x07\x16\x02\x0245\x07\x03\x02\x0256\x07%\x02\x026D\x05\x16\f\x0278\x07\x17\x02\x0289\x05\x16\f\x029:\x05\x0E\b\x02:D\x03\x02\x02\x02;<\x07\x18\x02\x02<=\x05\x10\t\x02=@\x05\x0E\b\x02>?\x07\x19\x02\x02?A\x05\x0E\b\x02@>\x03\x02\x02\x02@A\x03\x02\x02\x02AD\x03\x02\x02\x02BD\x05\f\x07\x02C%\x03\x02\x02\x02C'\x03\x02\x02\x02C)\x03\x02\x02\x02C+\x03\x02\x02\x02C-\x03\x02\x02\x02C.\x03\x02\x02\x02C/\x03\x02\x02\x02C1\x03\x02\x02\x02C2\x03\x02\x02\x02C3\x03\x02\x02\x02C7\x03\x02\x02\x02C;\x03\x02\x02\x02CB\x03\x02\x02\x02D\x07\x03\x02\x02\x02EF\x07\x1C\x02\x02FJ\x07%\x02\x02GI\x05\n\x06\x02HG\x03\x02\x02\x02IL\x03\x02\x02\x02JH\x03\x02\x02\x02JK\x03\x02\x02\x02KQ\x03\x02\x02\x02LJ\x03\x02\x02\x02MP\x05\x06\x04\x02NP\x05\x14\x0B\x02OM\x03\x02\x02\x02ON\x03\x02\x02\x02PS\x03\x02\x02\x02QO\x03\x02\x02\x02QR\x03\x02\x02\x02RT\x03\x02\x02\x02SQ\x03\x02\x02\x02TU\x07\x1D\x02\x02U\t\x03\x02\x02\x02VW\x07\x04\x02\x02WX\x07%\x02\x02X\x0B\x03\x02\x02\x02Y]\x07%\x02\x02Z\\\x05\x16\f\x02[Z\x03\x02\x02\x02\\_\x03\x02\x02\x02][\x03\x02\x02\x02]^\x03\x02\x02\x02^\r\x03\x02\x02\x02_]\x03\x02\x02\x02`b\x07\x05\x02\x02ac\x05\x14\x0B\x02ba\x03\x02\x02\x02bc\x03\x02\x02\x02cd\x03\x02\x02\x02di\x05\x06\x04\x02eh\x05\x06\x04\x02fh\x05\x14\x0B\x02ge\x03\x02\x02\x02gf\x03\x02\x02\x02hk\x03\x02\x02\x02ig\x03\x02\x02\x02ij\x03\x02\x02\x02jl\x03\x02\x02\x02ki\x03\x02\x02\x02lm\x07\x06\x02\x02m\x0F\x03\x02\x02\x02no\x07\x07\x02\x02op\x05\x16\f\x02pq\x05\x12\n\x02qr\x05\x16\f\x02rs\x07\b\x02\x02s\x89\x03\x02\x02\x02tu\x07\x07\x02\x02ux\x05\x10\t\x02vw\x07\x1E\x02\x02wy\x05\x10\t\x02xv\x03\x02\x02\x02yz\x03\x02\x02\x02zx\x03\x02\x02\x02z{\x03\x02\x02\x02{|\x03\x02\x02\x02|}\x07\b\x02\x02}\x89\x03\x02\x02\x02~\x7F\x07\x07\x02\x02\x7F\x82\x05\x10\t\x02\x80\x81\x07\x1F\x02\x02\x81\x83\x05\x10\t\x02\x82\x80\x03\x02\x02\x02\x83\x84\x03\x02\x02\x02\x84\x82\x03\x02\x02\x02\x84\x85\x03\x02\x02\x02\x85\x86\x03\x02\x02\x02\x86\x87\x07\b\x02\x02\x87\x89\x03\x02\x02\x02\x88n\x03\x02\x02\x02\x88t\x03\x02\x02\x02\x88~\x03\x02\x02\x02\x89\x11\x03\x02\x02\x02\x8A\x91\x07\t\x02\x02\x8B\x91\x07\n\x02\x02\x8C\x91\x07\x0B\x02\x02\x8D\x91\x07\f\x02\x02\x8E\x91\x07\r\x02\x02\x8F\x91\x07\x0E\x02\x02\x90\x8A\x03\x02\x02\x02\x90\x8B\x03\x02\x02\x02\x90\x8C\x03\x02\x02\x02\x90\x8D\x03\x02\x02\x02\x90\x8E\x03\x02\x02\x02\x90\x8F\x03\x02\x02\x02\x91\x13\x03\x02\x02\x02\x92\x93\x07$\x02\x02\x93\x15\x03\x02\x02\x02\x94\x95\b\f\x01\x02\x95\x96\x07#\x02\x02\x96\x9F\x05\x16\f\b\x97\x98\x07\x04\x02\x02\x98\x9F\x07%\x02\x02\x99\x9F\x07&\x02\x02\x9A\x9B\x07\x07\x02\x02\x9B\x9C\x05\x16\f\x02\x9C\x9D\x07\b\x02\x02\x9D\x9F\x03\x02\x02\x02\x9E\x94\x03\x02\x02\x02\x9E\x97\x03\x02\x02\x02\x9E\x99\x03\x02\x02\x02\x9E\x9A\x03\x02\x02\x02\x9F\xA8\x03\x02\x02\x02\xA0\xA1\f\x07\x02\x02\xA1\xA2\t\x02\x02\x02\xA2\xA7\x05\x16\f\b\xA3\xA4\f\x06\x02\x02\xA4\xA5\t\x03\x02\x02\xA5\xA7\x05\x16\f\x07\xA6\xA0\x03\x02\x02\x02\xA6\xA3\x03\x02\x02\x02\xA7\xAA\x03\x02\x02\x02\xA8\xA6\x03\x02\x02\x02\xA8\xA9\x03\x02\x02\x02\xA9\x17\x03\x02\x02\x02\xAA\xA8\x03\x02\x02\x02\x15\x1A\x1C#@CJOQ]bgiz\x84\x88\x90\x9E\xA6\xA8"),W=q.decisionToState.map(function(e,t){return new G.dfa.DFA(e,t)}),Y=new G.PredictionContextCache,w=[null,"'\"'","':'","'['","']'","'('","')'","'='","'!='","'<'","'<='","'>'","'>='",null,null,null,null,null,null,null,null,null,null,null,null,null,null,null,null,null,"'*'","'/'","'+'","'-'"],j=[null,null,null,null,null,null,null,null,null,null,null,null,null,"FD","BK","LT","RT","PU","PD","WAIT","MAKE","REPEAT","IF","ELSE","STOP","RETURN","TO","END","AND","OR","MUL","DIV","ADD","SUB","COMMENT","STRING","INTNUM","WS"],$=["program","statement","command","procedureDef","paramDef","procedureInvoke","block","condition","comparison","comment","expr"];r.prototype=Object.create(G.Parser.prototype),r.prototype.constructor=r,Object.defineProperty(r.prototype,"atn",{get:function(){return q}}),r.EOF=G.Token.EOF,r.T__0=1,r.T__1=2,r.T__2=3,r.T__3=4,r.T__4=5,r.T__5=6,r.T__6=7,r.T__7=8,r.T__8=9,r.T__9=10,r.T__10=11,r.T__11=12,r.FD=13,r.BK=14,r.LT=15,r.RT=16,r.PU=17,r.PD=18,r.WAIT=19,r.MAKE=20,r.REPEAT=21,r.IF=22,r.ELSE=23,r.STOP=24,r.RETURN=25,r.TO=26,r.END=27,r.AND=28,r.OR=29,r.MUL=30,r.DIV=31,r.ADD=32,r.SUB=33,r.COMMENT=34,r.STRING=35,r.INTNUM=36,r.WS=37,r.RULE_program=0,r.RULE_statement=1,r.RULE_command=2,r.RULE_procedureDef=3,r.RULE_paramDef=4,r.RULE_procedureInvoke=5,r.RULE_block=6,r.RULE_condition=7,r.RULE_comparison=8,r.RULE_comment=9,r.RULE_expr=10,n.prototype=Object.create(G.ParserRuleContext.prototype),n.prototype.constructor=n,n.prototype.EOF=function(){return this.getToken(r.EOF,0)},n.prototype.statement=function(e){return void 0===e&&(e=null),null===e?this.getTypedRuleContexts(p):this.getTypedRuleContext(p,e)},n.prototype.comment=function(e){return void 0===e&&(e=null),null===e?this.getTypedRuleContexts(b):this.getTypedRuleContext(b,e)},n.prototype.enterRule=function(e){e instanceof K&&e.enterProgram(this)},n.prototype.exitRule=function(e){e instanceof K&&e.exitProgram(this)},r.ProgramContext=n,r.prototype.program=function(){var e=new n(this,this._ctx,this.state);this.enterRule(e,0,r.RULE_program);var t=0;try{for(this.enterOuterAlt(e,1),this.state=26,this._errHandler.sync(this),t=this._input.LA(1);0==(-32&t-13)&&0!=(1<<t-13&(1<<r.FD-13|1<<r.BK-13|1<<r.LT-13|1<<r.RT-13|1<<r.PU-13|1<<r.PD-13|1<<r.WAIT-13|1<<r.MAKE-13|1<<r.REPEAT-13|1<<r.IF-13|1<<r.STOP-13|1<<r.RETURN-13|1<<r.TO-13|1<<r.COMMENT-13|1<<r.STRING-13));){switch(this.state=24,this._errHandler.sync(this),this._input.LA(1)){case r.FD:case r.BK:case r.LT:case r.RT:case r.PU:case r.PD:case r.WAIT:case r.MAKE:case r.REPEAT:case r.IF:case r.STOP:case r.RETURN:case r.TO:case r.STRING:this.state=22,this.statement();break;case r.COMMENT:this.state=23,this.comment();break;default:throw new G.error.NoViableAltException(this);}this.state=28,this._errHandler.sync(this),t=this._input.LA(1)}this.state=29,this.match(r.EOF)}catch(t){if(t instanceof G.error.RecognitionException)e.exception=t,this._errHandler.reportError(this,t),this._errHandler.recover(this,t);else throw t}finally{this.exitRule()}return e},p.prototype=Object.create(G.ParserRuleContext.prototype),p.prototype.constructor=p,p.prototype.command=function(){return this.getTypedRuleContext(a,0)},p.prototype.procedureDef=function(){return this.getTypedRuleContext(f,0)},p.prototype.enterRule=function(e){e instanceof K&&e.enterStatement(this)},p.prototype.exitRule=function(e){e instanceof K&&e.exitStatement(this)},r.StatementContext=p,r.prototype.statement=function(){var e=new p(this,this._ctx,this.state);this.enterRule(e,2,r.RULE_statement);try{switch(this.state=33,this._errHandler.sync(this),this._input.LA(1)){case r.FD:case r.BK:case r.LT:case r.RT:case r.PU:case r.PD:case r.WAIT:case r.MAKE:case r.REPEAT:case r.IF:case r.STOP:case r.RETURN:case r.STRING:this.enterOuterAlt(e,1),this.state=31,this.command();break;case r.TO:this.enterOuterAlt(e,2),this.state=32,this.procedureDef();break;default:throw new G.error.NoViableAltException(this);}}catch(t){if(t instanceof G.error.RecognitionException)e.exception=t,this._errHandler.reportError(this,t),this._errHandler.recover(this,t);else throw t}finally{this.exitRule()}return e},a.prototype=Object.create(G.ParserRuleContext.prototype),a.prototype.constructor=a,a.prototype.copyFrom=function(e){G.ParserRuleContext.prototype.copyFrom.call(this,e)},i.prototype=Object.create(a.prototype),i.prototype.constructor=i,r.RTContext=i,i.prototype.RT=function(){return this.getToken(r.RT,0)},i.prototype.expr=function(){return this.getTypedRuleContext(v,0)},i.prototype.enterRule=function(e){e instanceof K&&e.enterRT(this)},i.prototype.exitRule=function(e){e instanceof K&&e.exitRT(this)},s.prototype=Object.create(a.prototype),s.prototype.constructor=s,r.ReturnContext=s,s.prototype.RETURN=function(){return this.getToken(r.RETURN,0)},s.prototype.enterRule=function(e){e instanceof K&&e.enterReturn(this)},s.prototype.exitRule=function(e){e instanceof K&&e.exitReturn(this)},d.prototype=Object.create(a.prototype),d.prototype.constructor=d,r.PUContext=d,d.prototype.PU=function(){return this.getToken(r.PU,0)},d.prototype.enterRule=function(e){e instanceof K&&e.enterPU(this)},d.prototype.exitRule=function(e){e instanceof K&&e.exitPU(this)},c.prototype=Object.create(a.prototype),c.prototype.constructor=c,r.StopContext=c,c.prototype.STOP=function(){return this.getToken(r.STOP,0)},c.prototype.enterRule=function(e){e instanceof K&&e.enterStop(this)},c.prototype.exitRule=function(e){e instanceof K&&e.exitStop(this)},l.prototype=Object.create(a.prototype),l.prototype.constructor=l,r.LTContext=l,l.prototype.LT=function(){return this.getToken(r.LT,0)},l.prototype.expr=function(){return this.getTypedRuleContext(v,0)},l.prototype.enterRule=function(e){e instanceof K&&e.enterLT(this)},l.prototype.exitRule=function(e){e instanceof K&&e.exitLT(this)},u.prototype=Object.create(a.prototype),u.prototype.constructor=u,r.BKContext=u,u.prototype.BK=function(){return this.getToken(r.BK,0)},u.prototype.expr=function(){return this.getTypedRuleContext(v,0)},u.prototype.enterRule=function(e){e instanceof K&&e.enterBK(this)},u.prototype.exitRule=function(e){e instanceof K&&e.exitBK(this)},y.prototype=Object.create(a.prototype),y.prototype.constructor=y,r.MakeContext=y,y.prototype.MAKE=function(){return this.getToken(r.MAKE,0)},y.prototype.STRING=function(){return this.getToken(r.STRING,0)},y.prototype.expr=function(){return this.getTypedRuleContext(v,0)},y.prototype.enterRule=function(e){e instanceof K&&e.enterMake(this)},y.prototype.exitRule=function(e){e instanceof K&&e.exitMake(this)},g.prototype=Object.create(a.prototype),g.prototype.constructor=g,r.RepeatContext=g,g.prototype.REPEAT=function(){return this.getToken(r.REPEAT,0)},g.prototype.expr=function(){return this.getTypedRuleContext(v,0)},g.prototype.block=function(){return this.getTypedRuleContext(A,0)},g.prototype.enterRule=function(e){e instanceof K&&e.enterRepeat(this)},g.prototype.exitRule=function(e){e instanceof K&&e.exitRepeat(this)},T.prototype=Object.create(a.prototype),T.prototype.constructor=T,r.InvokeProcContext=T,T.prototype.procedureInvoke=function(){return this.getTypedRuleContext(E,0)},T.prototype.enterRule=function(e){e instanceof K&&e.enterInvokeProc(this)},T.prototype.exitRule=function(e){e instanceof K&&e.exitInvokeProc(this)},x.prototype=Object.create(a.prototype),x.prototype.constructor=x,r.PDContext=x,x.prototype.PD=function(){return this.getToken(r.PD,0)},x.prototype.enterRule=function(e){e instanceof K&&e.enterPD(this)},x.prototype.exitRule=function(e){e instanceof K&&e.exitPD(this)},m.prototype=Object.create(a.prototype),m.prototype.constructor=m,r.WaitContext=m,m.prototype.WAIT=function(){return this.getToken(r.WAIT,0)},m.prototype.expr=function(){return this.getTypedRuleContext(v,0)},m.prototype.enterRule=function(e){e instanceof K&&e.enterWait(this)},m.prototype.exitRule=function(e){e instanceof K&&e.exitWait(this)},_.prototype=Object.create(a.prototype),_.prototype.constructor=_,r.IfContext=_,_.prototype.IF=function(){return this.getToken(r.IF,0)},_.prototype.condition=function(){return this.getTypedRuleContext(C,0)},_.prototype.block=function(e){return void 0===e&&(e=null),null===e?this.getTypedRuleContexts(A):this.getTypedRuleContext(A,e)},_.prototype.ELSE=function(){return this.getToken(r.ELSE,0)},_.prototype.enterRule=function(e){e instanceof K&&e.enterIf(this)},_.prototype.exitRule=function(e){e instanceof K&&e.exitIf(this)},S.prototype=Object.create(a.prototype),S.prototype.constructor=S,r.FDContext=S,S.prototype.FD=function(){return this.getToken(r.FD,0)},S.prototype.expr=function(){return this.getTypedRuleContext(v,0)},S.prototype.enterRule=function(e){e instanceof K&&e.enterFD(this)},S.prototype.exitRule=function(e){e instanceof K&&e.exitFD(this)},r.CommandContext=a,r.prototype.command=function(){var e=new a(this,this._ctx,this.state);this.enterRule(e,4,r.RULE_command);var t=0;try{switch(this.state=65,this._errHandler.sync(this),this._input.LA(1)){case r.FD:e=new S(this,e),this.enterOuterAlt(e,1),this.state=35,this.match(r.FD),this.state=36,this.expr(0);break;case r.BK:e=new u(this,e),this.enterOuterAlt(e,2),this.state=37,this.match(r.BK),this.state=38,this.expr(0);break;case r.LT:e=new l(this,e),this.enterOuterAlt(e,3),this.state=39,this.match(r.LT),this.state=40,this.expr(0);break;case r.RT:e=new i(this,e),this.enterOuterAlt(e,4),this.state=41,this.match(r.RT),this.state=42,this.expr(0);break;case r.PU:e=new d(this,e),this.enterOuterAlt(e,5),this.state=43,this.match(r.PU);break;case r.PD:e=new x(this,e),this.enterOuterAlt(e,6),this.state=44,this.match(r.PD);break;case r.WAIT:e=new m(this,e),this.enterOuterAlt(e,7),this.state=45,this.match(r.WAIT),this.state=46,this.expr(0);break;case r.RETURN:e=new s(this,e),this.enterOuterAlt(e,8),this.state=47,this.match(r.RETURN);break;case r.STOP:e=new c(this,e),this.enterOuterAlt(e,9),this.state=48,this.match(r.STOP);break;case r.MAKE:e=new y(this,e),this.enterOuterAlt(e,10),this.state=49,this.match(r.MAKE),this.state=50,this.match(r.T__0),this.state=51,this.match(r.STRING),this.state=52,this.expr(0);break;case r.REPEAT:e=new g(this,e),this.enterOuterAlt(e,11),this.state=53,this.match(r.REPEAT),this.state=54,this.expr(0),this.state=55,this.block();break;case r.IF:e=new _(this,e),this.enterOuterAlt(e,12),this.state=57,this.match(r.IF),this.state=58,this.condition(),this.state=59,this.block(),this.state=62,this._errHandler.sync(this),t=this._input.LA(1),t===r.ELSE&&(this.state=60,this.match(r.ELSE),this.state=61,this.block());break;case r.STRING:e=new T(this,e),this.enterOuterAlt(e,13),this.state=64,this.procedureInvoke();break;default:throw new G.error.NoViableAltException(this);}}catch(t){if(t instanceof G.error.RecognitionException)e.exception=t,this._errHandler.reportError(this,t),this._errHandler.recover(this,t);else throw t}finally{this.exitRule()}return e},f.prototype=Object.create(G.ParserRuleContext.prototype),f.prototype.constructor=f,f.prototype.TO=function(){return this.getToken(r.TO,0)},f.prototype.STRING=function(){return this.getToken(r.STRING,0)},f.prototype.END=function(){return this.getToken(r.END,0)},f.prototype.paramDef=function(e){return void 0===e&&(e=null),null===e?this.getTypedRuleContexts(h):this.getTypedRuleContext(h,e)},f.prototype.command=function(e){return void 0===e&&(e=null),null===e?this.getTypedRuleContexts(a):this.getTypedRuleContext(a,e)},f.prototype.comment=function(e){return void 0===e&&(e=null),null===e?this.getTypedRuleContexts(b):this.getTypedRuleContext(b,e)},f.prototype.enterRule=function(e){e instanceof K&&e.enterProcedureDef(this)},f.prototype.exitRule=function(e){e instanceof K&&e.exitProcedureDef(this)},r.ProcedureDefContext=f,r.prototype.procedureDef=function(){var e=new f(this,this._ctx,this.state);this.enterRule(e,6,r.RULE_procedureDef);var t=0;try{for(this.enterOuterAlt(e,1),this.state=67,this.match(r.TO),this.state=68,this.match(r.STRING),this.state=72,this._errHandler.sync(this),t=this._input.LA(1);t===r.T__1;)this.state=69,this.paramDef(),this.state=74,this._errHandler.sync(this),t=this._input.LA(1);for(this.state=79,this._errHandler.sync(this),t=this._input.LA(1);0==(-32&t-13)&&0!=(1<<t-13&(1<<r.FD-13|1<<r.BK-13|1<<r.LT-13|1<<r.RT-13|1<<r.PU-13|1<<r.PD-13|1<<r.WAIT-13|1<<r.MAKE-13|1<<r.REPEAT-13|1<<r.IF-13|1<<r.STOP-13|1<<r.RETURN-13|1<<r.COMMENT-13|1<<r.STRING-13));){switch(this.state=77,this._errHandler.sync(this),this._input.LA(1)){case r.FD:case r.BK:case r.LT:case r.RT:case r.PU:case r.PD:case r.WAIT:case r.MAKE:case r.REPEAT:case r.IF:case r.STOP:case r.RETURN:case r.STRING:this.state=75,this.command();break;case r.COMMENT:this.state=76,this.comment();break;default:throw new G.error.NoViableAltException(this);}this.state=81,this._errHandler.sync(this),t=this._input.LA(1)}this.state=82,this.match(r.END)}catch(t){if(t instanceof G.error.RecognitionException)e.exception=t,this._errHandler.reportError(this,t),this._errHandler.recover(this,t);else throw t}finally{this.exitRule()}return e},h.prototype=Object.create(G.ParserRuleContext.prototype),h.prototype.constructor=h,h.prototype.STRING=function(){return this.getToken(r.STRING,0)},h.prototype.enterRule=function(e){e instanceof K&&e.enterParamDef(this)},h.prototype.exitRule=function(e){e instanceof K&&e.exitParamDef(this)},r.ParamDefContext=h,r.prototype.paramDef=function(){var e=new h(this,this._ctx,this.state);this.enterRule(e,8,r.RULE_paramDef);try{this.enterOuterAlt(e,1),this.state=84,this.match(r.T__1),this.state=85,this.match(r.STRING)}catch(t){if(t instanceof G.error.RecognitionException)e.exception=t,this._errHandler.reportError(this,t),this._errHandler.recover(this,t);else throw t}finally{this.exitRule()}return e},E.prototype=Object.create(G.ParserRuleContext.prototype),E.prototype.constructor=E,E.prototype.STRING=function(){return this.getToken(r.STRING,0)},E.prototype.expr=function(e){return void 0===e&&(e=null),null===e?this.getTypedRuleContexts(v):this.getTypedRuleContext(v,e)},E.prototype.enterRule=function(e){e instanceof K&&e.enterProcedureInvoke(this)},E.prototype.exitRule=function(e){e instanceof K&&e.exitProcedureInvoke(this)},r.ProcedureInvokeContext=E,r.prototype.procedureInvoke=function(){var e=new E(this,this._ctx,this.state);this.enterRule(e,10,r.RULE_procedureInvoke);var t=0;try{for(this.enterOuterAlt(e,1),this.state=87,this.match(r.STRING),this.state=91,this._errHandler.sync(this),t=this._input.LA(1);t===r.T__1||t===r.T__4||t===r.SUB||t===r.INTNUM;)this.state=88,this.expr(0),this.state=93,this._errHandler.sync(this),t=this._input.LA(1)}catch(t){if(t instanceof G.error.RecognitionException)e.exception=t,this._errHandler.reportError(this,t),this._errHandler.recover(this,t);else throw t}finally{this.exitRule()}return e},A.prototype=Object.create(G.ParserRuleContext.prototype),A.prototype.constructor=A,A.prototype.command=function(e){return void 0===e&&(e=null),null===e?this.getTypedRuleContexts(a):this.getTypedRuleContext(a,e)},A.prototype.comment=function(e){return void 0===e&&(e=null),null===e?this.getTypedRuleContexts(b):this.getTypedRuleContext(b,e)},A.prototype.enterRule=function(e){e instanceof K&&e.enterBlock(this)},A.prototype.exitRule=function(e){e instanceof K&&e.exitBlock(this)},r.BlockContext=A,r.prototype.block=function(){var e=new A(this,this._ctx,this.state);this.enterRule(e,12,r.RULE_block);var t=0;try{for(this.enterOuterAlt(e,1),this.state=94,this.match(r.T__2),this.state=96,this._errHandler.sync(this),t=this._input.LA(1),t===r.COMMENT&&(this.state=95,this.comment()),this.state=98,this.command(),this.state=103,this._errHandler.sync(this),t=this._input.LA(1);0==(-32&t-13)&&0!=(1<<t-13&(1<<r.FD-13|1<<r.BK-13|1<<r.LT-13|1<<r.RT-13|1<<r.PU-13|1<<r.PD-13|1<<r.WAIT-13|1<<r.MAKE-13|1<<r.REPEAT-13|1<<r.IF-13|1<<r.STOP-13|1<<r.RETURN-13|1<<r.COMMENT-13|1<<r.STRING-13));){switch(this.state=101,this._errHandler.sync(this),this._input.LA(1)){case r.FD:case r.BK:case r.LT:case r.RT:case r.PU:case r.PD:case r.WAIT:case r.MAKE:case r.REPEAT:case r.IF:case r.STOP:case r.RETURN:case r.STRING:this.state=99,this.command();break;case r.COMMENT:this.state=100,this.comment();break;default:throw new G.error.NoViableAltException(this);}this.state=105,this._errHandler.sync(this),t=this._input.LA(1)}this.state=106,this.match(r.T__3)}catch(t){if(t instanceof G.error.RecognitionException)e.exception=t,this._errHandler.reportError(this,t),this._errHandler.recover(this,t);else throw t}finally{this.exitRule()}return e},C.prototype=Object.create(G.ParserRuleContext.prototype),C.prototype.constructor=C,C.prototype.copyFrom=function(e){G.ParserRuleContext.prototype.copyFrom.call(this,e)},N.prototype=Object.create(C.prototype),N.prototype.constructor=N,r.CombineContext=N,N.prototype.condition=function(e){return void 0===e&&(e=null),null===e?this.getTypedRuleContexts(C):this.getTypedRuleContext(C,e)},N.prototype.AND=function(e){return void 0===e&&(e=null),null===e?this.getTokens(r.AND):this.getToken(r.AND,e)},N.prototype.OR=function(e){return void 0===e&&(e=null),null===e?this.getTokens(r.OR):this.getToken(r.OR,e)},N.prototype.enterRule=function(e){e instanceof K&&e.enterCombine(this)},N.prototype.exitRule=function(e){e instanceof K&&e.exitCombine(this)},R.prototype=Object.create(C.prototype),R.prototype.constructor=R,r.CompContext=R,R.prototype.expr=function(e){return void 0===e&&(e=null),null===e?this.getTypedRuleContexts(v):this.getTypedRuleContext(v,e)},R.prototype.comparison=function(){return this.getTypedRuleContext(L,0)},R.prototype.enterRule=function(e){e instanceof K&&e.enterComp(this)},R.prototype.exitRule=function(e){e instanceof K&&e.exitComp(this)},r.ConditionContext=C,r.prototype.condition=function(){var e=new C(this,this._ctx,this.state);this.enterRule(e,14,r.RULE_condition);var t=0;try{this.state=134,this._errHandler.sync(this);var o=this._interp.adaptivePredict(this._input,14,this._ctx);switch(o){case 1:e=new R(this,e),this.enterOuterAlt(e,1),this.state=108,this.match(r.T__4),this.state=109,this.expr(0),this.state=110,this.comparison(),this.state=111,this.expr(0),this.state=112,this.match(r.T__5);break;case 2:e=new N(this,e),this.enterOuterAlt(e,2),this.state=114,this.match(r.T__4),this.state=115,this.condition(),this.state=118,this._errHandler.sync(this),t=this._input.LA(1);do this.state=116,this.match(r.AND),this.state=117,this.condition(),this.state=120,this._errHandler.sync(this),t=this._input.LA(1);while(t===r.AND);this.state=122,this.match(r.T__5);break;case 3:e=new N(this,e),this.enterOuterAlt(e,3),this.state=124,this.match(r.T__4),this.state=125,this.condition(),this.state=128,this._errHandler.sync(this),t=this._input.LA(1);do this.state=126,this.match(r.OR),this.state=127,this.condition(),this.state=130,this._errHandler.sync(this),t=this._input.LA(1);while(t===r.OR);this.state=132,this.match(r.T__5);}}catch(t){if(t instanceof G.error.RecognitionException)e.exception=t,this._errHandler.reportError(this,t),this._errHandler.recover(this,t);else throw t}finally{this.exitRule()}return e},L.prototype=Object.create(G.ParserRuleContext.prototype),L.prototype.constructor=L,L.prototype.copyFrom=function(e){G.ParserRuleContext.prototype.copyFrom.call(this,e)},I.prototype=Object.create(L.prototype),I.prototype.constructor=I,r.NotEqContext=I,I.prototype.enterRule=function(e){e instanceof K&&e.enterNotEq(this)},I.prototype.exitRule=function(e){e instanceof K&&e.exitNotEq(this)},k.prototype=Object.create(L.prototype),k.prototype.constructor=k,r.LessThanContext=k,k.prototype.enterRule=function(e){e instanceof K&&e.enterLessThan(this)},k.prototype.exitRule=function(e){e instanceof K&&e.exitLessThan(this)},P.prototype=Object.create(L.prototype),P.prototype.constructor=P,r.GreaterThanContext=P,P.prototype.enterRule=function(e){e instanceof K&&e.enterGreaterThan(this)},P.prototype.exitRule=function(e){e instanceof K&&e.exitGreaterThan(this)},D.prototype=Object.create(L.prototype),D.prototype.constructor=D,r.LessThanEqContext=D,D.prototype.enterRule=function(e){e instanceof K&&e.enterLessThanEq(this)},D.prototype.exitRule=function(e){e instanceof K&&e.exitLessThanEq(this)},O.prototype=Object.create(L.prototype),O.prototype.constructor=O,r.GreaterThanEqContext=O,O.prototype.enterRule=function(e){e instanceof K&&e.enterGreaterThanEq(this)},O.prototype.exitRule=function(e){e instanceof K&&e.exitGreaterThanEq(this)},F.prototype=Object.create(L.prototype),F.prototype.constructor=F,r.EqContext=F,F.prototype.enterRule=function(e){e instanceof K&&e.enterEq(this)},F.prototype.exitRule=function(e){e instanceof K&&e.exitEq(this)},r.ComparisonContext=L,r.prototype.comparison=function(){var e=new L(this,this._ctx,this.state);this.enterRule(e,16,r.RULE_comparison);try{switch(this.state=142,this._errHandler.sync(this),this._input.LA(1)){case r.T__6:e=new F(this,e),this.enterOuterAlt(e,1),this.state=136,this.match(r.T__6);break;case r.T__7:e=new I(this,e),this.enterOuterAlt(e,2),this.state=137,this.match(r.T__7);break;case r.T__8:e=new k(this,e),this.enterOuterAlt(e,3),this.state=138,this.match(r.T__8);break;case r.T__9:e=new D(this,e),this.enterOuterAlt(e,4),this.state=139,this.match(r.T__9);break;case r.T__10:e=new P(this,e),this.enterOuterAlt(e,5),this.state=140,this.match(r.T__10);break;case r.T__11:e=new O(this,e),this.enterOuterAlt(e,6),this.state=141,this.match(r.T__11);break;default:throw new G.error.NoViableAltException(this);}}catch(t){if(t instanceof G.error.RecognitionException)e.exception=t,this._errHandler.reportError(this,t),this._errHandler.recover(this,t);else throw t}finally{this.exitRule()}return e},b.prototype=Object.create(G.ParserRuleContext.prototype),b.prototype.constructor=b,b.prototype.COMMENT=function(){return this.getToken(r.COMMENT,0)},b.prototype.enterRule=function(e){e instanceof K&&e.enterComment(this)},b.prototype.exitRule=function(e){e instanceof K&&e.exitComment(this)},r.CommentContext=b,r.prototype.comment=function(){var e=new b(this,this._ctx,this.state);this.enterRule(e,18,r.RULE_comment);try{this.enterOuterAlt(e,1),this.state=144,this.match(r.COMMENT)}catch(t){if(t instanceof G.error.RecognitionException)e.exception=t,this._errHandler.reportError(this,t),this._errHandler.recover(this,t);else throw t}finally{this.exitRule()}return e},v.prototype=Object.create(G.ParserRuleContext.prototype),v.prototype.constructor=v,v.prototype.copyFrom=function(e){G.ParserRuleContext.prototype.copyFrom.call(this,e)},M.prototype=Object.create(v.prototype),M.prototype.constructor=M,r.MulDivContext=M,M.prototype.expr=function(e){return void 0===e&&(e=null),null===e?this.getTypedRuleContexts(v):this.getTypedRuleContext(v,e)},M.prototype.MUL=function(){return this.getToken(r.MUL,0)},M.prototype.DIV=function(){return this.getToken(r.DIV,0)},M.prototype.enterRule=function(e){e instanceof K&&e.enterMulDiv(this)},M.prototype.exitRule=function(e){e instanceof K&&e.exitMulDiv(this)},U.prototype=Object.create(v.prototype),U.prototype.constructor=U,r.AddSubContext=U,U.prototype.expr=function(e){return void 0===e&&(e=null),null===e?this.getTypedRuleContexts(v):this.getTypedRuleContext(v,e)},U.prototype.ADD=function(){return this.getToken(r.ADD,0)},U.prototype.SUB=function(){return this.getToken(r.SUB,0)},U.prototype.enterRule=function(e){e instanceof K&&e.enterAddSub(this)},U.prototype.exitRule=function(e){e instanceof K&&e.exitAddSub(this)},B.prototype=Object.create(v.prototype),B.prototype.constructor=B,r.ParensContext=B,B.prototype.expr=function(){return this.getTypedRuleContext(v,0)},B.prototype.enterRule=function(e){e instanceof K&&e.enterParens(this)},B.prototype.exitRule=function(e){e instanceof K&&e.exitParens(this)},H.prototype=Object.create(v.prototype),H.prototype.constructor=H,r.NegateContext=H,H.prototype.SUB=function(){return this.getToken(r.SUB,0)},H.prototype.expr=function(){return this.getTypedRuleContext(v,0)},H.prototype.enterRule=function(e){e instanceof K&&e.enterNegate(this)},H.prototype.exitRule=function(e){e instanceof K&&e.exitNegate(this)},V.prototype=Object.create(v.prototype),V.prototype.constructor=V,r.IntContext=V,V.prototype.INTNUM=function(){return this.getToken(r.INTNUM,0)},V.prototype.enterRule=function(e){e instanceof K&&e.enterInt(this)},V.prototype.exitRule=function(e){e instanceof K&&e.exitInt(this)},z.prototype=Object.create(v.prototype),z.prototype.constructor=z,r.DerefContext=z,z.prototype.STRING=function(){return this.getToken(r.STRING,0)},z.prototype.enterRule=function(e){e instanceof K&&e.enterDeref(this)},z.prototype.exitRule=function(e){e instanceof K&&e.exitDeref(this)},r.prototype.expr=function(e){e===void 0&&(e=0);var t=this._ctx,o=this.state,n=new v(this,this._ctx,o),p=n,a=20;this.enterRecursionRule(n,20,r.RULE_expr,e);var i=0;try{switch(this.enterOuterAlt(n,1),this.state=156,this._errHandler.sync(this),this._input.LA(1)){case r.SUB:n=new H(this,n),this._ctx=n,p=n,this.state=147,this.match(r.SUB),this.state=148,this.expr(6);break;case r.T__1:n=new z(this,n),this._ctx=n,p=n,this.state=149,this.match(r.T__1),this.state=150,this.match(r.STRING);break;case r.INTNUM:n=new V(this,n),this._ctx=n,p=n,this.state=151,this.match(r.INTNUM);break;case r.T__4:n=new B(this,n),this._ctx=n,p=n,this.state=152,this.match(r.T__4),this.state=153,this.expr(0),this.state=154,this.match(r.T__5);break;default:throw new G.error.NoViableAltException(this);}this._ctx.stop=this._input.LT(-1),this.state=166,this._errHandler.sync(this);for(var s=this._interp.adaptivePredict(this._input,18,this._ctx);2!=s&&s!=G.atn.ATN.INVALID_ALT_NUMBER;){if(1===s){null!==this._parseListeners&&this.triggerExitRuleEvent(),p=n,this.state=164,this._errHandler.sync(this);var d=this._interp.adaptivePredict(this._input,17,this._ctx);switch(d){case 1:if(n=new M(this,new v(this,t,o)),this.pushNewRecursionContext(n,a,r.RULE_expr),this.state=158,!this.precpred(this._ctx,5))throw new G.error.FailedPredicateException(this,"this.precpred(this._ctx, 5)");this.state=159,i=this._input.LA(1),i===r.MUL||i===r.DIV?(this._errHandler.reportMatch(this),this.consume()):this._errHandler.recoverInline(this),this.state=160,this.expr(6);break;case 2:if(n=new U(this,new v(this,t,o)),this.pushNewRecursionContext(n,a,r.RULE_expr),this.state=161,!this.precpred(this._ctx,4))throw new G.error.FailedPredicateException(this,"this.precpred(this._ctx, 4)");this.state=162,i=this._input.LA(1),i===r.ADD||i===r.SUB?(this._errHandler.reportMatch(this),this.consume()):this._errHandler.recoverInline(this),this.state=163,this.expr(5);}}this.state=168,this._errHandler.sync(this),s=this._interp.adaptivePredict(this._input,18,this._ctx)}}catch(e){if(e instanceof G.error.RecognitionException)n.exception=e,this._errHandler.reportError(this,e),this._errHandler.recover(this,e);else throw e}finally{this.unrollRecursionContexts(t)}return n},r.prototype.sempred=function(e,t,o){switch(t){case 10:return this.expr_sempred(e,o);default:throw"No predicate with index:"+t;}},r.prototype.expr_sempred=function(e,t){switch(t){case 0:return this.precpred(this._ctx,5);case 1:return this.precpred(this._ctx,4);default:throw"No predicate with index:"+t;}},o.logoParser=r},{"./logoListener":6,"antlr4/index":49}],8:[function(e,t,o){function r(){return this}function n(e){return r.call(this),this.tokenSource=e,this.tokens=[],this.index=-1,this.fetchedEOF=!1,this}var p=e("./Token").Token,a=e("./Lexer").Lexer,d=e("./IntervalSet").Interval;n.prototype=Object.create(r.prototype),n.prototype.constructor=n,n.prototype.mark=function(){return 0},n.prototype.release=function(){},n.prototype.reset=function(){this.seek(0)},n.prototype.seek=function(e){this.lazyInit(),this.index=this.adjustSeekIndex(e)},n.prototype.get=function(e){return this.lazyInit(),this.tokens[e]},n.prototype.consume=function(){var e=!1;if(e=!!(0<=this.index)&&(this.fetchedEOF?this.index<this.tokens.length-1:this.index<this.tokens.length),!e&&this.LA(1)===p.EOF)throw"cannot consume EOF";this.sync(this.index+1)&&(this.index=this.adjustSeekIndex(this.index+1))},n.prototype.sync=function(e){var t=e-this.tokens.length+1;if(0<t){var o=this.fetch(t);return o>=t}return!0},n.prototype.fetch=function(e){if(this.fetchedEOF)return 0;for(var o=0,r;o<e;o++)if(r=this.tokenSource.nextToken(),r.tokenIndex=this.tokens.length,this.tokens.push(r),r.type===p.EOF)return this.fetchedEOF=!0,o+1;return e},n.prototype.getTokens=function(e,o,r){if(void 0===r&&(r=null),0>e||0>o)return null;this.lazyInit();var n=[];o>=this.tokens.length&&(o=this.tokens.length-1);for(var a=e,i;a<o&&(i=this.tokens[a],i.type!==p.EOF);a++)(null===r||r.contains(i.type))&&n.push(i);return n},n.prototype.LA=function(e){return this.LT(e).type},n.prototype.LB=function(e){return 0>this.index-e?null:this.tokens[this.index-e]},n.prototype.LT=function(e){if(this.lazyInit(),0===e)return null;if(0>e)return this.LB(-e);var t=this.index+e-1;return this.sync(t),t>=this.tokens.length?this.tokens[this.tokens.length-1]:this.tokens[t]},n.prototype.adjustSeekIndex=function(e){return e},n.prototype.lazyInit=function(){-1===this.index&&this.setup()},n.prototype.setup=function(){this.sync(0),this.index=this.adjustSeekIndex(0)},n.prototype.setTokenSource=function(e){this.tokenSource=e,this.tokens=[],this.index=-1,this.fetchedEOF=!1},n.prototype.nextTokenOnChannel=function(e){if(this.sync(e),e>=this.tokens.length)return-1;for(var t=this.tokens[e];t.channel!==this.channel;){if(t.type===p.EOF)return-1;e+=1,this.sync(e),t=this.tokens[e]}return e},n.prototype.previousTokenOnChannel=function(e,t){for(;0<=e&&this.tokens[e].channel!==t;)e-=1;return e},n.prototype.getHiddenTokensToRight=function(e,t){if(void 0===t&&(t=-1),this.lazyInit(),0>e||e>=this.tokens.length)throw""+e+" not in 0.."+this.tokens.length-1;var o=this.nextTokenOnChannel(e+1,a.DEFAULT_TOKEN_CHANNEL),r=-1===o?this.tokens.length-1:o;return this.filterForChannel(e+1,r,t)},n.prototype.getHiddenTokensToLeft=function(e,t){if(void 0===t&&(t=-1),this.lazyInit(),0>e||e>=this.tokens.length)throw""+e+" not in 0.."+this.tokens.length-1;var o=this.previousTokenOnChannel(e-1,a.DEFAULT_TOKEN_CHANNEL);if(o===e-1)return null;return this.filterForChannel(o+1,e-1,t)},n.prototype.filterForChannel=function(e,o,r){for(var n=[],p=e,i;p<o+1;p++)i=this.tokens[p],-1===r?i.channel!==a.DEFAULT_TOKEN_CHANNEL&&n.push(i):i.channel===r&&n.push(i);return 0===n.length?null:n},n.prototype.getSourceName=function(){return this.tokenSource.getSourceName()},n.prototype.getText=function(e){this.lazyInit(),this.fill(),(void 0===e||null===e)&&(e=new d(0,this.tokens.length-1));var o=e.start;o instanceof p&&(o=o.tokenIndex);var r=e.stop;if(r instanceof p&&(r=r.tokenIndex),null===o||null===r||0>o||0>r)return"";r>=this.tokens.length&&(r=this.tokens.length-1);for(var n="",a=o,i;a<r+1&&(i=this.tokens[a],i.type!==p.EOF);a++)n+=i.text;return n},n.prototype.fill=function(){for(this.lazyInit();1e3===this.fetch(1e3);)continue},o.BufferedTokenStream=n},{"./IntervalSet":14,"./Lexer":16,"./Token":22}],9:[function(e,t,o){var r=e("./InputStream").InputStream,n="undefined"==typeof window&&"undefined"==typeof importScripts,p=n?e("fs"):null;o.CharStreams={fromString:function(e){return new r(e,!0)},fromBlob:function(e,t,o,n){var p=FileReader();p.onload=function(t){var e=new r(t.target.result,!0);o(e)},p.onerror=n,p.readAsText(e,t)},fromBuffer:function(e,t){return new r(e.toString(t),!0)},fromPath:function(e,t,o){p.readFile(e,t,function(e,t){var n=null;null!==t&&(n=new r(t,!0)),o(e,n)})},fromPathSync:function(e,t){var o=p.readFileSync(e,t);return new r(o,!0)}}},{"./InputStream":13,fs:55}],10:[function(e,t,o){function r(){return this}function n(e){return r.call(this),this.copyText=void 0!==e&&e,this}var p=e("./Token").CommonToken;n.prototype=Object.create(r.prototype),n.prototype.constructor=n,n.DEFAULT=new n,n.prototype.create=function(e,o,r,n,a,i,s,d){var c=new p(e,o,n,a,i);return c.line=s,c.column=d,null===r?this.copyText&&null!==e[1]&&(c.text=e[1].getText(a,i)):c.text=r,c},n.prototype.createThin=function(e,o){var r=new p(null,e);return r.text=o,r},o.CommonTokenFactory=n},{"./Token":22}],11:[function(e,t,o){function r(e,t){return n.call(this,e),this.channel=void 0===t?p.DEFAULT_CHANNEL:t,this}var p=e("./Token").Token,n=e("./BufferedTokenStream").BufferedTokenStream;r.prototype=Object.create(n.prototype),r.prototype.constructor=r,r.prototype.adjustSeekIndex=function(e){return this.nextTokenOnChannel(e,this.channel)},r.prototype.LB=function(e){if(0===e||0>this.index-e)return null;for(var t=this.index,o=1;o<=e;)t=this.previousTokenOnChannel(t-1,this.channel),o+=1;return 0>t?null:this.tokens[t]},r.prototype.LT=function(e){if(this.lazyInit(),0===e)return null;if(0>e)return this.LB(-e);for(var t=this.index,o=1;o<e;)this.sync(t+1)&&(t=this.nextTokenOnChannel(t+1,this.channel)),o+=1;return this.tokens[t]},r.prototype.getNumberOfOnChannelTokens=function(){var e=0;this.fill();for(var o=0,r;o<this.tokens.length&&(r=this.tokens[o],r.channel===this.channel&&(e+=1),r.type!==p.EOF);o++);return e},o.CommonTokenStream=r},{"./BufferedTokenStream":8,"./Token":22}],12:[function(e,t,o){function r(e,t){var o=a.readFileSync(e,"utf8");return n.call(this,o,t),this.fileName=e,this}var n=e("./InputStream").InputStream,p="undefined"==typeof window&&"undefined"==typeof importScripts,a=p?e("fs"):null;r.prototype=Object.create(n.prototype),r.prototype.constructor=r,o.FileStream=r},{"./InputStream":13,fs:55}],13:[function(e,t,o){function r(e){if(e._index=0,e.data=[],e.decodeToUnicodeCodePoints)for(var t=0,o;t<e.strdata.length;)o=e.strdata.codePointAt(t),e.data.push(o),t+=65535>=o?1:2;else for(var t=0,r;t<e.strdata.length;t++)r=e.strdata.charCodeAt(t),e.data.push(r);e._size=e.data.length}function n(e,t){return this.name="<empty>",this.strdata=e,this.decodeToUnicodeCodePoints=t||!1,r(this),this}var p=e("./Token").Token;e("./polyfills/codepointat"),e("./polyfills/fromcodepoint"),Object.defineProperty(n.prototype,"index",{get:function(){return this._index}}),Object.defineProperty(n.prototype,"size",{get:function(){return this._size}}),n.prototype.reset=function(){this._index=0},n.prototype.consume=function(){if(this._index>=this._size)throw"cannot consume EOF";this._index+=1},n.prototype.LA=function(e){if(0===e)return 0;0>e&&(e+=1);var t=this._index+e-1;return 0>t||t>=this._size?p.EOF:this.data[t]},n.prototype.LT=function(e){return this.LA(e)},n.prototype.mark=function(){return-1},n.prototype.release=function(){},n.prototype.seek=function(e){return e<=this._index?void(this._index=e):void(this._index=Math.min(e,this._size))},n.prototype.getText=function(e,t){if(t>=this._size&&(t=this._size-1),e>=this._size)return"";if(this.decodeToUnicodeCodePoints){for(var o="",r=e;r<=t;r++)o+=String.fromCodePoint(this.data[r]);return o}return this.strdata.slice(e,t+1)},n.prototype.toString=function(){return this.strdata},o.InputStream=n},{"./Token":22,"./polyfills/codepointat":50,"./polyfills/fromcodepoint":51}],14:[function(e,t,o){function n(e,t){return this.start=e,this.stop=t,this}function r(){this.intervals=null,this.readOnly=!1}var p=String.fromCharCode,s=e("./Token").Token;n.prototype.contains=function(e){return e>=this.start&&e<this.stop},n.prototype.toString=function(){return this.start===this.stop-1?this.start.toString():this.start.toString()+".."+(this.stop-1).toString()},Object.defineProperty(n.prototype,"length",{get:function(){return this.stop-this.start}}),r.prototype.first=function(){return null===this.intervals||0===this.intervals.length?s.INVALID_TYPE:this.intervals[0].start},r.prototype.addOne=function(e){this.addInterval(new n(e,e+1))},r.prototype.addRange=function(e,t){this.addInterval(new n(e,t+1))},r.prototype.addInterval=function(e){if(null===this.intervals)this.intervals=[],this.intervals.push(e);else{for(var t=0,o;t<this.intervals.length;t++){if(o=this.intervals[t],e.stop<o.start)return void this.intervals.splice(t,0,e);if(e.stop===o.start)return void(this.intervals[t].start=e.start);if(e.start<=o.stop)return this.intervals[t]=new n(Math.min(o.start,e.start),Math.max(o.stop,e.stop)),void this.reduce(t)}this.intervals.push(e)}},r.prototype.addSet=function(e){if(null!==e.intervals)for(var t=0,o;t<e.intervals.length;t++)o=e.intervals[t],this.addInterval(new n(o.start,o.stop));return this},r.prototype.reduce=function(e){if(e<this.intervalslength-1){var t=this.intervals[e],o=this.intervals[e+1];t.stop>=o.stop?(this.intervals.pop(e+1),this.reduce(e)):t.stop>=o.start&&(this.intervals[e]=new n(t.start,o.stop),this.intervals.pop(e+1))}},r.prototype.complement=function(e,t){var o=new r;o.addInterval(new n(e,t+1));for(var p=0;p<this.intervals.length;p++)o.removeRange(this.intervals[p]);return o},r.prototype.contains=function(e){if(null===this.intervals)return!1;for(var t=0;t<this.intervals.length;t++)if(this.intervals[t].contains(e))return!0;return!1},Object.defineProperty(r.prototype,"length",{get:function(){var e=0;return this.intervals.map(function(t){e+=t.length}),e}}),r.prototype.removeRange=function(e){if(e.start===e.stop-1)this.removeOne(e.start);else if(null!==this.intervals)for(var t=0,o=0,r;o<this.intervals.length;o++){if(r=this.intervals[t],e.stop<=r.start)return;if(e.start>r.start&&e.stop<r.stop){this.intervals[t]=new n(r.start,e.start);var p=new n(e.stop,r.stop);return void this.intervals.splice(t,0,p)}e.start<=r.start&&e.stop>=r.stop?(this.intervals.splice(t,1),--t):e.start<r.stop?this.intervals[t]=new n(r.start,e.start):e.stop<r.stop&&(this.intervals[t]=new n(e.stop,r.stop)),t+=1}},r.prototype.removeOne=function(e){if(null!==this.intervals)for(var t=0,o;t<this.intervals.length;t++){if(o=this.intervals[t],e<o.start)return;if(e===o.start&&e===o.stop-1)return void this.intervals.splice(t,1);if(e===o.start)return void(this.intervals[t]=new n(o.start+1,o.stop));if(e===o.stop-1)return void(this.intervals[t]=new n(o.start,o.stop-1));if(e<o.stop-1){var r=new n(o.start,e);return o.start=e+1,void this.intervals.splice(t,0,r)}}},r.prototype.toString=function(e,t,o){return e=e||null,t=t||null,o=o||!1,null===this.intervals?"{}":null!==e||null!==t?this.toTokenString(e,t):o?this.toCharString():this.toIndexString()},r.prototype.toCharString=function(){for(var e=[],t=0,o;t<this.intervals.length;t++)o=this.intervals[t],o.stop===o.start+1?o.start===s.EOF?e.push("<EOF>"):e.push("'"+p(o.start)+"'"):e.push("'"+p(o.start)+"'..'"+p(o.stop-1)+"'");return 1<e.length?"{"+e.join(", ")+"}":e[0]},r.prototype.toIndexString=function(){for(var e=[],t=0,o;t<this.intervals.length;t++)o=this.intervals[t],o.stop===o.start+1?o.start===s.EOF?e.push("<EOF>"):e.push(o.start.toString()):e.push(o.start.toString()+".."+(o.stop-1).toString());return 1<e.length?"{"+e.join(", ")+"}":e[0]},r.prototype.toTokenString=function(e,t){for(var o=[],r=0,n;r<this.intervals.length;r++){n=this.intervals[r];for(var p=n.start;p<n.stop;p++)o.push(this.elementName(e,t,p))}return 1<o.length?"{"+o.join(", ")+"}":o[0]},r.prototype.elementName=function(e,t,o){return o===s.EOF?"<EOF>":o===s.EPSILON?"<EPSILON>":e[o]||t[o]},o.Interval=n,o.IntervalSet=r},{"./Token":22}],15:[function(e,t,o){function r(e){this.atn=e}var n=e("./Utils").Set,p=e("./Utils").BitSet,a=e("./Token").Token,d=e("./atn/ATNConfig").ATNConfig,i=e("./IntervalSet").Interval,c=e("./IntervalSet").IntervalSet,l=e("./atn/ATNState").RuleStopState,u=e("./atn/Transition").RuleTransition,s=e("./atn/Transition").NotSetTransition,y=e("./atn/Transition").WildcardTransition,g=e("./atn/Transition").AbstractPredicateTransition,T=e("./PredictionContext"),x=T.predictionContextFromRuleContext,m=T.PredictionContext,_=T.SingletonPredictionContext;r.HIT_PRED=a.INVALID_TYPE,r.prototype.getDecisionLookahead=function(e){if(null===e)return null;for(var t=e.transitions.length,o=[],a=0;a<t;a++){o[a]=new c;var i=new n;this._LOOK(e.transition(a).target,null,m.EMPTY,o[a],i,new p,!1,!1),(0===o[a].length||o[a].contains(r.HIT_PRED))&&(o[a]=null)}return o},r.prototype.LOOK=function(e,t,o){var a=new c;o=o||null;var r=null===o?null:x(e.atn,o);return this._LOOK(e,t,r,a,new n,new p,!0,!0),a},r.prototype._LOOK=function(e,o,n,p,T,x,S,f){var h=new d({state:e,alt:0,context:n},null);if(!T.contains(h)){if(T.add(h),e===o){if(null===n)return void p.addOne(a.EPSILON);if(n.isEmpty()&&f)return void p.addOne(a.EOF)}if(e instanceof l){if(null===n)return void p.addOne(a.EPSILON);if(n.isEmpty()&&f)return void p.addOne(a.EOF);if(n!==m.EMPTY){for(var c=0;c<n.length;c++){var i=this.atn.states[n.getReturnState(c)],E=x.contains(i.ruleIndex);try{x.remove(i.ruleIndex),this._LOOK(i,o,n.getParent(c),p,T,x,S,f)}finally{E&&x.add(i.ruleIndex)}}return}}for(var A=0,C;A<e.transitions.length;A++)if(C=e.transitions[A],C.constructor===u){if(x.contains(C.target.ruleIndex))continue;var t=_.create(n,C.followState.stateNumber);try{x.add(C.target.ruleIndex),this._LOOK(C.target,o,t,p,T,x,S,f)}finally{x.remove(C.target.ruleIndex)}}else if(C instanceof g)S?this._LOOK(C.target,o,n,p,T,x,S,f):p.addOne(r.HIT_PRED);else if(C.isEpsilon)this._LOOK(C.target,o,n,p,T,x,S,f);else if(C.constructor===y)p.addRange(a.MIN_USER_TOKEN_TYPE,this.atn.maxTokenType);else{var N=C.label;null!==N&&(C instanceof s&&(N=N.complement(a.MIN_USER_TOKEN_TYPE,this.atn.maxTokenType)),p.addSet(N))}}},o.LL1Analyzer=r},{"./IntervalSet":14,"./PredictionContext":19,"./Token":22,"./Utils":23,"./atn/ATNConfig":25,"./atn/ATNState":30,"./atn/Transition":38}],16:[function(e,t,o){function r(e){return p.call(this),this._input=e,this._factory=a.DEFAULT,this._tokenFactorySourcePair=[this,e],this._interp=null,this._token=null,this._tokenStartCharIndex=-1,this._tokenStartLine=-1,this._tokenStartColumn=-1,this._hitEOF=!1,this._channel=n.DEFAULT_CHANNEL,this._type=n.INVALID_TYPE,this._modeStack=[],this._mode=r.DEFAULT_MODE,this._text=null,this}var n=e("./Token").Token,p=e("./Recognizer").Recognizer,a=e("./CommonTokenFactory").CommonTokenFactory,i=e("./error/Errors").RecognitionException,s=e("./error/Errors").LexerNoViableAltException;r.prototype=Object.create(p.prototype),r.prototype.constructor=r,r.DEFAULT_MODE=0,r.MORE=-2,r.SKIP=-3,r.DEFAULT_TOKEN_CHANNEL=n.DEFAULT_CHANNEL,r.HIDDEN=n.HIDDEN_CHANNEL,r.MIN_CHAR_VALUE=0,r.MAX_CHAR_VALUE=1114111,r.prototype.reset=function(){null!==this._input&&this._input.seek(0),this._token=null,this._type=n.INVALID_TYPE,this._channel=n.DEFAULT_CHANNEL,this._tokenStartCharIndex=-1,this._tokenStartColumn=-1,this._tokenStartLine=-1,this._text=null,this._hitEOF=!1,this._mode=r.DEFAULT_MODE,this._modeStack=[],this._interp.reset()},r.prototype.nextToken=function(){if(null===this._input)throw"nextToken requires a non-null input stream.";var e=this._input.mark();try{for(;;){if(this._hitEOF)return this.emitEOF(),this._token;this._token=null,this._channel=n.DEFAULT_CHANNEL,this._tokenStartCharIndex=this._input.index,this._tokenStartColumn=this._interp.column,this._tokenStartLine=this._interp.line,this._text=null;for(var t=!1;;){this._type=n.INVALID_TYPE;var o=r.SKIP;try{o=this._interp.match(this._input,this._mode)}catch(t){if(t instanceof i)this.notifyListeners(t),this.recover(t);else throw console.log(t.stack),t}if(this._input.LA(1)===n.EOF&&(this._hitEOF=!0),this._type===n.INVALID_TYPE&&(this._type=o),this._type===r.SKIP){t=!0;break}if(this._type!==r.MORE)break}if(!t)return null===this._token&&this.emit(),this._token}}finally{this._input.release(e)}},r.prototype.skip=function(){this._type=r.SKIP},r.prototype.more=function(){this._type=r.MORE},r.prototype.mode=function(e){this._mode=e},r.prototype.pushMode=function(e){this._interp.debug&&console.log("pushMode "+e),this._modeStack.push(this._mode),this.mode(e)},r.prototype.popMode=function(){if(0===this._modeStack.length)throw"Empty Stack";return this._interp.debug&&console.log("popMode back to "+this._modeStack.slice(0,-1)),this.mode(this._modeStack.pop()),this._mode},Object.defineProperty(r.prototype,"inputStream",{get:function(){return this._input},set:function(e){this._input=null,this._tokenFactorySourcePair=[this,this._input],this.reset(),this._input=e,this._tokenFactorySourcePair=[this,this._input]}}),Object.defineProperty(r.prototype,"sourceName",{get:function(){return this._input.sourceName}}),r.prototype.emitToken=function(e){this._token=e},r.prototype.emit=function(){var e=this._factory.create(this._tokenFactorySourcePair,this._type,this._text,this._channel,this._tokenStartCharIndex,this.getCharIndex()-1,this._tokenStartLine,this._tokenStartColumn);return this.emitToken(e),e},r.prototype.emitEOF=function(){var e=this.column,t=this.line,o=this._factory.create(this._tokenFactorySourcePair,n.EOF,null,n.DEFAULT_CHANNEL,this._input.index,this._input.index-1,t,e);return this.emitToken(o),o},Object.defineProperty(r.prototype,"type",{get:function(){return this.type},set:function(e){this._type=e}}),Object.defineProperty(r.prototype,"line",{get:function(){return this._interp.line},set:function(e){this._interp.line=e}}),Object.defineProperty(r.prototype,"column",{get:function(){return this._interp.column},set:function(e){this._interp.column=e}}),r.prototype.getCharIndex=function(){return this._input.index},Object.defineProperty(r.prototype,"text",{get:function(){return null===this._text?this._interp.getText(this._input):this._text},set:function(e){this._text=e}}),r.prototype.getAllTokens=function(){for(var e=[],o=this.nextToken();o.type!==n.EOF;)e.push(o),o=this.nextToken();return e},r.prototype.notifyListeners=function(t){var e=this._tokenStartCharIndex,o=this._input.index,r=this._input.getText(e,o),n="token recognition error at: '"+this.getErrorDisplay(r)+"'",p=this.getErrorListenerDispatch();p.syntaxError(this,null,this._tokenStartLine,this._tokenStartColumn,n,t)},r.prototype.getErrorDisplay=function(e){for(var t=[],o=0;o<e.length;o++)t.push(e[o]);return t.join("")},r.prototype.getErrorDisplayForChar=function(e){return e.charCodeAt(0)===n.EOF?"<EOF>":"\n"===e?"\\n":"\t"===e?"\\t":"\r"===e?"\\r":e},r.prototype.getCharErrorDisplay=function(e){return"'"+this.getErrorDisplayForChar(e)+"'"},r.prototype.recover=function(e){this._input.LA(1)!==n.EOF&&(e instanceof s?this._interp.consume(this._input):this._input.consume())},o.Lexer=r},{"./CommonTokenFactory":10,"./Recognizer":20,"./Token":22,"./error/Errors":47}],17:[function(e,t,o){function r(e){return a.call(this),this.parser=e,this}function n(e){return i.call(this),this._input=null,this._errHandler=new s,this._precedenceStack=[],this._precedenceStack.push(0),this._ctx=null,this.buildParseTrees=!0,this._tracer=null,this._parseListeners=null,this._syntaxErrors=0,this.setInputStream(e),this}var p=e("./Token").Token,a=e("./tree/Tree").ParseTreeListener,i=e("./Recognizer").Recognizer,s=e("./error/ErrorStrategy").DefaultErrorStrategy,d=e("./atn/ATNDeserializer").ATNDeserializer,c=e("./atn/ATNDeserializationOptions").ATNDeserializationOptions,l=e("./tree/Tree").TerminalNode,u=e("./tree/Tree").ErrorNode;r.prototype=Object.create(a.prototype),r.prototype.constructor=r,r.prototype.enterEveryRule=function(e){console.log("enter   "+this.parser.ruleNames[e.ruleIndex]+", LT(1)="+this.parser._input.LT(1).text)},r.prototype.visitTerminal=function(e){console.log("consume "+e.symbol+" rule "+this.parser.ruleNames[this.parser._ctx.ruleIndex])},r.prototype.exitEveryRule=function(e){console.log("exit    "+this.parser.ruleNames[e.ruleIndex]+", LT(1)="+this.parser._input.LT(1).text)},n.prototype=Object.create(i.prototype),n.prototype.contructor=n,n.bypassAltsAtnCache={},n.prototype.reset=function(){null!==this._input&&this._input.seek(0),this._errHandler.reset(this),this._ctx=null,this._syntaxErrors=0,this.setTrace(!1),this._precedenceStack=[],this._precedenceStack.push(0),null!==this._interp&&this._interp.reset()},n.prototype.match=function(e){var o=this.getCurrentToken();return o.type===e?(this._errHandler.reportMatch(this),this.consume()):(o=this._errHandler.recoverInline(this),this.buildParseTrees&&-1===o.tokenIndex&&this._ctx.addErrorNode(o)),o},n.prototype.matchWildcard=function(){var e=this.getCurrentToken();return 0<e.type?(this._errHandler.reportMatch(this),this.consume()):(e=this._errHandler.recoverInline(this),this._buildParseTrees&&-1===e.tokenIndex&&this._ctx.addErrorNode(e)),e},n.prototype.getParseListeners=function(){return this._parseListeners||[]},n.prototype.addParseListener=function(e){if(null===e)throw"listener";null===this._parseListeners&&(this._parseListeners=[]),this._parseListeners.push(e)},n.prototype.removeParseListener=function(e){if(null!==this._parseListeners){var t=this._parseListeners.indexOf(e);0<=t&&this._parseListeners.splice(t,1),0===this._parseListeners.length&&(this._parseListeners=null)}},n.prototype.removeParseListeners=function(){this._parseListeners=null},n.prototype.triggerEnterRuleEvent=function(){if(null!==this._parseListeners){var e=this._ctx;this._parseListeners.map(function(t){t.enterEveryRule(e),e.enterRule(t)})}},n.prototype.triggerExitRuleEvent=function(){if(null!==this._parseListeners){var e=this._ctx;this._parseListeners.slice(0).reverse().map(function(t){e.exitRule(t),t.exitEveryRule(e)})}},n.prototype.getTokenFactory=function(){return this._input.tokenSource._factory},n.prototype.setTokenFactory=function(e){this._input.tokenSource._factory=e},n.prototype.getATNWithBypassAlts=function(){var e=this.getSerializedATN();if(null===e)throw"The current parser does not support an ATN with bypass alternatives.";var t=this.bypassAltsAtnCache[e];if(null===t){var o=new c;o.generateRuleBypassTransitions=!0,t=new d(o).deserialize(e),this.bypassAltsAtnCache[e]=t}return t};var y=e("./Lexer").Lexer;n.prototype.compileParseTreePattern=function(e,t,o){if(o=o||null,null===o&&null!==this.getTokenStream()){var r=this.getTokenStream().tokenSource;r instanceof y&&(o=r)}if(null===o)throw"Parser can't discover a lexer to use";var n=new ParseTreePatternMatcher(o,this);return n.compile(e,t)},n.prototype.getInputStream=function(){return this.getTokenStream()},n.prototype.setInputStream=function(e){this.setTokenStream(e)},n.prototype.getTokenStream=function(){return this._input},n.prototype.setTokenStream=function(e){this._input=null,this.reset(),this._input=e},n.prototype.getCurrentToken=function(){return this._input.LT(1)},n.prototype.notifyErrorListeners=function(e,t,o){t=t||null,o=o||null,null===t&&(t=this.getCurrentToken()),this._syntaxErrors+=1;var r=t.line,n=t.column,p=this.getErrorListenerDispatch();p.syntaxError(this,t,r,n,e,o)},n.prototype.consume=function(){var e=this.getCurrentToken();e.type!==p.EOF&&this.getInputStream().consume();var t=null!==this._parseListeners&&0<this._parseListeners.length;if(this.buildParseTrees||t){var o;o=this._errHandler.inErrorRecoveryMode(this)?this._ctx.addErrorNode(e):this._ctx.addTokenNode(e),o.invokingState=this.state,t&&this._parseListeners.map(function(e){o instanceof u||o.isErrorNode!==void 0&&o.isErrorNode()?e.visitErrorNode(o):o instanceof l&&e.visitTerminal(o)})}return e},n.prototype.addContextToParseTree=function(){null!==this._ctx.parentCtx&&this._ctx.parentCtx.addChild(this._ctx)},n.prototype.enterRule=function(e,t){this.state=t,this._ctx=e,this._ctx.start=this._input.LT(1),this.buildParseTrees&&this.addContextToParseTree(),null!==this._parseListeners&&this.triggerEnterRuleEvent()},n.prototype.exitRule=function(){this._ctx.stop=this._input.LT(-1),null!==this._parseListeners&&this.triggerExitRuleEvent(),this.state=this._ctx.invokingState,this._ctx=this._ctx.parentCtx},n.prototype.enterOuterAlt=function(e,t){e.setAltNumber(t),this.buildParseTrees&&this._ctx!==e&&null!==this._ctx.parentCtx&&(this._ctx.parentCtx.removeLastChild(),this._ctx.parentCtx.addChild(e)),this._ctx=e},n.prototype.getPrecedence=function(){return 0===this._precedenceStack.length?-1:this._precedenceStack[this._precedenceStack.length-1]},n.prototype.enterRecursionRule=function(e,t,o,r){this.state=t,this._precedenceStack.push(r),this._ctx=e,this._ctx.start=this._input.LT(1),null!==this._parseListeners&&this.triggerEnterRuleEvent()},n.prototype.pushNewRecursionContext=function(e,t){var o=this._ctx;o.parentCtx=e,o.invokingState=t,o.stop=this._input.LT(-1),this._ctx=e,this._ctx.start=o.start,this.buildParseTrees&&this._ctx.addChild(o),null!==this._parseListeners&&this.triggerEnterRuleEvent()},n.prototype.unrollRecursionContexts=function(e){this._precedenceStack.pop(),this._ctx.stop=this._input.LT(-1);var t=this._ctx;if(null!==this._parseListeners)for(;this._ctx!==e;)this.triggerExitRuleEvent(),this._ctx=this._ctx.parentCtx;else this._ctx=e;t.parentCtx=e,this.buildParseTrees&&null!==e&&e.addChild(t)},n.prototype.getInvokingContext=function(e){for(var t=this._ctx;null!==t;){if(t.ruleIndex===e)return t;t=t.parentCtx}return null},n.prototype.precpred=function(e,t){return t>=this._precedenceStack[this._precedenceStack.length-1]},n.prototype.inContext=function(){return!1},n.prototype.isExpectedToken=function(e){var t=this._interp.atn,o=this._ctx,r=t.states[this.state],n=t.nextTokens(r);if(n.contains(e))return!0;if(!n.contains(p.EPSILON))return!1;for(;null!==o&&0<=o.invokingState&&n.contains(p.EPSILON);){var a=t.states[o.invokingState],i=a.transitions[0];if(n=t.nextTokens(i.followState),n.contains(e))return!0;o=o.parentCtx}return!!(n.contains(p.EPSILON)&&e===p.EOF)},n.prototype.getExpectedTokens=function(){return this._interp.atn.getExpectedTokens(this.state,this._ctx)},n.prototype.getExpectedTokensWithinCurrentRule=function(){var e=this._interp.atn,t=e.states[this.state];return e.nextTokens(t)},n.prototype.getRuleIndex=function(e){var t=this.getRuleIndexMap()[e];return null===t?-1:t},n.prototype.getRuleInvocationStack=function(e){e=e||null,null===e&&(e=this._ctx);for(var t=[];null!==e;){var o=e.ruleIndex;0>o?t.push("n/a"):t.push(this.ruleNames[o]),e=e.parentCtx}return t},n.prototype.getDFAStrings=function(){return this._interp.decisionToDFA.toString()},n.prototype.dumpDFA=function(){for(var e=!1,t=0,o;t<this._interp.decisionToDFA.length;t++)o=this._interp.decisionToDFA[t],0<o.states.length&&(e&&console.log(),this.printer.println("Decision "+o.decision+":"),this.printer.print(o.toString(this.literalNames,this.symbolicNames)),e=!0)},n.prototype.getSourceName=function(){return this._input.sourceName},n.prototype.setTrace=function(e){e?(null!==this._tracer&&this.removeParseListener(this._tracer),this._tracer=new r(this),this.addParseListener(this._tracer)):(this.removeParseListener(this._tracer),this._tracer=null)},o.Parser=n},{"./Lexer":16,"./Recognizer":20,"./Token":22,"./atn/ATNDeserializationOptions":27,"./atn/ATNDeserializer":28,"./error/ErrorStrategy":46,"./tree/Tree":52}],18:[function(e,t,o){function r(e,t){e=e||null,t=t||null,p.call(this,e,t),this.ruleIndex=-1,this.children=null,this.start=null,this.stop=null,this.exception=null}function n(e,t,o){return r.call(e,t),this.ruleIndex=o,this}var p=e("./RuleContext").RuleContext,a=e("./tree/Tree"),i=a.INVALID_INTERVAL,s=a.TerminalNode,d=a.TerminalNodeImpl,c=a.ErrorNodeImpl,l=e("./IntervalSet").Interval;r.prototype=Object.create(p.prototype),r.prototype.constructor=r,r.prototype.copyFrom=function(e){this.parentCtx=e.parentCtx,this.invokingState=e.invokingState,this.children=null,this.start=e.start,this.stop=e.stop,e.children&&(this.children=[],e.children.map(function(e){e instanceof c&&(this.children.push(e),e.parentCtx=this)},this))},r.prototype.enterRule=function(){},r.prototype.exitRule=function(){},r.prototype.addChild=function(e){return null===this.children&&(this.children=[]),this.children.push(e),e},r.prototype.removeLastChild=function(){null!==this.children&&this.children.pop()},r.prototype.addTokenNode=function(e){var t=new d(e);return this.addChild(t),t.parentCtx=this,t},r.prototype.addErrorNode=function(e){var t=new c(e);return this.addChild(t),t.parentCtx=this,t},r.prototype.getChild=function(e,t){if(t=t||null,null===this.children||0>e||e>=this.children.length)return null;if(null===t)return this.children[e];for(var o=0,r;o<this.children.length;o++)if(r=this.children[o],r instanceof t){if(0===e)return r;e-=1}return null},r.prototype.getToken=function(e,t){if(null===this.children||0>t||t>=this.children.length)return null;for(var o=0,r;o<this.children.length;o++)if(r=this.children[o],r instanceof s&&r.symbol.type===e){if(0===t)return r;t-=1}return null},r.prototype.getTokens=function(e){if(null===this.children)return[];for(var t=[],o=0,r;o<this.children.length;o++)r=this.children[o],r instanceof s&&r.symbol.type===e&&t.push(r);return t},r.prototype.getTypedRuleContext=function(e,t){return this.getChild(t,e)},r.prototype.getTypedRuleContexts=function(e){if(null===this.children)return[];for(var t=[],o=0,r;o<this.children.length;o++)r=this.children[o],r instanceof e&&t.push(r);return t},r.prototype.getChildCount=function(){return null===this.children?0:this.children.length},r.prototype.getSourceInterval=function(){return null===this.start||null===this.stop?i:new l(this.start.tokenIndex,this.stop.tokenIndex)},p.EMPTY=new r,n.prototype=Object.create(r.prototype),n.prototype.constructor=n,o.ParserRuleContext=r},{"./IntervalSet":14,"./RuleContext":21,"./tree/Tree":52}],19:[function(e,t,o){function r(e){this.cachedHashCode=e}function n(){return this.cache={},this}function p(e,t){var o=0;if(null!==e){var n=new x;n.update(e,t),o=n.finish()}r.call(this,o),this.parentCtx=e,this.returnState=t}function i(){return p.call(this,null,r.EMPTY_RETURN_STATE),this}function s(e,t){var o=new x;o.update(e,t);var n=o.finish();return r.call(this,n),this.parents=e,this.returnStates=t,this}function a(e,t){if((void 0===t||null===t)&&(t=T.EMPTY),null===t.parentCtx||t===T.EMPTY)return r.EMPTY;var o=a(e,t.parentCtx),n=e.states[t.invokingState],i=n.transitions[0];return p.create(o,i.followState.stateNumber)}function d(e,t,o,r){if(e===t)return e;if(e instanceof p&&t instanceof p)return c(e,t,o,r);if(o){if(e instanceof i)return e;if(t instanceof i)return t}return e instanceof p&&(e=new s([e.getParent()],[e.returnState])),t instanceof p&&(t=new s([t.getParent()],[t.returnState])),u(e,t,o,r)}function c(e,t,o,r){if(null!==r){var n=r.get(e,t);if(null!==n)return n;if(n=r.get(t,e),null!==n)return n}var a=l(e,t,o);if(null!==a)return null!==r&&r.set(e,t,a),a;if(e.returnState===t.returnState){var i=d(e.parentCtx,t.parentCtx,o,r);if(i===e.parentCtx)return e;if(i===t.parentCtx)return t;var c=p.create(i,e.returnState);return null!==r&&r.set(e,t,c),c}var u=null;if((e===t||null!==e.parentCtx&&e.parentCtx===t.parentCtx)&&(u=e.parentCtx),null!==u){var y=[e.returnState,t.returnState];e.returnState>t.returnState&&(y[0]=t.returnState,y[1]=e.returnState);var g=[u,u],T=new s(g,y);return null!==r&&r.set(e,t,T),T}var y=[e.returnState,t.returnState],g=[e.parentCtx,t.parentCtx];e.returnState>t.returnState&&(y[0]=t.returnState,y[1]=e.returnState,g=[t.parentCtx,e.parentCtx]);var x=new s(g,y);return null!==r&&r.set(e,t,x),x}function l(e,t,o){if(o){if(e===r.EMPTY)return r.EMPTY;if(t===r.EMPTY)return r.EMPTY}else{if(e===r.EMPTY&&t===r.EMPTY)return r.EMPTY;if(e===r.EMPTY){var n=[t.returnState,r.EMPTY_RETURN_STATE],p=[t.parentCtx,null];return new s(p,n)}if(t===r.EMPTY){var n=[e.returnState,r.EMPTY_RETURN_STATE],p=[e.parentCtx,null];return new s(p,n)}}return null}function u(e,t,o,n){if(null!==n){var a=n.get(e,t);if(null!==a)return a;if(a=n.get(t,e),null!==a)return a}for(var c=0,i=0,l=0,u=[],g=[];c<e.returnStates.length&&i<t.returnStates.length;){var T=e.parents[c],x=t.parents[i];if(e.returnStates[c]===t.returnStates[i]){var m=e.returnStates[c],_=m===r.EMPTY_RETURN_STATE&&null===T&&null===x;if(_||null!==T&&null!==x&&T===x)g[l]=T,u[l]=m;else{var S=d(T,x,o,n);g[l]=S,u[l]=m}c+=1,i+=1}else e.returnStates[c]<t.returnStates[i]?(g[l]=T,u[l]=e.returnStates[c],c+=1):(g[l]=x,u[l]=t.returnStates[i],i+=1);l+=1}if(c<e.returnStates.length)for(var f=c;f<e.returnStates.length;f++)g[l]=e.parents[f],u[l]=e.returnStates[f],l+=1;else for(var f=i;f<t.returnStates.length;f++)g[l]=t.parents[f],u[l]=t.returnStates[f],l+=1;if(l<g.length){if(1==l){var h=p.create(g[0],u[0]);return null!==n&&n.set(e,t,h),h}g=g.slice(0,l),u=u.slice(0,l)}var E=new s(g,u);return E===e?(null!==n&&n.set(e,t,e),e):E===t?(null!==n&&n.set(e,t,t),t):(y(g),null!==n&&n.set(e,t,E),E)}function y(e){for(var t={},o=0,r;o<e.length;o++)r=e[o],r in t||(t[r]=r);for(var n=0;n<e.length;n++)e[n]=t[e[n]]}function g(e,t,o){if(e.isEmpty())return e;var n=o[e]||null;if(null!==n)return n;if(n=t.get(e),null!==n)return o[e]=n,n;for(var a=!1,d=[],c=0,i;c<d.length;c++)if(i=g(e.getParent(c),t,o),a||i!==e.getParent(c)){if(!a){d=[];for(var l=0;l<e.length;l++)d[l]=e.getParent(l);a=!0}d[c]=i}if(!a)return t.add(e),o[e]=e,e;var u=null;return u=0===d.length?r.EMPTY:1===d.length?p.create(d[0],e.getReturnState(0)):new s(d,e.returnStates),t.add(u),o[u]=u,o[e]=u,u}var T=e("./RuleContext").RuleContext,x=e("./Utils").Hash;r.EMPTY=null,r.EMPTY_RETURN_STATE=2147483647,r.globalNodeCount=1,r.id=r.globalNodeCount,r.prototype.isEmpty=function(){return this===r.EMPTY},r.prototype.hasEmptyPath=function(){return this.getReturnState(this.length-1)===r.EMPTY_RETURN_STATE},r.prototype.hashCode=function(){return this.cachedHashCode},r.prototype.updateHashCode=function(e){e.update(this.cachedHashCode)},n.prototype.add=function(e){if(e===r.EMPTY)return r.EMPTY;var t=this.cache[e]||null;return null===t?(this.cache[e]=e,e):t},n.prototype.get=function(e){return this.cache[e]||null},Object.defineProperty(n.prototype,"length",{get:function(){return this.cache.length}}),p.prototype=Object.create(r.prototype),p.prototype.contructor=p,p.create=function(e,t){return t===r.EMPTY_RETURN_STATE&&null===e?r.EMPTY:new p(e,t)},Object.defineProperty(p.prototype,"length",{get:function(){return 1}}),p.prototype.getParent=function(){return this.parentCtx},p.prototype.getReturnState=function(){return this.returnState},p.prototype.equals=function(e){return!(this!==e)||!!(e instanceof p)&&this.hashCode()===e.hashCode()&&this.returnState===e.returnState&&(null==this.parentCtx?null==e.parentCtx:this.parentCtx.equals(e.parentCtx))},p.prototype.toString=function(){var e=null===this.parentCtx?"":this.parentCtx.toString();return 0===e.length?this.returnState===r.EMPTY_RETURN_STATE?"$":""+this.returnState:""+this.returnState+" "+e},i.prototype=Object.create(p.prototype),i.prototype.constructor=i,i.prototype.isEmpty=function(){return!0},i.prototype.getParent=function(){return null},i.prototype.getReturnState=function(){return this.returnState},i.prototype.equals=function(e){return this===e},i.prototype.toString=function(){return"$"},r.EMPTY=new i,s.prototype=Object.create(r.prototype),s.prototype.constructor=s,s.prototype.isEmpty=function(){return this.returnStates[0]===r.EMPTY_RETURN_STATE},Object.defineProperty(s.prototype,"length",{get:function(){return this.returnStates.length}}),s.prototype.getParent=function(e){return this.parents[e]},s.prototype.getReturnState=function(e){return this.returnStates[e]},s.prototype.equals=function(e){return!(this!==e)||!!(e instanceof s)&&this.hashCode()===e.hashCode()&&this.returnStates===e.returnStates&&this.parents===e.parents},s.prototype.toString=function(){if(this.isEmpty())return"[]";for(var e="[",t=0;t<this.returnStates.length;t++){if(0<t&&(e+=", "),this.returnStates[t]===r.EMPTY_RETURN_STATE){e+="$";continue}e+=this.returnStates[t],null===this.parents[t]?e+="null":e=e+" "+this.parents[t]}return e+"]"},o.merge=d,o.PredictionContext=r,o.PredictionContextCache=n,o.SingletonPredictionContext=p,o.predictionContextFromRuleContext=a,o.getCachedPredictionContext=g},{"./RuleContext":21,"./Utils":23}],20:[function(e,t,o){function r(){return this._listeners=[p.INSTANCE],this._interp=null,this._stateNumber=-1,this}var n=e("./Token").Token,p=e("./error/ErrorListener").ConsoleErrorListener,a=e("./error/ErrorListener").ProxyErrorListener;r.tokenTypeMapCache={},r.ruleIndexMapCache={},r.prototype.checkVersion=function(e){var t="4.7.1";t!==e&&console.log("ANTLR runtime and generated code versions disagree: "+t+"!="+e)},r.prototype.addErrorListener=function(e){this._listeners.push(e)},r.prototype.removeErrorListeners=function(){this._listeners=[]},r.prototype.getTokenTypeMap=function(){var e=this.getTokenNames();if(null===e)throw"The current recognizer does not provide a list of token names.";var t=this.tokenTypeMapCache[e];return void 0===t&&(t=e.reduce(function(e,t,o){e[t]=o}),t.EOF=n.EOF,this.tokenTypeMapCache[e]=t),t},r.prototype.getRuleIndexMap=function(){var e=this.ruleNames;if(null===e)throw"The current recognizer does not provide a list of rule names.";var t=this.ruleIndexMapCache[e];return void 0===t&&(t=e.reduce(function(e,t,o){e[t]=o}),this.ruleIndexMapCache[e]=t),t},r.prototype.getTokenType=function(e){var t=this.getTokenTypeMap()[e];return void 0===t?n.INVALID_TYPE:t},r.prototype.getErrorHeader=function(t){var e=t.getOffendingToken().line,o=t.getOffendingToken().column;return"line "+e+":"+o},r.prototype.getTokenErrorDisplay=function(e){if(null===e)return"<no token>";var t=e.text;return null===t&&(e.type===n.EOF?t="<EOF>":t="<"+e.type+">"),t=t.replace("\n","\\n").replace("\r","\\r").replace("\t","\\t"),"'"+t+"'"},r.prototype.getErrorListenerDispatch=function(){return new a(this._listeners)},r.prototype.sempred=function(){return!0},r.prototype.precpred=function(){return!0},Object.defineProperty(r.prototype,"state",{get:function(){return this._stateNumber},set:function(e){this._stateNumber=e}}),o.Recognizer=r},{"./Token":22,"./error/ErrorListener":45}],21:[function(e,t,o){function r(e,t){return n.call(this),this.parentCtx=e||null,this.invokingState=t||-1,this}var n=e("./tree/Tree").RuleNode,p=e("./tree/Tree").INVALID_INTERVAL,a=e("./atn/ATN").INVALID_ALT_NUMBER;r.prototype=Object.create(n.prototype),r.prototype.constructor=r,r.prototype.depth=function(){for(var e=0,t=this;null!==t;)t=t.parentCtx,e+=1;return e},r.prototype.isEmpty=function(){return-1===this.invokingState},r.prototype.getSourceInterval=function(){return p},r.prototype.getRuleContext=function(){return this},r.prototype.getPayload=function(){return this},r.prototype.getText=function(){return 0===this.getChildCount()?"":this.children.map(function(e){return e.getText()}).join("")},r.prototype.getAltNumber=function(){return a},r.prototype.setAltNumber=function(){},r.prototype.getChild=function(){return null},r.prototype.getChildCount=function(){return 0},r.prototype.accept=function(e){return e.visitChildren(this)},o.RuleContext=r;var i=e("./tree/Trees").Trees;r.prototype.toStringTree=function(e,t){return i.toStringTree(this,e,t)},r.prototype.toString=function(e,t){e=e||null,t=t||null;for(var o=this,r="[";null!==o&&o!==t;){if(null===e)o.isEmpty()||(r+=o.invokingState);else{var n=o.ruleIndex,p=0<=n&&n<e.length?e[n]:""+n;r+=p}null===o.parentCtx||null===e&&o.parentCtx.isEmpty()||(r+=" "),o=o.parentCtx}return r+="]",r}},{"./atn/ATN":24,"./tree/Tree":52,"./tree/Trees":53}],22:[function(e,t,o){function r(){return this.source=null,this.type=null,this.channel=null,this.start=null,this.stop=null,this.tokenIndex=null,this.line=null,this.column=null,this._text=null,this}function n(e,t,o,p,a){return r.call(this),this.source=void 0===e?n.EMPTY_SOURCE:e,this.type=void 0===t?null:t,this.channel=void 0===o?r.DEFAULT_CHANNEL:o,this.start=void 0===p?-1:p,this.stop=void 0===a?-1:a,this.tokenIndex=-1,null===this.source[0]?this.column=-1:(this.line=e[0].line,this.column=e[0].column),this}r.INVALID_TYPE=0,r.EPSILON=-2,r.MIN_USER_TOKEN_TYPE=1,r.EOF=-1,r.DEFAULT_CHANNEL=0,r.HIDDEN_CHANNEL=1,Object.defineProperty(r.prototype,"text",{get:function(){return this._text},set:function(e){this._text=e}}),r.prototype.getTokenSource=function(){return this.source[0]},r.prototype.getInputStream=function(){return this.source[1]},n.prototype=Object.create(r.prototype),n.prototype.constructor=n,n.EMPTY_SOURCE=[null,null],n.prototype.clone=function(){var e=new n(this.source,this.type,this.channel,this.start,this.stop);return e.tokenIndex=this.tokenIndex,e.line=this.line,e.column=this.column,e.text=this.text,e},Object.defineProperty(n.prototype,"text",{get:function(){if(null!==this._text)return this._text;var e=this.getInputStream();if(null===e)return null;var t=e.size;return this.start<t&&this.stop<t?e.getText(this.start,this.stop):"<EOF>"},set:function(e){this._text=e}}),n.prototype.toString=function(){var e=this.text;return e=null===e?"<no text>":e.replace(/\n/g,"\\n").replace(/\r/g,"\\r").replace(/\t/g,"\\t"),"[@"+this.tokenIndex+","+this.start+":"+this.stop+"='"+e+"',<"+this.type+">"+(0<this.channel?",channel="+this.channel:"")+","+this.line+":"+this.column+"]"},o.Token=r,o.CommonToken=n},{}],23:[function(e,t,o){function r(e){return"["+e.join(", ")+"]"}function n(e,t){return e.equals(t)}function p(e){return e.hashCode()}function a(e,t){return this.data={},this.hashFunction=e||p,this.equalsFunction=t||n,this}function i(){return this.data=[],this}function s(e,t){return this.data={},this.hashFunction=e||p,this.equalsFunction=t||n,this}function d(){return this.data={},this}function c(){return this}function l(){return this.count=0,this.hash=0,this}var u=String.prototype;u.seed=u.seed||Math.round(4294967296*Math.random()),u.hashCode=function(){var e=this.toString(),t,o,r,n,p,a,s,d;for(t=3&e.length,o=e.length-t,r=u.seed,p=3432918353,a=461845907,d=0;d<o;)s=255&e.charCodeAt(d)|(255&e.charCodeAt(++d))<<8|(255&e.charCodeAt(++d))<<16|(255&e.charCodeAt(++d))<<24,++d,s=4294967295&(65535&s)*p+((65535&(s>>>16)*p)<<16),s=s<<15|s>>>17,s=4294967295&(65535&s)*a+((65535&(s>>>16)*a)<<16),r^=s,r=r<<13|r>>>19,n=4294967295&5*(65535&r)+((65535&5*(r>>>16))<<16),r=(65535&n)+27492+((65535&(n>>>16)+58964)<<16);switch(s=0,t){case 3:s^=(255&e.charCodeAt(d+2))<<16;case 2:s^=(255&e.charCodeAt(d+1))<<8;case 1:s^=255&e.charCodeAt(d),s=4294967295&(65535&s)*p+((65535&(s>>>16)*p)<<16),s=s<<15|s>>>17,s=4294967295&(65535&s)*a+((65535&(s>>>16)*a)<<16),r^=s;}return r^=e.length,r^=r>>>16,r=4294967295&2246822507*(65535&r)+((65535&2246822507*(r>>>16))<<16),r^=r>>>13,r=4294967295&3266489909*(65535&r)+((65535&3266489909*(r>>>16))<<16),r^=r>>>16,r>>>0},Object.defineProperty(a.prototype,"length",{get:function(){var e=0;for(var t in this.data)0===t.indexOf("hash_")&&(e+=this.data[t].length);return e}}),a.prototype.add=function(e){var t=this.hashFunction(e),o="hash_"+t;if(o in this.data){for(var r=this.data[o],n=0;n<r.length;n++)if(this.equalsFunction(e,r[n]))return r[n];return r.push(e),e}return this.data[o]=[e],e},a.prototype.contains=function(e){return null!=this.get(e)},a.prototype.get=function(e){var t=this.hashFunction(e),o="hash_"+t;if(o in this.data)for(var r=this.data[o],n=0;n<r.length;n++)if(this.equalsFunction(e,r[n]))return r[n];return null},a.prototype.values=function(){var e=[];for(var t in this.data)0===t.indexOf("hash_")&&(e=e.concat(this.data[t]));return e},a.prototype.toString=function(){return r(this.values())},i.prototype.add=function(e){this.data[e]=!0},i.prototype.or=function(e){var t=this;Object.keys(e.data).map(function(e){t.add(e)})},i.prototype.remove=function(e){delete this.data[e]},i.prototype.contains=function(e){return!0===this.data[e]},i.prototype.values=function(){return Object.keys(this.data)},i.prototype.minValue=function(){return Math.min.apply(null,this.values())},i.prototype.hashCode=function(){var e=new l;return e.update(this.values()),e.finish()},i.prototype.equals=function(e){return!!(e instanceof i)&&this.hashCode()===e.hashCode()},Object.defineProperty(i.prototype,"length",{get:function(){return this.values().length}}),i.prototype.toString=function(){return"{"+this.values().join(", ")+"}"},Object.defineProperty(s.prototype,"length",{get:function(){var e=0;for(var t in this.data)0===t.indexOf("hash_")&&(e+=this.data[t].length);return e}}),s.prototype.put=function(e,t){var o="hash_"+this.hashFunction(e);if(o in this.data){for(var r=this.data[o],n=0,p;n<r.length;n++)if(p=r[n],this.equalsFunction(e,p.key)){var a=p.value;return p.value=t,a}return r.push({key:e,value:t}),t}return this.data[o]=[{key:e,value:t}],t},s.prototype.containsKey=function(e){var t="hash_"+this.hashFunction(e);if(t in this.data)for(var o=this.data[t],r=0,n;r<o.length;r++)if(n=o[r],this.equalsFunction(e,n.key))return!0;return!1},s.prototype.get=function(e){var t="hash_"+this.hashFunction(e);if(t in this.data)for(var o=this.data[t],r=0,n;r<o.length;r++)if(n=o[r],this.equalsFunction(e,n.key))return n.value;return null},s.prototype.entries=function(){var e=[];for(var t in this.data)0===t.indexOf("hash_")&&(e=e.concat(this.data[t]));return e},s.prototype.getKeys=function(){return this.entries().map(function(t){return t.key})},s.prototype.getValues=function(){return this.entries().map(function(t){return t.value})},s.prototype.toString=function(){var e=this.entries().map(function(e){return"{"+e.key+":"+e.value+"}"});return"["+e.join(", ")+"]"},d.prototype.get=function(e){return e="k-"+e,e in this.data?this.data[e]:null},d.prototype.put=function(e,t){e="k-"+e,this.data[e]=t},d.prototype.values=function(){var e=this.data,t=Object.keys(this.data);return t.map(function(t){return e[t]})},l.prototype.update=function(){for(var e=0,t;e<arguments.length;e++)if(t=arguments[e],null!=t)if(Array.isArray(t))this.update.apply(t);else{var o=0;switch(typeof t){case"undefined":case"function":continue;case"number":case"boolean":o=t;break;case"string":o=t.hashCode();break;default:t.updateHashCode(this);continue;}o*=3432918353,o=o<<15|o>>>17,o*=461845907,++this.count;var r=this.hash^o;r=r<<13|r>>>19,r=5*r+3864292196,this.hash=r}},l.prototype.finish=function(){var e=this.hash^4*this.count;return e^=e>>>16,e*=2246822507,e^=e>>>13,e*=3266489909,e^=e>>>16,e},c.prototype.get=function(e,t){var o=this[e]||null;return null===o?null:o[t]||null},c.prototype.set=function(e,t,r){var o=this[e]||null;null===o&&(o={},this[e]=o),o[t]=r};o.Hash=l,o.Set=a,o.Map=s,o.BitSet=i,o.AltDict=d,o.DoubleDict=c,o.hashStuff=function(){var e=new l;return e.update.apply(arguments),e.finish()},o.escapeWhitespace=function(e,t){return e=e.replace(/\t/g,"\\t").replace(/\n/g,"\\n").replace(/\r/g,"\\r"),t&&(e=e.replace(/ /g,"\xB7")),e},o.arrayToString=r,o.titleCase=function(e){return e.replace(/\w\S*/g,function(e){return e.charAt(0).toUpperCase()+e.substr(1)})},o.equalArrays=function(e,t){if(!Array.isArray(e)||!Array.isArray(t))return!1;if(e==t)return!0;if(e.length!=t.length)return!1;for(var o=0;o<e.length;o++)if(e[o]!=t[o]&&!e[o].equals(t[o]))return!1;return!0}},{}],24:[function(e,t,o){function r(e,t){return this.grammarType=e,this.maxTokenType=t,this.states=[],this.decisionToState=[],this.ruleToStartState=[],this.ruleToStopState=null,this.modeNameToStartState={},this.ruleToTokenType=null,this.lexerActions=null,this.modeToStartState=[],this}var n=e("./../LL1Analyzer").LL1Analyzer,p=e("./../IntervalSet").IntervalSet;r.prototype.nextTokensInContext=function(e,t){var o=new n(this);return o.LOOK(e,null,t)},r.prototype.nextTokensNoContext=function(e){return null===e.nextTokenWithinRule?(e.nextTokenWithinRule=this.nextTokensInContext(e,null),e.nextTokenWithinRule.readOnly=!0,e.nextTokenWithinRule):e.nextTokenWithinRule},r.prototype.nextTokens=function(e,t){return void 0===t?this.nextTokensNoContext(e):this.nextTokensInContext(e,t)},r.prototype.addState=function(e){null!==e&&(e.atn=this,e.stateNumber=this.states.length),this.states.push(e)},r.prototype.removeState=function(e){this.states[e.stateNumber]=null},r.prototype.defineDecisionState=function(e){return this.decisionToState.push(e),e.decision=this.decisionToState.length-1,e.decision},r.prototype.getDecisionState=function(e){return 0===this.decisionToState.length?null:this.decisionToState[e]};var a=e("./../Token").Token;r.prototype.getExpectedTokens=function(e,t){if(0>e||e>=this.states.length)throw"Invalid state number.";var o=this.states[e],r=this.nextTokens(o);if(!r.contains(a.EPSILON))return r;var n=new p;for(n.addSet(r),n.removeOne(a.EPSILON);null!==t&&0<=t.invokingState&&r.contains(a.EPSILON);){var i=this.states[t.invokingState],s=i.transitions[0];r=this.nextTokens(s.followState),n.addSet(r),n.removeOne(a.EPSILON),t=t.parentCtx}return r.contains(a.EPSILON)&&n.addOne(a.EOF),n},r.INVALID_ALT_NUMBER=0,o.ATN=r},{"./../IntervalSet":14,"./../LL1Analyzer":15,"./../Token":22}],25:[function(e,t,o){function r(e,t){if(null===e){var o={state:null,alt:null,context:null,semanticContext:null};return t&&(o.reachesIntoOuterContext=0),o}var r={};return r.state=e.state||null,r.alt=void 0===e.alt?null:e.alt,r.context=e.context||null,r.semanticContext=e.semanticContext||null,t&&(r.reachesIntoOuterContext=e.reachesIntoOuterContext||0,r.precedenceFilterSuppressed=e.precedenceFilterSuppressed||!1),r}function n(e,t){return this.checkContext(e,t),e=r(e),t=r(t,!0),this.state=null===e.state?t.state:e.state,this.alt=null===e.alt?t.alt:e.alt,this.context=null===e.context?t.context:e.context,this.semanticContext=null===e.semanticContext?null===t.semanticContext?i.NONE:t.semanticContext:e.semanticContext,this.reachesIntoOuterContext=t.reachesIntoOuterContext,this.precedenceFilterSuppressed=t.precedenceFilterSuppressed,this}function p(e,t){n.call(this,e,t);var o=e.lexerActionExecutor||null;return this.lexerActionExecutor=o||(null===t?null:t.lexerActionExecutor),this.passedThroughNonGreedyDecision=null!==t&&this.checkNonGreedyDecision(t,this.state),this}var a=e("./ATNState").DecisionState,i=e("./SemanticContext").SemanticContext,s=e("../Utils").Hash;n.prototype.checkContext=function(e,t){(null===e.context||e.context===void 0)&&(null===t||null===t.context||t.context===void 0)&&(this.context=null)},n.prototype.hashCode=function(){var e=new s;return this.updateHashCode(e),e.finish()},n.prototype.updateHashCode=function(e){e.update(this.state.stateNumber,this.alt,this.context,this.semanticContext)},n.prototype.equals=function(e){return!(this!==e)||!!(e instanceof n)&&this.state.stateNumber===e.state.stateNumber&&this.alt===e.alt&&(null===this.context?null===e.context:this.context.equals(e.context))&&this.semanticContext.equals(e.semanticContext)&&this.precedenceFilterSuppressed===e.precedenceFilterSuppressed},n.prototype.hashCodeForConfigSet=function(){var e=new s;return e.update(this.state.stateNumber,this.alt,this.semanticContext),e.finish()},n.prototype.equalsForConfigSet=function(e){return!(this!==e)||!!(e instanceof n)&&this.state.stateNumber===e.state.stateNumber&&this.alt===e.alt&&this.semanticContext.equals(e.semanticContext)},n.prototype.toString=function(){return"("+this.state+","+this.alt+(null===this.context?"":",["+this.context.toString()+"]")+(this.semanticContext===i.NONE?"":","+this.semanticContext.toString())+(0<this.reachesIntoOuterContext?",up="+this.reachesIntoOuterContext:"")+")"},p.prototype=Object.create(n.prototype),p.prototype.constructor=p,p.prototype.updateHashCode=function(e){e.update(this.state.stateNumber,this.alt,this.context,this.semanticContext,this.passedThroughNonGreedyDecision,this.lexerActionExecutor)},p.prototype.equals=function(e){return this===e||e instanceof p&&this.passedThroughNonGreedyDecision==e.passedThroughNonGreedyDecision&&(this.lexerActionExecutor?this.lexerActionExecutor.equals(e.lexerActionExecutor):!e.lexerActionExecutor)&&n.prototype.equals.call(this,e)},p.prototype.hashCodeForConfigSet=p.prototype.hashCode,p.prototype.equalsForConfigSet=p.prototype.equals,p.prototype.checkNonGreedyDecision=function(e,t){return e.passedThroughNonGreedyDecision||t instanceof a&&t.nonGreedy},o.ATNConfig=n,o.LexerATNConfig=p},{"../Utils":23,"./ATNState":30,"./SemanticContext":37}],26:[function(e,t,o){function r(e){return e.hashCodeForConfigSet()}function n(e,t){return!(e!==t)||null!==e&&null!==t&&e.equalsForConfigSet(t)}function p(e){return this.configLookup=new c(r,n),this.fullCtx=void 0===e||e,this.readOnly=!1,this.configs=[],this.uniqueAlt=0,this.conflictingAlts=null,this.hasSemanticContext=!1,this.dipsIntoOuterContext=!1,this.cachedHashCode=-1,this}function a(){return p.call(this),this.configLookup=new c,this}var i=e("./ATN").ATN,s=e("./../Utils"),d=s.Hash,c=s.Set,l=e("./SemanticContext").SemanticContext,u=e("./../PredictionContext").merge;p.prototype.add=function(e,t){if(void 0===t&&(t=null),this.readOnly)throw"This set is readonly";e.semanticContext!==l.NONE&&(this.hasSemanticContext=!0),0<e.reachesIntoOuterContext&&(this.dipsIntoOuterContext=!0);var o=this.configLookup.add(e);if(o===e)return this.cachedHashCode=-1,this.configs.push(e),!0;var r=!this.fullCtx,n=u(o.context,e.context,r,t);return o.reachesIntoOuterContext=Math.max(o.reachesIntoOuterContext,e.reachesIntoOuterContext),e.precedenceFilterSuppressed&&(o.precedenceFilterSuppressed=!0),o.context=n,!0},p.prototype.getStates=function(){for(var e=new c,t=0;t<this.configs.length;t++)e.add(this.configs[t].state);return e},p.prototype.getPredicates=function(){for(var e=[],t=0,o;t<this.configs.length;t++)o=this.configs[t].semanticContext,o!==l.NONE&&e.push(o.semanticContext);return e},Object.defineProperty(p.prototype,"items",{get:function(){return this.configs}}),p.prototype.optimizeConfigs=function(e){if(this.readOnly)throw"This set is readonly";if(0!==this.configLookup.length)for(var t=0,o;t<this.configs.length;t++)o=this.configs[t],o.context=e.getCachedContext(o.context)},p.prototype.addAll=function(e){for(var t=0;t<e.length;t++)this.add(e[t]);return!1},p.prototype.equals=function(e){return this===e||e instanceof p&&s.equalArrays(this.configs,e.configs)&&this.fullCtx===e.fullCtx&&this.uniqueAlt===e.uniqueAlt&&this.conflictingAlts===e.conflictingAlts&&this.hasSemanticContext===e.hasSemanticContext&&this.dipsIntoOuterContext===e.dipsIntoOuterContext},p.prototype.hashCode=function(){var e=new d;return this.updateHashCode(e),e.finish()},p.prototype.updateHashCode=function(e){if(this.readOnly){if(-1===this.cachedHashCode){var e=new d;e.update(this.configs),this.cachedHashCode=e.finish()}e.update(this.cachedHashCode)}else e.update(this.configs)},Object.defineProperty(p.prototype,"length",{get:function(){return this.configs.length}}),p.prototype.isEmpty=function(){return 0===this.configs.length},p.prototype.contains=function(e){if(null===this.configLookup)throw"This method is not implemented for readonly sets.";return this.configLookup.contains(e)},p.prototype.containsFast=function(e){if(null===this.configLookup)throw"This method is not implemented for readonly sets.";return this.configLookup.containsFast(e)},p.prototype.clear=function(){if(this.readOnly)throw"This set is readonly";this.configs=[],this.cachedHashCode=-1,this.configLookup=new c},p.prototype.setReadonly=function(e){this.readOnly=e,e&&(this.configLookup=null)},p.prototype.toString=function(){return s.arrayToString(this.configs)+(this.hasSemanticContext?",hasSemanticContext="+this.hasSemanticContext:"")+(this.uniqueAlt===i.INVALID_ALT_NUMBER?"":",uniqueAlt="+this.uniqueAlt)+(null===this.conflictingAlts?"":",conflictingAlts="+this.conflictingAlts)+(this.dipsIntoOuterContext?",dipsIntoOuterContext":"")},a.prototype=Object.create(p.prototype),a.prototype.constructor=a,o.ATNConfigSet=p,o.OrderedATNConfigSet=a},{"./../PredictionContext":19,"./../Utils":23,"./ATN":24,"./SemanticContext":37}],27:[function(e,t,o){function r(e){return void 0===e&&(e=null),this.readOnly=!1,this.verifyATN=null===e||e.verifyATN,this.generateRuleBypassTransitions=null!==e&&e.generateRuleBypassTransitions,this}r.defaultOptions=new r,r.defaultOptions.readOnly=!0,o.ATNDeserializationOptions=r},{}],28:[function(e,t,o){function r(e,t){var o=[];return o[e-1]=t,o.map(function(){return t})}function n(e){return(void 0===e||null===e)&&(e=B.defaultOptions),this.deserializationOptions=e,this.stateFactories=null,this.actionFactories=null,this}var p=e("./../Token").Token,a=e("./ATN").ATN,d=e("./ATNType").ATNType,i=e("./ATNState"),c=i.ATNState,s=i.BasicState,l=i.DecisionState,u=i.BlockStartState,y=i.BlockEndState,g=i.LoopEndState,T=i.RuleStartState,x=i.RuleStopState,m=i.TokensStartState,_=i.PlusLoopbackState,S=i.StarLoopbackState,f=i.StarLoopEntryState,h=i.PlusBlockStartState,E=i.StarBlockStartState,A=i.BasicBlockStartState,C=e("./Transition"),N=C.Transition,R=C.AtomTransition,L=C.SetTransition,I=C.NotSetTransition,k=C.RuleTransition,P=C.RangeTransition,D=C.ActionTransition,O=C.EpsilonTransition,F=C.WildcardTransition,b=C.PredicateTransition,v=C.PrecedencePredicateTransition,M=e("./../IntervalSet").IntervalSet,U=e("./../IntervalSet").Interval,B=e("./ATNDeserializationOptions").ATNDeserializationOptions,H=e("./LexerAction"),V=H.LexerActionType,z=H.LexerSkipAction,G=H.LexerChannelAction,K=H.LexerCustomAction,q=H.LexerMoreAction,W=H.LexerTypeAction,Y=H.LexerPushModeAction,w=H.LexerPopModeAction,j=H.LexerModeAction,$="59627784-3BE5-417A-B9EB-8131A7286089",X=["AADB8D7E-AEEF-4415-AD2B-8204D6CF042E",$],Q=3,J=$;n.prototype.isFeatureSupported=function(e,t){var o=X.indexOf(e);if(0>o)return!1;var r=X.indexOf(t);return r>=o},n.prototype.deserialize=function(e){this.reset(e),this.checkVersion(),this.checkUUID();var t=this.readATN();this.readStates(t),this.readRules(t),this.readModes(t);var o=[];return this.readSets(t,o,this.readInt.bind(this)),this.isFeatureSupported($,this.uuid)&&this.readSets(t,o,this.readInt32.bind(this)),this.readEdges(t,o),this.readDecisions(t),this.readLexerActions(t),this.markPrecedenceDecisions(t),this.verifyATN(t),this.deserializationOptions.generateRuleBypassTransitions&&t.grammarType===d.PARSER&&(this.generateRuleBypassTransitions(t),this.verifyATN(t)),t},n.prototype.reset=function(e){var t=e.split("").map(function(e){var t=e.charCodeAt(0);return 1<t?t-2:t+65533});t[0]=e.charCodeAt(0),this.data=t,this.pos=0},n.prototype.checkVersion=function(){var e=this.readInt();if(e!==Q)throw"Could not deserialize ATN with version "+e+" (expected "+Q+")."},n.prototype.checkUUID=function(){var e=this.readUUID();if(0>X.indexOf(e))throw"Could not deserialize ATN with UUID: "+e+" (expected "+J+" or a legacy UUID).",e,J;this.uuid=e},n.prototype.readATN=function(){var e=this.readInt(),t=this.readInt();return new a(e,t)},n.prototype.readStates=function(e){for(var t=[],o=[],r=this.readInt(),n=0,p,a,i,d;n<r;n++){if(d=this.readInt(),d===c.INVALID_TYPE){e.addState(null);continue}var l=this.readInt();65535===l&&(l=-1);var y=this.stateFactory(d,l);if(d===c.LOOP_END){var s=this.readInt();t.push([y,s])}else if(y instanceof u){var g=this.readInt();o.push([y,g])}e.addState(y)}for(p=0;p<t.length;p++)a=t[p],a[0].loopBackState=e.states[a[1]];for(p=0;p<o.length;p++)a=o[p],a[0].endState=e.states[a[1]];var T=this.readInt();for(p=0;p<T;p++)i=this.readInt(),e.states[i].nonGreedy=!0;var x=this.readInt();for(p=0;p<x;p++)i=this.readInt(),e.states[i].isPrecedenceRule=!0},n.prototype.readRules=function(e){var t=this.readInt(),o;for(e.grammarType===d.LEXER&&(e.ruleToTokenType=r(t,0)),e.ruleToStartState=r(t,0),o=0;o<t;o++){var n=this.readInt(),a=e.states[n];if(e.ruleToStartState[o]=a,e.grammarType===d.LEXER){var i=this.readInt();65535===i&&(i=p.EOF),e.ruleToTokenType[o]=i}}for(e.ruleToStopState=r(t,0),o=0;o<e.states.length;o++){var s=e.states[o];s instanceof x&&(e.ruleToStopState[s.ruleIndex]=s,e.ruleToStartState[s.ruleIndex].stopState=s)}},n.prototype.readModes=function(e){for(var t=this.readInt(),o=0,r;o<t;o++)r=this.readInt(),e.modeToStartState.push(e.states[r])},n.prototype.readSets=function(e,t,o){for(var r=this.readInt(),p=0,a;p<r;p++){a=new M,t.push(a);var i=this.readInt(),n=this.readInt();0!==n&&a.addOne(-1);for(var s=0;s<i;s++){var d=o(),c=o();a.addRange(d,c)}}},n.prototype.readEdges=function(e,o){var r=this.readInt(),n,p,a,i,s;for(n=0;n<r;n++){var d=this.readInt(),c=this.readInt(),l=this.readInt(),y=this.readInt(),g=this.readInt(),T=this.readInt();i=this.edgeFactory(e,l,d,c,y,g,T,o);var x=e.states[d];x.addTransition(i)}for(n=0;n<e.states.length;n++)for(a=e.states[n],p=0;p<a.transitions.length;p++){var m=a.transitions[p];if(m instanceof k){var t=-1;e.ruleToStartState[m.target.ruleIndex].isPrecedenceRule&&0===m.precedence&&(t=m.target.ruleIndex),i=new O(m.followState,t),e.ruleToStopState[m.target.ruleIndex].addTransition(i)}}for(n=0;n<e.states.length;n++){if(a=e.states[n],a instanceof u){if(null===a.endState)throw"IllegalState";if(null!==a.endState.startState)throw"IllegalState";a.endState.startState=a}if(a instanceof _)for(p=0;p<a.transitions.length;p++)s=a.transitions[p].target,s instanceof h&&(s.loopBackState=a);else if(a instanceof S)for(p=0;p<a.transitions.length;p++)s=a.transitions[p].target,s instanceof f&&(s.loopBackState=a)}},n.prototype.readDecisions=function(e){for(var t=this.readInt(),o=0;o<t;o++){var r=this.readInt(),n=e.states[r];e.decisionToState.push(n),n.decision=o}},n.prototype.readLexerActions=function(e){if(e.grammarType===d.LEXER){var t=this.readInt();e.lexerActions=r(t,null);for(var o=0;o<t;o++){var n=this.readInt(),p=this.readInt();65535===p&&(p=-1);var a=this.readInt();65535===a&&(a=-1);var i=this.lexerActionFactory(n,p,a);e.lexerActions[o]=i}}},n.prototype.generateRuleBypassTransitions=function(e){var t=e.ruleToStartState.length,o;for(o=0;o<t;o++)e.ruleToTokenType[o]=e.maxTokenType+o+1;for(o=0;o<t;o++)this.generateRuleBypassTransition(e,o)},n.prototype.generateRuleBypassTransition=function(e,t){var o=new A,r,n;o.ruleIndex=t,e.addState(o);var p=new y;p.ruleIndex=t,e.addState(p),o.endState=p,e.defineDecisionState(o),p.startState=o;var a=null,i=null;if(e.ruleToStartState[t].isPrecedenceRule){for(i=null,r=0;r<e.states.length;r++)if(n=e.states[r],this.stateIsEndStateFor(n,t)){i=n,a=n.loopBackState.transitions[0];break}if(null===a)throw"Couldn't identify final state of the precedence rule prefix section."}else i=e.ruleToStopState[t];for(r=0;r<e.states.length;r++){n=e.states[r];for(var d=0,c;d<n.transitions.length;d++)(c=n.transitions[d],c!==a)&&c.target===i&&(c.target=p)}for(var l=e.ruleToStartState[t],u=l.transitions.length;0<u;)o.addTransition(l.transitions[u-1]),l.transitions=l.transitions.slice(-1);e.ruleToStartState[t].addTransition(new O(o)),p.addTransition(new O(i));var g=new s;e.addState(g),g.addTransition(new R(p,e.ruleToTokenType[t])),o.addTransition(new O(g))},n.prototype.stateIsEndStateFor=function(e,t){if(e.ruleIndex!==t)return null;if(!(e instanceof f))return null;var o=e.transitions[e.transitions.length-1].target;return o instanceof g?o.epsilonOnlyTransitions&&o.transitions[0].target instanceof x?e:null:null},n.prototype.markPrecedenceDecisions=function(e){for(var t=0,o;t<e.states.length;t++)if((o=e.states[t],!!(o instanceof f))&&e.ruleToStartState[o.ruleIndex].isPrecedenceRule){var r=o.transitions[o.transitions.length-1].target;r instanceof g&&r.epsilonOnlyTransitions&&r.transitions[0].target instanceof x&&(o.isPrecedenceDecision=!0)}},n.prototype.verifyATN=function(e){if(this.deserializationOptions.verifyATN)for(var t=0,o;t<e.states.length;t++)if(o=e.states[t],null!==o)if(this.checkCondition(o.epsilonOnlyTransitions||1>=o.transitions.length),o instanceof h)this.checkCondition(null!==o.loopBackState);else if(!(o instanceof f))o instanceof S?(this.checkCondition(1===o.transitions.length),this.checkCondition(o.transitions[0].target instanceof f)):o instanceof g?this.checkCondition(null!==o.loopBackState):o instanceof T?this.checkCondition(null!==o.stopState):o instanceof u?this.checkCondition(null!==o.endState):o instanceof y?this.checkCondition(null!==o.startState):o instanceof l?this.checkCondition(1>=o.transitions.length||0<=o.decision):this.checkCondition(1>=o.transitions.length||o instanceof x);else if(this.checkCondition(null!==o.loopBackState),this.checkCondition(2===o.transitions.length),o.transitions[0].target instanceof E)this.checkCondition(o.transitions[1].target instanceof g),this.checkCondition(!o.nonGreedy);else if(o.transitions[0].target instanceof g)this.checkCondition(o.transitions[1].target instanceof E),this.checkCondition(o.nonGreedy);else throw"IllegalState"},n.prototype.checkCondition=function(e,t){if(!e)throw(void 0===t||null===t)&&(t="IllegalState"),t},n.prototype.readInt=function(){return this.data[this.pos++]},n.prototype.readInt32=function(){var e=this.readInt(),t=this.readInt();return e|t<<16},n.prototype.readLong=function(){var e=this.readInt32(),t=this.readInt32();return 4294967295&e|t<<32};var Z=function(){for(var e=[],t=0;256>t;t++)e[t]=(t+256).toString(16).substr(1).toUpperCase();return e}();n.prototype.readUUID=function(){for(var e=[],t=7,o;0<=t;t--)o=this.readInt(),e[2*t+1]=255&o,e[2*t]=255&o>>8;return Z[e[0]]+Z[e[1]]+Z[e[2]]+Z[e[3]]+"-"+Z[e[4]]+Z[e[5]]+"-"+Z[e[6]]+Z[e[7]]+"-"+Z[e[8]]+Z[e[9]]+"-"+Z[e[10]]+Z[e[11]]+Z[e[12]]+Z[e[13]]+Z[e[14]]+Z[e[15]]},n.prototype.edgeFactory=function(e,t,o,r,n,a,i,s){var d=e.states[r];switch(t){case N.EPSILON:return new O(d);case N.RANGE:return 0===i?new P(d,n,a):new P(d,p.EOF,a);case N.RULE:return new k(e.states[n],a,i,d);case N.PREDICATE:return new b(d,n,a,0!==i);case N.PRECEDENCE:return new v(d,n);case N.ATOM:return 0===i?new R(d,n):new R(d,p.EOF);case N.ACTION:return new D(d,n,a,0!==i);case N.SET:return new L(d,s[n]);case N.NOT_SET:return new I(d,s[n]);case N.WILDCARD:return new F(d);default:throw"The specified transition type: "+t+" is not valid.";}},n.prototype.stateFactory=function(e,t){if(null===this.stateFactories){var o=[];o[c.INVALID_TYPE]=null,o[c.BASIC]=function(){return new s},o[c.RULE_START]=function(){return new T},o[c.BLOCK_START]=function(){return new A},o[c.PLUS_BLOCK_START]=function(){return new h},o[c.STAR_BLOCK_START]=function(){return new E},o[c.TOKEN_START]=function(){return new m},o[c.RULE_STOP]=function(){return new x},o[c.BLOCK_END]=function(){return new y},o[c.STAR_LOOP_BACK]=function(){return new S},o[c.STAR_LOOP_ENTRY]=function(){return new f},o[c.PLUS_LOOP_BACK]=function(){return new _},o[c.LOOP_END]=function(){return new g},this.stateFactories=o}if(e>this.stateFactories.length||null===this.stateFactories[e])throw"The specified state type "+e+" is not valid.";else{var r=this.stateFactories[e]();if(null!==r)return r.ruleIndex=t,r}},n.prototype.lexerActionFactory=function(e,t,o){if(null===this.actionFactories){var r=[];r[V.CHANNEL]=function(e){return new G(e)},r[V.CUSTOM]=function(e,t){return new K(e,t)},r[V.MODE]=function(e){return new j(e)},r[V.MORE]=function(){return q.INSTANCE},r[V.POP_MODE]=function(){return w.INSTANCE},r[V.PUSH_MODE]=function(e){return new Y(e)},r[V.SKIP]=function(){return z.INSTANCE},r[V.TYPE]=function(e){return new W(e)},this.actionFactories=r}if(e>this.actionFactories.length||null===this.actionFactories[e])throw"The specified lexer action type "+e+" is not valid.";else return this.actionFactories[e](t,o)},o.ATNDeserializer=n},{"./../IntervalSet":14,"./../Token":22,"./ATN":24,"./ATNDeserializationOptions":27,"./ATNState":30,"./ATNType":31,"./LexerAction":33,"./Transition":38}],29:[function(e,t,o){function r(e,t){return this.atn=e,this.sharedContextCache=t,this}var n=e("./../dfa/DFAState").DFAState,p=e("./ATNConfigSet").ATNConfigSet,a=e("./../PredictionContext").getCachedPredictionContext;r.ERROR=new n(2147483647,new p()),r.prototype.getCachedContext=function(e){if(null===this.sharedContextCache)return e;return a(e,this.sharedContextCache,{})},o.ATNSimulator=r},{"./../PredictionContext":19,"./../dfa/DFAState":42,"./ATNConfigSet":26}],30:[function(e,t,o){function r(){return this.atn=null,this.stateNumber=r.INVALID_STATE_NUMBER,this.stateType=null,this.ruleIndex=0,this.epsilonOnlyTransitions=!1,this.transitions=[],this.nextTokenWithinRule=null,this}function n(){return r.call(this),this.stateType=r.BASIC,this}function p(){return r.call(this),this.decision=-1,this.nonGreedy=!1,this}function a(){return p.call(this),this.endState=null,this}function i(){return a.call(this),this.stateType=r.BLOCK_START,this}function s(){return r.call(this),this.stateType=r.BLOCK_END,this.startState=null,this}function d(){return r.call(this),this.stateType=r.RULE_STOP,this}function c(){return r.call(this),this.stateType=r.RULE_START,this.stopState=null,this.isPrecedenceRule=!1,this}function l(){return p.call(this),this.stateType=r.PLUS_LOOP_BACK,this}function u(){return a.call(this),this.stateType=r.PLUS_BLOCK_START,this.loopBackState=null,this}function y(){return a.call(this),this.stateType=r.STAR_BLOCK_START,this}function g(){return r.call(this),this.stateType=r.STAR_LOOP_BACK,this}function T(){return p.call(this),this.stateType=r.STAR_LOOP_ENTRY,this.loopBackState=null,this.isPrecedenceDecision=null,this}function x(){return r.call(this),this.stateType=r.LOOP_END,this.loopBackState=null,this}function m(){return p.call(this),this.stateType=r.TOKEN_START,this}r.INVALID_TYPE=0,r.BASIC=1,r.RULE_START=2,r.BLOCK_START=3,r.PLUS_BLOCK_START=4,r.STAR_BLOCK_START=5,r.TOKEN_START=6,r.RULE_STOP=7,r.BLOCK_END=8,r.STAR_LOOP_BACK=9,r.STAR_LOOP_ENTRY=10,r.PLUS_LOOP_BACK=11,r.LOOP_END=12,r.serializationNames=["INVALID","BASIC","RULE_START","BLOCK_START","PLUS_BLOCK_START","STAR_BLOCK_START","TOKEN_START","RULE_STOP","BLOCK_END","STAR_LOOP_BACK","STAR_LOOP_ENTRY","PLUS_LOOP_BACK","LOOP_END"],r.INVALID_STATE_NUMBER=-1,r.prototype.toString=function(){return this.stateNumber},r.prototype.equals=function(e){return!!(e instanceof r)&&this.stateNumber===e.stateNumber},r.prototype.isNonGreedyExitState=function(){return!1},r.prototype.addTransition=function(e,t){t===void 0&&(t=-1),0===this.transitions.length?this.epsilonOnlyTransitions=e.isEpsilon:this.epsilonOnlyTransitions!==e.isEpsilon&&(this.epsilonOnlyTransitions=!1),-1===t?this.transitions.push(e):this.transitions.splice(t,1,e)},n.prototype=Object.create(r.prototype),n.prototype.constructor=n,p.prototype=Object.create(r.prototype),p.prototype.constructor=p,a.prototype=Object.create(p.prototype),a.prototype.constructor=a,i.prototype=Object.create(a.prototype),i.prototype.constructor=i,s.prototype=Object.create(r.prototype),s.prototype.constructor=s,d.prototype=Object.create(r.prototype),d.prototype.constructor=d,c.prototype=Object.create(r.prototype),c.prototype.constructor=c,l.prototype=Object.create(p.prototype),l.prototype.constructor=l,u.prototype=Object.create(a.prototype),u.prototype.constructor=u,y.prototype=Object.create(a.prototype),y.prototype.constructor=y,g.prototype=Object.create(r.prototype),g.prototype.constructor=g,T.prototype=Object.create(p.prototype),T.prototype.constructor=T,x.prototype=Object.create(r.prototype),x.prototype.constructor=x,m.prototype=Object.create(p.prototype),m.prototype.constructor=m,o.ATNState=r,o.BasicState=n,o.DecisionState=p,o.BlockStartState=a,o.BlockEndState=s,o.LoopEndState=x,o.RuleStartState=c,o.RuleStopState=d,o.TokensStartState=m,o.PlusLoopbackState=l,o.StarLoopbackState=g,o.StarLoopEntryState=T,o.PlusBlockStartState=u,o.StarBlockStartState=y,o.BasicBlockStartState=i},{}],31:[function(e,t,o){function r(){}r.LEXER=0,r.PARSER=1,o.ATNType=r},{}],32:[function(e,t,o){function r(e){e.index=-1,e.line=0,e.column=-1,e.dfaState=null}function n(){return r(this),this}function p(e,t,o,r){return d.call(this,t,r),this.decisionToDFA=o,this.recog=e,this.startIndex=-1,this.line=1,this.column=0,this.mode=i.DEFAULT_MODE,this.prevAccept=new n,this}var a=e("./../Token").Token,i=e("./../Lexer").Lexer,s=e("./ATN").ATN,d=e("./ATNSimulator").ATNSimulator,c=e("./../dfa/DFAState").DFAState,l=e("./ATNConfigSet").ATNConfigSet,u=e("./ATNConfigSet").OrderedATNConfigSet,y=e("./../PredictionContext").PredictionContext,g=e("./../PredictionContext").SingletonPredictionContext,T=e("./ATNState").RuleStopState,x=e("./ATNConfig").LexerATNConfig,m=e("./Transition").Transition,_=e("./LexerActionExecutor").LexerActionExecutor,S=e("./../error/Errors").LexerNoViableAltException;n.prototype.reset=function(){r(this)},p.prototype=Object.create(d.prototype),p.prototype.constructor=p,p.debug=!1,p.dfa_debug=!1,p.MIN_DFA_EDGE=0,p.MAX_DFA_EDGE=127,p.match_calls=0,p.prototype.copyState=function(e){this.column=e.column,this.line=e.line,this.mode=e.mode,this.startIndex=e.startIndex},p.prototype.match=function(e,t){this.match_calls+=1,this.mode=t;var o=e.mark();try{this.startIndex=e.index,this.prevAccept.reset();var r=this.decisionToDFA[t];return null===r.s0?this.matchATN(e):this.execATN(e,r.s0)}finally{e.release(o)}},p.prototype.reset=function(){this.prevAccept.reset(),this.startIndex=-1,this.line=1,this.column=0,this.mode=i.DEFAULT_MODE},p.prototype.matchATN=function(e){var t=this.atn.modeToStartState[this.mode];p.debug&&console.log("matchATN mode "+this.mode+" start: "+t);var o=this.mode,r=this.computeStartState(e,t),n=r.hasSemanticContext;r.hasSemanticContext=!1;var a=this.addDFAState(r);n||(this.decisionToDFA[this.mode].s0=a);var i=this.execATN(e,a);return p.debug&&console.log("DFA after matchATN: "+this.decisionToDFA[o].toLexerString()),i},p.prototype.execATN=function(e,o){p.debug&&console.log("start state closure="+o.configs),o.isAcceptState&&this.captureSimState(this.prevAccept,e,o);for(var r=e.LA(1),t=o;;){p.debug&&console.log("execATN loop starting closure: "+t.configs);var n=this.getExistingTargetState(t,r);if(null===n&&(n=this.computeTargetState(e,t,r)),n===d.ERROR)break;if(r!==a.EOF&&this.consume(e),n.isAcceptState&&(this.captureSimState(this.prevAccept,e,n),r===a.EOF))break;r=e.LA(1),t=n}return this.failOrAccept(this.prevAccept,e,t.configs,r)},p.prototype.getExistingTargetState=function(e,o){if(null===e.edges||o<p.MIN_DFA_EDGE||o>p.MAX_DFA_EDGE)return null;var t=e.edges[o-p.MIN_DFA_EDGE];return void 0===t&&(t=null),p.debug&&null!==t&&console.log("reuse state "+e.stateNumber+" edge to "+t.stateNumber),t},p.prototype.computeTargetState=function(e,o,r){var t=new u;return this.getReachableConfigSet(e,o.configs,t,r),0===t.items.length?(t.hasSemanticContext||this.addDFAEdge(o,r,d.ERROR),d.ERROR):this.addDFAEdge(o,r,null,t)},p.prototype.failOrAccept=function(e,o,r,n){if(null!==this.prevAccept.dfaState){var t=e.dfaState.lexerActionExecutor;return this.accept(o,t,this.startIndex,e.index,e.line,e.column),e.dfaState.prediction}if(n===a.EOF&&o.index===this.startIndex)return a.EOF;throw new S(this.recog,o,this.startIndex,r)},p.prototype.getReachableConfigSet=function(e,o,r,n){for(var t=s.INVALID_ALT_NUMBER,d=0;d<o.items.length;d++){var i=o.items[d],c=i.alt===t;if(!(c&&i.passedThroughNonGreedyDecision)){p.debug&&console.log("testing %s at %s\n",this.getTokenName(n),i.toString(this.recog,!0));for(var l=0;l<i.state.transitions.length;l++){var u=i.state.transitions[l],y=this.getReachableTarget(u,n);if(null!==y){var g=i.lexerActionExecutor;null!==g&&(g=g.fixOffsetBeforeMatch(e.index-this.startIndex));var T=n===a.EOF,m=new x({state:y,lexerActionExecutor:g},i);this.closure(e,m,r,c,!0,T)&&(t=i.alt)}}}}},p.prototype.accept=function(e,t,o,r,n,a){p.debug&&console.log("ACTION %s\n",t),e.seek(r),this.line=n,this.column=a,null!==t&&null!==this.recog&&t.execute(this.recog,e,o)},p.prototype.getReachableTarget=function(e,o){return e.matches(o,0,i.MAX_CHAR_VALUE)?e.target:null},p.prototype.computeStartState=function(e,t){for(var o=y.EMPTY,r=new u,n=0;n<t.transitions.length;n++){var p=t.transitions[n].target,a=new x({state:p,alt:n+1,context:o},null);this.closure(e,a,r,!1,!1,!1)}return r},p.prototype.closure=function(e,t,o,r,n,a){var s=null;if(p.debug&&console.log("closure("+t.toString(this.recog,!0)+")"),t.state instanceof T){if(p.debug&&(null===this.recog?console.log("closure at rule stop %s\n",t):console.log("closure at %s rule stop %s\n",this.recog.ruleNames[t.state.ruleIndex],t)),null===t.context||t.context.hasEmptyPath()){if(null===t.context||t.context.isEmpty())return o.add(t),!0;o.add(new x({state:t.state,context:y.EMPTY},t)),r=!0}if(null!==t.context&&!t.context.isEmpty())for(var d=0;d<t.context.length;d++)if(t.context.getReturnState(d)!==y.EMPTY_RETURN_STATE){var i=t.context.getParent(d),c=this.atn.states[t.context.getReturnState(d)];s=new x({state:c,context:i},t),r=this.closure(e,s,o,r,n,a)}return r}t.state.epsilonOnlyTransitions||r&&t.passedThroughNonGreedyDecision||o.add(t);for(var l=0,u;l<t.state.transitions.length;l++)u=t.state.transitions[l],s=this.getEpsilonTarget(e,t,u,o,n,a),null!==s&&(r=this.closure(e,s,o,r,n,a));return r},p.prototype.getEpsilonTarget=function(e,t,o,r,n,s){var d=null;if(o.serializationType===m.RULE){var c=g.create(t.context,o.followState.stateNumber);d=new x({state:o.target,context:c},t)}else if(o.serializationType===m.PRECEDENCE)throw"Precedence predicates are not supported in lexers.";else if(o.serializationType===m.PREDICATE)p.debug&&console.log("EVAL rule "+o.ruleIndex+":"+o.predIndex),r.hasSemanticContext=!0,this.evaluatePredicate(e,o.ruleIndex,o.predIndex,n)&&(d=new x({state:o.target},t));else if(!(o.serializationType===m.ACTION))o.serializationType===m.EPSILON?d=new x({state:o.target},t):(o.serializationType===m.ATOM||o.serializationType===m.RANGE||o.serializationType===m.SET)&&s&&o.matches(a.EOF,0,i.MAX_CHAR_VALUE)&&(d=new x({state:o.target},t));else if(null===t.context||t.context.hasEmptyPath()){var l=_.append(t.lexerActionExecutor,this.atn.lexerActions[o.actionIndex]);d=new x({state:o.target,lexerActionExecutor:l},t)}else d=new x({state:o.target},t);return d},p.prototype.evaluatePredicate=function(e,t,o,r){if(null===this.recog)return!0;if(!r)return this.recog.sempred(null,t,o);var n=this.column,p=this.line,a=e.index,i=e.mark();try{return this.consume(e),this.recog.sempred(null,t,o)}finally{this.column=n,this.line=p,e.seek(a),e.release(i)}},p.prototype.captureSimState=function(e,t,o){e.index=t.index,e.line=this.line,e.column=this.column,e.dfaState=o},p.prototype.addDFAEdge=function(e,t,o,r){if(void 0===o&&(o=null),void 0===r&&(r=null),null===o&&null!==r){var n=r.hasSemanticContext;if(r.hasSemanticContext=!1,o=this.addDFAState(r),n)return o}return t<p.MIN_DFA_EDGE||t>p.MAX_DFA_EDGE?o:(p.debug&&console.log("EDGE "+e+" -> "+o+" upon "+t),null===e.edges&&(e.edges=[]),e.edges[t-p.MIN_DFA_EDGE]=o,o)},p.prototype.addDFAState=function(e){for(var t=new c(null,e),o=null,r=0,n;r<e.items.length;r++)if(n=e.items[r],n.state instanceof T){o=n;break}null!==o&&(t.isAcceptState=!0,t.lexerActionExecutor=o.lexerActionExecutor,t.prediction=this.atn.ruleToTokenType[o.state.ruleIndex]);var p=this.decisionToDFA[this.mode],a=p.states.get(t);if(null!==a)return a;var i=t;return i.stateNumber=p.states.length,e.setReadonly(!0),i.configs=e,p.states.add(i),i},p.prototype.getDFA=function(e){return this.decisionToDFA[e]},p.prototype.getText=function(e){return e.getText(this.startIndex,e.index-1)},p.prototype.consume=function(e){var t=e.LA(1);t===10?(this.line+=1,this.column=0):this.column+=1,e.consume()},p.prototype.getTokenName=function(e){return-1===e?"EOF":"'"+String.fromCharCode(e)+"'"},o.LexerATNSimulator=p},{"./../Lexer":16,"./../PredictionContext":19,"./../Token":22,"./../dfa/DFAState":42,"./../error/Errors":47,"./ATN":24,"./ATNConfig":25,"./ATNConfigSet":26,"./ATNSimulator":29,"./ATNState":30,"./LexerActionExecutor":34,"./Transition":38}],33:[function(e,t,o){function r(){}function n(e){return this.actionType=e,this.isPositionDependent=!1,this}function p(){return n.call(this,r.SKIP),this}function a(e){return n.call(this,r.TYPE),this.type=e,this}function i(e){return n.call(this,r.PUSH_MODE),this.mode=e,this}function s(){return n.call(this,r.POP_MODE),this}function d(){return n.call(this,r.MORE),this}function c(e){return n.call(this,r.MODE),this.mode=e,this}function l(e,t){return n.call(this,r.CUSTOM),this.ruleIndex=e,this.actionIndex=t,this.isPositionDependent=!0,this}function u(e){return n.call(this,r.CHANNEL),this.channel=e,this}function y(e,t){return n.call(this,t.actionType),this.offset=e,this.action=t,this.isPositionDependent=!0,this}r.CHANNEL=0,r.CUSTOM=1,r.MODE=2,r.MORE=3,r.POP_MODE=4,r.PUSH_MODE=5,r.SKIP=6,r.TYPE=7,n.prototype.hashCode=function(){var e=new Hash;return this.updateHashCode(e),e.finish()},n.prototype.updateHashCode=function(e){e.update(this.actionType)},n.prototype.equals=function(e){return this===e},p.prototype=Object.create(n.prototype),p.prototype.constructor=p,p.INSTANCE=new p,p.prototype.execute=function(e){e.skip()},p.prototype.toString=function(){return"skip"},a.prototype=Object.create(n.prototype),a.prototype.constructor=a,a.prototype.execute=function(e){e.type=this.type},a.prototype.updateHashCode=function(e){e.update(this.actionType,this.type)},a.prototype.equals=function(e){return!(this!==e)||!!(e instanceof a)&&this.type===e.type},a.prototype.toString=function(){return"type("+this.type+")"},i.prototype=Object.create(n.prototype),i.prototype.constructor=i,i.prototype.execute=function(e){e.pushMode(this.mode)},i.prototype.updateHashCode=function(e){e.update(this.actionType,this.mode)},i.prototype.equals=function(e){return!(this!==e)||!!(e instanceof i)&&this.mode===e.mode},i.prototype.toString=function(){return"pushMode("+this.mode+")"},s.prototype=Object.create(n.prototype),s.prototype.constructor=s,s.INSTANCE=new s,s.prototype.execute=function(e){e.popMode()},s.prototype.toString=function(){return"popMode"},d.prototype=Object.create(n.prototype),d.prototype.constructor=d,d.INSTANCE=new d,d.prototype.execute=function(e){e.more()},d.prototype.toString=function(){return"more"},c.prototype=Object.create(n.prototype),c.prototype.constructor=c,c.prototype.execute=function(e){e.mode(this.mode)},c.prototype.updateHashCode=function(e){e.update(this.actionType,this.mode)},c.prototype.equals=function(e){return!(this!==e)||!!(e instanceof c)&&this.mode===e.mode},c.prototype.toString=function(){return"mode("+this.mode+")"},l.prototype=Object.create(n.prototype),l.prototype.constructor=l,l.prototype.execute=function(e){e.action(null,this.ruleIndex,this.actionIndex)},l.prototype.updateHashCode=function(e){e.update(this.actionType,this.ruleIndex,this.actionIndex)},l.prototype.equals=function(e){return!(this!==e)||!!(e instanceof l)&&this.ruleIndex===e.ruleIndex&&this.actionIndex===e.actionIndex},u.prototype=Object.create(n.prototype),u.prototype.constructor=u,u.prototype.execute=function(e){e._channel=this.channel},u.prototype.updateHashCode=function(e){e.update(this.actionType,this.channel)},u.prototype.equals=function(e){return!(this!==e)||!!(e instanceof u)&&this.channel===e.channel},u.prototype.toString=function(){return"channel("+this.channel+")"},y.prototype=Object.create(n.prototype),y.prototype.constructor=y,y.prototype.execute=function(e){this.action.execute(e)},y.prototype.updateHashCode=function(e){e.update(this.actionType,this.offset,this.action)},y.prototype.equals=function(e){return!(this!==e)||!!(e instanceof y)&&this.offset===e.offset&&this.action===e.action},o.LexerActionType=r,o.LexerSkipAction=p,o.LexerChannelAction=u,o.LexerCustomAction=l,o.LexerIndexedCustomAction=y,o.LexerMoreAction=d,o.LexerTypeAction=a,o.LexerPushModeAction=i,o.LexerPopModeAction=s,o.LexerModeAction=c},{}],34:[function(e,t,o){function r(e){return this.lexerActions=null===e?[]:e,this.cachedHashCode=n(e),this}var n=e("../Utils").hashStuff,p=e("./LexerAction").LexerIndexedCustomAction;r.append=function(e,t){if(null===e)return new r([t]);var o=e.lexerActions.concat([t]);return new r(o)},r.prototype.fixOffsetBeforeMatch=function(e){for(var t=null,o=0;o<this.lexerActions.length;o++)this.lexerActions[o].isPositionDependent&&!(this.lexerActions[o]instanceof p)&&(null===t&&(t=this.lexerActions.concat([])),t[o]=new p(e,this.lexerActions[o]));return null===t?this:new r(t)},r.prototype.execute=function(e,t,o){var r=!1,n=t.index;try{for(var a=0,i;a<this.lexerActions.length;a++){if(i=this.lexerActions[a],i instanceof p){var s=i.offset;t.seek(o+s),i=i.action,r=o+s!==n}else i.isPositionDependent&&(t.seek(n),r=!1);i.execute(e)}}finally{r&&t.seek(n)}},r.prototype.hashCode=function(){return this.cachedHashCode},r.prototype.updateHashCode=function(e){e.update(this.cachedHashCode)},r.prototype.equals=function(e){if(this===e)return!0;if(!(e instanceof r))return!1;if(this.cachedHashCode!=e.cachedHashCode)return!1;if(this.lexerActions.length!=e.lexerActions.length)return!1;for(var t=this.lexerActions.length,o=0;o<t;++o)if(!this.lexerActions[o].equals(e.lexerActions[o]))return!1;return!0},o.LexerActionExecutor=r},{"../Utils":23,"./LexerAction":33}],35:[function(e,t,o){function r(e,t,o,r){return T.call(this,t,r),this.parser=e,this.decisionToDFA=o,this.predictionMode=x.LL,this._input=null,this._startIndex=0,this._outerContext=null,this._dfa=null,this.mergeCache=null,this}var n=e("./../Utils"),a=n.Set,p=n.BitSet,s=n.DoubleDict,d=e("./ATN").ATN,c=e("./ATNState").ATNState,l=e("./ATNConfig").ATNConfig,u=e("./ATNConfigSet").ATNConfigSet,y=e("./../Token").Token,i=e("./../dfa/DFAState").DFAState,g=e("./../dfa/DFAState").PredPrediction,T=e("./ATNSimulator").ATNSimulator,x=e("./PredictionMode").PredictionMode,m=e("./../RuleContext").RuleContext,_=e("./../ParserRuleContext").ParserRuleContext,S=e("./SemanticContext").SemanticContext,f=e("./ATNState").StarLoopEntryState,h=e("./ATNState").RuleStopState,E=e("./../PredictionContext").PredictionContext,A=e("./../IntervalSet").Interval,C=e("./Transition"),N=C.Transition,R=C.SetTransition,L=C.NotSetTransition,I=C.RuleTransition,k=C.ActionTransition,P=e("./../error/Errors").NoViableAltException,D=e("./../PredictionContext").SingletonPredictionContext,O=e("./../PredictionContext").predictionContextFromRuleContext;r.prototype=Object.create(T.prototype),r.prototype.constructor=r,r.prototype.debug=!1,r.prototype.debug_closure=!1,r.prototype.debug_add=!1,r.prototype.debug_list_atn_decisions=!1,r.prototype.dfa_debug=!1,r.prototype.retry_debug=!1,r.prototype.reset=function(){},r.prototype.adaptivePredict=function(e,t,o){(this.debug||this.debug_list_atn_decisions)&&console.log("adaptivePredict decision "+t+" exec LA(1)=="+this.getLookaheadName(e)+" line "+e.LT(1).line+":"+e.LT(1).column),this._input=e,this._startIndex=e.index,this._outerContext=o;var r=this.decisionToDFA[t];this._dfa=r;var n=e.mark(),p=e.index;try{var a;if(a=r.precedenceDfa?r.getPrecedenceStartState(this.parser.getPrecedence()):r.s0,null===a){null===o&&(o=m.EMPTY),(this.debug||this.debug_list_atn_decisions)&&console.log("predictATN decision "+r.decision+" exec LA(1)=="+this.getLookaheadName(e)+", outerContext="+o.toString(this.parser.ruleNames));var s=this.computeStartState(r.atnStartState,m.EMPTY,!1);r.precedenceDfa?(r.s0.configs=s,s=this.applyPrecedenceFilter(s),a=this.addDFAState(r,new i(null,s)),r.setPrecedenceStartState(this.parser.getPrecedence(),a)):(a=this.addDFAState(r,new i(null,s)),r.s0=a)}var d=this.execATN(r,a,e,p,o);return this.debug&&console.log("DFA after predictATN: "+r.toString(this.parser.literalNames)),d}finally{this._dfa=null,this.mergeCache=null,e.seek(p),e.release(n)}},r.prototype.execATN=function(o,r,n,p,a){(this.debug||this.debug_list_atn_decisions)&&console.log("execATN decision "+o.decision+" exec LA(1)=="+this.getLookaheadName(n)+" line "+n.LT(1).line+":"+n.LT(1).column);var i=r,s;this.debug&&console.log("s0 = "+r);for(var c=n.LA(1),t;;){if(t=this.getExistingTargetState(i,c),null===t&&(t=this.computeTargetState(o,i,c)),t===T.ERROR){var l=this.noViableAlt(n,a,i.configs,p);if(n.seek(p),s=this.getSynValidOrSemInvalidAltThatFinishedDecisionEntryRule(i.configs,a),s!==d.INVALID_ALT_NUMBER)return s;throw l}if(t.requiresFullContext&&this.predictionMode!==x.SLL){var e=null;if(null!==t.predicates){this.debug&&console.log("DFA state has preds in DFA sim LL failover");var u=n.index;if(u!==p&&n.seek(p),e=this.evalSemanticContext(t.predicates,a,!0),1===e.length)return this.debug&&console.log("Full LL avoided"),e.minValue();u!==p&&n.seek(u)}this.dfa_debug&&console.log("ctx sensitive state "+a+" in "+t);var g=this.computeStartState(o.atnStartState,a,!0);return this.reportAttemptingFullContext(o,e,t.configs,p,n.index),s=this.execATNWithFullContext(o,t,g,n,p,a),s}if(t.isAcceptState){if(null===t.predicates)return t.prediction;var m=n.index;n.seek(p);var _=this.evalSemanticContext(t.predicates,a,!0);if(0===_.length)throw this.noViableAlt(n,a,t.configs,p);else return 1===_.length?_.minValue():(this.reportAmbiguity(o,t,p,m,!1,_,t.configs),_.minValue())}i=t,c!==y.EOF&&(n.consume(),c=n.LA(1))}},r.prototype.getExistingTargetState=function(e,o){var t=e.edges;return null===t?null:t[o+1]||null},r.prototype.computeTargetState=function(e,o,r){var t=this.computeReachSet(o.configs,r,!1);if(null===t)return this.addDFAEdge(e,o,r,T.ERROR),T.ERROR;var p=new i(null,t),a=this.getUniqueAlt(t);if(this.debug){var s=x.getConflictingAltSubsets(t);console.log("SLL altSubSets="+n.arrayToString(s)+", previous="+o.configs+", configs="+t+", predict="+a+", allSubsetsConflict="+x.allSubsetsConflict(s)+", conflictingAlts="+this.getConflictingAlts(t))}return a===d.INVALID_ALT_NUMBER?x.hasSLLConflictTerminatingPrediction(this.predictionMode,t)&&(p.configs.conflictingAlts=this.getConflictingAlts(t),p.requiresFullContext=!0,p.isAcceptState=!0,p.prediction=p.configs.conflictingAlts.minValue()):(p.isAcceptState=!0,p.configs.uniqueAlt=a,p.prediction=a),p.isAcceptState&&p.configs.hasSemanticContext&&(this.predicateDFAState(p,this.atn.getDecisionState(e.decision)),null!==p.predicates&&(p.prediction=d.INVALID_ALT_NUMBER)),p=this.addDFAEdge(e,o,r,p),p},r.prototype.predicateDFAState=function(e,t){var o=t.transitions.length,r=this.getConflictingAltsOrUniqueAlt(e.configs),n=this.getPredsForAmbigAlts(r,e.configs,o);null===n?e.prediction=r.minValue():(e.predicates=this.getPredicatePredictions(r,n),e.prediction=d.INVALID_ALT_NUMBER)},r.prototype.execATNWithFullContext=function(o,r,n,p,a,i){(this.debug||this.debug_list_atn_decisions)&&console.log("execATNWithFullContext "+n);var s=!1,c=null,l=n;p.seek(a);for(var u=p.LA(1),t=-1;;){if(c=this.computeReachSet(l,u,!0),null===c){var g=this.noViableAlt(p,i,l,a);p.seek(a);var e=this.getSynValidOrSemInvalidAltThatFinishedDecisionEntryRule(l,i);if(e!==d.INVALID_ALT_NUMBER)return e;throw g}var T=x.getConflictingAltSubsets(c);if(this.debug&&console.log("LL altSubSets="+T+", predict="+x.getUniqueAlt(T)+", resolvesToJustOneViableAlt="+x.resolvesToJustOneViableAlt(T)),c.uniqueAlt=this.getUniqueAlt(c),c.uniqueAlt!==d.INVALID_ALT_NUMBER){t=c.uniqueAlt;break}else if(this.predictionMode!==x.LL_EXACT_AMBIG_DETECTION){if(t=x.resolvesToJustOneViableAlt(T),t!==d.INVALID_ALT_NUMBER)break;}else if(x.allSubsetsConflict(T)&&x.allSubsetsEqual(T)){s=!0,t=x.getSingleViableAlt(T);break}l=c,u!==y.EOF&&(p.consume(),u=p.LA(1))}return c.uniqueAlt===d.INVALID_ALT_NUMBER?(this.reportAmbiguity(o,r,a,p.index,s,null,c),t):(this.reportContextSensitivity(o,t,c,a,p.index),t)},r.prototype.computeReachSet=function(e,o,t){this.debug&&console.log("in computeReachSet, starting closure: "+e),null===this.mergeCache&&(this.mergeCache=new s);for(var r=new u(t),n=null,p=0,i;p<e.items.length;p++){if(i=e.items[p],this.debug_add&&console.log("testing "+this.getTokenName(o)+" at "+i),i.state instanceof h){(t||o===y.EOF)&&(null==n&&(n=[]),n.push(i),this.debug_add&&console.log("added "+i+" to skippedStopStates"));continue}for(var c=0;c<i.state.transitions.length;c++){var g=i.state.transitions[c],T=this.getReachableTarget(g,o);if(null!==T){var m=new l({state:T},i);r.add(m,this.mergeCache),this.debug_add&&console.log("added "+m+" to intermediate")}}}var _=null;if(null===n&&o!==y.EOF&&(1===r.items.length?_=r:this.getUniqueAlt(r)!==d.INVALID_ALT_NUMBER&&(_=r)),null===_){_=new u(t);for(var S=new a,f=o===y.EOF,E=0;E<r.items.length;E++)this.closure(r.items[E],_,S,!1,t,f)}if(o===y.EOF&&(_=this.removeAllConfigsNotInRuleStopState(_,_===r)),null!==n&&(!t||!x.hasConfigInRuleStopState(_)))for(var A=0;A<n.length;A++)_.add(n[A],this.mergeCache);return 0===_.items.length?null:_},r.prototype.removeAllConfigsNotInRuleStopState=function(e,t){if(x.allConfigsInRuleStopStates(e))return e;for(var o=new u(e.fullCtx),r=0,n;r<e.items.length;r++){if(n=e.items[r],n.state instanceof h){o.add(n,this.mergeCache);continue}if(t&&n.state.epsilonOnlyTransitions){var p=this.atn.nextTokens(n.state);if(p.contains(y.EPSILON)){var a=this.atn.ruleToStopState[n.state.ruleIndex];o.add(new l({state:a},n),this.mergeCache)}}}return o},r.prototype.computeStartState=function(e,t,o){for(var r=O(this.atn,t),n=new u(o),p=0;p<e.transitions.length;p++){var i=e.transitions[p].target,s=new l({state:i,alt:p+1,context:r},null),d=new a;this.closure(s,n,d,!0,o,!1)}return n},r.prototype.applyPrecedenceFilter=function(e){for(var t=[],o=new u(e.fullCtx),r=0,n;r<e.items.length;r++)if(n=e.items[r],1===n.alt){var p=n.semanticContext.evalPrecedence(this.parser,this._outerContext);null!==p&&(t[n.state.stateNumber]=n.context,p===n.semanticContext?o.add(n,this.mergeCache):o.add(new l({semanticContext:p},n),this.mergeCache))}for(r=0;r<e.items.length;r++)if(n=e.items[r],1!==n.alt){if(!n.precedenceFilterSuppressed){var a=t[n.state.stateNumber]||null;if(null!==a&&a.equals(n.context))continue}o.add(n,this.mergeCache)}return o},r.prototype.getReachableTarget=function(e,t){return e.matches(t,0,this.atn.maxTokenType)?e.target:null},r.prototype.getPredsForAmbigAlts=function(e,t,o){for(var r=[],p=0,a;p<t.items.length;p++)a=t.items[p],e.contains(a.alt)&&(r[a.alt]=S.orContext(r[a.alt]||null,a.semanticContext));var i=0;for(p=1;p<o+1;p++){var s=r[p]||null;null===s?r[p]=S.NONE:s!==S.NONE&&(i+=1)}return 0==i&&(r=null),this.debug&&console.log("getPredsForAmbigAlts result "+n.arrayToString(r)),r},r.prototype.getPredicatePredictions=function(e,t){for(var o=[],r=!1,n=1,p;n<t.length;n++)p=t[n],null!==e&&e.contains(n)&&o.push(new g(p,n)),p!==S.NONE&&(r=!0);return r?o:null},r.prototype.getSynValidOrSemInvalidAltThatFinishedDecisionEntryRule=function(e,t){var o=this.splitAccordingToSemanticValidity(e,t),r=o[0],n=o[1],p=this.getAltThatFinishedDecisionEntryRule(r);return p===d.INVALID_ALT_NUMBER?0<n.items.length&&(p=this.getAltThatFinishedDecisionEntryRule(n),p!==d.INVALID_ALT_NUMBER)?p:d.INVALID_ALT_NUMBER:p},r.prototype.getAltThatFinishedDecisionEntryRule=function(e){for(var t=[],o=0,r;o<e.items.length;o++)r=e.items[o],(0<r.reachesIntoOuterContext||r.state instanceof h&&r.context.hasEmptyPath())&&0>t.indexOf(r.alt)&&t.push(r.alt);return 0===t.length?d.INVALID_ALT_NUMBER:Math.min.apply(null,t)},r.prototype.splitAccordingToSemanticValidity=function(e,t){for(var o=new u(e.fullCtx),r=new u(e.fullCtx),n=0,p;n<e.items.length;n++)if(p=e.items[n],p.semanticContext!==S.NONE){var a=p.semanticContext.evaluate(this.parser,t);a?o.add(p):r.add(p)}else o.add(p);return[o,r]},r.prototype.evalSemanticContext=function(e,t,o){for(var r=new p,n=0,a;n<e.length;n++){if(a=e[n],a.pred===S.NONE){if(r.add(a.alt),!o)break;continue}var i=a.pred.evaluate(this.parser,t);if((this.debug||this.dfa_debug)&&console.log("eval pred "+a+"="+i),i&&((this.debug||this.dfa_debug)&&console.log("PREDICT "+a.alt),r.add(a.alt),!o))break}return r},r.prototype.closure=function(e,t,o,r,n,p){this.closureCheckingStopState(e,t,o,r,n,0,p)},r.prototype.closureCheckingStopState=function(e,t,o,r,n,p,a){if((this.debug||this.debug_closure)&&(console.log("closure("+e.toString(this.parser,!0)+")"),50<e.reachesIntoOuterContext))throw"problem";if(e.state instanceof h){if(!e.context.isEmpty()){for(var s=0;s<e.context.length;s++){if(e.context.getReturnState(s)===E.EMPTY_RETURN_STATE){if(n){t.add(new l({state:e.state,context:E.EMPTY},e),this.mergeCache);continue}else this.debug&&console.log("FALLING off rule "+this.getRuleName(e.state.ruleIndex)),this.closure_(e,t,o,r,n,p,a);continue}var i=this.atn.states[e.context.getReturnState(s)],d=e.context.getParent(s),u={state:i,alt:e.alt,context:d,semanticContext:e.semanticContext},y=new l(u,null);y.reachesIntoOuterContext=e.reachesIntoOuterContext,this.closureCheckingStopState(y,t,o,r,n,p-1,a)}return}if(n)return void t.add(e,this.mergeCache);this.debug&&console.log("FALLING off rule "+this.getRuleName(e.state.ruleIndex))}this.closure_(e,t,o,r,n,p,a)},r.prototype.closure_=function(e,o,r,n,a,s,d){var l=e.state;l.epsilonOnlyTransitions||o.add(e,this.mergeCache);for(var p=0;p<l.transitions.length;p++)if(!(0==p&&this.canDropLoopEntryEdgeInLeftRecursiveRule(e))){var i=l.transitions[p],t=n&&!(i instanceof k),u=this.getEpsilonTarget(e,i,t,0===s,a,d);if(null!==u){if(!i.isEpsilon&&r.add(u)!==u)continue;var c=s;if(e.state instanceof h){if(r.add(u)!==u)continue;null!==this._dfa&&this._dfa.precedenceDfa&&i.outermostPrecedenceReturn===this._dfa.atnStartState.ruleIndex&&(u.precedenceFilterSuppressed=!0),u.reachesIntoOuterContext+=1,o.dipsIntoOuterContext=!0,c-=1,this.debug&&console.log("dips into outer ctx: "+u)}else i instanceof I&&0<=c&&(c+=1);this.closureCheckingStopState(u,o,r,t,a,c,d)}}},r.prototype.canDropLoopEntryEdgeInLeftRecursiveRule=function(e){var t=e.state;if(t.stateType!=c.STAR_LOOP_ENTRY)return!1;if(t.stateType!=c.STAR_LOOP_ENTRY||!t.isPrecedenceDecision||e.context.isEmpty()||e.context.hasEmptyPath())return!1;for(var o=e.context.length,r=0,n;r<o;r++)if(n=this.atn.states[e.context.getReturnState(r)],n.ruleIndex!=t.ruleIndex)return!1;for(var p=t.transitions[0].target,a=p.endState.stateNumber,i=this.atn.states[a],r=0;r<o;r++){var s=e.context.getReturnState(r),n=this.atn.states[s];if(1!=n.transitions.length||!n.transitions[0].isEpsilon)return!1;var d=n.transitions[0].target;if((n.stateType!=c.BLOCK_END||d!=t)&&n!=i&&d!=i&&!(d.stateType==c.BLOCK_END&&1==d.transitions.length&&d.transitions[0].isEpsilon&&d.transitions[0].target==t))return!1}return!0},r.prototype.getRuleName=function(e){return null!==this.parser&&0<=e?this.parser.ruleNames[e]:"<rule "+e+">"},r.prototype.getEpsilonTarget=function(e,o,t,r,n,p){switch(o.serializationType){case N.RULE:return this.ruleTransition(e,o);case N.PRECEDENCE:return this.precedenceTransition(e,o,t,r,n);case N.PREDICATE:return this.predTransition(e,o,t,r,n);case N.ACTION:return this.actionTransition(e,o);case N.EPSILON:return new l({state:o.target},e);case N.ATOM:case N.RANGE:case N.SET:return p&&o.matches(y.EOF,0,1)?new l({state:o.target},e):null;default:return null;}},r.prototype.actionTransition=function(e,o){if(this.debug){var t=-1==o.actionIndex?65535:o.actionIndex;console.log("ACTION edge "+o.ruleIndex+":"+t)}return new l({state:o.target},e)},r.prototype.precedenceTransition=function(e,t,o,r,p){this.debug&&(console.log("PRED (collectPredicates="+o+") "+t.precedence+">=_p, ctx dependent=true"),null!==this.parser&&console.log("context surrounding pred is "+n.arrayToString(this.parser.getRuleInvocationStack())));var a=null;if(!(o&&r))a=new l({state:t.target},e);else if(p){var i=this._input.index;this._input.seek(this._startIndex);var s=t.getPredicate().evaluate(this.parser,this._outerContext);this._input.seek(i),s&&(a=new l({state:t.target},e))}else{var d=S.andContext(e.semanticContext,t.getPredicate());a=new l({state:t.target,semanticContext:d},e)}return this.debug&&console.log("config from pred transition="+a),a},r.prototype.predTransition=function(e,t,o,r,p){this.debug&&(console.log("PRED (collectPredicates="+o+") "+t.ruleIndex+":"+t.predIndex+", ctx dependent="+t.isCtxDependent),null!==this.parser&&console.log("context surrounding pred is "+n.arrayToString(this.parser.getRuleInvocationStack())));var a=null;if(!(o&&(t.isCtxDependent&&r||!t.isCtxDependent)))a=new l({state:t.target},e);else if(p){var i=this._input.index;this._input.seek(this._startIndex);var s=t.getPredicate().evaluate(this.parser,this._outerContext);this._input.seek(i),s&&(a=new l({state:t.target},e))}else{var d=S.andContext(e.semanticContext,t.getPredicate());a=new l({state:t.target,semanticContext:d},e)}return this.debug&&console.log("config from pred transition="+a),a},r.prototype.ruleTransition=function(e,o){this.debug&&console.log("CALL rule "+this.getRuleName(o.target.ruleIndex)+", ctx="+e.context);var t=o.followState,r=D.create(e.context,t.stateNumber);return new l({state:o.target,context:r},e)},r.prototype.getConflictingAlts=function(e){var t=x.getConflictingAltSubsets(e);return x.getAlts(t)},r.prototype.getConflictingAltsOrUniqueAlt=function(e){var t=null;return e.uniqueAlt===d.INVALID_ALT_NUMBER?t=e.conflictingAlts:(t=new p,t.add(e.uniqueAlt)),t},r.prototype.getTokenName=function(e){if(e===y.EOF)return"EOF";if(null!==this.parser&&null!==this.parser.literalNames)if(e>=this.parser.literalNames.length&&e>=this.parser.symbolicNames.length)console.log(""+e+" ttype out of range: "+this.parser.literalNames),console.log(""+this.parser.getInputStream().getTokens());else{var t=this.parser.literalNames[e]||this.parser.symbolicNames[e];return t+"<"+e+">"}return""+e},r.prototype.getLookaheadName=function(e){return this.getTokenName(e.LA(1))},r.prototype.dumpDeadEndConfigs=function(e){console.log("dead end configs: ");for(var o=e.getDeadEndConfigs(),r=0;r<o.length;r++){var n=o[r],p="no edges";if(0<n.state.transitions.length){var a=n.state.transitions[0];if(a instanceof AtomTransition)p="Atom "+this.getTokenName(a.label);else if(a instanceof R){p=(a instanceof L?"~":"")+"Set "+a.set}}console.error(n.toString(this.parser,!0)+":"+p)}},r.prototype.noViableAlt=function(e,t,o,r){return new P(this.parser,e,e.get(r),e.LT(1),o,t)},r.prototype.getUniqueAlt=function(e){for(var t=d.INVALID_ALT_NUMBER,o=0,r;o<e.items.length;o++)if(r=e.items[o],t===d.INVALID_ALT_NUMBER)t=r.alt;else if(r.alt!==t)return d.INVALID_ALT_NUMBER;return t},r.prototype.addDFAEdge=function(e,o,r,t){if(this.debug&&console.log("EDGE "+o+" -> "+t+" upon "+this.getTokenName(r)),null===t)return null;if(t=this.addDFAState(e,t),null===o||-1>r||r>this.atn.maxTokenType)return t;if(null===o.edges&&(o.edges=[]),o.edges[r+1]=t,this.debug){var n=null===this.parser?null:this.parser.literalNames,p=null===this.parser?null:this.parser.symbolicNames;console.log("DFA=\n"+e.toString(n,p))}return t},r.prototype.addDFAState=function(e,t){if(t==T.ERROR)return t;var o=e.states.get(t);return null===o?(t.stateNumber=e.states.length,t.configs.readOnly||(t.configs.optimizeConfigs(this),t.configs.setReadonly(!0)),e.states.add(t),this.debug&&console.log("adding new DFA state: "+t),t):o},r.prototype.reportAttemptingFullContext=function(e,t,o,r,n){if(this.debug||this.retry_debug){var p=new A(r,n+1);console.log("reportAttemptingFullContext decision="+e.decision+":"+o+", input="+this.parser.getTokenStream().getText(p))}null!==this.parser&&this.parser.getErrorListenerDispatch().reportAttemptingFullContext(this.parser,e,r,n,t,o)},r.prototype.reportContextSensitivity=function(e,t,o,r,n){if(this.debug||this.retry_debug){var p=new A(r,n+1);console.log("reportContextSensitivity decision="+e.decision+":"+o+", input="+this.parser.getTokenStream().getText(p))}null!==this.parser&&this.parser.getErrorListenerDispatch().reportContextSensitivity(this.parser,e,r,n,t,o)},r.prototype.reportAmbiguity=function(e,t,o,r,n,p,a){if(this.debug||this.retry_debug){var i=new A(o,r+1);console.log("reportAmbiguity "+p+":"+a+", input="+this.parser.getTokenStream().getText(i))}null!==this.parser&&this.parser.getErrorListenerDispatch().reportAmbiguity(this.parser,e,o,r,n,p,a)},o.ParserATNSimulator=r},{"./../IntervalSet":14,"./../ParserRuleContext":18,"./../PredictionContext":19,"./../RuleContext":21,"./../Token":22,"./../Utils":23,"./../dfa/DFAState":42,"./../error/Errors":47,"./ATN":24,"./ATNConfig":25,"./ATNConfigSet":26,"./ATNSimulator":29,"./ATNState":30,"./PredictionMode":36,"./SemanticContext":37,"./Transition":38}],36:[function(e,t,o){function r(){return this}var n=e("./../Utils").Set,p=e("./../Utils").Map,a=e("./../Utils").BitSet,i=e("./../Utils").AltDict,s=e("./ATN").ATN,d=e("./ATNState").RuleStopState,l=e("./ATNConfigSet").ATNConfigSet,u=e("./ATNConfig").ATNConfig,y=e("./SemanticContext").SemanticContext,c=e("../Utils").Hash,g=e("./../Utils").hashStuff,T=e("./../Utils").equalArrays;r.SLL=0,r.LL=1,r.LL_EXACT_AMBIG_DETECTION=2,r.hasSLLConflictTerminatingPrediction=function(e,t){if(r.allConfigsInRuleStopStates(t))return!0;if(e===r.SLL&&t.hasSemanticContext){for(var o=new l,n=0,p;n<t.items.length;n++)p=t.items[n],p=new u({semanticContext:y.NONE},p),o.add(p);t=o}var a=r.getConflictingAltSubsets(t);return r.hasConflictingAltSet(a)&&!r.hasStateAssociatedWithOneAlt(t)},r.hasConfigInRuleStopState=function(e){for(var t=0,o;t<e.items.length;t++)if(o=e.items[t],o.state instanceof d)return!0;return!1},r.allConfigsInRuleStopStates=function(e){for(var t=0,o;t<e.items.length;t++)if(o=e.items[t],!(o.state instanceof d))return!1;return!0},r.resolvesToJustOneViableAlt=function(e){return r.getSingleViableAlt(e)},r.allSubsetsConflict=function(e){return!r.hasNonConflictingAltSet(e)},r.hasNonConflictingAltSet=function(e){for(var t=0,o;t<e.length;t++)if(o=e[t],1===o.length)return!0;return!1},r.hasConflictingAltSet=function(e){for(var t=0,o;t<e.length;t++)if(o=e[t],1<o.length)return!0;return!1},r.allSubsetsEqual=function(e){for(var t=null,o=0,r;o<e.length;o++)if(r=e[o],null===t)t=r;else if(r!==t)return!1;return!0},r.getUniqueAlt=function(e){var t=r.getAlts(e);return 1===t.length?t.minValue():s.INVALID_ALT_NUMBER},r.getAlts=function(e){var t=new a;return e.map(function(e){t.or(e)}),t},r.getConflictingAltSubsets=function(e){var t=new p;return t.hashFunction=function(e){g(e.state.stateNumber,e.context)},t.equalsFunction=function(e,t){return e.state.stateNumber==t.state.stateNumber&&e.context.equals(t.context)},e.items.map(function(e){var o=t.get(e);null===o&&(o=new a,t.put(e,o)),o.add(e.alt)}),t.getValues()},r.getStateToAltMap=function(e){var t=new i;return e.items.map(function(e){var o=t.get(e.state);null===o&&(o=new a,t.put(e.state,o)),o.add(e.alt)}),t},r.hasStateAssociatedWithOneAlt=function(e){for(var t=r.getStateToAltMap(e).values(),o=0;o<t.length;o++)if(1===t[o].length)return!0;return!1},r.getSingleViableAlt=function(e){for(var t=null,o=0;o<e.length;o++){var r=e[o],n=r.minValue();if(null===t)t=n;else if(t!==n)return s.INVALID_ALT_NUMBER}return t},o.PredictionMode=r},{"../Utils":23,"./../Utils":23,"./ATN":24,"./ATNConfig":25,"./ATNConfigSet":26,"./ATNState":30,"./SemanticContext":37}],37:[function(e,t,o){function r(){return this}function n(e,t,o){return r.call(this),this.ruleIndex=void 0===e?-1:e,this.predIndex=void 0===t?-1:t,this.isCtxDependent=void 0!==o&&o,this}function p(e){r.call(this),this.precedence=e===void 0?0:e}function i(e,t){r.call(this);var n=new c;e instanceof i?e.opnds.map(function(e){n.add(e)}):n.add(e),t instanceof i?t.opnds.map(function(e){n.add(e)}):n.add(t);var o=p.filterPrecedencePredicates(n);if(0<o.length){var a=null;o.map(function(e){(null===a||e.precedence<a.precedence)&&(a=e)}),n.add(a)}return this.opnds=n.values(),this}function d(e,t){r.call(this);var n=new c;e instanceof d?e.opnds.map(function(e){n.add(e)}):n.add(e),t instanceof d?t.opnds.map(function(e){n.add(e)}):n.add(t);var o=p.filterPrecedencePredicates(n);if(0<o.length){var a=o.sort(function(e,t){return e.compareTo(t)}),i=a[a.length-1];n.add(i)}return this.opnds=n.values(),this}var c=e("./../Utils").Set,a=e("./../Utils").Hash;r.prototype.hashCode=function(){var e=new a;return this.updateHashCode(e),e.finish()},r.prototype.evaluate=function(){},r.prototype.evalPrecedence=function(){return this},r.andContext=function(e,t){if(null===e||e===r.NONE)return t;if(null===t||t===r.NONE)return e;var o=new i(e,t);return 1===o.opnds.length?o.opnds[0]:o},r.orContext=function(e,t){if(null===e)return t;if(null===t)return e;if(e===r.NONE||t===r.NONE)return r.NONE;var o=new d(e,t);return 1===o.opnds.length?o.opnds[0]:o},n.prototype=Object.create(r.prototype),n.prototype.constructor=n,r.NONE=new n,n.prototype.evaluate=function(e,t){var o=this.isCtxDependent?t:null;return e.sempred(o,this.ruleIndex,this.predIndex)},n.prototype.updateHashCode=function(e){e.update(this.ruleIndex,this.predIndex,this.isCtxDependent)},n.prototype.equals=function(e){return!(this!==e)||!!(e instanceof n)&&this.ruleIndex===e.ruleIndex&&this.predIndex===e.predIndex&&this.isCtxDependent===e.isCtxDependent},n.prototype.toString=function(){return"{"+this.ruleIndex+":"+this.predIndex+"}?"},p.prototype=Object.create(r.prototype),p.prototype.constructor=p,p.prototype.evaluate=function(e,t){return e.precpred(t,this.precedence)},p.prototype.evalPrecedence=function(e,t){return e.precpred(t,this.precedence)?r.NONE:null},p.prototype.compareTo=function(e){return this.precedence-e.precedence},p.prototype.updateHashCode=function(e){e.update(31)},p.prototype.equals=function(e){return!(this!==e)||!!(e instanceof p)&&this.precedence===e.precedence},p.prototype.toString=function(){return"{"+this.precedence+">=prec}?"},p.filterPrecedencePredicates=function(e){var t=[];return e.values().map(function(e){e instanceof p&&t.push(e)}),t},i.prototype=Object.create(r.prototype),i.prototype.constructor=i,i.prototype.equals=function(e){return!(this!==e)||!!(e instanceof i)&&this.opnds===e.opnds},i.prototype.updateHashCode=function(e){e.update(this.opnds,"AND")},i.prototype.evaluate=function(e,t){for(var o=0;o<this.opnds.length;o++)if(!this.opnds[o].evaluate(e,t))return!1;return!0},i.prototype.evalPrecedence=function(e,t){for(var o=!1,n=[],p=0;p<this.opnds.length;p++){var a=this.opnds[p],i=a.evalPrecedence(e,t);if(o|=i!==a,null===i)return null;i!==r.NONE&&n.push(i)}if(!o)return this;if(0===n.length)return r.NONE;var s=null;return n.map(function(e){s=null===s?e:r.andContext(s,e)}),s},i.prototype.toString=function(){var e="";return this.opnds.map(function(t){e+="&& "+t.toString()}),3<e.length?e.slice(3):e},d.prototype=Object.create(r.prototype),d.prototype.constructor=d,d.prototype.constructor=function(e){return!(this!==e)||!!(e instanceof d)&&this.opnds===e.opnds},d.prototype.updateHashCode=function(e){e.update(this.opnds,"OR")},d.prototype.evaluate=function(e,t){for(var o=0;o<this.opnds.length;o++)if(this.opnds[o].evaluate(e,t))return!0;return!1},d.prototype.evalPrecedence=function(e,t){for(var o=!1,n=[],p=0;p<this.opnds.length;p++){var a=this.opnds[p],i=a.evalPrecedence(e,t);if(o|=i!==a,i===r.NONE)return r.NONE;null!==i&&n.push(i)}if(!o)return this;if(0===n.length)return null;var s=null;return n.map(function(e){return e}),s},d.prototype.toString=function(){var e="";return this.opnds.map(function(t){e+="|| "+t.toString()}),3<e.length?e.slice(3):e},o.SemanticContext=r,o.PrecedencePredicate=p,o.Predicate=n},{"./../Utils":23}],38:[function(e,t,o){function r(e){if(void 0===e||null===e)throw"target cannot be null.";return this.target=e,this.isEpsilon=!1,this.label=null,this}function n(e,t){return r.call(this,e),this.label_=t,this.label=this.makeLabel(),this.serializationType=r.ATOM,this}function p(e,t,o,n){return r.call(this,e),this.ruleIndex=t,this.precedence=o,this.followState=n,this.serializationType=r.RULE,this.isEpsilon=!0,this}function a(e,t){return r.call(this,e),this.serializationType=r.EPSILON,this.isEpsilon=!0,this.outermostPrecedenceReturn=t,this}function i(e,t,o){return r.call(this,e),this.serializationType=r.RANGE,this.start=t,this.stop=o,this.label=this.makeLabel(),this}function s(e){return r.call(this,e),this}function d(e,t,o,n){return s.call(this,e),this.serializationType=r.PREDICATE,this.ruleIndex=t,this.predIndex=o,this.isCtxDependent=n,this.isEpsilon=!0,this}function c(e,t,o,n){return r.call(this,e),this.serializationType=r.ACTION,this.ruleIndex=t,this.actionIndex=void 0===o?-1:o,this.isCtxDependent=void 0!==n&&n,this.isEpsilon=!0,this}function l(e,t){return r.call(this,e),this.serializationType=r.SET,void 0!==t&&null!==t?this.label=t:(this.label=new _,this.label.addOne(x.INVALID_TYPE)),this}function u(e,t){return l.call(this,e,t),this.serializationType=r.NOT_SET,this}function y(e){return r.call(this,e),this.serializationType=r.WILDCARD,this}function g(e,t){return s.call(this,e),this.serializationType=r.PRECEDENCE,this.precedence=t,this.isEpsilon=!0,this}var T=String.fromCharCode,x=e("./../Token").Token,m=e("./../IntervalSet").Interval,_=e("./../IntervalSet").IntervalSet,S=e("./SemanticContext").Predicate,f=e("./SemanticContext").PrecedencePredicate;r.EPSILON=1,r.RANGE=2,r.RULE=3,r.PREDICATE=4,r.ATOM=5,r.ACTION=6,r.SET=7,r.NOT_SET=8,r.WILDCARD=9,r.PRECEDENCE=10,r.serializationNames=["INVALID","EPSILON","RANGE","RULE","PREDICATE","ATOM","ACTION","SET","NOT_SET","WILDCARD","PRECEDENCE"],r.serializationTypes={EpsilonTransition:r.EPSILON,RangeTransition:r.RANGE,RuleTransition:r.RULE,PredicateTransition:r.PREDICATE,AtomTransition:r.ATOM,ActionTransition:r.ACTION,SetTransition:r.SET,NotSetTransition:r.NOT_SET,WildcardTransition:r.WILDCARD,PrecedencePredicateTransition:r.PRECEDENCE},n.prototype=Object.create(r.prototype),n.prototype.constructor=n,n.prototype.makeLabel=function(){var e=new _;return e.addOne(this.label_),e},n.prototype.matches=function(e){return this.label_===e},n.prototype.toString=function(){return this.label_},p.prototype=Object.create(r.prototype),p.prototype.constructor=p,p.prototype.matches=function(){return!1},a.prototype=Object.create(r.prototype),a.prototype.constructor=a,a.prototype.matches=function(){return!1},a.prototype.toString=function(){return"epsilon"},i.prototype=Object.create(r.prototype),i.prototype.constructor=i,i.prototype.makeLabel=function(){var e=new _;return e.addRange(this.start,this.stop),e},i.prototype.matches=function(e){return e>=this.start&&e<=this.stop},i.prototype.toString=function(){return"'"+T(this.start)+"'..'"+T(this.stop)+"'"},s.prototype=Object.create(r.prototype),s.prototype.constructor=s,d.prototype=Object.create(s.prototype),d.prototype.constructor=d,d.prototype.matches=function(){return!1},d.prototype.getPredicate=function(){return new S(this.ruleIndex,this.predIndex,this.isCtxDependent)},d.prototype.toString=function(){return"pred_"+this.ruleIndex+":"+this.predIndex},c.prototype=Object.create(r.prototype),c.prototype.constructor=c,c.prototype.matches=function(){return!1},c.prototype.toString=function(){return"action_"+this.ruleIndex+":"+this.actionIndex},l.prototype=Object.create(r.prototype),l.prototype.constructor=l,l.prototype.matches=function(e){return this.label.contains(e)},l.prototype.toString=function(){return this.label.toString()},u.prototype=Object.create(l.prototype),u.prototype.constructor=u,u.prototype.matches=function(e,t,o){return e>=t&&e<=o&&!l.prototype.matches.call(this,e,t,o)},u.prototype.toString=function(){return"~"+l.prototype.toString.call(this)},y.prototype=Object.create(r.prototype),y.prototype.constructor=y,y.prototype.matches=function(e,t,o){return e>=t&&e<=o},y.prototype.toString=function(){return"."},g.prototype=Object.create(s.prototype),g.prototype.constructor=g,g.prototype.matches=function(){return!1},g.prototype.getPredicate=function(){return new f(this.precedence)},g.prototype.toString=function(){return this.precedence+" >= _p"},o.Transition=r,o.AtomTransition=n,o.SetTransition=l,o.NotSetTransition=u,o.RuleTransition=p,o.ActionTransition=c,o.EpsilonTransition=a,o.RangeTransition=i,o.WildcardTransition=y,o.PredicateTransition=d,o.PrecedencePredicateTransition=g,o.AbstractPredicateTransition=s},{"./../IntervalSet":14,"./../Token":22,"./SemanticContext":37}],39:[function(e,t,o){o.ATN=e("./ATN").ATN,o.ATNDeserializer=e("./ATNDeserializer").ATNDeserializer,o.LexerATNSimulator=e("./LexerATNSimulator").LexerATNSimulator,o.ParserATNSimulator=e("./ParserATNSimulator").ParserATNSimulator,o.PredictionMode=e("./PredictionMode").PredictionMode},{"./ATN":24,"./ATNDeserializer":28,"./LexerATNSimulator":32,"./ParserATNSimulator":35,"./PredictionMode":36}],40:[function(e,t,o){function r(e,t){if(void 0===t&&(t=0),this.atnStartState=e,this.decision=t,this._states=new n,this.s0=null,this.precedenceDfa=!1,e instanceof a&&e.isPrecedenceDecision){this.precedenceDfa=!0;var o=new p(null,new i());o.edges=[],o.isAcceptState=!1,o.requiresFullContext=!1,this.s0=o}return this}var n=e("../Utils").Set,p=e("./DFAState").DFAState,a=e("../atn/ATNState").StarLoopEntryState,i=e("./../atn/ATNConfigSet").ATNConfigSet,s=e("./DFASerializer").DFASerializer,d=e("./DFASerializer").LexerDFASerializer;r.prototype.getPrecedenceStartState=function(e){if(!this.precedenceDfa)throw"Only precedence DFAs may contain a precedence start state.";return 0>e||e>=this.s0.edges.length?null:this.s0.edges[e]||null},r.prototype.setPrecedenceStartState=function(e,t){if(!this.precedenceDfa)throw"Only precedence DFAs may contain a precedence start state.";0>e||(this.s0.edges[e]=t)},r.prototype.setPrecedenceDfa=function(e){if(this.precedenceDfa!==e){if(this._states=new DFAStatesSet,e){var t=new p(null,new i());t.edges=[],t.isAcceptState=!1,t.requiresFullContext=!1,this.s0=t}else this.s0=null;this.precedenceDfa=e}},Object.defineProperty(r.prototype,"states",{get:function(){return this._states}}),r.prototype.sortedStates=function(){var e=this._states.values();return e.sort(function(e,t){return e.stateNumber-t.stateNumber})},r.prototype.toString=function(e,t){if(e=e||null,t=t||null,null===this.s0)return"";var o=new s(this,e,t);return o.toString()},r.prototype.toLexerString=function(){if(null===this.s0)return"";var e=new d(this);return e.toString()},o.DFA=r},{"../Utils":23,"../atn/ATNState":30,"./../atn/ATNConfigSet":26,"./DFASerializer":41,"./DFAState":42}],41:[function(e,t,o){function r(e,t,o){return this.dfa=e,this.literalNames=t||[],this.symbolicNames=o||[],this}function n(e){return r.call(this,e,null),this}var p=String.fromCharCode;r.prototype.toString=function(){if(null===this.dfa.s0)return null;for(var e="",o=this.dfa.sortedStates(),r=0,p;r<o.length;r++)if(p=o[r],null!==p.edges)for(var a=p.edges.length,n=0,i;n<a;n++)i=p.edges[n]||null,null!==i&&2147483647!==i.stateNumber&&(e=e.concat(this.getStateString(p)),e=e.concat("-"),e=e.concat(this.getEdgeLabel(n)),e=e.concat("->"),e=e.concat(this.getStateString(i)),e=e.concat("\n"));return 0===e.length?null:e},r.prototype.getEdgeLabel=function(e){return 0===e?"EOF":null!==this.literalNames||null!==this.symbolicNames?this.literalNames[e-1]||this.symbolicNames[e-1]:p(e-1)},r.prototype.getStateString=function(e){var t=(e.isAcceptState?":":"")+"s"+e.stateNumber+(e.requiresFullContext?"^":"");return e.isAcceptState?null===e.predicates?t+"=>"+e.prediction.toString():t+"=>"+e.predicates.toString():t},n.prototype=Object.create(r.prototype),n.prototype.constructor=n,n.prototype.getEdgeLabel=function(e){return"'"+p(e)+"'"},o.DFASerializer=r,o.LexerDFASerializer=n},{}],42:[function(e,t,o){function r(e,t){return this.alt=t,this.pred=e,this}function n(e,t){return null===e&&(e=-1),null===t&&(t=new p),this.stateNumber=e,this.configs=t,this.edges=null,this.isAcceptState=!1,this.prediction=0,this.lexerActionExecutor=null,this.requiresFullContext=!1,this.predicates=null,this}var p=e("./../atn/ATNConfigSet").ATNConfigSet,a=e("./../Utils"),i=a.Hash,s=a.Set;r.prototype.toString=function(){return"("+this.pred+", "+this.alt+")"},n.prototype.getAltSet=function(){var e=new s;if(null!==this.configs)for(var t=0,o;t<this.configs.length;t++)o=this.configs[t],e.add(o.alt);return 0===e.length?null:e},n.prototype.equals=function(e){return this===e||e instanceof n&&this.configs.equals(e.configs)},n.prototype.toString=function(){var e=""+this.stateNumber+":"+this.configs;return this.isAcceptState&&(e+="=>",e+=null===this.predicates?this.prediction:this.predicates),e},n.prototype.hashCode=function(){var e=new i;return e.update(this.configs),this.isAcceptState&&(null===this.predicates?e.update(this.prediction):e.update(this.predicates)),e.finish()},o.DFAState=n,o.PredPrediction=r},{"./../Utils":23,"./../atn/ATNConfigSet":26}],43:[function(e,t,o){o.DFA=e("./DFA").DFA,o.DFASerializer=e("./DFASerializer").DFASerializer,o.LexerDFASerializer=e("./DFASerializer").LexerDFASerializer,o.PredPrediction=e("./DFAState").PredPrediction},{"./DFA":40,"./DFASerializer":41,"./DFAState":42}],44:[function(e,t,o){function r(e){return p.call(this),e=e||!0,this.exactOnly=e,this}var n=e("./../Utils").BitSet,p=e("./ErrorListener").ErrorListener,a=e("./../IntervalSet").Interval;r.prototype=Object.create(p.prototype),r.prototype.constructor=r,r.prototype.reportAmbiguity=function(e,t,o,r,n,p,i){if(!this.exactOnly||n){var s="reportAmbiguity d="+this.getDecisionDescription(e,t)+": ambigAlts="+this.getConflictingAlts(p,i)+", input='"+e.getTokenStream().getText(new a(o,r))+"'";e.notifyErrorListeners(s)}},r.prototype.reportAttemptingFullContext=function(e,t,o,r){var n="reportAttemptingFullContext d="+this.getDecisionDescription(e,t)+", input='"+e.getTokenStream().getText(new a(o,r))+"'";e.notifyErrorListeners(n)},r.prototype.reportContextSensitivity=function(e,t,o,r){var n="reportContextSensitivity d="+this.getDecisionDescription(e,t)+", input='"+e.getTokenStream().getText(new a(o,r))+"'";e.notifyErrorListeners(n)},r.prototype.getDecisionDescription=function(e,t){var o=t.decision,r=t.atnStartState.ruleIndex,n=e.ruleNames;if(0>r||r>=n.length)return""+o;var p=n[r]||null;return null===p||0===p.length?""+o:""+o+" ("+p+")"},r.prototype.getConflictingAlts=function(e,t){if(null!==e)return e;for(var o=new n,r=0;r<t.items.length;r++)o.add(t.items[r].alt);return"{"+o.values().join(", ")+"}"},o.DiagnosticErrorListener=r},{"./../IntervalSet":14,"./../Utils":23,"./ErrorListener":45}],45:[function(e,t,o){function r(){return this}function n(){return r.call(this),this}function p(e){if(r.call(this),null===e)throw"delegates";return this.delegates=e,this}r.prototype.syntaxError=function(){},r.prototype.reportAmbiguity=function(){},r.prototype.reportAttemptingFullContext=function(){},r.prototype.reportContextSensitivity=function(){},n.prototype=Object.create(r.prototype),n.prototype.constructor=n,n.INSTANCE=new n,n.prototype.syntaxError=function(e,t,o,r,n){console.error("line "+o+":"+r+" "+n)},p.prototype=Object.create(r.prototype),p.prototype.constructor=p,p.prototype.syntaxError=function(t,o,r,n,p,a){this.delegates.map(function(e){e.syntaxError(t,o,r,n,p,a)})},p.prototype.reportAmbiguity=function(e,t,o,r,n,p,a){this.delegates.map(function(i){i.reportAmbiguity(e,t,o,r,n,p,a)})},p.prototype.reportAttemptingFullContext=function(e,t,o,r,n,p){this.delegates.map(function(a){a.reportAttemptingFullContext(e,t,o,r,n,p)})},p.prototype.reportContextSensitivity=function(e,t,o,r,n,p){this.delegates.map(function(a){a.reportContextSensitivity(e,t,o,r,n,p)})},o.ErrorListener=r,o.ConsoleErrorListener=n,o.ProxyErrorListener=p},{}],46:[function(e,t,o){function r(){}function n(){return r.call(this),this.errorRecoveryMode=!1,this.lastErrorIndex=-1,this.lastErrorStates=null,this}function p(){return n.call(this),this}var a=e("./../Token").Token,i=e("./Errors"),s=i.NoViableAltException,d=i.InputMismatchException,c=i.FailedPredicateException,l=i.ParseCancellationException,u=e("./../atn/ATNState").ATNState,y=e("./../IntervalSet").Interval,g=e("./../IntervalSet").IntervalSet;r.prototype.reset=function(){},r.prototype.recoverInline=function(){},r.prototype.recover=function(){},r.prototype.sync=function(){},r.prototype.inErrorRecoveryMode=function(){},r.prototype.reportError=function(){},n.prototype=Object.create(r.prototype),n.prototype.constructor=n,n.prototype.reset=function(e){this.endErrorCondition(e)},n.prototype.beginErrorCondition=function(){this.errorRecoveryMode=!0},n.prototype.inErrorRecoveryMode=function(){return this.errorRecoveryMode},n.prototype.endErrorCondition=function(){this.errorRecoveryMode=!1,this.lastErrorStates=null,this.lastErrorIndex=-1},n.prototype.reportMatch=function(e){this.endErrorCondition(e)},n.prototype.reportError=function(t,o){this.inErrorRecoveryMode(t)||(this.beginErrorCondition(t),o instanceof s?this.reportNoViableAlternative(t,o):o instanceof d?this.reportInputMismatch(t,o):o instanceof c?this.reportFailedPredicate(t,o):(console.log("unknown recognition error type: "+o.constructor.name),console.log(o.stack),t.notifyErrorListeners(o.getOffendingToken(),o.getMessage(),o)))},n.prototype.recover=function(e){this.lastErrorIndex===e.getInputStream().index&&null!==this.lastErrorStates&&0<=this.lastErrorStates.indexOf(e.state)&&e.consume(),this.lastErrorIndex=e._input.index,null===this.lastErrorStates&&(this.lastErrorStates=[]),this.lastErrorStates.push(e.state);var t=this.getErrorRecoverySet(e);this.consumeUntil(e,t)},n.prototype.sync=function(e){if(!this.inErrorRecoveryMode(e)){var t=e._interp.atn.states[e.state],o=e.getTokenStream().LA(1),r=e.atn.nextTokens(t);if(!(r.contains(a.EPSILON)||r.contains(o)))switch(t.stateType){case u.BLOCK_START:case u.STAR_BLOCK_START:case u.PLUS_BLOCK_START:case u.STAR_LOOP_ENTRY:if(null!==this.singleTokenDeletion(e))return;throw new d(e);break;case u.PLUS_LOOP_BACK:case u.STAR_LOOP_BACK:this.reportUnwantedToken(e);var n=new g;n.addSet(e.getExpectedTokens());var p=n.addSet(this.getErrorRecoverySet(e));this.consumeUntil(e,p);break;default:}}},n.prototype.reportNoViableAlternative=function(t,o){var e=t.getTokenStream(),r;r=null===e?"<unknown input>":o.startToken.type===a.EOF?"<EOF>":e.getText(new y(o.startToken.tokenIndex,o.offendingToken.tokenIndex));var n="no viable alternative at input "+this.escapeWSAndQuote(r);t.notifyErrorListeners(n,o.offendingToken,o)},n.prototype.reportInputMismatch=function(t,o){var e="mismatched input "+this.getTokenErrorDisplay(o.offendingToken)+" expecting "+o.getExpectedTokens().toString(t.literalNames,t.symbolicNames);t.notifyErrorListeners(e,o.offendingToken,o)},n.prototype.reportFailedPredicate=function(t,o){var e=t.ruleNames[t._ctx.ruleIndex],r="rule "+e+" "+o.message;t.notifyErrorListeners(r,o.offendingToken,o)},n.prototype.reportUnwantedToken=function(e){if(!this.inErrorRecoveryMode(e)){this.beginErrorCondition(e);var o=e.getCurrentToken(),t=this.getTokenErrorDisplay(o),r=this.getExpectedTokens(e),n="extraneous input "+t+" expecting "+r.toString(e.literalNames,e.symbolicNames);e.notifyErrorListeners(n,o,null)}},n.prototype.reportMissingToken=function(e){if(!this.inErrorRecoveryMode(e)){this.beginErrorCondition(e);var o=e.getCurrentToken(),t=this.getExpectedTokens(e),r="missing "+t.toString(e.literalNames,e.symbolicNames)+" at "+this.getTokenErrorDisplay(o);e.notifyErrorListeners(r,o,null)}},n.prototype.recoverInline=function(e){var t=this.singleTokenDeletion(e);if(null!==t)return e.consume(),t;if(this.singleTokenInsertion(e))return this.getMissingSymbol(e);throw new d(e)},n.prototype.singleTokenInsertion=function(e){var t=e.getTokenStream().LA(1),o=e._interp.atn,r=o.states[e.state],n=r.transitions[0].target,p=o.nextTokens(n,e._ctx);return!!p.contains(t)&&(this.reportMissingToken(e),!0)},n.prototype.singleTokenDeletion=function(e){var t=e.getTokenStream().LA(2),o=this.getExpectedTokens(e);if(o.contains(t)){this.reportUnwantedToken(e),e.consume();var r=e.getCurrentToken();return this.reportMatch(e),r}return null},n.prototype.getMissingSymbol=function(e){var t=e.getCurrentToken(),o=this.getExpectedTokens(e),r=o.first(),n;n=r===a.EOF?"<missing EOF>":"<missing "+e.literalNames[r]+">";var p=t,i=e.getTokenStream().LT(-1);return p.type===a.EOF&&null!==i&&(p=i),e.getTokenFactory().create(p.source,r,n,a.DEFAULT_CHANNEL,-1,-1,p.line,p.column)},n.prototype.getExpectedTokens=function(e){return e.getExpectedTokens()},n.prototype.getTokenErrorDisplay=function(e){if(null===e)return"<no token>";var t=e.text;return null===t&&(e.type===a.EOF?t="<EOF>":t="<"+e.type+">"),this.escapeWSAndQuote(t)},n.prototype.escapeWSAndQuote=function(e){return e=e.replace(/\n/g,"\\n"),e=e.replace(/\r/g,"\\r"),e=e.replace(/\t/g,"\\t"),"'"+e+"'"},n.prototype.getErrorRecoverySet=function(e){for(var t=e._interp.atn,o=e._ctx,r=new g;null!==o&&0<=o.invokingState;){var n=t.states[o.invokingState],p=n.transitions[0],i=t.nextTokens(p.followState);r.addSet(i),o=o.parentCtx}return r.removeOne(a.EPSILON),r},n.prototype.consumeUntil=function(e,t){for(var o=e.getTokenStream().LA(1);o!==a.EOF&&!t.contains(o);)e.consume(),o=e.getTokenStream().LA(1)},p.prototype=Object.create(n.prototype),p.prototype.constructor=p,p.prototype.recover=function(t,o){for(var e=t._ctx;null!==e;)e.exception=o,e=e.parentCtx;throw new l(o)},p.prototype.recoverInline=function(e){this.recover(e,new d(e))},p.prototype.sync=function(){},o.BailErrorStrategy=p,o.DefaultErrorStrategy=n},{"./../IntervalSet":14,"./../Token":22,"./../atn/ATNState":30,"./Errors":47}],47:[function(e,t,o){function r(e){if(Error.call(this),!!Error.captureStackTrace)Error.captureStackTrace(this,r);else new Error().stack;return this.message=e.message,this.recognizer=e.recognizer,this.input=e.input,this.ctx=e.ctx,this.offendingToken=null,this.offendingState=-1,null!==this.recognizer&&(this.offendingState=this.recognizer.state),this}function n(e,t,o,n){return r.call(this,{message:"",recognizer:e,input:t,ctx:null}),this.startIndex=o,this.deadEndConfigs=n,this}function p(e,t,o,n,p,a){a=a||e._ctx,n=n||e.getCurrentToken(),o=o||e.getCurrentToken(),t=t||e.getInputStream(),r.call(this,{message:"",recognizer:e,input:t,ctx:a}),this.deadEndConfigs=p,this.startToken=o,this.offendingToken=n}function a(e){r.call(this,{message:"",recognizer:e,input:e.getInputStream(),ctx:e._ctx}),this.offendingToken=e.getCurrentToken()}function i(e,t,o){r.call(this,{message:this.formatMessage(t,o||null),recognizer:e,input:e.getInputStream(),ctx:e._ctx});var n=e._interp.atn.states[e.state],p=n.transitions[0];return p instanceof d?(this.ruleIndex=p.ruleIndex,this.predicateIndex=p.predIndex):(this.ruleIndex=0,this.predicateIndex=0),this.predicate=t,this.offendingToken=e.getCurrentToken(),this}function s(){return Error.call(this),Error.captureStackTrace(this,s),this}var d=e("./../atn/Transition").PredicateTransition;r.prototype=Object.create(Error.prototype),r.prototype.constructor=r,r.prototype.getExpectedTokens=function(){return null===this.recognizer?null:this.recognizer.atn.getExpectedTokens(this.offendingState,this.ctx)},r.prototype.toString=function(){return this.message},n.prototype=Object.create(r.prototype),n.prototype.constructor=n,n.prototype.toString=function(){var e="";return 0<=this.startIndex&&this.startIndex<this.input.size&&(e=this.input.getText((this.startIndex,this.startIndex))),"LexerNoViableAltException"+e},p.prototype=Object.create(r.prototype),p.prototype.constructor=p,a.prototype=Object.create(r.prototype),a.prototype.constructor=a,i.prototype=Object.create(r.prototype),i.prototype.constructor=i,i.prototype.formatMessage=function(e,t){return null===t?"failed predicate: {"+e+"}?":t},s.prototype=Object.create(Error.prototype),s.prototype.constructor=s,o.RecognitionException=r,o.NoViableAltException=p,o.LexerNoViableAltException=n,o.InputMismatchException=a,o.FailedPredicateException=i,o.ParseCancellationException=s},{"./../atn/Transition":38}],48:[function(e,t,o){o.RecognitionException=e("./Errors").RecognitionException,o.NoViableAltException=e("./Errors").NoViableAltException,o.LexerNoViableAltException=e("./Errors").LexerNoViableAltException,o.InputMismatchException=e("./Errors").InputMismatchException,o.FailedPredicateException=e("./Errors").FailedPredicateException,o.DiagnosticErrorListener=e("./DiagnosticErrorListener").DiagnosticErrorListener,o.BailErrorStrategy=e("./ErrorStrategy").BailErrorStrategy,o.ErrorListener=e("./ErrorListener").ErrorListener},{"./DiagnosticErrorListener":44,"./ErrorListener":45,"./ErrorStrategy":46,"./Errors":47}],49:[function(e,t,o){o.atn=e("./atn/index"),o.codepointat=e("./polyfills/codepointat"),o.dfa=e("./dfa/index"),o.fromcodepoint=e("./polyfills/fromcodepoint"),o.tree=e("./tree/index"),o.error=e("./error/index"),o.Token=e("./Token").Token,o.CharStreams=e("./CharStreams").CharStreams,o.CommonToken=e("./Token").CommonToken,o.InputStream=e("./InputStream").InputStream,o.FileStream=e("./FileStream").FileStream,o.CommonTokenStream=e("./CommonTokenStream").CommonTokenStream,o.Lexer=e("./Lexer").Lexer,o.Parser=e("./Parser").Parser;var r=e("./PredictionContext");o.PredictionContextCache=r.PredictionContextCache,o.ParserRuleContext=e("./ParserRuleContext").ParserRuleContext,o.Interval=e("./IntervalSet").Interval,o.Utils=e("./Utils")},{"./CharStreams":9,"./CommonTokenStream":11,"./FileStream":12,"./InputStream":13,"./IntervalSet":14,"./Lexer":16,"./Parser":17,"./ParserRuleContext":18,"./PredictionContext":19,"./Token":22,"./Utils":23,"./atn/index":39,"./dfa/index":43,"./error/index":48,"./polyfills/codepointat":50,"./polyfills/fromcodepoint":51,"./tree/index":54}],50:[function(){var e=String.prototype;e.codePointAt||function(){"use strict";var t=function(){try{var e={},t=Object.defineProperty,o=t(e,e,e)&&t}catch(e){}return o}(),o=function(e){if(null==this)throw TypeError();var t=this+"",o=t.length,r=e?+e:0;if(r!=r&&(r=0),!(0>r||r>=o)){var n=t.charCodeAt(r),p;return 55296<=n&&56319>=n&&o>r+1&&(p=t.charCodeAt(r+1),56320<=p&&57343>=p)?1024*(n-55296)+p-56320+65536:n}};t?t(String.prototype,"codePointAt",{value:o,configurable:!0,writable:!0}):e.codePointAt=o}()},{}],51:[function(){var e=String.fromCodePoint;e||function(){var t=function(){try{var e={},t=Object.defineProperty,o=t(e,e,e)&&t}catch(e){}return o}(),o=String.fromCharCode,r=Math.floor,n=function(){var e=[],t=-1,n=arguments.length,p,a;if(!n)return"";for(var i="";++t<n;){var s=+arguments[t];if(!isFinite(s)||0>s||1114111<s||r(s)!=s)throw RangeError("Invalid code point: "+s);65535>=s?e.push(s):(s-=65536,p=(s>>10)+55296,a=s%1024+56320,e.push(p,a)),(t+1==n||e.length>16384)&&(i+=o.apply(null,e),e.length=0)}return i};t?t(String,"fromCodePoint",{value:n,configurable:!0,writable:!0}):e=n}()},{}],52:[function(e,t,o){function r(){return this}function n(){return r.call(this),this}function p(){return n.call(this),this}function a(){return p.call(this),this}function s(){return p.call(this),this}function d(){return s.call(this),this}function i(){return this}function c(){return this}function l(e){return s.call(this),this.parentCtx=null,this.symbol=e,this}function u(e){return l.call(this,e),this}function y(){return this}var g=e("./../Token").Token,T=e("./../IntervalSet").Interval,x=new T(-1,-2),m=e("../Utils.js");n.prototype=Object.create(r.prototype),n.prototype.constructor=n,p.prototype=Object.create(n.prototype),p.prototype.constructor=p,a.prototype=Object.create(p.prototype),a.prototype.constructor=a,s.prototype=Object.create(p.prototype),s.prototype.constructor=s,d.prototype=Object.create(s.prototype),d.prototype.constructor=d,i.prototype.visit=function(e){return Array.isArray(e)?e.map(function(e){return e.accept(this)},this):e.accept(this)},i.prototype.visitChildren=function(e){return this.visit(e.children)},i.prototype.visitTerminal=function(){},i.prototype.visitErrorNode=function(){},c.prototype.visitTerminal=function(){},c.prototype.visitErrorNode=function(){},c.prototype.enterEveryRule=function(){},c.prototype.exitEveryRule=function(){},l.prototype=Object.create(s.prototype),l.prototype.constructor=l,l.prototype.getChild=function(){return null},l.prototype.getSymbol=function(){return this.symbol},l.prototype.getParent=function(){return this.parentCtx},l.prototype.getPayload=function(){return this.symbol},l.prototype.getSourceInterval=function(){if(null===this.symbol)return x;var e=this.symbol.tokenIndex;return new T(e,e)},l.prototype.getChildCount=function(){return 0},l.prototype.accept=function(e){return e.visitTerminal(this)},l.prototype.getText=function(){return this.symbol.text},l.prototype.toString=function(){return this.symbol.type===g.EOF?"<EOF>":this.symbol.text},u.prototype=Object.create(l.prototype),u.prototype.constructor=u,u.prototype.isErrorNode=function(){return!0},u.prototype.accept=function(e){return e.visitErrorNode(this)},y.prototype.walk=function(e,o){var t=o instanceof d||o.isErrorNode!==void 0&&o.isErrorNode();if(t)e.visitErrorNode(o);else if(o instanceof s)e.visitTerminal(o);else{this.enterRule(e,o);for(var r=0,n;r<o.getChildCount();r++)n=o.getChild(r),this.walk(e,n);this.exitRule(e,o)}},y.prototype.enterRule=function(e,t){var o=t.getRuleContext();e.enterEveryRule(o),o.enterRule(e)},y.prototype.exitRule=function(e,t){var o=t.getRuleContext();o.exitRule(e),e.exitEveryRule(o)},y.DEFAULT=new y,o.RuleNode=a,o.ErrorNode=d,o.TerminalNode=s,o.ErrorNodeImpl=u,o.TerminalNodeImpl=l,o.ParseTreeListener=c,o.ParseTreeVisitor=i,o.ParseTreeWalker=y,o.INVALID_INTERVAL=x},{"../Utils.js":23,"./../IntervalSet":14,"./../Token":22}],53:[function(e,t,o){function r(){}var n=e("./../Utils"),p=e("./../Token").Token,a=e("./Tree").RuleNode,i=e("./Tree").ErrorNode,s=e("./Tree").TerminalNode,d=e("./../ParserRuleContext").ParserRuleContext,c=e("./../RuleContext").RuleContext,l=e("./../atn/ATN").INVALID_ALT_NUMBER;r.toStringTree=function(e,t,o){t=t||null,o=o||null,null!==o&&(t=o.ruleNames);var p=r.getNodeText(e,t);p=n.escapeWhitespace(p,!1);var a=e.getChildCount();if(0===a)return p;var s="("+p+" ";0<a&&(p=r.toStringTree(e.getChild(0),t),s=s.concat(p));for(var d=1;d<a;d++)p=r.toStringTree(e.getChild(d),t),s=s.concat(" "+p);return s=s.concat(")"),s},r.getNodeText=function(e,t,o){if(t=t||null,o=o||null,null!==o&&(t=o.ruleNames),null!==t){if(e instanceof c){var r=e.getAltNumber();return r==l?t[e.ruleIndex]:t[e.ruleIndex]+":"+r}if(e instanceof i)return e.toString();if(e instanceof s&&null!==e.symbol)return e.symbol.text}var n=e.getPayload();return n instanceof p?n.text:e.getPayload().toString()},r.getChildren=function(e){for(var t=[],o=0;o<e.getChildCount();o++)t.push(e.getChild(o));return t},r.getAncestors=function(e){var t=[];for(e=e.getParent();null!==e;)t=[e].concat(t),e=e.getParent();return t},r.findAllTokenNodes=function(e,t){return r.findAllNodes(e,t,!0)},r.findAllRuleNodes=function(e,t){return r.findAllNodes(e,t,!1)},r.findAllNodes=function(e,t,o){var n=[];return r._findAllNodes(e,t,o,n),n},r._findAllNodes=function(e,t,o,n){o&&e instanceof s?e.symbol.type===t&&n.push(e):!o&&e instanceof d&&e.ruleIndex===t&&n.push(e);for(var p=0;p<e.getChildCount();p++)r._findAllNodes(e.getChild(p),t,o,n)},r.descendants=function(e){for(var t=[e],o=0;o<e.getChildCount();o++)t=t.concat(r.descendants(e.getChild(o)));return t},o.Trees=r},{"./../ParserRuleContext":18,"./../RuleContext":21,"./../Token":22,"./../Utils":23,"./../atn/ATN":24,"./Tree":52}],54:[function(e,t,o){var r=e("./Tree");o.Trees=e("./Trees").Trees,o.RuleNode=r.RuleNode,o.ParseTreeListener=r.ParseTreeListener,o.ParseTreeVisitor=r.ParseTreeVisitor,o.ParseTreeWalker=r.ParseTreeWalker},{"./Tree":52,"./Trees":53}],55:[function(){},{}]},{},[4]);
\ No newline at end of file
+(function(){function p(d,e,t){function r(i,o){if(!e[i]){if(!d[i]){var s="function"==typeof require&&require;if(!o&&s)return s(i,!0);if(n)return n(i,!0);var a=new Error("Cannot find module '"+i+"'");throw a.code="MODULE_NOT_FOUND",a}var c=e[i]={exports:{}};d[i][0].call(c.exports,function(t){var e=d[i][1][t];return r(e?e:t)},c,c.exports,p,d,e,t)}return e[i].exports}for(var n="function"==typeof require&&require,a=0;a<t.length;a++)r(t[a]);return r}return p})()({1:[function(e,t,o){function r(e){return n.Lexer.call(this,e),this._interp=new n.atn.LexerATNSimulator(this,p,a,new n.PredictionContextCache()),this}var n=e("antlr4/index"),p=new n.atn.ATNDeserializer().deserialize("\x03\u608B\uA72A\u8133\uB9ED\u417C\u3BE7\u7786\u5964\x02\x12w\b\x01\x04\x02\t\x02\x04\x03\t\x03\x04\x04\t\x04\x04\x05\t\x05\x04\x06\t\x06\x04\x07\t\x07\x04\b\t\b\x04\t\t\t\x04\n\t\n\x04\x0B\t\x0B\x04\f\t\f\x04\r\t\r\x04\x0E\t\x0E\x04\x0F\t\x0F\x04\x10\t\x10\x04\x11\t\x11\x03\x02\x03\x02\x03\x03\x03\x03\x03\x04\x03\x04\x03\x05\x03\x05\x03\x05\x03\x05\x03\x05\x03\x05\x03\x05\x03\x05\x03\x05\x03\x06\x03\x06\x03\x06\x03\x06\x03\x06\x03\x07\x03\x07\x03\x07\x03\x07\x03\x07\x03\b\x03\b\x03\b\x03\b\x03\b\x03\b\x03\b\x03\t\x03\t\x03\t\x03\t\x03\t\x03\t\x03\n\x03\n\x03\n\x03\n\x05\nN\n\n\x03\x0B\x03\x0B\x03\x0B\x03\x0B\x03\x0B\x03\f\x03\f\x03\f\x03\f\x03\f\x03\f\x03\f\x03\r\x03\r\x07\r^\n\r\f\r\x0E\ra\x0B\r\x03\x0E\x06\x0Ed\n\x0E\r\x0E\x0E\x0Ee\x03\x0F\x03\x0F\x07\x0Fj\n\x0F\f\x0F\x0E\x0Fm\x0B\x0F\x03\x10\x05\x10p\n\x10\x03\x10\x03\x10\x03\x11\x03\x11\x03\x11\x03\x11\x02\x02\x12\x03\x03\x05\x04\x07\x05\t\x06\x0B\x07\r\b\x0F\t\x11\n\x13\x0B\x15\f\x17\r\x19\x0E\x1B\x0F\x1D\x10\x1F\x11!\x12\x03\x02\b\x04\x02hhvv\x04\x02C\\c|\x07\x02//2;C\\aac|\x03\x022;\x04\x02\f\f\x0F\x0F\x04\x02\x0B\x0B\"\"\x02{\x02\x03\x03\x02\x02\x02\x02\x05\x03\x02\x02\x02\x02\x07\x03\x02\x02\x02\x02\t\x03\x02\x02\x02\x02\x0B\x03\x02\x02\x02\x02\r\x03\x02\x02\x02\x02\x0F\x03\x02\x02\x02\x02\x11\x03\x02\x02\x02\x02\x13\x03\x02\x02\x02\x02\x15\x03\x02\x02\x02\x02\x17\x03\x02\x02\x02\x02\x19\x03\x02\x02\x02\x02\x1B\x03\x02\x02\x02\x02\x1D\x03\x02\x02\x02\x02\x1F\x03\x02\x02\x02\x02!\x03\x02\x02\x02\x03#\x03\x02\x02\x02\x05%\x03\x02\x02\x02\x07'\x03\x02\x02\x02\t)\x03\x02\x02\x02\x0B2\x03\x02\x02\x02\r7\x03\x02\x02\x02\x0F<\x03\x02\x02\x02\x11C\x03\x02\x02\x02\x13I\x03\x02\x02\x02\x15O\x03\x02\x02\x02\x17T\x03\x02\x02\x02\x19[\x03\x02\x02\x02\x1Bc\x03\x02\x02\x02\x1Dg\x03\x02\x02\x02\x1Fo\x03\x02\x02\x02!s\x03\x02\x02\x02#$\x07<\x02\x02$\x04\x03\x02\x02\x02%&\x07?\x02\x02&\x06\x03\x02\x02\x02'(\x07.\x02\x02(\b\x03\x02\x02\x02)*\x070\x02\x02*+\x07i\x02\x02+,\x07n\x02\x02,-\x07q\x02\x02-.\x07d\x02\x02./\x07c\x02\x02/0\x07n\x02\x0201\x07u\x02\x021\n\x03\x02\x02\x0223\x070\x02\x0234\x07f\x02\x0245\x07g\x02\x0256\x07h\x02\x026\f\x03\x02\x02\x0278\x07c\x02\x0289\x07t\x02\x029:\x07i\x02\x02:;\x07u\x02\x02;\x0E\x03\x02\x02\x02<=\x07n\x02\x02=>\x07q\x02\x02>?\x07e\x02\x02?@\x07c\x02\x02@A\x07n\x02\x02AB\x07u\x02\x02B\x10\x03\x02\x02\x02CD\x07u\x02\x02DE\x07v\x02\x02EF\x07c\x02\x02FG\x07e\x02\x02GH\x07m\x02\x02H\x12\x03\x02\x02\x02IJ\x07d\x02\x02JK\x07t\x02\x02KM\x03\x02\x02\x02LN\t\x02\x02\x02ML\x03\x02\x02\x02MN\x03\x02\x02\x02N\x14\x03\x02\x02\x02OP\x07e\x02\x02PQ\x07c\x02\x02QR\x07n\x02\x02RS\x07n\x02\x02S\x16\x03\x02\x02\x02TU\x07>\x02\x02UV\x07o\x02\x02VW\x07c\x02\x02WX\x07k\x02\x02XY\x07p\x02\x02YZ\x07@\x02\x02Z\x18\x03\x02\x02\x02[_\t\x03\x02\x02\\^\t\x04\x02\x02]\\\x03\x02\x02\x02^a\x03\x02\x02\x02_]\x03\x02\x02\x02_`\x03\x02\x02\x02`\x1A\x03\x02\x02\x02a_\x03\x02\x02\x02bd\t\x05\x02\x02cb\x03\x02\x02\x02de\x03\x02\x02\x02ec\x03\x02\x02\x02ef\x03\x02\x02\x02f\x1C\x03\x02\x02\x02gk\x07=\x02\x02hj\n\x06\x02\x02ih\x03\x02\x02\x02jm\x03\x02\x02\x02ki\x03\x02\x02\x02kl\x03\x02\x02\x02l\x1E\x03\x02\x02\x02mk\x03\x02\x02\x02np\x07\x0F\x02\x02on\x03\x02\x02\x02op\x03\x02\x02\x02pq\x03\x02\x02\x02qr\x07\f\x02\x02r \x03\x02\x02\x02st\t\x07\x02\x02tu\x03\x02\x02\x02uv\b\x11\x02\x02v\"\x03\x02\x02\x02\b\x02M_eko\x03\b\x02\x02"),a=p.decisionToState.map(function(e,t){return new n.dfa.DFA(e,t)});r.prototype=Object.create(n.Lexer.prototype),r.prototype.constructor=r,Object.defineProperty(r.prototype,"atn",{get:function(){return p}}),r.EOF=n.Token.EOF,r.T__0=1,r.T__1=2,r.T__2=3,r.GLOBALS=4,r.DEF=5,r.ARGS=6,r.LOCALS=7,r.STACK=8,r.BRANCH=9,r.CALL=10,r.MAINID=11,r.ID=12,r.NUM=13,r.COMMENT=14,r.EOL=15,r.WS=16,r.prototype.channelNames=["DEFAULT_TOKEN_CHANNEL","HIDDEN"],r.prototype.modeNames=["DEFAULT_MODE"],r.prototype.literalNames=[null,"':'","'='","','","'.globals'","'.def'","'args'","'locals'","'stack'",null,"'call'","'<main>'"],r.prototype.symbolicNames=[null,null,null,null,"GLOBALS","DEF","ARGS","LOCALS","STACK","BRANCH","CALL","MAINID","ID","NUM","COMMENT","EOL","WS"],r.prototype.ruleNames=["T__0","T__1","T__2","GLOBALS","DEF","ARGS","LOCALS","STACK","BRANCH","CALL","MAINID","ID","NUM","COMMENT","EOL","WS"],r.prototype.grammarFileName="asm.g4",o.asmLexer=r},{"antlr4/index":49}],2:[function(e,t,o){function r(){return n.tree.ParseTreeListener.call(this),this}var n=e("antlr4/index");r.prototype=Object.create(n.tree.ParseTreeListener.prototype),r.prototype.constructor=r,r.prototype.enterProgram=function(){},r.prototype.exitProgram=function(){},r.prototype.enterDef=function(){},r.prototype.exitDef=function(){},r.prototype.enterLabel=function(){},r.prototype.exitLabel=function(){},r.prototype.enterInstrLine=function(){},r.prototype.exitInstrLine=function(){},r.prototype.enterAsmComment=function(){},r.prototype.exitAsmComment=function(){},r.prototype.enterBranch=function(){},r.prototype.exitBranch=function(){},r.prototype.enterCall=function(){},r.prototype.exitCall=function(){},r.prototype.enterOtherInstr=function(){},r.prototype.exitOtherInstr=function(){},r.prototype.enterComment=function(){},r.prototype.exitComment=function(){},o.asmListener=r},{"antlr4/index":49}],3:[function(e,t,o){function r(e){return T.Parser.call(this,e),this._interp=new T.atn.ParserATNSimulator(this,m,_,S),this.ruleNames=E,this.literalNames=f,this.symbolicNames=h,this}function n(e,t,o){return void 0===t&&(t=null),(void 0===o||null===o)&&(o=-1),T.ParserRuleContext.call(this,t,o),this.parser=e,this.ruleIndex=r.RULE_program,this}function p(e,t,o){return void 0===t&&(t=null),(void 0===o||null===o)&&(o=-1),T.ParserRuleContext.call(this,t,o),this.parser=e,this.ruleIndex=r.RULE_line,this}function a(e,t){return p.call(this,e),p.prototype.copyFrom.call(this,t),this}function i(e,t){return p.call(this,e),p.prototype.copyFrom.call(this,t),this}function s(e,t){return p.call(this,e),p.prototype.copyFrom.call(this,t),this}function d(e,t){return p.call(this,e),p.prototype.copyFrom.call(this,t),this}function c(e,t,o){return void 0===t&&(t=null),(void 0===o||null===o)&&(o=-1),T.ParserRuleContext.call(this,t,o),this.parser=e,this.ruleIndex=r.RULE_instr,this}function l(e,t){return c.call(this,e),c.prototype.copyFrom.call(this,t),this}function u(e,t){return c.call(this,e),c.prototype.copyFrom.call(this,t),this}function y(e,t){return c.call(this,e),c.prototype.copyFrom.call(this,t),this}function g(e,t,o){return void 0===t&&(t=null),(void 0===o||null===o)&&(o=-1),T.ParserRuleContext.call(this,t,o),this.parser=e,this.ruleIndex=r.RULE_comment,this}var T=e("antlr4/index"),x=e("./asmListener").asmListener,m=new T.atn.ATNDeserializer().deserialize("\x03\u608B\uA72A\u8133\uB9ED\u417C\u3BE7\u7786\u5964\x03\x12?\x04\x02\t\x02\x04\x03\t\x03\x04\x04\t\x04\x04\x05\t\x05\x03\x02\x03\x02\x03\x02\x03\x02\x07\x02\x0F\n\x02\f\x02\x0E\x02\x12\x0B\x02\x03\x02\x03\x02\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x05\x03*\n\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x03\x05\x031\n\x03\x03\x04\x03\x04\x03\x04\x03\x04\x03\x04\x03\x04\x05\x049\n\x04\x05\x04;\n\x04\x03\x05\x03\x05\x03\x05\x02\x02\x06\x02\x04\x06\b\x02\x03\x03\x02\r\x0E\x02B\x02\n\x03\x02\x02\x02\x040\x03\x02\x02\x02\x06:\x03\x02\x02\x02\b<\x03\x02\x02\x02\n\x0B\x07\x06\x02\x02\x0B\f\x07\x0F\x02\x02\f\x10\x07\x11\x02\x02\r\x0F\x05\x04\x03\x02\x0E\r\x03\x02\x02\x02\x0F\x12\x03\x02\x02\x02\x10\x0E\x03\x02\x02\x02\x10\x11\x03\x02\x02\x02\x11\x13\x03\x02\x02\x02\x12\x10\x03\x02\x02\x02\x13\x14\x07\x02\x02\x03\x14\x03\x03\x02\x02\x02\x15\x16\x07\x07\x02\x02\x16\x17\t\x02\x02\x02\x17\x18\x07\x03\x02\x02\x18\x19\x07\b\x02\x02\x19\x1A\x07\x04\x02\x02\x1A\x1B\x07\x0F\x02\x02\x1B\x1C\x07\x05\x02\x02\x1C\x1D\x07\t\x02\x02\x1D\x1E\x07\x04\x02\x02\x1E\x1F\x07\x0F\x02\x02\x1F \x07\x05\x02\x02 !\x07\n\x02\x02!\"\x07\x04\x02\x02\"#\x07\x0F\x02\x02#1\x07\x11\x02\x02$%\x07\x0E\x02\x02%&\x07\x03\x02\x02&1\x07\x11\x02\x02')\x05\x06\x04\x02(*\x05\b\x05\x02)(\x03\x02\x02\x02)*\x03\x02\x02\x02*+\x03\x02\x02\x02+,\x07\x11\x02\x02,1\x03\x02\x02\x02-.\x05\b\x05\x02./\x07\x11\x02\x02/1\x03\x02\x02\x020\x15\x03\x02\x02\x020$\x03\x02\x02\x020'\x03\x02\x02\x020-\x03\x02\x02\x021\x05\x03\x02\x02\x0223\x07\x0B\x02\x023;\x07\x0E\x02\x0245\x07\f\x02\x025;\x07\x0E\x02\x0268\x07\x0E\x02\x0279\x07\x0F\x02\x0287\x03\x02\x02\x0289\x03\x02\x02\x029;\x03\x02\x02\x02:2\x03\x02\x02\x02:4\x03\x02\x02\x02:6\x03\x02\x02\x02;\x07\x03\x02\x02\x02<=\x07\x10\x02\x02=\t\x03\x02\x02\x02\x07\x10)08:"),_=m.decisionToState.map(function(e,t){return new T.dfa.DFA(e,t)}),S=new T.PredictionContextCache,f=[null,"':'","'='","','","'.globals'","'.def'","'args'","'locals'","'stack'",null,"'call'","'<main>'"],h=[null,null,null,null,"GLOBALS","DEF","ARGS","LOCALS","STACK","BRANCH","CALL","MAINID","ID","NUM","COMMENT","EOL","WS"],E=["program","line","instr","comment"];r.prototype=Object.create(T.Parser.prototype),r.prototype.constructor=r,Object.defineProperty(r.prototype,"atn",{get:function(){return m}}),r.EOF=T.Token.EOF,r.T__0=1,r.T__1=2,r.T__2=3,r.GLOBALS=4,r.DEF=5,r.ARGS=6,r.LOCALS=7,r.STACK=8,r.BRANCH=9,r.CALL=10,r.MAINID=11,r.ID=12,r.NUM=13,r.COMMENT=14,r.EOL=15,r.WS=16,r.RULE_program=0,r.RULE_line=1,r.RULE_instr=2,r.RULE_comment=3,n.prototype=Object.create(T.ParserRuleContext.prototype),n.prototype.constructor=n,n.prototype.GLOBALS=function(){return this.getToken(r.GLOBALS,0)},n.prototype.NUM=function(){return this.getToken(r.NUM,0)},n.prototype.EOL=function(){return this.getToken(r.EOL,0)},n.prototype.EOF=function(){return this.getToken(r.EOF,0)},n.prototype.line=function(e){return void 0===e&&(e=null),null===e?this.getTypedRuleContexts(p):this.getTypedRuleContext(p,e)},n.prototype.enterRule=function(e){e instanceof x&&e.enterProgram(this)},n.prototype.exitRule=function(e){e instanceof x&&e.exitProgram(this)},r.ProgramContext=n,r.prototype.program=function(){var e=new n(this,this._ctx,this.state);this.enterRule(e,0,r.RULE_program);var t=0;try{for(this.enterOuterAlt(e,1),this.state=8,this.match(r.GLOBALS),this.state=9,this.match(r.NUM),this.state=10,this.match(r.EOL),this.state=14,this._errHandler.sync(this),t=this._input.LA(1);0==(-32&t)&&0!=(1<<t&(1<<r.DEF|1<<r.BRANCH|1<<r.CALL|1<<r.ID|1<<r.COMMENT));)this.state=11,this.line(),this.state=16,this._errHandler.sync(this),t=this._input.LA(1);this.state=17,this.match(r.EOF)}catch(t){if(t instanceof T.error.RecognitionException)e.exception=t,this._errHandler.reportError(this,t),this._errHandler.recover(this,t);else throw t}finally{this.exitRule()}return e},p.prototype=Object.create(T.ParserRuleContext.prototype),p.prototype.constructor=p,p.prototype.copyFrom=function(e){T.ParserRuleContext.prototype.copyFrom.call(this,e)},a.prototype=Object.create(p.prototype),a.prototype.constructor=a,r.DefContext=a,a.prototype.DEF=function(){return this.getToken(r.DEF,0)},a.prototype.ARGS=function(){return this.getToken(r.ARGS,0)},a.prototype.NUM=function(e){return void 0===e&&(e=null),null===e?this.getTokens(r.NUM):this.getToken(r.NUM,e)},a.prototype.LOCALS=function(){return this.getToken(r.LOCALS,0)},a.prototype.STACK=function(){return this.getToken(r.STACK,0)},a.prototype.EOL=function(){return this.getToken(r.EOL,0)},a.prototype.ID=function(){return this.getToken(r.ID,0)},a.prototype.MAINID=function(){return this.getToken(r.MAINID,0)},a.prototype.enterRule=function(e){e instanceof x&&e.enterDef(this)},a.prototype.exitRule=function(e){e instanceof x&&e.exitDef(this)},i.prototype=Object.create(p.prototype),i.prototype.constructor=i,r.AsmCommentContext=i,i.prototype.comment=function(){return this.getTypedRuleContext(g,0)},i.prototype.EOL=function(){return this.getToken(r.EOL,0)},i.prototype.enterRule=function(e){e instanceof x&&e.enterAsmComment(this)},i.prototype.exitRule=function(e){e instanceof x&&e.exitAsmComment(this)},s.prototype=Object.create(p.prototype),s.prototype.constructor=s,r.LabelContext=s,s.prototype.ID=function(){return this.getToken(r.ID,0)},s.prototype.EOL=function(){return this.getToken(r.EOL,0)},s.prototype.enterRule=function(e){e instanceof x&&e.enterLabel(this)},s.prototype.exitRule=function(e){e instanceof x&&e.exitLabel(this)},d.prototype=Object.create(p.prototype),d.prototype.constructor=d,r.InstrLineContext=d,d.prototype.instr=function(){return this.getTypedRuleContext(c,0)},d.prototype.EOL=function(){return this.getToken(r.EOL,0)},d.prototype.comment=function(){return this.getTypedRuleContext(g,0)},d.prototype.enterRule=function(e){e instanceof x&&e.enterInstrLine(this)},d.prototype.exitRule=function(e){e instanceof x&&e.exitInstrLine(this)},r.LineContext=p,r.prototype.line=function(){var e=new p(this,this._ctx,this.state);this.enterRule(e,2,r.RULE_line);var t=0;try{this.state=46,this._errHandler.sync(this);var o=this._interp.adaptivePredict(this._input,2,this._ctx);1===o?(e=new a(this,e),this.enterOuterAlt(e,1),this.state=19,this.match(r.DEF),this.state=20,t=this._input.LA(1),t===r.MAINID||t===r.ID?(this._errHandler.reportMatch(this),this.consume()):this._errHandler.recoverInline(this),this.state=21,this.match(r.T__0),this.state=22,this.match(r.ARGS),this.state=23,this.match(r.T__1),this.state=24,this.match(r.NUM),this.state=25,this.match(r.T__2),this.state=26,this.match(r.LOCALS),this.state=27,this.match(r.T__1),this.state=28,this.match(r.NUM),this.state=29,this.match(r.T__2),this.state=30,this.match(r.STACK),this.state=31,this.match(r.T__1),this.state=32,this.match(r.NUM),this.state=33,this.match(r.EOL)):2===o?(e=new s(this,e),this.enterOuterAlt(e,2),this.state=34,this.match(r.ID),this.state=35,this.match(r.T__0),this.state=36,this.match(r.EOL)):3===o?(e=new d(this,e),this.enterOuterAlt(e,3),this.state=37,this.instr(),this.state=39,this._errHandler.sync(this),t=this._input.LA(1),t===r.COMMENT&&(this.state=38,this.comment()),this.state=41,this.match(r.EOL)):4===o?(e=new i(this,e),this.enterOuterAlt(e,4),this.state=43,this.comment(),this.state=44,this.match(r.EOL)):void 0}catch(t){if(t instanceof T.error.RecognitionException)e.exception=t,this._errHandler.reportError(this,t),this._errHandler.recover(this,t);else throw t}finally{this.exitRule()}return e},c.prototype=Object.create(T.ParserRuleContext.prototype),c.prototype.constructor=c,c.prototype.copyFrom=function(e){T.ParserRuleContext.prototype.copyFrom.call(this,e)},l.prototype=Object.create(c.prototype),l.prototype.constructor=l,r.OtherInstrContext=l,l.prototype.ID=function(){return this.getToken(r.ID,0)},l.prototype.NUM=function(){return this.getToken(r.NUM,0)},l.prototype.enterRule=function(e){e instanceof x&&e.enterOtherInstr(this)},l.prototype.exitRule=function(e){e instanceof x&&e.exitOtherInstr(this)},u.prototype=Object.create(c.prototype),u.prototype.constructor=u,r.CallContext=u,u.prototype.CALL=function(){return this.getToken(r.CALL,0)},u.prototype.ID=function(){return this.getToken(r.ID,0)},u.prototype.enterRule=function(e){e instanceof x&&e.enterCall(this)},u.prototype.exitRule=function(e){e instanceof x&&e.exitCall(this)},y.prototype=Object.create(c.prototype),y.prototype.constructor=y,r.BranchContext=y,y.prototype.BRANCH=function(){return this.getToken(r.BRANCH,0)},y.prototype.ID=function(){return this.getToken(r.ID,0)},y.prototype.enterRule=function(e){e instanceof x&&e.enterBranch(this)},y.prototype.exitRule=function(e){e instanceof x&&e.exitBranch(this)},r.InstrContext=c,r.prototype.instr=function(){var e=new c(this,this._ctx,this.state);this.enterRule(e,4,r.RULE_instr);var t=0;try{switch(this.state=56,this._errHandler.sync(this),this._input.LA(1)){case r.BRANCH:e=new y(this,e),this.enterOuterAlt(e,1),this.state=48,this.match(r.BRANCH),this.state=49,this.match(r.ID);break;case r.CALL:e=new u(this,e),this.enterOuterAlt(e,2),this.state=50,this.match(r.CALL),this.state=51,this.match(r.ID);break;case r.ID:e=new l(this,e),this.enterOuterAlt(e,3),this.state=52,this.match(r.ID),this.state=54,this._errHandler.sync(this),t=this._input.LA(1),t===r.NUM&&(this.state=53,this.match(r.NUM));break;default:throw new T.error.NoViableAltException(this);}}catch(t){if(t instanceof T.error.RecognitionException)e.exception=t,this._errHandler.reportError(this,t),this._errHandler.recover(this,t);else throw t}finally{this.exitRule()}return e},g.prototype=Object.create(T.ParserRuleContext.prototype),g.prototype.constructor=g,g.prototype.COMMENT=function(){return this.getToken(r.COMMENT,0)},g.prototype.enterRule=function(e){e instanceof x&&e.enterComment(this)},g.prototype.exitRule=function(e){e instanceof x&&e.exitComment(this)},r.CommentContext=g,r.prototype.comment=function(){var e=new g(this,this._ctx,this.state);this.enterRule(e,6,r.RULE_comment);try{this.enterOuterAlt(e,1),this.state=58,this.match(r.COMMENT)}catch(t){if(t instanceof T.error.RecognitionException)e.exception=t,this._errHandler.reportError(this,t),this._errHandler.recover(this,t);else throw t}finally{this.exitRule()}return e},o.asmParser=r},{"./asmListener":2,"antlr4/index":49}],4:[function(require,module,exports){var antlr4=require('antlr4/index');var logoLexer=require('./logoLexer');var logoParser=require('./logoParser');var logoListener=require('./logoListener').logoListener;var asmLexer=require('./asmLexer');var asmParser=require('./asmParser');var asmListener=require('./asmListener').asmListener;var errorListener=antlr4.error.ErrorListener;var builtInCommands=new Map([["arc",2]]);function resolveBuiltIn(scope,name){if(scope.resolveProcedure(name)!==undefined){return undefined;}
+return builtInCommands.get(name.toLowerCase());}
+function Scope(parent){this._parent=parent;this._variables=new Map();this._procedures=new Map();this._currentStackDepth=0;this._maxStackDepth=0;return this;}
+Scope.prototype.resolveLocalVariable=function(name){return this._variables.get(name);};Scope.prototype.resolveLocalProcedure=function(name){return this._procedures.get(name);};Scope.prototype.resolveVariable=function(name){var result=this.resolveLocalVariable(name);if(result!==undefined){return result;}else{if(this._parent!==undefined){return this._parent.resolveVariable(name);}else{return undefined;}}};Scope.prototype.resolveProcedure=function(name){var result=this.resolveLocalProcedure(name);if(result!==undefined){return result;}else{if(this._parent!==undefined){return this._parent.resolveProcedure(name);}else{return undefined;}}};Scope.prototype.defineVariable=function(name){if(this.resolveLocalVariable(name)!==undefined){return false;}else{this._variables.set(name,{type:"variable",index:this._variables.size});return true;}};Scope.prototype.defineProcedure=function(name,paramCount,scope){if(this.resolveLocalProcedure(name)!==undefined){return false;}else{this._procedures.set(name,{type:"procedure",paramCount:paramCount,scope:scope});return true;}};Scope.prototype.incrementStack=function(amount,boost){this._currentStackDepth+=amount;this._maxStackDepth=Math.max(this._maxStackDepth,this._currentStackDepth+boost);};Scope.prototype.decrementStack=function(amount,boost){this._maxStackDepth=Math.max(this._maxStackDepth,this._currentStackDepth+boost);this._currentStackDepth-=amount;};Scope.prototype.getStackSize=function(){return this._maxStackDepth;};Scope.prototype.getVariableCount=function(){return this._variables.size;};Scope.prototype.nameAnonymousVariable=function(depth,instance){var name="__Anon-"+depth+"-"+instance;return name;};function AssemblerFactory(){this._procedures=[undefined];this._procedureMap=new Map();this._instructionMap=new Map();this._segments=[];this._segmentIndex=-1;this._currentSegment=undefined;return this;};AssemblerFactory.prototype.pushSegment=function(){this._currentSegment=[];this._segmentIndex=this._segments.length;this._segments.push(this._currentSegment);}
+AssemblerFactory.prototype.popSegment=function(){this._segmentIndex--;if(this._segmentIndex<0){this._currentSegment=undefined;}else{this._currentSegment=this._segments[this._segmentIndex];}
+return this._segments.pop();};AssemblerFactory.prototype.insertSegment=function(segment){for(var ii=0;ii<segment.length;ii++){this._currentSegment.push(segment[ii]);}};AssemblerFactory.prototype.addProcedure=function(name,paramCount,variableCount,stackSize){var proc={name:name,paramCount:paramCount,variableCount:variableCount,stackSize:stackSize};if(name===undefined){this._procedures[0]=proc;this._procedureMap.set(undefined,0);this._currentSegment.push(".def <main>: args=0, locals="+proc.variableCount+", stack="+proc.stackSize);}else{var index=this._procedures.length;this._procedures.push(proc);this._procedureMap.set(name,index);this._currentSegment.push(".def "+name+": args="+proc.paramCount+", locals="+proc.variableCount+", stack="+proc.stackSize);}};AssemblerFactory.prototype.assignSegmentToProcedure=function(name,segment){this._instructionMap.set(name,segment);};AssemblerFactory.prototype.getProcedureSegment=function(name){return this._instructionMap.get(name);};AssemblerFactory.prototype.getProcedures=function(){var names=[];var key;for(key of this._procedureMap.keys()){names.push(key);}
+return names;};AssemblerFactory.prototype.instrFd=function(){this._currentSegment.push("  fd");};AssemblerFactory.prototype.instrBk=function(){this._currentSegment.push("  bk");};AssemblerFactory.prototype.instrLt=function(){this._currentSegment.push("  lt");}
+AssemblerFactory.prototype.instrRt=function(){this._currentSegment.push("  rt");};AssemblerFactory.prototype.instrArc=function(){this._currentSegment.push("  arc");};AssemblerFactory.prototype.instrPu=function(){this._currentSegment.push("  pu");};AssemblerFactory.prototype.instrPd=function(){this._currentSegment.push("  pd");};AssemblerFactory.prototype.instrIAdd=function(){this._currentSegment.push("  iadd");};AssemblerFactory.prototype.instrISub=function(){this._currentSegment.push("  isub");};AssemblerFactory.prototype.instrIMul=function(){this._currentSegment.push("  imul");};AssemblerFactory.prototype.instrIDiv=function(){this._currentSegment.push("  idiv");};AssemblerFactory.prototype.instrIConst=function(val){switch(val){case 0:this._currentSegment.push("  iconst_0");break;case 1:this._currentSegment.push("  iconst_1");break;case 45:this._currentSegment.push("  iconst_45");break;case 90:this._currentSegment.push("  iconst_90");break;default:this._currentSegment.push("  iconst  "+val);break;}};AssemblerFactory.prototype.instrILoad=function(index){switch(index){case 0:this._currentSegment.push("  iload_0");break;case 1:this._currentSegment.push("  iload_1");break;case 2:this._currentSegment.push("  iload_2");break;default:this._currentSegment.push("  iload  "+index);break;}};AssemblerFactory.prototype.instrIStore=function(index){switch(index){case 0:this._currentSegment.push("  istore_0");break;case 1:this._currentSegment.push("  istore_1");break;case 2:this._currentSegment.push("  istore_2");break;default:this._currentSegment.push("  istore  "+index);break;}};AssemblerFactory.prototype.instrGLoad=function(index){switch(index){case 0:this._currentSegment.push("  gload_0");break;case 1:this._currentSegment.push("  gload_1");break;case 2:this._currentSegment.push("  gload_2");break;default:this._currentSegment.push("  gload  "+index);break;}};AssemblerFactory.prototype.instrGStore=function(index){switch(index){case 0:this._currentSegment.push("  gstore_0");break;case 1:this._currentSegment.push("  gstore_1");break;case 2:this._currentSegment.push("  gstore_2");break;default:this._currentSegment.push("  gstore  "+index);break;}};AssemblerFactory.prototype.instrILt=function(){this._currentSegment.push("  ilt");};AssemblerFactory.prototype.instrILe=function(){this._currentSegment.push("  ile");};AssemblerFactory.prototype.instrIGt=function(){this._currentSegment.push("  igt");};AssemblerFactory.prototype.instrIGe=function(){this._currentSegment.push("  ige");};AssemblerFactory.prototype.instrIEq=function(){this._currentSegment.push("  ieq");};AssemblerFactory.prototype.instrINe=function(){this._currentSegment.push("  ine");};AssemblerFactory.prototype.label=function(label){this._currentSegment.push(label+":");};AssemblerFactory.prototype.instrCall=function(name){this._currentSegment.push("  call  "+name);};AssemblerFactory.prototype.instrRet=function(){this._currentSegment.push("  ret");};AssemblerFactory.prototype.instrStop=function(){this._currentSegment.push("  stop");};AssemblerFactory.prototype.instrBr=function(label){this._currentSegment.push("  br  "+label);};AssemblerFactory.prototype.instrBrt=function(label){this._currentSegment.push("  brt  "+label);};AssemblerFactory.prototype.instrBrf=function(label){this._currentSegment.push("  brf  "+label);};AssemblerFactory.prototype.instrWait=function(label){this._currentSegment.push("  wait");};function LogoDefs(exceptions){logoListener.call(this);this._scopes=undefined;this._globalScope=undefined;this._currentScope=undefined;this._exceptions=exceptions;this._repeatDepth=0;return this;};LogoDefs.prototype=Object.create(logoListener.prototype);LogoDefs.prototype.constructor=LogoDefs;LogoDefs.prototype.getGlobalScope=function(){return this._globalScope;};LogoDefs.prototype.getScopes=function(){return this._scopes;};LogoDefs.prototype.enterProgram=function(ctx){this._globalScope=new Scope(undefined);var scope=new Scope(this._globalScope);this._scopes=new Map();this._scopes.set(undefined,scope);this._currentScope=scope;};LogoDefs.prototype.enterProcedureDef=function(ctx){var name=ctx.STRING().getText();var paramCount=ctx.paramDef().length;if(!this._currentScope.defineProcedure(name,paramCount,this._currentScope)){var start=ctx.start;var col=start.column+ctx.TO().getText().length+1;this._exceptions.push({line:start.line,col:col,message:"Duplicate procedure name \""+ctx.STRING().getText()+"\"."});}
+var scope=new Scope(this._currentScope);this._scopes.set(name,scope);this._currentScope=scope;};LogoDefs.prototype.exitProcedureDef=function(ctx){this._currentScope=this._currentScope._parent;};LogoDefs.prototype.exitParamDef=function(ctx){this._currentScope.defineVariable(ctx.STRING().getText())};LogoDefs.prototype.exitMake=function(ctx){var name=ctx.STRING();if(name!==null){name=name.getText();}else{name="<undefined>";}
+if(this._currentScope._parent==this._globalScope){this._globalScope.defineVariable(name)}else{this._currentScope.defineVariable(name)}};LogoDefs.prototype.exitDeref=function(ctx){var name=ctx.STRING().getText();if(this._currentScope.resolveVariable(name)===undefined){var start=ctx.start;this._exceptions.push({line:start.line,col:start.column+1,message:"Unknown variable \""+name+"\"."});}};LogoDefs.prototype.enterRepeat=function(ctx){this._repeatDepth++;var name=this._currentScope.nameAnonymousVariable(this._repeatDepth,0);this._currentScope.defineVariable(name);name=this._currentScope.nameAnonymousVariable(this._repeatDepth,1);this._currentScope.defineVariable(name);};LogoDefs.prototype.exitRepeat=function(ctx){this._repeatDepth--;};function LogoRefs(scopes,exceptions){logoListener.call(this);this._scopes=scopes;this._currentScope=undefined;this._exceptions=exceptions;return this;};LogoRefs.prototype=Object.create(logoListener.prototype);LogoRefs.prototype.constructor=LogoRefs;LogoRefs.prototype.incrementStack=function(ctx,boost=0){this._currentScope.incrementStack(1,boost);};LogoRefs.prototype.decrementStack=function(ctx,amount=1,boost=0){this._currentScope.decrementStack(amount,boost);};LogoRefs.prototype.enterProgram=function(ctx){this._currentScope=this._scopes.get(undefined);};LogoRefs.prototype.enterProcedureDef=function(ctx){var name=ctx.STRING().getText();this._currentScope=this._scopes.get(name);};LogoRefs.prototype.exitProcedureDef=function(ctx){this._currentScope=this._currentScope._parent;};LogoRefs.prototype.enterProcedureInvoke=function(ctx){var name=ctx.STRING().getText();var proc=this._currentScope.resolveProcedure(name);var builtIn=resolveBuiltIn(this._currentScope,name);if(builtIn!==undefined){if(ctx.expr().length!==builtIn){var start=ctx.start;this._exceptions.push({line:start.line,col:start.column+1,message:"Incorrect parameter count for \""+name+"\", "+ctx.expr().length+" instead of "+builtIn+"."});}}else if(proc===undefined){var start=ctx.start;this._exceptions.push({line:start.line,col:start.column+1,message:"Unknown procedure name \""+name+"\"."});}else if(ctx.expr().length!==proc.paramCount){var start=ctx.start;this._exceptions.push({line:start.line,col:start.column+1,message:"Incorrect parameter count for procedure \""+name+"\", "+ctx.expr().length+" instead of "+proc.paramCount+"."});}};LogoRefs.prototype.exitProcedureInvoke=function(ctx){var name=ctx.STRING().getText();var proc=this._currentScope.resolveProcedure(name);var builtIn=resolveBuiltIn(this._currentScope,name);if(builtIn!==undefined){this.decrementStack(ctx,builtIn);}else if(proc!==undefined){this.decrementStack(ctx,proc.paramCount);}};LogoRefs.prototype.exitIf=function(ctx){this.decrementStack(ctx)};LogoRefs.prototype.exitFD=function(ctx){this.decrementStack(ctx)};LogoRefs.prototype.exitBK=function(ctx){this.decrementStack(ctx)};LogoRefs.prototype.exitLT=function(ctx){this.decrementStack(ctx)};LogoRefs.prototype.exitRT=function(ctx){this.decrementStack(ctx)};LogoRefs.prototype.exitMulDiv=function(ctx){this.decrementStack(ctx)};LogoRefs.prototype.exitAddSub=function(ctx){this.decrementStack(ctx)};LogoRefs.prototype.exitInt=function(ctx){this.incrementStack(ctx)};LogoRefs.prototype.exitDeref=function(ctx){this.incrementStack(ctx)};LogoRefs.prototype.exitComp=function(ctx){this.decrementStack(ctx)};LogoRefs.prototype.exitMake=function(ctx){this.decrementStack(ctx)};LogoRefs.prototype.exitRepeat=function(ctx){this.decrementStack(ctx,1,1);}
+LogoRefs.prototype.exitNegate=function(ctx){this.incrementStack(ctx,2);};function LogoAssembler(globalScope,scopes){logoListener.call(this);this._scopes=scopes;this._globalScope=globalScope;this._currentScope=undefined;this._asm=new AssemblerFactory();this._frames=[];this._repeatDepth=0;this._labelNumber=-1;return this;};LogoAssembler.prototype=Object.create(logoListener.prototype);LogoAssembler.prototype.constructor=LogoAssembler;LogoAssembler.prototype.getText=function(){var text=".globals "+this._globalScope.getVariableCount()+"\n";var procs=this._asm.getProcedures();for(var index in procs){var segment=this._asm.getProcedureSegment(procs[index]);for(var ii=0;ii<segment.length;ii++){text+=segment[ii]+"\n";}}
+return text;};LogoAssembler.prototype.getNextLabelBase=function(text){this._labelNumber++;return text+"-"+this._labelNumber;};LogoAssembler.prototype.enterProgram=function(ctx){this._currentScope=this._scopes.get(undefined);this._asm.pushSegment();this._asm.addProcedure(undefined,0,this._currentScope.getVariableCount(),this._currentScope.getStackSize());};LogoAssembler.prototype.enterProcedureDef=function(ctx){var name=ctx.STRING().getText();this._currentScope=this._scopes.get(name);this._asm.pushSegment();this._asm.addProcedure(ctx.STRING().getText(),ctx.paramDef().length,this._currentScope.getVariableCount()-ctx.paramDef().length,this._currentScope.getStackSize());};LogoAssembler.prototype.exitProcedureDef=function(ctx){this._asm.instrRet();this._currentScope=this._currentScope._parent;this._asm.assignSegmentToProcedure(ctx.STRING().getText(),this._asm.popSegment());};LogoAssembler.prototype.exitProgram=function(ctx){this._asm.instrStop();this._asm.assignSegmentToProcedure(undefined,this._asm.popSegment());};LogoAssembler.prototype.enterRepeat=function(ctx){this._repeatDepth++;this._frames.push([]);};LogoAssembler.prototype.exitRepeat=function(ctx){var segments=this._frames.pop();if(segments.length>0){var name=this._currentScope.nameAnonymousVariable(this._repeatDepth,0);var var1=this._currentScope.resolveLocalVariable(name);this._asm.instrIStore(var1.index);this._asm.instrIConst(0);name=this._currentScope.nameAnonymousVariable(this._repeatDepth,1);var var2=this._currentScope.resolveLocalVariable(name);this._asm.instrIStore(var2.index);var labelBase=this.getNextLabelBase("repeat");this._asm.label(labelBase+"-start");this._asm.instrILoad(var2.index);this._asm.instrILoad(var1.index);this._asm.instrIGe();this._asm.instrBrt(labelBase+"-end");this._asm.insertSegment(segments[0]);this._asm.instrILoad(var2.index);this._asm.instrIConst(1);this._asm.instrIAdd();this._asm.instrIStore(var2.index);this._asm.instrBr(labelBase+"-start");this._asm.label(labelBase+"-end");}
+this._repeatDepth--;};LogoAssembler.prototype.enterIf=function(ctx){this._frames.push([]);};LogoAssembler.prototype.exitIf=function(ctx){var segments=this._frames.pop();var labelBase=this.getNextLabelBase("if");this._asm.insertSegment(segments[0]);this._asm.instrBrf(labelBase+"-false");this._asm.insertSegment(segments[1]);if(ctx.ELSE()!==null){this._asm.instrBr(labelBase+"-end");this._asm.label(labelBase+"-false");this._asm.insertSegment(segments[2]);this._asm.label(labelBase+"-end");}else{this._asm.label(labelBase+"-false");}};LogoAssembler.prototype.enterBlock=function(ctx){this._asm.pushSegment();};LogoAssembler.prototype.exitBlock=function(ctx){this._frames[this._frames.length-1].push(this._asm.popSegment());};LogoAssembler.prototype.enterCombine=function(ctx){this._asm.pushSegment();this._frames.push([]);};LogoAssembler.prototype.exitCombine=function(ctx){var segments=this._frames.pop();this._asm.insertSegment(segments[0]);var labelBase=this.getNextLabelBase("cmp");var andOp=true;if(ctx.OR().length>0){andOp=false;}
+for(var ii=1;ii<segments.length;ii++){if(andOp){this._asm.instrBrf(labelBase+"-fail");}else{this._asm.instrBrt(labelBase+"-pass");}
+this._asm.insertSegment(segments[ii]);}
+this._asm.instrBr(labelBase+"-end");if(andOp){this._asm.label(labelBase+"-fail");this._asm.instrIConst(0);}else{this._asm.label(labelBase+"-pass");this._asm.instrIConst(1);}
+this._asm.label(labelBase+"-end");this._frames[this._frames.length-1].push(this._asm.popSegment());};LogoAssembler.prototype.exitProcedureInvoke=function(ctx){var name=ctx.STRING().getText();if(resolveBuiltIn(this._currentScope,name)!==undefined){this._asm.instrArc();}else{this._asm.instrCall(name);}};LogoAssembler.prototype.exitFD=function(ctx){this._asm.instrFd();};LogoAssembler.prototype.exitBK=function(ctx){this._asm.instrBk();};LogoAssembler.prototype.exitLT=function(ctx){this._asm.instrLt();};LogoAssembler.prototype.exitRT=function(ctx){this._asm.instrRt();};LogoAssembler.prototype.exitPU=function(ctx){this._asm.instrPu();};LogoAssembler.prototype.exitPD=function(ctx){this._asm.instrPd();};LogoAssembler.prototype.exitWait=function(ctx){this._asm.instrWait();};LogoAssembler.prototype.exitMulDiv=function(ctx){if(ctx.MUL()!==null){this._asm.instrIMul();}else{this._asm.instrIDiv();}};LogoAssembler.prototype.exitAddSub=function(ctx){if(ctx.ADD()!==null){this._asm.instrIAdd();}else{this._asm.instrISub();}};LogoAssembler.prototype.exitInt=function(ctx){this._asm.instrIConst(parseInt(ctx.INTNUM().getText()));};LogoAssembler.prototype.exitDeref=function(ctx){var name=ctx.STRING().getText();var variable=this._currentScope.resolveLocalVariable(name);if(variable===undefined){variable=this._currentScope.resolveVariable(name);this._asm.instrGLoad(variable.index);}else{this._asm.instrILoad(variable.index);}};LogoAssembler.prototype.exitNegate=function(ctx){this._asm.instrIConst(-1);this._asm.instrIMul();};LogoAssembler.prototype.exitMake=function(ctx){var name=ctx.STRING().getText();var variable=this._currentScope.resolveLocalVariable(name);if(variable===undefined){variable=this._currentScope.resolveVariable(name);this._asm.instrGStore(variable.index);}else{this._asm.instrIStore(variable.index);}};LogoAssembler.prototype.enterComp=function(ctx){this._asm.pushSegment();};LogoAssembler.prototype.exitComp=function(ctx){switch(ctx.comparison().getText()){case"=":this._asm.instrIEq();break;case"!=":this._asm.instrINe();break;case"<":this._asm.instrILt();break;case"<=":this._asm.instrILe();break;case">":this._asm.instrIGt();break;case">=":this._asm.instrIGe();break;}
+this._frames[this._frames.length-1].push(this._asm.popSegment());};LogoAssembler.prototype.exitReturn=function(ctx){this._asm.instrRet();};LogoAssembler.prototype.exitStop=function(ctx){this._asm.instrStop();};function AsmCompiler(){asmListener.call(this);this._errors=[];this._codes=[];this._globalCount=0;this._nextFunctionId=0;this._currentFunctionName=undefined;this._functions=new Map();this._labels=new Map();this._unresolvedFunctions=[];this._unresolvedLabels=[];this._instrCodes=[["fd",1,0],["bk",2,0],["lt",3,0],["rt",4,0],["pu",5,0],["pd",6,0],["iadd",7,0],["isub",8,0],["imul",9,0],["idiv",10,0],["iconst_0",11,0],["iconst_1",12,0],["iconst_45",13,0],["iconst_90",14,0],["iconst",15,1],["iload_0",16,0],["iload_1",17,0],["iload_2",18,0],["iload",19,1],["istore_0",20,0],["istore_1",21,0],["istore_2",22,0],["istore",23,1],["gload_0",24,0],["gload_1",25,0],["gload_2",26,0],["gload",27,1],["gstore_0",28,0],["gstore_1",29,0],["gstore_2",30,0],["gstore",31,1],["ilt",32,0],["ile",33,0],["igt",34,0],["ige",35,0],["ieq",36,0],["ine",37,0],["call",38,1],["ret",39,0],["stop",40,0],["br",41,1],["brt",42,1],["brf",43,1],["fdraw",44,0],["bkraw",45,0],["ltraw",46,0],["rtraw",47,0],["wait",48,0],["arc",49,0]];this._instrMap=new Map();for(var ii=0;ii<this._instrCodes.length;ii++){this._instrMap.set(this._instrCodes[ii][0],{opcode:this._instrCodes[ii][1],operands:this._instrCodes[ii][2]});}}
+AsmCompiler.prototype=Object.create(asmListener.prototype);AsmCompiler.prototype.constructor=AsmCompiler;AsmCompiler.prototype.getBytecode=function(){var functions=[];for(var[name,value]of this._functions){functions.push({args:value.args,locals:value.locals,stack:value.stack,codes:value.codes});}
+return{globals:this._globalCount,functions:functions};};AsmCompiler.prototype.enterProgram=function(ctx){var globals=parseInt(ctx.NUM().getText());if(globals>255){var start=ctx.start;this._errors.push({line:start.line,col:start.column+1,message:"Global count cannot exceed 255."});}else{this._globalCount=globals;}};AsmCompiler.prototype.enterDef=function(ctx){var name;if(ctx.ID()===null){name=ctx.MAINID().getText();}else{name=ctx.ID().getText();}
+var id=this._nextFunctionId++;var args=parseInt(ctx.NUM()[0].getText());var locals=parseInt(ctx.NUM()[1].getText());var stack=parseInt(ctx.NUM()[2].getText());this._currentFunctionName=name;this._codes=[];this._labels=new Map();this._functions.set(name,{id:id,args:args,locals:locals,stack:stack,codes:this._codes,labels:this._labels});};AsmCompiler.prototype.enterLabel=function(ctx){var name=ctx.ID().getText();this._labels.set(name,this._codes.length);};AsmCompiler.prototype.enterBranch=function(ctx){var instr=ctx.BRANCH().getText();var label=ctx.ID().getText();var op=this._instrMap.get(instr);if(op===undefined){var start=ctx.start;this._errors.push({line:start.line,col:start.column+1,message:"Unknown instruction: \""+instr+"\"."});}else{this._codes.push(op.opcode);var labelIndex=this._labels.get(label);if(labelIndex===undefined){var start=ctx.start;this._unresolvedLabels.push({name:label,codes:this._codes,index:this._codes.length,fnName:this._currentFunctionName,line:start.line,col:start.column+1});this._codes.push(0);this._codes.push(0);this._codes.push(0);this._codes.push(0);}else{this._codes.push((labelIndex&0xFF000000)>>24);this._codes.push((labelIndex&0x00FF0000)>>16);this._codes.push((labelIndex&0x0000FF00)>>8);this._codes.push((labelIndex&0x000000FF));}}};AsmCompiler.prototype.enterCall=function(ctx){var instr=ctx.CALL().getText();var fnName=ctx.ID().getText();var op=this._instrMap.get(instr);if(op===undefined){var start=ctx.start;this._errors.push({line:start.line,col:start.column+1,message:"Unknown instruction: \""+instr+"\"."});}else{this._codes.push(op.opcode);var fnInfo=this._functions.get(fnName);if(fnInfo===undefined){var start=ctx.start;this._unresolvedFunctions.push({name:fnName,codes:this._codes,index:this._codes.length,line:start.line,col:start.column+1});this._codes.push(0);this._codes.push(0);this._codes.push(0);this._codes.push(0);}else{this._codes.push((fnInfo.id&0xFF000000)>>24);this._codes.push((fnInfo.id&0x00FF0000)>>16);this._codes.push((fnInfo.id&0x0000FF00)>>8);this._codes.push((fnInfo.id&0x000000FF));}}};AsmCompiler.prototype.enterOtherInstr=function(ctx){var instr=ctx.ID().getText();var op=this._instrMap.get(instr);if(op===undefined){var start=ctx.start;this._errors.push({line:start.line,col:start.column+1,message:"Unknown instruction: \""+instr+"\"."});}else{this._codes.push(op.opcode);if(op.operands==1){var num=parseInt(ctx.NUM().getText());this._codes.push((num&0xFF000000)>>24);this._codes.push((num&0x00FF0000)>>16);this._codes.push((num&0x0000FF00)>>8);this._codes.push((num&0x000000FF));}}};AsmCompiler.prototype.exitProgram=function(ctx){for(var ii=0;ii<this._unresolvedFunctions.length;ii++){var item=this._unresolvedFunctions[ii];var fnInfo=this._functions.get(item.name);if(fnInfo===undefined){this._errors.push({line:item.line,col:item.col,message:"Unknown function: \""+item.name+"\"."});}else{item.codes[item.index]=(fnInfo.id&0xFF000000)>>24;item.codes[item.index+1]=(fnInfo.id&0x00FF0000)>>16;item.codes[item.index+2]=(fnInfo.id&0x0000FF00)>>8;item.codes[item.index+3]=(fnInfo.id&0x000000FF);}}
+for(var ii=0;ii<this._unresolvedLabels.length;ii++){var item=this._unresolvedLabels[ii];var fnInfo=this._functions.get(item.fnName);var labelIndex=fnInfo.labels.get(item.name);if(labelIndex===undefined){this._errors.push({line:item.line,col:label.col,message:"Unknown label: \""+item.name+"\"."});}else{item.codes[item.index]=(labelIndex&0xFF000000)>>24;item.codes[item.index+1]=(labelIndex&0x00FF0000)>>16;item.codes[item.index+2]=(labelIndex&0x0000FF00)>>8;item.codes[item.index+3]=(labelIndex&0x000000FF);}}};function CapturingErrorListener(errors){errorListener.call(this);this._errors=errors;return this;};CapturingErrorListener.prototype=Object.create(errorListener.prototype);CapturingErrorListener.prototype.constructor=CapturingErrorListener;CapturingErrorListener.prototype.syntaxError=function(recognizer,offendingSymbol,line,column,msg,e){this._errors.push({line:line,col:column,message:msg,type:"error"});}
+function _lexAndParseLogoProgram(input){var chars=new antlr4.InputStream(input);var lexer=new logoLexer.logoLexer(chars);var tokens=new antlr4.CommonTokenStream(lexer);var parser=new logoParser.logoParser(tokens);var exceptions=[];var errListener=new CapturingErrorListener(exceptions);lexer.removeErrorListeners();lexer.addErrorListener(errListener);parser.removeErrorListeners();parser.addErrorListener(errListener);parser.buildParseTrees=true;var tree=parser.program();var lDef=new LogoDefs(exceptions);antlr4.tree.ParseTreeWalker.DEFAULT.walk(lDef,tree);var globalScope=lDef.getGlobalScope();var scopes=lDef.getScopes();var lRef=new LogoRefs(scopes,exceptions);antlr4.tree.ParseTreeWalker.DEFAULT.walk(lRef,tree);return{parseTree:tree,globalScope:globalScope,scopes:scopes,exceptions:exceptions};}
+function verifyProgram(input){var results=_lexAndParseLogoProgram(input);return results.exceptions;}
+function _crc32(data){var crc=0xFFFFFFFF;for(var ii=0;ii<data.length;ii++){crc^=data[ii];for(var jj=0;jj<8;jj++){crc=(crc>>>1)^(0xEDB88320&-(crc&1));}}
+return(crc^0xFFFFFFFF)>>>0;}
+function createProgramImage(bytecode){var functions=bytecode.functions;var length=8+(6*functions.length)+4;for(var ii=0;ii<functions.length;ii++){length+=functions[ii].codes.length;}
+var image=new Uint8Array(length);image.set([0x4D,0x54,0x50,0x49,1,bytecode.globals,functions.length,0]);var index=8;for(var ii=0;ii<functions.length;ii++){var len=functions[ii].codes.length;image.set([functions[ii].args,functions[ii].locals,functions[ii].stack,0,(len>>8)&0xFF,len&0xFF],index);index+=6;}
+for(var ii=0;ii<functions.length;ii++){image.set(functions[ii].codes,index);index+=functions[ii].codes.length;}
+var crc=_crc32(image.subarray(0,index));image.set([(crc>>>24)&0xFF,(crc>>>16)&0xFF,(crc>>>8)&0xFF,crc&0xFF],index);return image;}
+function compileProgram(){var input=editor.getValue();var results=_lexAndParseLogoProgram(input);if(results.exceptions.length===0){var lAsm=new LogoAssembler(results.globalScope,results.scopes);antlr4.tree.ParseTreeWalker.DEFAULT.walk(lAsm,results.parseTree);var asmText=lAsm.getText();console.log(asmText);var chars=new antlr4.InputStream(asmText);var lexer=new asmLexer.asmLexer(chars);var tokens=new antlr4.CommonTokenStream(lexer);var parser=new asmParser.asmParser(tokens);parser.buildParseTrees=true;var tree=parser.program();var comp=new AsmCompiler();antlr4.tree.ParseTreeWalker.DEFAULT.walk(comp,tree);var bytecode=comp.getBytecode();return{success:true,bytecode:bytecode};}else{return{success:false,exceptions:results.exceptions};}}
+logo={};logo.verifyProgram=verifyProgram;logo.compileProgram=compileProgram;logo.createProgramImage=createProgramImage;},{"./asmLexer":1,"./asmListener":2,"./asmParser":3,"./logoLexer":5,"./logoListener":6,"./logoParser":7,"antlr4/index":49}],5:[function(e,t,o){function r(e){return n.Lexer.call(this,e),this._interp=new n.atn.LexerATNSimulator(this,p,a,new n.PredictionContextCache()),this}var n=e("antlr4/index"),p=new n.atn.ATNDeserializer().deserialize("\x03\u608B\uA72A\u8133\uB9ED\u417C\u3BE7\u7786\u5964\x02'\xF4\b\x01\x04\x02\t\x02\x04\x03\t\x03\x04\x04\t\x04\x04\x05\t\x05\x04\x06\t\x06\x04\x07\t\x07\x04\b\t\b\x04\t\t\t\x04\n\t\n\x04\x0B\t\x0B\x04\f\t\f\x04\r\t\r\x04\x0E\t\x0E\x04\x0F\t\x0F\x04\x10\t\x10\x04\x11\t\x11\x04\x12\t\x12\x04\x13\t\x13\x04\x14\t\x14\x04\x15\t\x15\x04\x16\t\x16\x04\x17\t\x17\x04\x18\t\x18\x04\x19\t\x19\x04\x1A\t\x1A\x04\x1B\t\x1B\x04\x1C\t\x1C\x04\x1D\t\x1D\x04\x1E\t\x1E\x04\x1F\t\x1F\x04 \t \x04!\t!\x04\"\t\"\x04#\t#\x04$\t$\x04%\t%\x04&\t&\x03\x02\x03\x02\x03\x03\x03\x03\x03\x04\x03\x04\x03\x05\x03\x05\x03\x06\x03\x06\x03\x07\x03\x07\x03\b\x03\b\x03\t\x03\t\x03\t\x03\n\x03\n\x03\x0B\x03\x0B\x03\x0B\x03\f\x03\f\x03\r\x03\r\x03\r\x03\x0E\x03\x0E\x03\x0E\x03\x0E\x03\x0E\x03\x0E\x03\x0E\x03\x0E\x05\x0Eq\n\x0E\x03\x0F\x03\x0F\x03\x0F\x03\x0F\x03\x0F\x03\x0F\x05\x0Fy\n\x0F\x03\x10\x03\x10\x03\x10\x03\x10\x03\x10\x03\x10\x05\x10\x81\n\x10\x03\x11\x03\x11\x03\x11\x03\x11\x03\x11\x03\x11\x03\x11\x05\x11\x8A\n\x11\x03\x12\x03\x12\x03\x12\x03\x12\x03\x12\x03\x12\x03\x12\x05\x12\x93\n\x12\x03\x13\x03\x13\x03\x13\x03\x13\x03\x13\x03\x13\x03\x13\x03\x13\x03\x13\x05\x13\x9E\n\x13\x03\x14\x03\x14\x03\x14\x03\x14\x03\x14\x03\x15\x03\x15\x03\x15\x03\x15\x03\x15\x03\x16\x03\x16\x03\x16\x03\x16\x03\x16\x03\x16\x03\x16\x03\x17\x03\x17\x03\x17\x03\x18\x03\x18\x03\x18\x03\x18\x03\x18\x03\x19\x03\x19\x03\x19\x03\x19\x03\x19\x03\x1A\x03\x1A\x03\x1A\x03\x1A\x03\x1A\x03\x1A\x03\x1A\x03\x1B\x03\x1B\x03\x1B\x03\x1C\x03\x1C\x03\x1C\x03\x1C\x03\x1D\x03\x1D\x03\x1D\x03\x1D\x03\x1E\x03\x1E\x03\x1E\x03\x1F\x03\x1F\x03 \x03 \x03!\x03!\x03\"\x03\"\x03#\x03#\x07#\xDD\n#\f#\x0E#\xE0\x0B#\x03$\x03$\x07$\xE4\n$\f$\x0E$\xE7\x0B$\x03%\x05%\xEA\n%\x03%\x06%\xED\n%\r%\x0E%\xEE\x03&\x03&\x03&\x03&\x02\x02'\x03\x03\x05\x04\x07\x05\t\x06\x0B\x07\r\b\x0F\t\x11\n\x13\x0B\x15\f\x17\r\x19\x0E\x1B\x0F\x1D\x10\x1F\x11!\x12#\x13%\x14'\x15)\x16+\x17-\x18/\x191\x1A3\x1B5\x1C7\x1D9\x1E;\x1F= ?!A\"C#E$G%I&K'\x03\x02\x1B\x04\x02HHhh\x04\x02FFff\x04\x02QQqq\x04\x02YYyy\x04\x02CCcc\x04\x02TTtt\x04\x02DDdd\x04\x02MMmm\x04\x02EEee\x04\x02NNnn\x04\x02VVvv\x04\x02GGgg\x04\x02KKkk\x04\x02IIii\x04\x02JJjj\x04\x02RRrr\x04\x02WWww\x04\x02PPpp\x04\x02OOoo\x04\x02UUuu\x04\x02\f\f\x0F\x0F\x04\x02C\\c|\x06\x022;C\\aac|\x03\x022;\x05\x02\x0B\f\x0F\x0F\"\"\x02\xFD\x02\x03\x03\x02\x02\x02\x02\x05\x03\x02\x02\x02\x02\x07\x03\x02\x02\x02\x02\t\x03\x02\x02\x02\x02\x0B\x03\x02\x02\x02\x02\r\x03\x02\x02\x02\x02\x0F\x03\x02\x02\x02\x02\x11\x03\x02\x02\x02\x02\x13\x03\x02\x02\x02\x02\x15\x03\x02\x02\x02\x02\x17\x03\x02\x02\x02\x02\x19\x03\x02\x02\x02\x02\x1B\x03\x02\x02\x02\x02\x1D\x03\x02\x02\x02\x02\x1F\x03\x02\x02\x02\x02!\x03\x02\x02\x02\x02#\x03\x02\x02\x02\x02%\x03\x02\x02\x02\x02'\x03\x02\x02\x02\x02)\x03\x02\x02\x02\x02+\x03\x02\x02\x02\x02-\x03\x02\x02\x02\x02/\x03\x02\x02\x02\x021\x03\x02\x02\x02\x023\x03\x02\x02\x02\x025\x03\x02\x02\x02\x027\x03\x02\x02\x02\x029\x03\x02\x02\x02\x02;\x03\x02\x02\x02\x02=\x03\x02\x02\x02\x02?\x03\x02\x02\x02\x02A\x03\x02\x02\x02\x02C\x03\x02\x02\x02\x02E\x03\x02\x02\x02\x02G\x03\x02\x02\x02\x02I\x03\x02\x02\x02\x02K\x03\x02\x02\x02\x03M\x03\x02\x02\x02\x05O\x03\x02\x02\x02\x07Q\x03\x02\x02\x02\tS\x03\x02\x02\x02\x0BU\x03\x02\x02\x02\rW\x03\x02\x02\x02\x0FY\x03\x02\x02\x02\x11[\x03\x02\x02\x02\x13^\x03\x02\x02\x02\x15`\x03\x02\x02\x02\x17c\x03\x02\x02\x02\x19e\x03\x02\x02\x02\x1Bp\x03\x02\x02\x02\x1Dx\x03\x02\x02\x02\x1F\x80\x03\x02\x02\x02!\x89\x03\x02\x02\x02#\x92\x03\x02\x02\x02%\x9D\x03\x02\x02\x02'\x9F\x03\x02\x02\x02)\xA4\x03\x02\x02\x02+\xA9\x03\x02\x02\x02-\xB0\x03\x02\x02\x02/\xB3\x03\x02\x02\x021\xB8\x03\x02\x02\x023\xBD\x03\x02\x02\x025\xC4\x03\x02\x02\x027\xC7\x03\x02\x02\x029\xCB\x03\x02\x02\x02;\xCF\x03\x02\x02\x02=\xD2\x03\x02\x02\x02?\xD4\x03\x02\x02\x02A\xD6\x03\x02\x02\x02C\xD8\x03\x02\x02\x02E\xDA\x03\x02\x02\x02G\xE1\x03\x02\x02\x02I\xE9\x03\x02\x02\x02K\xF0\x03\x02\x02\x02MN\x07$\x02\x02N\x04\x03\x02\x02\x02OP\x07<\x02\x02P\x06\x03\x02\x02\x02QR\x07]\x02\x02R\b\x03\x02\x02\x02ST\x07_\x02\x02T\n\x03\x02\x02\x02UV\x07*\x02\x02V\f\x03\x02\x02\x02WX\x07+\x02\x02X\x0E\x03\x02\x02\x02YZ\x07?\x02\x02Z\x10\x03\x02\x02\x02[\\\x07#\x02\x02\\]\x07?\x02\x02]\x12\x03\x02\x02\x02^_\x07>\x02\x02_\x14\x03\x02\x02\x02`a\x07>\x02\x02ab\x07?\x02\x02b\x16\x03\x02\x02\x02cd\x07@\x02\x02d\x18\x03\x02\x02\x02ef\x07@\x02\x02fg\x07?\x02\x02g\x1A\x03\x02\x02\x02hi\t\x02\x02\x02iq\t\x03\x02\x02jk\t\x02\x02\x02kl\t\x04\x02\x02lm\t\x05\x02\x02mn\t\x06\x02\x02no\t\x07\x02\x02oq\t\x03\x02\x02ph\x03\x02\x02\x02pj\x03\x02\x02\x02q\x1C\x03\x02\x02\x02rs\t\b\x02\x02sy\t\t\x02\x02tu\t\b\x02\x02uv\t\x06\x02\x02vw\t\n\x02\x02wy\t\t\x02\x02xr\x03\x02\x02\x02xt\x03\x02\x02\x02y\x1E\x03\x02\x02\x02z{\t\x0B\x02\x02{\x81\t\f\x02\x02|}\t\x0B\x02\x02}~\t\r\x02\x02~\x7F\t\x02\x02\x02\x7F\x81\t\f\x02\x02\x80z\x03\x02\x02\x02\x80|\x03\x02\x02\x02\x81 \x03\x02\x02\x02\x82\x83\t\x07\x02\x02\x83\x8A\t\f\x02\x02\x84\x85\t\x07\x02\x02\x85\x86\t\x0E\x02\x02\x86\x87\t\x0F\x02\x02\x87\x88\t\x10\x02\x02\x88\x8A\t\f\x02\x02\x89\x82\x03\x02\x02\x02\x89\x84\x03\x02\x02\x02\x8A\"\x03\x02\x02\x02\x8B\x8C\t\x11\x02\x02\x8C\x93\t\x12\x02\x02\x8D\x8E\t\x11\x02\x02\x8E\x8F\t\r\x02\x02\x8F\x90\t\x13\x02\x02\x90\x91\t\x12\x02\x02\x91\x93\t\x11\x02\x02\x92\x8B\x03\x02\x02\x02\x92\x8D\x03\x02\x02\x02\x93$\x03\x02\x02\x02\x94\x95\t\x11\x02\x02\x95\x9E\t\x03\x02\x02\x96\x97\t\x11\x02\x02\x97\x98\t\r\x02\x02\x98\x99\t\x13\x02\x02\x99\x9A\t\x03\x02\x02\x9A\x9B\t\x04\x02\x02\x9B\x9C\t\x05\x02\x02\x9C\x9E\t\x13\x02\x02\x9D\x94\x03\x02\x02\x02\x9D\x96\x03\x02\x02\x02\x9E&\x03\x02\x02\x02\x9F\xA0\t\x05\x02\x02\xA0\xA1\t\x06\x02\x02\xA1\xA2\t\x0E\x02\x02\xA2\xA3\t\f\x02\x02\xA3(\x03\x02\x02\x02\xA4\xA5\t\x14\x02\x02\xA5\xA6\t\x06\x02\x02\xA6\xA7\t\t\x02\x02\xA7\xA8\t\r\x02\x02\xA8*\x03\x02\x02\x02\xA9\xAA\t\x07\x02\x02\xAA\xAB\t\r\x02\x02\xAB\xAC\t\x11\x02\x02\xAC\xAD\t\r\x02\x02\xAD\xAE\t\x06\x02\x02\xAE\xAF\t\f\x02\x02\xAF,\x03\x02\x02\x02\xB0\xB1\t\x0E\x02\x02\xB1\xB2\t\x02\x02\x02\xB2.\x03\x02\x02\x02\xB3\xB4\t\r\x02\x02\xB4\xB5\t\x0B\x02\x02\xB5\xB6\t\x15\x02\x02\xB6\xB7\t\r\x02\x02\xB70\x03\x02\x02\x02\xB8\xB9\t\x15\x02\x02\xB9\xBA\t\f\x02\x02\xBA\xBB\t\x04\x02\x02\xBB\xBC\t\x11\x02\x02\xBC2\x03\x02\x02\x02\xBD\xBE\t\x07\x02\x02\xBE\xBF\t\r\x02\x02\xBF\xC0\t\f\x02\x02\xC0\xC1\t\x12\x02\x02\xC1\xC2\t\x07\x02\x02\xC2\xC3\t\x13\x02\x02\xC34\x03\x02\x02\x02\xC4\xC5\t\f\x02\x02\xC5\xC6\t\x04\x02\x02\xC66\x03\x02\x02\x02\xC7\xC8\t\r\x02\x02\xC8\xC9\t\x13\x02\x02\xC9\xCA\t\x03\x02\x02\xCA8\x03\x02\x02\x02\xCB\xCC\t\x06\x02\x02\xCC\xCD\t\x13\x02\x02\xCD\xCE\t\x03\x02\x02\xCE:\x03\x02\x02\x02\xCF\xD0\t\x04\x02\x02\xD0\xD1\t\x07\x02\x02\xD1<\x03\x02\x02\x02\xD2\xD3\x07,\x02\x02\xD3>\x03\x02\x02\x02\xD4\xD5\x071\x02\x02\xD5@\x03\x02\x02\x02\xD6\xD7\x07-\x02\x02\xD7B\x03\x02\x02\x02\xD8\xD9\x07/\x02\x02\xD9D\x03\x02\x02\x02\xDA\xDE\x07=\x02\x02\xDB\xDD\n\x16\x02\x02\xDC\xDB\x03\x02\x02\x02\xDD\xE0\x03\x02\x02\x02\xDE\xDC\x03\x02\x02\x02\xDE\xDF\x03\x02\x02\x02\xDFF\x03\x02\x02\x02\xE0\xDE\x03\x02\x02\x02\xE1\xE5\t\x17\x02\x02\xE2\xE4\t\x18\x02\x02\xE3\xE2\x03\x02\x02\x02\xE4\xE7\x03\x02\x02\x02\xE5\xE3\x03\x02\x02\x02\xE5\xE6\x03\x02\x02\x02\xE6H\x03\x02\x02\x02\xE7\xE5\x03\x02\x02\x02\xE8\xEA\x07/\x02\x02\xE9\xE8\x03\x02\x02\x02\xE9\xEA\x03\x02\x02\x02\xEA\xEC\x03\x02\x02\x02\xEB\xED\t\x19\x02\x02\xEC\xEB\x03\x02\x02\x02\xED\xEE\x03\x02\x02\x02\xEE\xEC\x03\x02\x02\x02\xEE\xEF\x03\x02\x02\x02\xEFJ\x03\x02\x02\x02\xF0\xF1\t\x1A\x02\x02\xF1\xF2\x03\x02\x02\x02\xF2\xF3\b&\x02\x02\xF3L\x03\x02\x02\x02\r\x02px\x80\x89\x92\x9D\xDE\xE5\xE9\xEE\x03\b\x02\x02"),a=p.decisionToState.map(function(e,t){return new n.dfa.DFA(e,t)});r.prototype=Object.create(n.Lexer.prototype),r.prototype.constructor=r,Object.defineProperty(r.prototype,"atn",{get:function(){return p}}),r.EOF=n.Token.EOF,r.T__0=1,r.T__1=2,r.T__2=3,r.T__3=4,r.T__4=5,r.T__5=6,r.T__6=7,r.T__7=8,r.T__8=9,r.T__9=10,r.T__10=11,r.T__11=12,r.FD=13,r.BK=14,r.LT=15,r.RT=16,r.PU=17,r.PD=18,r.WAIT=19,r.MAKE=20,r.REPEAT=21,r.IF=22,r.ELSE=23,r.STOP=24,r.RETURN=25,r.TO=26,r.END=27,r.AND=28,r.OR=29,r.MUL=30,r.DIV=31,r.ADD=32,r.SUB=33,r.COMMENT=34,r.STRING=35,r.INTNUM=36,r.WS=37,r.prototype.channelNames=["DEFAULT_TOKEN_CHANNEL","HIDDEN"],r.prototype.modeNames=["DEFAULT_MODE"],r.prototype.literalNames=[null,"'\"'","':'","'['","']'","'('","')'","'='","'!='","'<'","'<='","'>'","'>='",null,null,null,null,null,null,null,null,null,null,null,null,null,null,null,null,null,"'*'","'/'","'+'","'-'"],r.prototype.symbolicNames=[null,null,null,null,null,null,null,null,null,null,null,null,null,"FD","BK","LT","RT","PU","PD","WAIT","MAKE","REPEAT","IF","ELSE","STOP","RETURN","TO","END","AND","OR","MUL","DIV","ADD","SUB","COMMENT","STRING","INTNUM","WS"],r.prototype.ruleNames=["T__0","T__1","T__2","T__3","T__4","T__5","T__6","T__7","T__8","T__9","T__10","T__11","FD","BK","LT","RT","PU","PD","WAIT","MAKE","REPEAT","IF","ELSE","STOP","RETURN","TO","END","AND","OR","MUL","DIV","ADD","SUB","COMMENT","STRING","INTNUM","WS"],r.prototype.grammarFileName="logo.g4",o.logoLexer=r},{"antlr4/index":49}],6:[function(e,t,o){function r(){return n.tree.ParseTreeListener.call(this),this}var n=e("antlr4/index");r.prototype=Object.create(n.tree.ParseTreeListener.prototype),r.prototype.constructor=r,r.prototype.enterProgram=function(){},r.prototype.exitProgram=function(){},r.prototype.enterStatement=function(){},r.prototype.exitStatement=function(){},r.prototype.enterFD=function(){},r.prototype.exitFD=function(){},r.prototype.enterBK=function(){},r.prototype.exitBK=function(){},r.prototype.enterLT=function(){},r.prototype.exitLT=function(){},r.prototype.enterRT=function(){},r.prototype.exitRT=function(){},r.prototype.enterPU=function(){},r.prototype.exitPU=function(){},r.prototype.enterPD=function(){},r.prototype.exitPD=function(){},r.prototype.enterWait=function(){},r.prototype.exitWait=function(){},r.prototype.enterReturn=function(){},r.prototype.exitReturn=function(){},r.prototype.enterStop=function(){},r.prototype.exitStop=function(){},r.prototype.enterMake=function(){},r.prototype.exitMake=function(){},r.prototype.enterRepeat=function(){},r.prototype.exitRepeat=function(){},r.prototype.enterIf=function(){},r.prototype.exitIf=function(){},r.prototype.enterInvokeProc=function(){},r.prototype.exitInvokeProc=function(){},r.prototype.enterProcedureDef=function(){},r.prototype.exitProcedureDef=function(){},r.prototype.enterParamDef=function(){},r.prototype.exitParamDef=function(){},r.prototype.enterProcedureInvoke=function(){},r.prototype.exitProcedureInvoke=function(){},r.prototype.enterBlock=function(){},r.prototype.exitBlock=function(){},r.prototype.enterComp=function(){},r.prototype.exitComp=function(){},r.prototype.enterCombine=function(){},r.prototype.exitCombine=function(){},r.prototype.enterEq=function(){},r.prototype.exitEq=function(){},r.prototype.enterNotEq=function(){},r.prototype.exitNotEq=function(){},r.prototype.enterLessThan=function(){},r.prototype.exitLessThan=function(){},r.prototype.enterLessThanEq=function(){},r.prototype.exitLessThanEq=function(){},r.prototype.enterGreaterThan=function(){},r.prototype.exitGreaterThan=function(){},r.prototype.enterGreaterThanEq=function(){},r.prototype.exitGreaterThanEq=function(){},r.prototype.enterComment=function(){},r.prototype.exitComment=function(){},r.prototype.enterMulDiv=function(){},r.prototype.exitMulDiv=function(){},r.prototype.enterAddSub=function(){},r.prototype.exitAddSub=function(){},r.prototype.enterParens=function(){},r.prototype.exitParens=function(){},r.prototype.enterNegate=function(){},r.prototype.exitNegate=function(){},r.prototype.enterInt=function(){},r.prototype.exitInt=function(){},r.prototype.enterDeref=function(){},r.prototype.exitDeref=function(){},o.logoListener=r},{"antlr4/index":49}],7:[function(e,t,o){function r(e){return G.Parser.call(this,e),this._interp=new G.atn.ParserATNSimulator(this,q,W,Y),this.ruleNames=$,this.literalNames=w,this.symbolicNames=j,this}function n(e,t,o){return void 0===t&&(t=null),(void 0===o||null===o)&&(o=-1),G.ParserRuleContext.call(this,t,o),this.parser=e,this.ruleIndex=r.RULE_program,this}function p(e,t,o){return void 0===t&&(t=null),(void 0===o||null===o)&&(o=-1),G.ParserRuleContext.call(this,t,o),this.parser=e,this.ruleIndex=r.RULE_statement,this}function a(e,t,o){return void 0===t&&(t=null),(void 0===o||null===o)&&(o=-1),G.ParserRuleContext.call(this,t,o),this.parser=e,this.ruleIndex=r.RULE_command,this}function i(e,t){return a.call(this,e),a.prototype.copyFrom.call(this,t),this}function s(e,t){return a.call(this,e),a.prototype.copyFrom.call(this,t),this}function d(e,t){return a.call(this,e),a.prototype.copyFrom.call(this,t),this}function c(e,t){return a.call(this,e),a.prototype.copyFrom.call(this,t),this}function l(e,t){return a.call(this,e),a.prototype.copyFrom.call(this,t),this}function u(e,t){return a.call(this,e),a.prototype.copyFrom.call(this,t),this}function y(e,t){return a.call(this,e),a.prototype.copyFrom.call(this,t),this}function g(e,t){return a.call(this,e),a.prototype.copyFrom.call(this,t),this}function T(e,t){return a.call(this,e),a.prototype.copyFrom.call(this,t),this}function x(e,t){return a.call(this,e),a.prototype.copyFrom.call(this,t),this}function m(e,t){return a.call(this,e),a.prototype.copyFrom.call(this,t),this}function _(e,t){return a.call(this,e),a.prototype.copyFrom.call(this,t),this}function S(e,t){return a.call(this,e),a.prototype.copyFrom.call(this,t),this}function f(e,t,o){return void 0===t&&(t=null),(void 0===o||null===o)&&(o=-1),G.ParserRuleContext.call(this,t,o),this.parser=e,this.ruleIndex=r.RULE_procedureDef,this}function h(e,t,o){return void 0===t&&(t=null),(void 0===o||null===o)&&(o=-1),G.ParserRuleContext.call(this,t,o),this.parser=e,this.ruleIndex=r.RULE_paramDef,this}function E(e,t,o){return void 0===t&&(t=null),(void 0===o||null===o)&&(o=-1),G.ParserRuleContext.call(this,t,o),this.parser=e,this.ruleIndex=r.RULE_procedureInvoke,this}function A(e,t,o){return void 0===t&&(t=null),(void 0===o||null===o)&&(o=-1),G.ParserRuleContext.call(this,t,o),this.parser=e,this.ruleIndex=r.RULE_block,this}function C(e,t,o){return void 0===t&&(t=null),(void 0===o||null===o)&&(o=-1),G.ParserRuleContext.call(this,t,o),this.parser=e,this.ruleIndex=r.RULE_condition,this}function N(e,t){return C.call(this,e),C.prototype.copyFrom.call(this,t),this}function R(e,t){return C.call(this,e),C.prototype.copyFrom.call(this,t),this}function L(e,t,o){return void 0===t&&(t=null),(void 0===o||null===o)&&(o=-1),G.ParserRuleContext.call(this,t,o),this.parser=e,this.ruleIndex=r.RULE_comparison,this}function I(e,t){return L.call(this,e),L.prototype.copyFrom.call(this,t),this}function k(e,t){return L.call(this,e),L.prototype.copyFrom.call(this,t),this}function P(e,t){return L.call(this,e),L.prototype.copyFrom.call(this,t),this}function D(e,t){return L.call(this,e),L.prototype.copyFrom.call(this,t),this}function O(e,t){return L.call(this,e),L.prototype.copyFrom.call(this,t),this}function F(e,t){return L.call(this,e),L.prototype.copyFrom.call(this,t),this}function b(e,t,o){return void 0===t&&(t=null),(void 0===o||null===o)&&(o=-1),G.ParserRuleContext.call(this,t,o),this.parser=e,this.ruleIndex=r.RULE_comment,this}function v(e,t,o){return void 0===t&&(t=null),(void 0===o||null===o)&&(o=-1),G.ParserRuleContext.call(this,t,o),this.parser=e,this.ruleIndex=r.RULE_expr,this}function M(e,t){return v.call(this,e),v.prototype.copyFrom.call(this,t),this}function U(e,t){return v.call(this,e),v.prototype.copyFrom.call(this,t),this}function B(e,t){return v.call(this,e),v.prototype.copyFrom.call(this,t),this}function H(e,t){return v.call(this,e),v.prototype.copyFrom.call(this,t),this}function V(e,t){return v.call(this,e),v.prototype.copyFrom.call(this,t),this}function z(e,t){return v.call(this,e),v.prototype.copyFrom.call(this,t),this}var G=e("antlr4/index"),K=e("./logoListener").logoListener,q=new G.atn.ATNDeserializer().deserialize("\x03\u608B\uA72A\u8133\uB9ED\u417C\u3BE7\u7786\u5964\x03'\xAC\x04\x02\t\x02\x04\x03\t\x03\x04\x04\t\x04\x04\x05\t\x05\x04\x06\t\x06\x04\x07\t\x07\x04\b\t\b\x04\t\t\t\x04\n\t\n\x04\x0B\t\x0B\x04\f\t\f\x03\x02\x03\x02\x07\x02\x1B\n\x02\f\x02\x0E\x02\x1E\x0B\x02\x03\x02\x03\x02\x03\x03\x03\x03\x05\x03$\n\x03\x03\x04\x03\x04\x03\x04\x03\x04\x03\x04\x03\x04\x03\x04\x03\x04\x03\x04\x03\x04\x03\x04\x03\x04\x03\x04\x03\x04\x03\x04\x03\x04\x03\x04\x03\x04\x03\x04\x03\x04\x03\x04\x03\x04\x03\x04\x03\x04\x03\x04\x03\x04\x03\x04\x05\x04A\n\x04\x03\x04\x05\x04D\n\x04\x03\x05\x03\x05\x03\x05\x07\x05I\n\x05\f\x05\x0E\x05L\x0B\x05\x03\x05\x03\x05\x07\x05P\n\x05\f\x05\x0E\x05S\x0B\x05\x03\x05\x03\x05\x03\x06\x03\x06\x03\x06\x03\x07\x03\x07\x07\x07\\\n\x07\f\x07\x0E\x07_\x0B\x07\x03\b\x03\b\x05\bc\n\b\x03\b\x03\b\x03\b\x07\bh\n\b\f\b\x0E\bk\x0B\b\x03\b\x03\b\x03\t\x03\t\x03\t\x03\t\x03\t\x03\t\x03\t\x03\t\x03\t\x03\t\x06\ty\n\t\r\t\x0E\tz\x03\t\x03\t\x03\t\x03\t\x03\t\x03\t\x06\t\x83\n\t\r\t\x0E\t\x84\x03\t\x03\t\x05\t\x89\n\t\x03\n\x03\n\x03\n\x03\n\x03\n\x03\n\x05\n\x91\n\n\x03\x0B\x03\x0B\x03\f\x03\f\x03\f\x03\f\x03\f\x03\f\x03\f\x03\f\x03\f\x03\f\x05\f\x9F\n\f\x03\f\x03\f\x03\f\x03\f\x03\f\x03\f\x07\f\xA7\n\f\f\f\x0E\f\xAA\x0B\f\x03\f\x02\x03\x16\r\x02\x04\x06\b\n\f\x0E\x10\x12\x14\x16\x02\x04\x03\x02 !\x03\x02\"#\x02\xC5\x02\x1C\x03\x02\x02\x02\x04#\x03\x02\x02\x02\x06C\x03\x02\x02\x02\bE\x03\x02\x02\x02\nV\x03\x02\x02\x02\fY\x03\x02\x02\x02\x0E`\x03\x02\x02\x02\x10\x88\x03\x02\x02\x02\x12\x90\x03\x02\x02\x02\x14\x92\x03\x02\x02\x02\x16\x9E\x03\x02\x02\x02\x18\x1B\x05\x04\x03\x02\x19\x1B\x05\x14\x0B\x02\x1A\x18\x03\x02\x02\x02\x1A\x19\x03\x02\x02\x02\x1B\x1E\x03\x02\x02\x02\x1C\x1A\x03\x02\x02\x02\x1C\x1D\x03\x02\x02\x02\x1D\x1F\x03\x02\x02\x02\x1E\x1C\x03\x02\x02\x02\x1F \x07\x02\x02\x03 \x03\x03\x02\x02\x02!$\x05\x06\x04\x02\"$\x05\b\x05\x02#!\x03\x02\x02\x02#\"\x03\x02\x02\x02$\x05\x03\x02\x02\x02%&\x07\x0F\x02\x02&D\x05\x16\f\x02'(\x07\x10\x02\x02(D\x05\x16\f\x02)*\x07\x11\x02\x02*D\x05\x16\f\x02+,\x07\x12\x02\x02,D\x05\x16\f\x02-D\x07\x13\x02\x02.D\x07\x14\x02\x02/0\x07\x15\x02\x020D\x05\x16\f\x021D\x07\x1B\x02\x022D\x07\x1A\x02\x0234\x07\x16\x02\x0245\x07\x03\x02\x0256\x07%\x02\x026D\x05\x16\f\x0278\x07\x17\x02\x0289\x05\x16\f\x029:\x05\x0E\b\x02:D\x03\x02\x02\x02;<\x07\x18\x02\x02<=\x05\x10\t\x02=@\x05\x0E\b\x02>?\x07\x19\x02\x02?A\x05\x0E\b\x02@>\x03\x02\x02\x02@A\x03\x02\x02\x02AD\x03\x02\x02\x02BD\x05\f\x07\x02C%\x03\x02\x02\x02C'\x03\x02\x02\x02C)\x03\x02\x02\x02C+\x03\x02\x02\x02C-\x03\x02\x02\x02C.\x03\x02\x02\x02C/\x03\x02\x02\x02C1\x03\x02\x02\x02C2\x03\x02\x02\x02C3\x03\x02\x02\x02C7\x03\x02\x02\x02C;\x03\x02\x02\x02CB\x03\x02\x02\x02D\x07\x03\x02\x02\x02EF\x07\x1C\x02\x02FJ\x07%\x02\x02GI\x05\n\x06\x02HG\x03\x02\x02\x02IL\x03\x02\x02\x02JH\x03\x02\x02\x02JK\x03\x02\x02\x02KQ\x03\x02\x02\x02LJ\x03\x02\x02\x02MP\x05\x06\x04\x02NP\x05\x14\x0B\x02OM\x03\x02\x02\x02ON\x03\x02\x02\x02PS\x03\x02\x02\x02QO\x03\x02\x02\x02QR\x03\x02\x02\x02RT\x03\x02\x02\x02SQ\x03\x02\x02\x02TU\x07\x1D\x02\x02U\t\x03\x02\x02\x02VW\x07\x04\x02\x02WX\x07%\x02\x02X\x0B\x03\x02\x02\x02Y]\x07%\x02\x02Z\\\x05\x16\f\x02[Z\x03\x02\x02\x02\\_\x03\x02\x02\x02][\x03\x02\x02\x02]^\x03\x02\x02\x02^\r\x03\x02\x02\x02_]\x03\x02\x02\x02`b\x07\x05\x02\x02ac\x05\x14\x0B\x02ba\x03\x02\x02\x02bc\x03\x02\x02\x02cd\x03\x02\x02\x02di\x05\x06\x04\x02eh\x05\x06\x04\x02fh\x05\x14\x0B\x02ge\x03\x02\x02\x02gf\x03\x02\x02\x02hk\x03\x02\x02\x02ig\x03\x02\x02\x02ij\x03\x02\x02\x02jl\x03\x02\x02\x02ki\x03\x02\x02\x02lm\x07\x06\x02\x02m\x0F\x03\x02\x02\x02no\x07\x07\x02\x02op\x05\x16\f\x02pq\x05\x12\n\x02qr\x05\x16\f\x02rs\x07\b\x02\x02s\x89\x03\x02\x02\x02tu\x07\x07\x02\x02ux\x05\x10\t\x02vw\x07\x1E\x02\x02wy\x05\x10\t\x02xv\x03\x02\x02\x02yz\x03\x02\x02\x02zx\x03\x02\x02\x02z{\x03\x02\x02\x02{|\x03\x02\x02\x02|}\x07\b\x02\x02}\x89\x03\x02\x02\x02~\x7F\x07\x07\x02\x02\x7F\x82\x05\x10\t\x02\x80\x81\x07\x1F\x02\x02\x81\x83\x05\x10\t\x02\x82\x80\x03\x02\x02\x02\x83\x84\x03\x02\x02\x02\x84\x82\x03\x02\x02\x02\x84\x85\x03\x02\x02\x02\x85\x86\x03\x02\x02\x02\x86\x87\x07\b\x02\x02\x87\x89\x03\x02\x02\x02\x88n\x03\x02\x02\x02\x88t\x03\x02\x02\x02\x88~\x03\x02\x02\x02\x89\x11\x03\x02\x02\x02\x8A\x91\x07\t\x02\x02\x8B\x91\x07\n\x02\x02\x8C\x91\x07\x0B\x02\x02\x8D\x91\x07\f\x02\x02\x8E\x91\x07\r\x02\x02\x8F\x91\x07\x0E\x02\x02\x90\x8A\x03\x02\x02\x02\x90\x8B\x03\x02\x02\x02\x90\x8C\x03\x02\x02\x02\x90\x8D\x03\x02\x02\x02\x90\x8E\x03\x02\x02\x02\x90\x8F\x03\x02\x02\x02\x91\x13\x03\x02\x02\x02\x92\x93\x07$\x02\x02\x93\x15\x03\x02\x02\x02\x94\x95\b\f\x01\x02\x95\x96\x07#\x02\x02\x96\x9F\x05\x16\f\b\x97\x98\x07\x04\x02\x02\x98\x9F\x07%\x02\x02\x99\x9F\x07&\x02\x02\x9A\x9B\x07\x07\x02\x02\x9B\x9C\x05\x16\f\x02\x9C\x9D\x07\b\x02\x02\x9D\x9F\x03\x02\x02\x02\x9E\x94\x03\x02\x02\x02\x9E\x97\x03\x02\x02\x02\x9E\x99\x03\x02\x02\x02\x9E\x9A\x03\x02\x02\x02\x9F\xA8\x03\x02\x02\x02\xA0\xA1\f\x07\x02\x02\xA1\xA2\t\x02\x02\x02\xA2\xA7\x05\x16\f\b\xA3\xA4\f\x06\x02\x02\xA4\xA5\t\x03\x02\x02\xA5\xA7\x05\x16\f\x07\xA6\xA0\x03\x02\x02\x02\xA6\xA3\x03\x02\x02\x02\xA7\xAA\x03\x02\x02\x02\xA8\xA6\x03\x02\x02\x02\xA8\xA9\x03\x02\x02\x02\xA9\x17\x03\x02\x02\x02\xAA\xA8\x03\x02\x02\x02\x15\x1A\x1C#@CJOQ]bgiz\x84\x88\x90\x9E\xA6\xA8"),W=q.decisionToState.map(function(e,t){return new G.dfa.DFA(e,t)}),Y=new G.PredictionContextCache,w=[null,"'\"'","':'","'['","']'","'('","')'","'='","'!='","'<'","'<='","'>'","'>='",null,null,null,null,null,null,null,null,null,null,null,null,null,null,null,null,null,"'*'","'/'","'+'","'-'"],j=[null,null,null,null,null,null,null,null,null,null,null,null,null,"FD","BK","LT","RT","PU","PD","WAIT","MAKE","REPEAT","IF","ELSE","STOP","RETURN","TO","END","AND","OR","MUL","DIV","ADD","SUB","COMMENT","STRING","INTNUM","WS"],$=["program","statement","command","procedureDef","paramDef","procedureInvoke","block","condition","comparison","comment","expr"];r.prototype=Object.create(G.Parser.prototype),r.prototype.constructor=r,Object.defineProperty(r.prototype,"atn",{get:function(){return q}}),r.EOF=G.Token.EOF,r.T__0=1,r.T__1=2,r.T__2=3,r.T__3=4,r.T__4=5,r.T__5=6,r.T__6=7,r.T__7=8,r.T__8=9,r.T__9=10,r.T__10=11,r.T__11=12,r.FD=13,r.BK=14,r.LT=15,r.RT=16,r.PU=17,r.PD=18,r.WAIT=19,r.MAKE=20,r.REPEAT=21,r.IF=22,r.ELSE=23,r.STOP=24,r.RETURN=25,r.TO=26,r.END=27,r.AND=28,r.OR=29,r.MUL=30,r.DIV=31,r.ADD=32,r.SUB=33,r.COMMENT=34,r.STRING=35,r.INTNUM=36,r.WS=37,r.RULE_program=0,r.RULE_statement=1,r.RULE_command=2,r.RULE_procedureDef=3,r.RULE_paramDef=4,r.RULE_procedureInvoke=5,r.RULE_block=6,r.RULE_condition=7,r.RULE_comparison=8,r.RULE_comment=9,r.RULE_expr=10,n.prototype=Object.create(G.ParserRuleContext.prototype),n.prototype.constructor=n,n.prototype.EOF=function(){return this.getToken(r.EOF,0)},n.prototype.statement=function(e){return void 0===e&&(e=null),null===e?this.getTypedRuleContexts(p):this.getTypedRuleContext(p,e)},n.prototype.comment=function(e){return void 0===e&&(e=null),null===e?this.getTypedRuleContexts(b):this.getTypedRuleContext(b,e)},n.prototype.enterRule=function(e){e instanceof K&&e.enterProgram(this)},n.prototype.exitRule=function(e){e instanceof K&&e.exitProgram(this)},r.ProgramContext=n,r.prototype.program=function(){var e=new n(this,this._ctx,this.state);this.enterRule(e,0,r.RULE_program);var t=0;try{for(this.enterOuterAlt(e,1),this.state=26,this._errHandler.sync(this),t=this._input.LA(1);0==(-32&t-13)&&0!=(1<<t-13&(1<<r.FD-13|1<<r.BK-13|1<<r.LT-13|1<<r.RT-13|1<<r.PU-13|1<<r.PD-13|1<<r.WAIT-13|1<<r.MAKE-13|1<<r.REPEAT-13|1<<r.IF-13|1<<r.STOP-13|1<<r.RETURN-13|1<<r.TO-13|1<<r.COMMENT-13|1<<r.STRING-13));){switch(this.state=24,this._errHandler.sync(this),this._input.LA(1)){case r.FD:case r.BK:case r.LT:case r.RT:case r.PU:case r.PD:case r.WAIT:case r.MAKE:case r.REPEAT:case r.IF:case r.STOP:case r.RETURN:case r.TO:case r.STRING:this.state=22,this.statement();break;case r.COMMENT:this.state=23,this.comment();break;default:throw new G.error.NoViableAltException(this);}this.state=28,this._errHandler.sync(this),t=this._input.LA(1)}this.state=29,this.match(r.EOF)}catch(t){if(t instanceof G.error.RecognitionException)e.exception=t,this._errHandler.reportError(this,t),this._errHandler.recover(this,t);else throw t}finally{this.exitRule()}return e},p.prototype=Object.create(G.ParserRuleContext.prototype),p.prototype.constructor=p,p.prototype.command=function(){return this.getTypedRuleContext(a,0)},p.prototype.procedureDef=function(){return this.getTypedRuleContext(f,0)},p.prototype.enterRule=function(e){e instanceof K&&e.enterStatement(this)},p.prototype.exitRule=function(e){e instanceof K&&e.exitStatement(this)},r.StatementContext=p,r.prototype.statement=function(){var e=new p(this,this._ctx,this.state);this.enterRule(e,2,r.RULE_statement);try{switch(this.state=33,this._errHandler.sync(this),this._input.LA(1)){case r.FD:case r.BK:case r.LT:case r.RT:case r.PU:case r.PD:case r.WAIT:case r.MAKE:case r.REPEAT:case r.IF:case r.STOP:case r.RETURN:case r.STRING:this.enterOuterAlt(e,1),this.state=31,this.command();break;case r.TO:this.enterOuterAlt(e,2),this.state=32,this.procedureDef();break;default:throw new G.error.NoViableAltException(this);}}catch(t){if(t instanceof G.error.RecognitionException)e.exception=t,this._errHandler.reportError(this,t),this._errHandler.recover(this,t);else throw t}finally{this.exitRule()}return e},a.prototype=Object.create(G.ParserRuleContext.prototype),a.prototype.constructor=a,a.prototype.copyFrom=function(e){G.ParserRuleContext.prototype.copyFrom.call(this,e)},i.prototype=Object.create(a.prototype),i.prototype.constructor=i,r.RTContext=i,i.prototype.RT=function(){return this.getToken(r.RT,0)},i.prototype.expr=function(){return this.getTypedRuleContext(v,0)},i.prototype.enterRule=function(e){e instanceof K&&e.enterRT(this)},i.prototype.exitRule=function(e){e instanceof K&&e.exitRT(this)},s.prototype=Object.create(a.prototype),s.prototype.constructor=s,r.ReturnContext=s,s.prototype.RETURN=function(){return this.getToken(r.RETURN,0)},s.prototype.enterRule=function(e){e instanceof K&&e.enterReturn(this)},s.prototype.exitRule=function(e){e instanceof K&&e.exitReturn(this)},d.prototype=Object.create(a.prototype),d.prototype.constructor=d,r.PUContext=d,d.prototype.PU=function(){return this.getToken(r.PU,0)},d.prototype.enterRule=function(e){e instanceof K&&e.enterPU(this)},d.prototype.exitRule=function(e){e instanceof K&&e.exitPU(this)},c.prototype=Object.create(a.prototype),c.prototype.constructor=c,r.StopContext=c,c.prototype.STOP=function(){return this.getToken(r.STOP,0)},c.prototype.enterRule=function(e){e instanceof K&&e.enterStop(this)},c.prototype.exitRule=function(e){e instanceof K&&e.exitStop(this)},l.prototype=Object.create(a.prototype),l.prototype.constructor=l,r.LTContext=l,l.prototype.LT=function(){return this.getToken(r.LT,0)},l.prototype.expr=function(){return this.getTypedRuleContext(v,0)},l.prototype.enterRule=function(e){e instanceof K&&e.enterLT(this)},l.prototype.exitRule=function(e){e instanceof K&&e.exitLT(this)},u.prototype=Object.create(a.prototype),u.prototype.constructor=u,r.BKContext=u,u.prototype.BK=function(){return this.getToken(r.BK,0)},u.prototype.expr=function(){return this.getTypedRuleContext(v,0)},u.prototype.enterRule=function(e){e instanceof K&&e.enterBK(this)},u.prototype.exitRule=function(e){e instanceof K&&e.exitBK(this)},y.prototype=Object.create(a.prototype),y.prototype.constructor=y,r.MakeContext=y,y.prototype.MAKE=function(){return this.getToken(r.MAKE,0)},y.prototype.STRING=function(){return this.getToken(r.STRING,0)},y.prototype.expr=function(){return this.getTypedRuleContext(v,0)},y.prototype.enterRule=function(e){e instanceof K&&e.enterMake(this)},y.prototype.exitRule=function(e){e instanceof K&&e.exitMake(this)},g.prototype=Object.create(a.prototype),g.prototype.constructor=g,r.RepeatContext=g,g.prototype.REPEAT=function(){return this.getToken(r.REPEAT,0)},g.prototype.expr=function(){return this.getTypedRuleContext(v,0)},g.prototype.block=function(){return this.getTypedRuleContext(A,0)},g.prototype.enterRule=function(e){e instanceof K&&e.enterRepeat(this)},g.prototype.exitRule=function(e){e instanceof K&&e.exitRepeat(this)},T.prototype=Object.create(a.prototype),T.prototype.constructor=T,r.InvokeProcContext=T,T.prototype.procedureInvoke=function(){return this.getTypedRuleContext(E,0)},T.prototype.enterRule=function(e){e instanceof K&&e.enterInvokeProc(this)},T.prototype.exitRule=function(e){e instanceof K&&e.exitInvokeProc(this)},x.prototype=Object.create(a.prototype),x.prototype.constructor=x,r.PDContext=x,x.prototype.PD=function(){return this.getToken(r.PD,0)},x.prototype.enterRule=function(e){e instanceof K&&e.enterPD(this)},x.prototype.exitRule=function(e){e instanceof K&&e.exitPD(this)},m.prototype=Object.create(a.prototype),m.prototype.constructor=m,r.WaitContext=m,m.prototype.WAIT=function(){return this.getToken(r.WAIT,0)},m.prototype.expr=function(){return this.getTypedRuleContext(v,0)},m.prototype.enterRule=function(e){e instanceof K&&e.enterWait(this)},m.prototype.exitRule=function(e){e instanceof K&&e.exitWait(this)},_.prototype=Object.create(a.prototype),_.prototype.constructor=_,r.IfContext=_,_.prototype.IF=function(){return this.getToken(r.IF,0)},_.prototype.condition=function(){return this.getTypedRuleContext(C,0)},_.prototype.block=function(e){return void 0===e&&(e=null),null===e?this.getTypedRuleContexts(A):this.getTypedRuleContext(A,e)},_.prototype.ELSE=function(){return this.getToken(r.ELSE,0)},_.prototype.enterRule=function(e){e instanceof K&&e.enterIf(this)},_.prototype.exitRule=function(e){e instanceof K&&e.exitIf(this)},S.prototype=Object.create(a.prototype),S.prototype.constructor=S,r.FDContext=S,S.prototype.FD=function(){return this.getToken(r.FD,0)},S.prototype.expr=function(){return this.getTypedRuleContext(v,0)},S.prototype.enterRule=function(e){e instanceof K&&e.enterFD(this)},S.prototype.exitRule=function(e){e instanceof K&&e.exitFD(this)},r.CommandContext=a,r.prototype.command=function(){var e=new a(this,this._ctx,this.state);this.enterRule(e,4,r.RULE_command);var t=0;try{switch(this.state=65,this._errHandler.sync(this),this._input.LA(1)){case r.FD:e=new S(this,e),this.enterOuterAlt(e,1),this.state=35,this.match(r.FD),this.state=36,this.expr(0);break;case r.BK:e=new u(this,e),this.enterOuterAlt(e,2),this.state=37,this.match(r.BK),this.state=38,this.expr(0);break;case r.LT:e=new l(this,e),this.enterOuterAlt(e,3),this.state=39,this.match(r.LT),this.state=40,this.expr(0);break;case r.RT:e=new i(this,e),this.enterOuterAlt(e,4),this.state=41,this.match(r.RT),this.state=42,this.expr(0);break;case r.PU:e=new d(this,e),this.enterOuterAlt(e,5),this.state=43,this.match(r.PU);break;case r.PD:e=new x(this,e),this.enterOuterAlt(e,6),this.state=44,this.match(r.PD);break;case r.WAIT:e=new m(this,e),this.enterOuterAlt(e,7),this.state=45,this.match(r.WAIT),this.state=46,this.expr(0);break;case r.RETURN:e=new s(this,e),this.enterOuterAlt(e,8),this.state=47,this.match(r.RETURN);break;case r.STOP:e=new c(this,e),this.enterOuterAlt(e,9),this.state=48,this.match(r.STOP);break;case r.MAKE:e=new y(this,e),this.enterOuterAlt(e,10),this.state=49,this.match(r.MAKE),this.state=50,this.match(r.T__0),this.state=51,this.match(r.STRING),this.state=52,this.expr(0);break;case r.REPEAT:e=new g(this,e),this.enterOuterAlt(e,11),this.state=53,this.match(r.REPEAT),this.state=54,this.expr(0),this.state=55,this.block();break;case r.IF:e=new _(this,e),this.enterOuterAlt(e,12),this.state=57,this.match(r.IF),this.state=58,this.condition(),this.state=59,this.block(),this.state=62,this._errHandler.sync(this),t=this._input.LA(1),t===r.ELSE&&(this.state=60,this.match(r.ELSE),this.state=61,this.block());break;case r.STRING:e=new T(this,e),this.enterOuterAlt(e,13),this.state=64,this.procedureInvoke();break;default:throw new G.error.NoViableAltException(this);}}catch(t){if(t instanceof G.error.RecognitionException)e.exception=t,this._errHandler.reportError(this,t),this._errHandler.recover(this,t);else throw t}finally{this.exitRule()}return e},f.prototype=Object.create(G.ParserRuleContext.prototype),f.prototype.constructor=f,f.prototype.TO=function(){return this.getToken(r.TO,0)},f.prototype.STRING=function(){return this.getToken(r.STRING,0)},f.prototype.END=function(){return this.getToken(r.END,0)},f.prototype.paramDef=function(e){return void 0===e&&(e=null),null===e?this.getTypedRuleContexts(h):this.getTypedRuleContext(h,e)},f.prototype.command=function(e){return void 0===e&&(e=null),null===e?this.getTypedRuleContexts(a):this.getTypedRuleContext(a,e)},f.prototype.comment=function(e){return void 0===e&&(e=null),null===e?this.getTypedRuleContexts(b):this.getTypedRuleContext(b,e)},f.prototype.enterRule=function(e){e instanceof K&&e.enterProcedureDef(this)},f.prototype.exitRule=function(e){e instanceof K&&e.exitProcedureDef(this)},r.ProcedureDefContext=f,r.prototype.procedureDef=function(){var e=new f(this,this._ctx,this.state);this.enterRule(e,6,r.RULE_procedureDef);var t=0;try{for(this.enterOuterAlt(e,1),this.state=67,this.match(r.TO),this.state=68,this.match(r.STRING),this.state=72,this._errHandler.sync(this),t=this._input.LA(1);t===r.T__1;)this.state=69,this.paramDef(),this.state=74,this._errHandler.sync(this),t=this._input.LA(1);for(this.state=79,this._errHandler.sync(this),t=this._input.LA(1);0==(-32&t-13)&&0!=(1<<t-13&(1<<r.FD-13|1<<r.BK-13|1<<r.LT-13|1<<r.RT-13|1<<r.PU-13|1<<r.PD-13|1<<r.WAIT-13|1<<r.MAKE-13|1<<r.REPEAT-13|1<<r.IF-13|1<<r.STOP-13|1<<r.RETURN-13|1<<r.COMMENT-13|1<<r.STRING-13));){switch(this.state=77,this._errHandler.sync(this),this._input.LA(1)){case r.FD:case r.BK:case r.LT:case r.RT:case r.PU:case r.PD:case r.WAIT:case r.MAKE:case r.REPEAT:case r.IF:case r.STOP:case r.RETURN:case r.STRING:this.state=75,this.command();break;case r.COMMENT:this.state=76,this.comment();break;default:throw new G.error.NoViableAltException(this);}this.state=81,this._errHandler.sync(this),t=this._input.LA(1)}this.state=82,this.match(r.END)}catch(t){if(t instanceof G.error.RecognitionException)e.exception=t,this._errHandler.reportError(this,t),this._errHandler.recover(this,t);else throw t}finally{this.exitRule()}return e},h.prototype=Object.create(G.ParserRuleContext.prototype),h.prototype.constructor=h,h.prototype.STRING=function(){return this.getToken(r.STRING,0)},h.prototype.enterRule=function(e){e instanceof K&&e.enterParamDef(this)},h.prototype.exitRule=function(e){e instanceof K&&e.exitParamDef(this)},r.ParamDefContext=h,r.prototype.paramDef=function(){var e=new h(this,this._ctx,this.state);this.enterRule(e,8,r.RULE_paramDef);try{this.enterOuterAlt(e,1),this.state=84,this.match(r.T__1),this.state=85,this.match(r.STRING)}catch(t){if(t instanceof G.error.RecognitionException)e.exception=t,this._errHandler.reportError(this,t),this._errHandler.recover(this,t);else throw t}finally{this.exitRule()}return e},E.prototype=Object.create(G.ParserRuleContext.prototype),E.prototype.constructor=E,E.prototype.STRING=function(){return this.getToken(r.STRING,0)},E.prototype.expr=function(e){return void 0===e&&(e=null),null===e?this.getTypedRuleContexts(v):this.getTypedRuleContext(v,e)},E.prototype.enterRule=function(e){e instanceof K&&e.enterProcedureInvoke(this)},E.prototype.exitRule=function(e){e instanceof K&&e.exitProcedureInvoke(this)},r.ProcedureInvokeContext=E,r.prototype.procedureInvoke=function(){var e=new E(this,this._ctx,this.state);this.enterRule(e,10,r.RULE_procedureInvoke);var t=0;try{for(this.enterOuterAlt(e,1),this.state=87,this.match(r.STRING),this.state=91,this._errHandler.sync(this),t=this._input.LA(1);t===r.T__1||t===r.T__4||t===r.SUB||t===r.INTNUM;)this.state=88,this.expr(0),this.state=93,this._errHandler.sync(this),t=this._input.LA(1)}catch(t){if(t instanceof G.error.RecognitionException)e.exception=t,this._errHandler.reportError(this,t),this._errHandler.recover(this,t);else throw t}finally{this.exitRule()}return e},A.prototype=Object.create(G.ParserRuleContext.prototype),A.prototype.constructor=A,A.prototype.command=function(e){return void 0===e&&(e=null),null===e?this.getTypedRuleContexts(a):this.getTypedRuleContext(a,e)},A.prototype.comment=function(e){return void 0===e&&(e=null),null===e?this.getTypedRuleContexts(b):this.getTypedRuleContext(b,e)},A.prototype.enterRule=function(e){e instanceof K&&e.enterBlock(this)},A.prototype.exitRule=function(e){e instanceof K&&e.exitBlock(this)},r.BlockContext=A,r.prototype.block=function(){var e=new A(this,this._ctx,this.state);this.enterRule(e,12,r.RULE_block);var t=0;try{for(this.enterOuterAlt(e,1),this.state=94,this.match(r.T__2),this.state=96,this._errHandler.sync(this),t=this._input.LA(1),t===r.COMMENT&&(this.state=95,this.comment()),this.state=98,this.command(),this.state=103,this._errHandler.sync(this),t=this._input.LA(1);0==(-32&t-13)&&0!=(1<<t-13&(1<<r.FD-13|1<<r.BK-13|1<<r.LT-13|1<<r.RT-13|1<<r.PU-13|1<<r.PD-13|1<<r.WAIT-13|1<<r.MAKE-13|1<<r.REPEAT-13|1<<r.IF-13|1<<r.STOP-13|1<<r.RETURN-13|1<<r.COMMENT-13|1<<r.STRING-13));){switch(this.state=101,this._errHandler.sync(this),this._input.LA(1)){case r.FD:case r.BK:case r.LT:case r.RT:case r.PU:case r.PD:case r.WAIT:case r.MAKE:case r.REPEAT:case r.IF:case r.STOP:case r.RETURN:case r.STRING:this.state=99,this.command();break;case r.COMMENT:this.state=100,this.comment();break;default:throw new G.error.NoViableAltException(this);}this.state=105,this._errHandler.sync(this),t=this._input.LA(1)}this.state=106,this.match(r.T__3)}catch(t){if(t instanceof G.error.RecognitionException)e.exception=t,this._errHandler.reportError(this,t),this._errHandler.recover(this,t);else throw t}finally{this.exitRule()}return e},C.prototype=Object.create(G.ParserRuleContext.prototype),C.prototype.constructor=C,C.prototype.copyFrom=function(e){G.ParserRuleContext.prototype.copyFrom.call(this,e)},N.prototype=Object.create(C.prototype),N.prototype.constructor=N,r.CombineContext=N,N.prototype.condition=function(e){return void 0===e&&(e=null),null===e?this.getTypedRuleContexts(C):this.getTypedRuleContext(C,e)},N.prototype.AND=function(e){return void 0===e&&(e=null),null===e?this.getTokens(r.AND):this.getToken(r.AND,e)},N.prototype.OR=function(e){return void 0===e&&(e=null),null===e?this.getTokens(r.OR):this.getToken(r.OR,e)},N.prototype.enterRule=function(e){e instanceof K&&e.enterCombine(this)},N.prototype.exitRule=function(e){e instanceof K&&e.exitCombine(this)},R.prototype=Object.create(C.prototype),R.prototype.constructor=R,r.CompContext=R,R.prototype.expr=function(e){return void 0===e&&(e=null),null===e?this.getTypedRuleContexts(v):this.getTypedRuleContext(v,e)},R.prototype.comparison=function(){return this.getTypedRuleContext(L,0)},R.prototype.enterRule=function(e){e instanceof K&&e.enterComp(this)},R.prototype.exitRule=function(e){e instanceof K&&e.exitComp(this)},r.ConditionContext=C,r.prototype.condition=function(){var e=new C(this,this._ctx,this.state);this.enterRule(e,14,r.RULE_condition);var t=0;try{this.state=134,this._errHandler.sync(this);var o=this._interp.adaptivePredict(this._input,14,this._ctx);switch(o){case 1:e=new R(this,e),this.enterOuterAlt(e,1),this.state=108,this.match(r.T__4),this.state=109,this.expr(0),this.state=110,this.comparison(),this.state=111,this.expr(0),this.state=112,this.match(r.T__5);break;case 2:e=new N(this,e),this.enterOuterAlt(e,2),this.state=114,this.match(r.T__4),this.state=115,this.condition(),this.state=118,this._errHandler.sync(this),t=this._input.LA(1);do this.state=116,this.match(r.AND),this.state=117,this.condition(),this.state=120,this._errHandler.sync(this),t=this._input.LA(1);while(t===r.AND);this.state=122,this.match(r.T__5);break;case 3:e=new N(this,e),this.enterOuterAlt(e,3),this.state=124,this.match(r.T__4),this.state=125,this.condition(),this.state=128,this._errHandler.sync(this),t=this._input.LA(1);do this.state=126,this.match(r.OR),this.state=127,this.condition(),this.state=130,this._errHandler.sync(this),t=this._input.LA(1);while(t===r.OR);this.state=132,this.match(r.T__5);}}catch(t){if(t instanceof G.error.RecognitionException)e.exception=t,this._errHandler.reportError(this,t),this._errHandler.recover(this,t);else throw t}finally{this.exitRule()}return e},L.prototype=Object.create(G.ParserRuleContext.prototype),L.prototype.constructor=L,L.prototype.copyFrom=function(e){G.ParserRuleContext.prototype.copyFrom.call(this,e)},I.prototype=Object.create(L.prototype),I.prototype.constructor=I,r.NotEqContext=I,I.prototype.enterRule=function(e){e instanceof K&&e.enterNotEq(this)},I.prototype.exitRule=function(e){e instanceof K&&e.exitNotEq(this)},k.prototype=Object.create(L.prototype),k.prototype.constructor=k,r.LessThanContext=k,k.prototype.enterRule=function(e){e instanceof K&&e.enterLessThan(this)},k.prototype.exitRule=function(e){e instanceof K&&e.exitLessThan(this)},P.prototype=Object.create(L.prototype),P.prototype.constructor=P,r.GreaterThanContext=P,P.prototype.enterRule=function(e){e instanceof K&&e.enterGreaterThan(this)},P.prototype.exitRule=function(e){e instanceof K&&e.exitGreaterThan(this)},D.prototype=Object.create(L.prototype),D.prototype.constructor=D,r.LessThanEqContext=D,D.prototype.enterRule=function(e){e instanceof K&&e.enterLessThanEq(this)},D.prototype.exitRule=function(e){e instanceof K&&e.exitLessThanEq(this)},O.prototype=Object.create(L.prototype),O.prototype.constructor=O,r.GreaterThanEqContext=O,O.prototype.enterRule=function(e){e instanceof K&&e.enterGreaterThanEq(this)},O.prototype.exitRule=function(e){e instanceof K&&e.exitGreaterThanEq(this)},F.prototype=Object.create(L.prototype),F.prototype.constructor=F,r.EqContext=F,F.prototype.enterRule=function(e){e instanceof K&&e.enterEq(this)},F.prototype.exitRule=function(e){e instanceof K&&e.exitEq(this)},r.ComparisonContext=L,r.prototype.comparison=function(){var e=new L(this,this._ctx,this.state);this.enterRule(e,16,r.RULE_comparison);try{switch(this.state=142,this._errHandler.sync(this),this._input.LA(1)){case r.T__6:e=new F(this,e),this.enterOuterAlt(e,1),this.state=136,this.match(r.T__6);break;case r.T__7:e=new I(this,e),this.enterOuterAlt(e,2),this.state=137,this.match(r.T__7);break;case r.T__8:e=new k(this,e),this.enterOuterAlt(e,3),this.state=138,this.match(r.T__8);break;case r.T__9:e=new D(this,e),this.enterOuterAlt(e,4),this.state=139,this.match(r.T__9);break;case r.T__10:e=new P(this,e),this.enterOuterAlt(e,5),this.state=140,this.match(r.T__10);break;case r.T__11:e=new O(this,e),this.enterOuterAlt(e,6),this.state=141,this.match(r.T__11);break;default:throw new G.error.NoViableAltException(this);}}catch(t){if(t instanceof G.error.RecognitionException)e.exception=t,this._errHandler.reportError(this,t),this._errHandler.recover(this,t);else throw t}finally{this.exitRule()}return e},b.prototype=Object.create(G.ParserRuleContext.prototype),b.prototype.constructor=b,b.prototype.COMMENT=function(){return this.getToken(r.COMMENT,0)},b.prototype.enterRule=function(e){e instanceof K&&e.enterComment(this)},b.prototype.exitRule=function(e){e instanceof K&&e.exitComment(this)},r.CommentContext=b,r.prototype.comment=function(){var e=new b(this,this._ctx,this.state);this.enterRule(e,18,r.RULE_comment);try{this.enterOuterAlt(e,1),this.state=144,this.match(r.COMMENT)}catch(t){if(t instanceof G.error.RecognitionException)e.exception=t,this._errHandler.reportError(this,t),this._errHandler.recover(this,t);else throw t}finally{this.exitRule()}return e},v.prototype=Object.create(G.ParserRuleContext.prototype),v.prototype.constructor=v,v.prototype.copyFrom=function(e){G.ParserRuleContext.prototype.copyFrom.call(this,e)},M.prototype=Object.create(v.prototype),M.prototype.constructor=M,r.MulDivContext=M,M.prototype.expr=function(e){return void 0===e&&(e=null),null===e?this.getTypedRuleContexts(v):this.getTypedRuleContext(v,e)},M.prototype.MUL=function(){return this.getToken(r.MUL,0)},M.prototype.DIV=function(){return this.getToken(r.DIV,0)},M.prototype.enterRule=function(e){e instanceof K&&e.enterMulDiv(this)},M.prototype.exitRule=function(e){e instanceof K&&e.exitMulDiv(this)},U.prototype=Object.create(v.prototype),U.prototype.constructor=U,r.AddSubContext=U,U.prototype.expr=function(e){return void 0===e&&(e=null),null===e?this.getTypedRuleContexts(v):this.getTypedRuleContext(v,e)},U.prototype.ADD=function(){return this.getToken(r.ADD,0)},U.prototype.SUB=function(){return this.getToken(r.SUB,0)},U.prototype.enterRule=function(e){e instanceof K&&e.enterAddSub(this)},U.prototype.exitRule=function(e){e instanceof K&&e.exitAddSub(this)},B.prototype=Object.create(v.prototype),B.prototype.constructor=B,r.ParensContext=B,B.prototype.expr=function(){return this.getTypedRuleContext(v,0)},B.prototype.enterRule=function(e){e instanceof K&&e.enterParens(this)},B.prototype.exitRule=function(e){e instanceof K&&e.exitParens(this)},H.prototype=Object.create(v.prototype),H.prototype.constructor=H,r.NegateContext=H,H.prototype.SUB=function(){return this.getToken(r.SUB,0)},H.prototype.expr=function(){return this.getTypedRuleContext(v,0)},H.prototype.enterRule=function(e){e instanceof K&&e.enterNegate(this)},H.prototype.exitRule=function(e){e instanceof K&&e.exitNegate(this)},V.prototype=Object.create(v.prototype),V.prototype.constructor=V,r.IntContext=V,V.prototype.INTNUM=function(){return this.getToken(r.INTNUM,0)},V.prototype.enterRule=function(e){e instanceof K&&e.enterInt(this)},V.prototype.exitRule=function(e){e instanceof K&&e.exitInt(this)},z.prototype=Object.create(v.prototype),z.prototype.constructor=z,r.DerefContext=z,z.prototype.STRING=function(){return this.getToken(r.STRING,0)},z.prototype.enterRule=function(e){e instanceof K&&e.enterDeref(this)},z.prototype.exitRule=function(e){e instanceof K&&e.exitDeref(this)},r.prototype.expr=function(e){e===void 0&&(e=0);var t=this._ctx,o=this.state,n=new v(this,this._ctx,o),p=n,a=20;this.enterRecursionRule(n,20,r.RULE_expr,e);var i=0;try{switch(this.enterOuterAlt(n,1),this.state=156,this._errHandler.sync(this),this._input.LA(1)){case r.SUB:n=new H(this,n),this._ctx=n,p=n,this.state=147,this.match(r.SUB),this.state=148,this.expr(6);break;case r.T__1:n=new z(this,n),this._ctx=n,p=n,this.state=149,this.match(r.T__1),this.state=150,this.match(r.STRING);break;case r.INTNUM:n=new V(this,n),this._ctx=n,p=n,this.state=151,this.match(r.INTNUM);break;case r.T__4:n=new B(this,n),this._ctx=n,p=n,this.state=152,this.match(r.T__4),this.state=153,this.expr(0),this.state=154,this.match(r.T__5);break;default:throw new G.error.NoViableAltException(this);}this._ctx.stop=this._input.LT(-1),this.state=166,this._errHandler.sync(this);for(var s=this._interp.adaptivePredict(this._input,18,this._ctx);2!=s&&s!=G.atn.ATN.INVALID_ALT_NUMBER;){if(1===s){null!==this._parseListeners&&this.triggerExitRuleEvent(),p=n,this.state=164,this._errHandler.sync(this);var d=this._interp.adaptivePredict(this._input,17,this._ctx);switch(d){case 1:if(n=new M(this,new v(this,t,o)),this.pushNewRecursionContext(n,a,r.RULE_expr),this.state=158,!this.precpred(this._ctx,5))throw new G.error.FailedPredicateException(this,"this.precpred(this._ctx, 5)");this.state=159,i=this._input.LA(1),i===r.MUL||i===r.DIV?(this._errHandler.reportMatch(this),this.consume()):this._errHandler.recoverInline(this),this.state=160,this.expr(6);break;case 2:if(n=new U(this,new v(this,t,o)),this.pushNewRecursionContext(n,a,r.RULE_expr),this.state=161,!this.precpred(this._ctx,4))throw new G.error.FailedPredicateException(this,"this.precpred(this._ctx, 4)");this.state=162,i=this._input.LA(1),i===r.ADD||i===r.SUB?(this._errHandler.reportMatch(this),this.consume()):this._errHandler.recoverInline(this),this.state=163,this.expr(5);}}this.state=168,this._errHandler.sync(this),s=this._interp.adaptivePredict(this._input,18,this._ctx)}}catch(e){if(e instanceof G.error.RecognitionException)n.exception=e,this._errHandler.reportError(this,e),this._errHandler.recover(this,e);else throw e}finally{this.unrollRecursionContexts(t)}return n},r.prototype.sempred=function(e,t,o){switch(t){case 10:return this.expr_sempred(e,o);default:throw"No predicate with index:"+t;}},r.prototype.expr_sempred=function(e,t){switch(t){case 0:return this.precpred(this._ctx,5);case 1:return this.precpred(this._ctx,4);default:throw"No predicate with index:"+t;}},o.logoParser=r},{"./logoListener":6,"antlr4/index":49}],8:[function(e,t,o){function r(){return this}function n(e){return r.call(this),this.tokenSource=e,this.tokens=[],this.index=-1,this.fetchedEOF=!1,this}var p=e("./Token").Token,a=e("./Lexer").Lexer,d=e("./IntervalSet").Interval;n.prototype=Object.create(r.prototype),n.prototype.constructor=n,n.prototype.mark=function(){return 0},n.prototype.release=function(){},n.prototype.reset=function(){this.seek(0)},n.prototype.seek=function(e){this.lazyInit(),this.index=this.adjustSeekIndex(e)},n.prototype.get=function(e){return this.lazyInit(),this.tokens[e]},n.prototype.consume=function(){var e=!1;if(e=!!(0<=this.index)&&(this.fetchedEOF?this.index<this.tokens.length-1:this.index<this.tokens.length),!e&&this.LA(1)===p.EOF)throw"cannot consume EOF";this.sync(this.index+1)&&(this.index=this.adjustSeekIndex(this.index+1))},n.prototype.sync=function(e){var t=e-this.tokens.length+1;if(0<t){var o=this.fetch(t);return o>=t}return!0},n.prototype.fetch=function(e){if(this.fetchedEOF)return 0;for(var o=0,r;o<e;o++)if(r=this.tokenSource.nextToken(),r.tokenIndex=this.tokens.length,this.tokens.push(r),r.type===p.EOF)return this.fetchedEOF=!0,o+1;return e},n.prototype.getTokens=function(e,o,r){if(void 0===r&&(r=null),0>e||0>o)return null;this.lazyInit();var n=[];o>=this.tokens.length&&(o=this.tokens.length-1);for(var a=e,i;a<o&&(i=this.tokens[a],i.type!==p.EOF);a++)(null===r||r.contains(i.type))&&n.push(i);return n},n.prototype.LA=function(e){return this.LT(e).type},n.prototype.LB=function(e){return 0>this.index-e?null:this.tokens[this.index-e]},n.prototype.LT=function(e){if(this.lazyInit(),0===e)return null;if(0>e)return this.LB(-e);var t=this.index+e-1;return this.sync(t),t>=this.tokens.length?this.tokens[this.tokens.length-1]:this.tokens[t]},n.prototype.adjustSeekIndex=function(e){return e},n.prototype.lazyInit=function(){-1===this.index&&this.setup()},n.prototype.setup=function(){this.sync(0),this.index=this.adjustSeekIndex(0)},n.prototype.setTokenSource=function(e){this.tokenSource=e,this.tokens=[],this.index=-1,this.fetchedEOF=!1},n.prototype.nextTokenOnChannel=function(e){if(this.sync(e),e>=this.tokens.length)return-1;for(var t=this.tokens[e];t.channel!==this.channel;){if(t.type===p.EOF)return-1;e+=1,this.sync(e),t=this.tokens[e]}return e},n.prototype.previousTokenOnChannel=function(e,t){for(;0<=e&&this.tokens[e].channel!==t;)e-=1;return e},n.prototype.getHiddenTokensToRight=function(e,t){if(void 0===t&&(t=-1),this.lazyInit(),0>e||e>=this.tokens.length)throw""+e+" not in 0.."+this.tokens.length-1;var o=this.nextTokenOnChannel(e+1,a.DEFAULT_TOKEN_CHANNEL),r=-1===o?this.tokens.length-1:o;return this.filterForChannel(e+1,r,t)},n.prototype.getHiddenTokensToLeft=function(e,t){if(void 0===t&&(t=-1),this.lazyInit(),0>e||e>=this.tokens.length)throw""+e+" not in 0.."+this.tokens.length-1;var o=this.previousTokenOnChannel(e-1,a.DEFAULT_TOKEN_CHANNEL);if(o===e-1)return null;return this.filterForChannel(o+1,e-1,t)},n.prototype.filterForChannel=function(e,o,r){for(var n=[],p=e,i;p<o+1;p++)i=this.tokens[p],-1===r?i.channel!==a.DEFAULT_TOKEN_CHANNEL&&n.push(i):i.channel===r&&n.push(i);return 0===n.length?null:n},n.prototype.getSourceName=function(){return this.tokenSource.getSourceName()},n.prototype.getText=function(e){this.lazyInit(),this.fill(),(void 0===e||null===e)&&(e=new d(0,this.tokens.length-1));var o=e.start;o instanceof p&&(o=o.tokenIndex);var r=e.stop;if(r instanceof p&&(r=r.tokenIndex),null===o||null===r||0>o||0>r)return"";r>=this.tokens.length&&(r=this.tokens.length-1);for(var n="",a=o,i;a<r+1&&(i=this.tokens[a],i.type!==p.EOF);a++)n+=i.text;return n},n.prototype.fill=function(){for(this.lazyInit();1e3===this.fetch(1e3);)continue},o.BufferedTokenStream=n},{"./IntervalSet":14,"./Lexer":16,"./Token":22}],9:[function(e,t,o){var r=e("./InputStream").InputStream,n="undefined"==typeof window&&"undefined"==typeof importScripts,p=n?e("fs"):null;o.CharStreams={fromString:function(e){return new r(e,!0)},fromBlob:function(e,t,o,n){var p=FileReader();p.onload=function(t){var e=new r(t.target.result,!0);o(e)},p.onerror=n,p.readAsText(e,t)},fromBuffer:function(e,t){return new r(e.toString(t),!0)},fromPath:function(e,t,o){p.readFile(e,t,function(e,t){var n=null;null!==t&&(n=new r(t,!0)),o(e,n)})},fromPathSync:function(e,t){var o=p.readFileSync(e,t);return new r(o,!0)}}},{"./InputStream":13,fs:55}],10:[function(e,t,o){function r(){return this}function n(e){return r.call(this),this.copyText=void 0!==e&&e,this}var p=e("./Token").CommonToken;n.prototype=Object.create(r.prototype),n.prototype.constructor=n,n.DEFAULT=new n,n.prototype.create=function(e,o,r,n,a,i,s,d){var c=new p(e,o,n,a,i);return c.line=s,c.column=d,null===r?this.copyText&&null!==e[1]&&(c.text=e[1].getText(a,i)):c.text=r,c},n.prototype.createThin=function(e,o){var r=new p(null,e);return r.text=o,r},o.CommonTokenFactory=n},{"./Token":22}],11:[function(e,t,o){function r(e,t){return n.call(this,e),this.channel=void 0===t?p.DEFAULT_CHANNEL:t,this}var p=e("./Token").Token,n=e("./BufferedTokenStream").BufferedTokenStream;r.prototype=Object.create(n.prototype),r.prototype.constructor=r,r.prototype.adjustSeekIndex=function(e){return this.nextTokenOnChannel(e,this.channel)},r.prototype.LB=function(e){if(0===e||0>this.index-e)return null;for(var t=this.index,o=1;o<=e;)t=this.previousTokenOnChannel(t-1,this.channel),o+=1;return 0>t?null:this.tokens[t]},r.prototype.LT=function(e){if(this.lazyInit(),0===e)return null;if(0>e)return this.LB(-e);for(var t=this.index,o=1;o<e;)this.sync(t+1)&&(t=this.nextTokenOnChannel(t+1,this.channel)),o+=1;return this.tokens[t]},r.prototype.getNumberOfOnChannelTokens=function(){var e=0;this.fill();for(var o=0,r;o<this.tokens.length&&(r=this.tokens[o],r.channel===this.channel&&(e+=1),r.type!==p.EOF);o++);return e},o.CommonTokenStream=r},{"./BufferedTokenStream":8,"./Token":22}],12:[function(e,t,o){function r(e,t){var o=a.readFileSync(e,"utf8");return n.call(this,o,t),this.fileName=e,this}var n=e("./InputStream").InputStream,p="undefined"==typeof window&&"undefined"==typeof importScripts,a=p?e("fs"):null;r.prototype=Object.create(n.prototype),r.prototype.constructor=r,o.FileStream=r},{"./InputStream":13,fs:55}],13:[function(e,t,o){function r(e){if(e._index=0,e.data=[],e.decodeToUnicodeCodePoints)for(var t=0,o;t<e.strdata.length;)o=e.strdata.codePointAt(t),e.data.push(o),t+=65535>=o?1:2;else for(var t=0,r;t<e.strdata.length;t++)r=e.strdata.charCodeAt(t),e.data.push(r);e._size=e.data.length}function n(e,t){return this.name="<empty>",this.strdata=e,this.decodeToUnicodeCodePoints=t||!1,r(this),this}var p=e("./Token").Token;e("./polyfills/codepointat"),e("./polyfills/fromcodepoint"),Object.defineProperty(n.prototype,"index",{get:function(){return this._index}}),Object.defineProperty(n.prototype,"size",{get:function(){return this._size}}),n.prototype.reset=function(){this._index=0},n.prototype.consume=function(){if(this._index>=this._size)throw"cannot consume EOF";this._index+=1},n.prototype.LA=function(e){if(0===e)return 0;0>e&&(e+=1);var t=this._index+e-1;return 0>t||t>=this._size?p.EOF:this.data[t]},n.prototype.LT=function(e){return this.LA(e)},n.prototype.mark=function(){return-1},n.prototype.release=function(){},n.prototype.seek=function(e){return e<=this._index?void(this._index=e):void(this._index=Math.min(e,this._size))},n.prototype.getText=function(e,t){if(t>=this._size&&(t=this._size-1),e>=this._size)return"";if(this.decodeToUnicodeCodePoints){for(var o="",r=e;r<=t;r++)o+=String.fromCodePoint(this.data[r]);return o}return this.strdata.slice(e,t+1)},n.prototype.toString=function(){return this.strdata},o.InputStream=n},{"./Token":22,"./polyfills/codepointat":50,"./polyfills/fromcodepoint":51}],14:[function(e,t,o){function n(e,t){return this.start=e,this.stop=t,this}function r(){this.intervals=null,this.readOnly=!1}var p=String.fromCharCode,s=e("./Token").Token;n.prototype.contains=function(e){return e>=this.start&&e<this.stop},n.prototype.toString=function(){return this.start===this.stop-1?this.start.toString():this.start.toString()+".."+(this.stop-1).toString()},Object.defineProperty(n.prototype,"length",{get:function(){return this.stop-this.start}}),r.prototype.first=function(){return null===this.intervals||0===this.intervals.length?s.INVALID_TYPE:this.intervals[0].start},r.prototype.addOne=function(e){this.addInterval(new n(e,e+1))},r.prototype.addRange=function(e,t){this.addInterval(new n(e,t+1))},r.prototype.addInterval=function(e){if(null===this.intervals)this.intervals=[],this.intervals.push(e);else{for(var t=0,o;t<this.intervals.length;t++){if(o=this.intervals[t],e.stop<o.start)return void this.intervals.splice(t,0,e);if(e.stop===o.start)return void(this.intervals[t].start=e.start);if(e.start<=o.stop)return this.intervals[t]=new n(Math.min(o.start,e.start),Math.max(o.stop,e.stop)),void this.reduce(t)}this.intervals.push(e)}},r.prototype.addSet=function(e){if(null!==e.intervals)for(var t=0,o;t<e.intervals.length;t++)o=e.intervals[t],this.addInterval(new n(o.start,o.stop));return this},r.prototype.reduce=function(e){if(e<this.intervalslength-1){var t=this.intervals[e],o=this.intervals[e+1];t.stop>=o.stop?(this.intervals.pop(e+1),this.reduce(e)):t.stop>=o.start&&(this.intervals[e]=new n(t.start,o.stop),this.intervals.pop(e+1))}},r.prototype.complement=function(e,t){var o=new r;o.addInterval(new n(e,t+1));for(var p=0;p<this.intervals.length;p++)o.removeRange(this.intervals[p]);return o},r.prototype.contains=function(e){if(null===this.intervals)return!1;for(var t=0;t<this.intervals.length;t++)if(this.intervals[t].contains(e))return!0;return!1},Object.defineProperty(r.prototype,"length",{get:function(){var e=0;return this.intervals.map(function(t){e+=t.length}),e}}),r.prototype.removeRange=function(e){if(e.start===e.stop-1)this.removeOne(e.start);else if(null!==this.intervals)for(var t=0,o=0,r;o<this.intervals.length;o++){if(r=this.intervals[t],e.stop<=r.start)return;if(e.start>r.start&&e.stop<r.stop){this.intervals[t]=new n(r.start,e.start);var p=new n(e.stop,r.stop);return void this.intervals.splice(t,0,p)}e.start<=r.start&&e.stop>=r.stop?(this.intervals.splice(t,1),--t):e.start<r.stop?this.intervals[t]=new n(r.start,e.start):e.stop<r.stop&&(this.intervals[t]=new n(e.stop,r.stop)),t+=1}},r.prototype.removeOne=function(e){if(null!==this.intervals)for(var t=0,o;t<this.intervals.length;t++){if(o=this.intervals[t],e<o.start)return;if(e===o.start&&e===o.stop-1)return void this.intervals.splice(t,1);if(e===o.start)return void(this.intervals[t]=new n(o.start+1,o.stop));if(e===o.stop-1)return void(this.intervals[t]=new n(o.start,o.stop-1));if(e<o.stop-1){var r=new n(o.start,e);return o.start=e+1,void this.intervals.splice(t,0,r)}}},r.prototype.toString=function(e,t,o){return e=e||null,t=t||null,o=o||!1,null===this.intervals?"{}":null!==e||null!==t?this.toTokenString(e,t):o?this.toCharString():this.toIndexString()},r.prototype.toCharString=function(){for(var e=[],t=0,o;t<this.intervals.length;t++)o=this.intervals[t],o.stop===o.start+1?o.start===s.EOF?e.push("<EOF>"):e.push("'"+p(o.start)+"'"):e.push("'"+p(o.start)+"'..'"+p(o.stop-1)+"'");return 1<e.length?"{"+e.join(", ")+"}":e[0]},r.prototype.toIndexString=function(){for(var e=[],t=0,o;t<this.intervals.length;t++)o=this.intervals[t],o.stop===o.start+1?o.start===s.EOF?e.push("<EOF>"):e.push(o.start.toString()):e.push(o.start.toString()+".."+(o.stop-1).toString());return 1<e.length?"{"+e.join(", ")+"}":e[0]},r.prototype.toTokenString=function(e,t){for(var o=[],r=0,n;r<this.intervals.length;r++){n=this.intervals[r];for(var p=n.start;p<n.stop;p++)o.push(this.elementName(e,t,p))}return 1<o.length?"{"+o.join(", ")+"}":o[0]},r.prototype.elementName=function(e,t,o){return o===s.EOF?"<EOF>":o===s.EPSILON?"<EPSILON>":e[o]||t[o]},o.Interval=n,o.IntervalSet=r},{"./Token":22}],15:[function(e,t,o){function r(e){this.atn=e}var n=e("./Utils").Set,p=e("./Utils").BitSet,a=e("./Token").Token,d=e("./atn/ATNConfig").ATNConfig,i=e("./IntervalSet").Interval,c=e("./IntervalSet").IntervalSet,l=e("./atn/ATNState").RuleStopState,u=e("./atn/Transition").RuleTransition,s=e("./atn/Transition").NotSetTransition,y=e("./atn/Transition").WildcardTransition,g=e("./atn/Transition").AbstractPredicateTransition,T=e("./PredictionContext"),x=T.predictionContextFromRuleContext,m=T.PredictionContext,_=T.SingletonPredictionContext;r.HIT_PRED=a.INVALID_TYPE,r.prototype.getDecisionLookahead=function(e){if(null===e)return null;for(var t=e.transitions.length,o=[],a=0;a<t;a++){o[a]=new c;var i=new n;this._LOOK(e.transition(a).target,null,m.EMPTY,o[a],i,new p,!1,!1),(0===o[a].length||o[a].contains(r.HIT_PRED))&&(o[a]=null)}return o},r.prototype.LOOK=function(e,t,o){var a=new c;o=o||null;var r=null===o?null:x(e.atn,o);return this._LOOK(e,t,r,a,new n,new p,!0,!0),a},r.prototype._LOOK=function(e,o,n,p,T,x,S,f){var h=new d({state:e,alt:0,context:n},null);if(!T.contains(h)){if(T.add(h),e===o){if(null===n)return void p.addOne(a.EPSILON);if(n.isEmpty()&&f)return void p.addOne(a.EOF)}if(e instanceof l){if(null===n)return void p.addOne(a.EPSILON);if(n.isEmpty()&&f)return void p.addOne(a.EOF);if(n!==m.EMPTY){for(var c=0;c<n.length;c++){var i=this.atn.states[n.getReturnState(c)],E=x.contains(i.ruleIndex);try{x.remove(i.ruleIndex),this._LOOK(i,o,n.getParent(c),p,T,x,S,f)}finally{E&&x.add(i.ruleIndex)}}return}}for(var A=0,C;A<e.transitions.length;A++)if(C=e.transitions[A],C.constructor===u){if(x.contains(C.target.ruleIndex))continue;var t=_.create(n,C.followState.stateNumber);try{x.add(C.target.ruleIndex),this._LOOK(C.target,o,t,p,T,x,S,f)}finally{x.remove(C.target.ruleIndex)}}else if(C instanceof g)S?this._LOOK(C.target,o,n,p,T,x,S,f):p.addOne(r.HIT_PRED);else if(C.isEpsilon)this._LOOK(C.target,o,n,p,T,x,S,f);else if(C.constructor===y)p.addRange(a.MIN_USER_TOKEN_TYPE,this.atn.maxTokenType);else{var N=C.label;null!==N&&(C instanceof s&&(N=N.complement(a.MIN_USER_TOKEN_TYPE,this.atn.maxTokenType)),p.addSet(N))}}},o.LL1Analyzer=r},{"./IntervalSet":14,"./PredictionContext":19,"./Token":22,"./Utils":23,"./atn/ATNConfig":25,"./atn/ATNState":30,"./atn/Transition":38}],16:[function(e,t,o){function r(e){return p.call(this),this._input=e,this._factory=a.DEFAULT,this._tokenFactorySourcePair=[this,e],this._interp=null,this._token=null,this._tokenStartCharIndex=-1,this._tokenStartLine=-1,this._tokenStartColumn=-1,this._hitEOF=!1,this._channel=n.DEFAULT_CHANNEL,this._type=n.INVALID_TYPE,this._modeStack=[],this._mode=r.DEFAULT_MODE,this._text=null,this}var n=e("./Token").Token,p=e("./Recognizer").Recognizer,a=e("./CommonTokenFactory").CommonTokenFactory,i=e("./error/Errors").RecognitionException,s=e("./error/Errors").LexerNoViableAltException;r.prototype=Object.create(p.prototype),r.prototype.constructor=r,r.DEFAULT_MODE=0,r.MORE=-2,r.SKIP=-3,r.DEFAULT_TOKEN_CHANNEL=n.DEFAULT_CHANNEL,r.HIDDEN=n.HIDDEN_CHANNEL,r.MIN_CHAR_VALUE=0,r.MAX_CHAR_VALUE=1114111,r.prototype.reset=function(){null!==this._input&&this._input.seek(0),this._token=null,this._type=n.INVALID_TYPE,this._channel=n.DEFAULT_CHANNEL,this._tokenStartCharIndex=-1,this._tokenStartColumn=-1,this._tokenStartLine=-1,this._text=null,this._hitEOF=!1,this._mode=r.DEFAULT_MODE,this._modeStack=[],this._interp.reset()},r.prototype.nextToken=function(){if(null===this._input)throw"nextToken requires a non-null input stream.";var e=this._input.mark();try{for(;;){if(this._hitEOF)return this.emitEOF(),this._token;this._token=null,this._channel=n.DEFAULT_CHANNEL,this._tokenStartCharIndex=this._input.index,this._tokenStartColumn=this._interp.column,this._tokenStartLine=this._interp.line,this._text=null;for(var t=!1;;){this._type=n.INVALID_TYPE;var o=r.SKIP;try{o=this._interp.match(this._input,this._mode)}catch(t){if(t instanceof i)this.notifyListeners(t),this.recover(t);else throw console.log(t.stack),t}if(this._input.LA(1)===n.EOF&&(this._hitEOF=!0),this._type===n.INVALID_TYPE&&(this._type=o),this._type===r.SKIP){t=!0;break}if(this._type!==r.MORE)break}if(!t)return null===this._token&&this.emit(),this._token}}finally{this._input.release(e)}},r.prototype.skip=function(){this._type=r.SKIP},r.prototype.more=function(){this._type=r.MORE},r.prototype.mode=function(e){this._mode=e},r.prototype.pushMode=function(e){this._interp.debug&&console.log("pushMode "+e),this._modeStack.push(this._mode),this.mode(e)},r.prototype.popMode=function(){if(0===this._modeStack.length)throw"Empty Stack";return this._interp.debug&&console.log("popMode back to "+this._modeStack.slice(0,-1)),this.mode(this._modeStack.pop()),this._mode},Object.defineProperty(r.prototype,"inputStream",{get:function(){return this._input},set:function(e){this._input=null,this._tokenFactorySourcePair=[this,this._input],this.reset(),this._input=e,this._tokenFactorySourcePair=[this,this._input]}}),Object.defineProperty(r.prototype,"sourceName",{get:function(){return this._input.sourceName}}),r.prototype.emitToken=function(e){this._token=e},r.prototype.emit=function(){var e=this._factory.create(this._tokenFactorySourcePair,this._type,this._text,this._channel,this._tokenStartCharIndex,this.getCharIndex()-1,this._tokenStartLine,this._tokenStartColumn);return this.emitToken(e),e},r.prototype.emitEOF=function(){var e=this.column,t=this.line,o=this._factory.create(this._tokenFactorySourcePair,n.EOF,null,n.DEFAULT_CHANNEL,this._input.index,this._input.index-1,t,e);return this.emitToken(o),o},Object.defineProperty(r.prototype,"type",{get:function(){return this.type},set:function(e){this._type=e}}),Object.defineProperty(r.prototype,"line",{get:function(){return this._interp.line},set:function(e){this._interp.line=e}}),Object.defineProperty(r.prototype,"column",{get:function(){return this._interp.column},set:function(e){this._interp.column=e}}),r.prototype.getCharIndex=function(){return this._input.index},Object.defineProperty(r.prototype,"text",{get:function(){return null===this._text?this._interp.getText(this._input):this._text},set:function(e){this._text=e}}),r.prototype.getAllTokens=function(){for(var e=[],o=this.nextToken();o.type!==n.EOF;)e.push(o),o=this.nextToken();return e},r.prototype.notifyListeners=function(t){var e=this._tokenStartCharIndex,o=this._input.index,r=this._input.getText(e,o),n="token recognition error at: '"+this.getErrorDisplay(r)+"'",p=this.getErrorListenerDispatch();p.syntaxError(this,null,this._tokenStartLine,this._tokenStartColumn,n,t)},r.prototype.getErrorDisplay=function(e){for(var t=[],o=0;o<e.length;o++)t.push(e[o]);return t.join("")},r.prototype.getErrorDisplayForChar=function(e){return e.charCodeAt(0)===n.EOF?"<EOF>":"\n"===e?"\\n":"\t"===e?"\\t":"\r"===e?"\\r":e},r.prototype.getCharErrorDisplay=function(e){return"'"+this.getErrorDisplayForChar(e)+"'"},r.prototype.recover=function(e){this._input.LA(1)!==n.EOF&&(e instanceof s?this._interp.consume(this._input):this._input.consume())},o.Lexer=r},{"./CommonTokenFactory":10,"./Recognizer":20,"./Token":22,"./error/Errors":47}],17:[function(e,t,o){function r(e){return a.call(this),this.parser=e,this}function n(e){return i.call(this),this._input=null,this._errHandler=new s,this._precedenceStack=[],this._precedenceStack.push(0),this._ctx=null,this.buildParseTrees=!0,this._tracer=null,this._parseListeners=null,this._syntaxErrors=0,this.setInputStream(e),this}var p=e("./Token").Token,a=e("./tree/Tree").ParseTreeListener,i=e("./Recognizer").Recognizer,s=e("./error/ErrorStrategy").DefaultErrorStrategy,d=e("./atn/ATNDeserializer").ATNDeserializer,c=e("./atn/ATNDeserializationOptions").ATNDeserializationOptions,l=e("./tree/Tree").TerminalNode,u=e("./tree/Tree").ErrorNode;r.prototype=Object.create(a.prototype),r.prototype.constructor=r,r.prototype.enterEveryRule=function(e){console.log("enter   "+this.parser.ruleNames[e.ruleIndex]+", LT(1)="+this.parser._input.LT(1).text)},r.prototype.visitTerminal=function(e){console.log("consume "+e.symbol+" rule "+this.parser.ruleNames[this.parser._ctx.ruleIndex])},r.prototype.exitEveryRule=function(e){console.log("exit    "+this.parser.ruleNames[e.ruleIndex]+", LT(1)="+this.parser._input.LT(1).text)},n.prototype=Object.create(i.prototype),n.prototype.contructor=n,n.bypassAltsAtnCache={},n.prototype.reset=function(){null!==this._input&&this._input.seek(0),this._errHandler.reset(this),this._ctx=null,this._syntaxErrors=0,this.setTrace(!1),this._precedenceStack=[],this._precedenceStack.push(0),null!==this._interp&&this._interp.reset()},n.prototype.match=function(e){var o=this.getCurrentToken();return o.type===e?(this._errHandler.reportMatch(this),this.consume()):(o=this._errHandler.recoverInline(this),this.buildParseTrees&&-1===o.tokenIndex&&this._ctx.addErrorNode(o)),o},n.prototype.matchWildcard=function(){var e=this.getCurrentToken();return 0<e.type?(this._errHandler.reportMatch(this),this.consume()):(e=this._errHandler.recoverInline(this),this._buildParseTrees&&-1===e.tokenIndex&&this._ctx.addErrorNode(e)),e},n.prototype.getParseListeners=function(){return this._parseListeners||[]},n.prototype.addParseListener=function(e){if(null===e)throw"listener";null===this._parseListeners&&(this._parseListeners=[]),this._parseListeners.push(e)},n.prototype.removeParseListener=function(e){if(null!==this._parseListeners){var t=this._parseListeners.indexOf(e);0<=t&&this._parseListeners.splice(t,1),0===this._parseListeners.length&&(this._parseListeners=null)}},n.prototype.removeParseListeners=function(){this._parseListeners=null},n.prototype.triggerEnterRuleEvent=function(){if(null!==this._parseListeners){var e=this._ctx;this._parseListeners.map(function(t){t.enterEveryRule(e),e.enterRule(t)})}},n.prototype.triggerExitRuleEvent=function(){if(null!==this._parseListeners){var e=this._ctx;this._parseListeners.slice(0).reverse().map(function(t){e.exitRule(t),t.exitEveryRule(e)})}},n.prototype.getTokenFactory=function(){return this._input.tokenSource._factory},n.prototype.setTokenFactory=function(e){this._input.tokenSource._factory=e},n.prototype.getATNWithBypassAlts=function(){var e=this.getSerializedATN();if(null===e)throw"The current parser does not support an ATN with bypass alternatives.";var t=this.bypassAltsAtnCache[e];if(null===t){var o=new c;o.generateRuleBypassTransitions=!0,t=new d(o).deserialize(e),this.bypassAltsAtnCache[e]=t}return t};var y=e("./Lexer").Lexer;n.prototype.compileParseTreePattern=function(e,t,o){if(o=o||null,null===o&&null!==this.getTokenStream()){var r=this.getTokenStream().tokenSource;r instanceof y&&(o=r)}if(null===o)throw"Parser can't discover a lexer to use";var n=new ParseTreePatternMatcher(o,this);return n.compile(e,t)},n.prototype.getInputStream=function(){return this.getTokenStream()},n.prototype.setInputStream=function(e){this.setTokenStream(e)},n.prototype.getTokenStream=function(){return this._input},n.prototype.setTokenStream=function(e){this._input=null,this.reset(),this._input=e},n.prototype.getCurrentToken=function(){return this._input.LT(1)},n.prototype.notifyErrorListeners=function(e,t,o){t=t||null,o=o||null,null===t&&(t=this.getCurrentToken()),this._syntaxErrors+=1;var r=t.line,n=t.column,p=this.getErrorListenerDispatch();p.syntaxError(this,t,r,n,e,o)},n.prototype.consume=function(){var e=this.getCurrentToken();e.type!==p.EOF&&this.getInputStream().consume();var t=null!==this._parseListeners&&0<this._parseListeners.length;if(this.buildParseTrees||t){var o;o=this._errHandler.inErrorRecoveryMode(this)?this._ctx.addErrorNode(e):this._ctx.addTokenNode(e),o.invokingState=this.state,t&&this._parseListeners.map(function(e){o instanceof u||o.isErrorNode!==void 0&&o.isErrorNode()?e.visitErrorNode(o):o instanceof l&&e.visitTerminal(o)})}return e},n.prototype.addContextToParseTree=function(){null!==this._ctx.parentCtx&&this._ctx.parentCtx.addChild(this._ctx)},n.prototype.enterRule=function(e,t){this.state=t,this._ctx=e,this._ctx.start=this._input.LT(1),this.buildParseTrees&&this.addContextToParseTree(),null!==this._parseListeners&&this.triggerEnterRuleEvent()},n.prototype.exitRule=function(){this._ctx.stop=this._input.LT(-1),null!==this._parseListeners&&this.triggerExitRuleEvent(),this.state=this._ctx.invokingState,this._ctx=this._ctx.parentCtx},n.prototype.enterOuterAlt=function(e,t){e.setAltNumber(t),this.buildParseTrees&&this._ctx!==e&&null!==this._ctx.parentCtx&&(this._ctx.parentCtx.removeLastChild(),this._ctx.parentCtx.addChild(e)),this._ctx=e},n.prototype.getPrecedence=function(){return 0===this._precedenceStack.length?-1:this._precedenceStack[this._precedenceStack.length-1]},n.prototype.enterRecursionRule=function(e,t,o,r){this.state=t,this._precedenceStack.push(r),this._ctx=e,this._ctx.start=this._input.LT(1),null!==this._parseListeners&&this.triggerEnterRuleEvent()},n.prototype.pushNewRecursionContext=function(e,t){var o=this._ctx;o.parentCtx=e,o.invokingState=t,o.stop=this._input.LT(-1),this._ctx=e,this._ctx.start=o.start,this.buildParseTrees&&this._ctx.addChild(o),null!==this._parseListeners&&this.triggerEnterRuleEvent()},n.prototype.unrollRecursionContexts=function(e){this._precedenceStack.pop(),this._ctx.stop=this._input.LT(-1);var t=this._ctx;if(null!==this._parseListeners)for(;this._ctx!==e;)this.triggerExitRuleEvent(),this._ctx=this._ctx.parentCtx;else this._ctx=e;t.parentCtx=e,this.buildParseTrees&&null!==e&&e.addChild(t)},n.prototype.getInvokingContext=function(e){for(var t=this._ctx;null!==t;){if(t.ruleIndex===e)return t;t=t.parentCtx}return null},n.prototype.precpred=function(e,t){return t>=this._precedenceStack[this._precedenceStack.length-1]},n.prototype.inContext=function(){return!1},n.prototype.isExpectedToken=function(e){var t=this._interp.atn,o=this._ctx,r=t.states[this.state],n=t.nextTokens(r);if(n.contains(e))return!0;if(!n.contains(p.EPSILON))return!1;for(;null!==o&&0<=o.invokingState&&n.contains(p.EPSILON);){var a=t.states[o.invokingState],i=a.transitions[0];if(n=t.nextTokens(i.followState),n.contains(e))return!0;o=o.parentCtx}return!!(n.contains(p.EPSILON)&&e===p.EOF)},n.prototype.getExpectedTokens=function(){return this._interp.atn.getExpectedTokens(this.state,this._ctx)},n.prototype.getExpectedTokensWithinCurrentRule=function(){var e=this._interp.atn,t=e.states[this.state];return e.nextTokens(t)},n.prototype.getRuleIndex=function(e){var t=this.getRuleIndexMap()[e];return null===t?-1:t},n.prototype.getRuleInvocationStack=function(e){e=e||null,null===e&&(e=this._ctx);for(var t=[];null!==e;){var o=e.ruleIndex;0>o?t.push("n/a"):t.push(this.ruleNames[o]),e=e.parentCtx}return t},n.prototype.getDFAStrings=function(){return this._interp.decisionToDFA.toString()},n.prototype.dumpDFA=function(){for(var e=!1,t=0,o;t<this._interp.decisionToDFA.length;t++)o=this._interp.decisionToDFA[t],0<o.states.length&&(e&&console.log(),this.printer.println("Decision "+o.decision+":"),this.printer.print(o.toString(this.literalNames,this.symbolicNames)),e=!0)},n.prototype.getSourceName=function(){return this._input.sourceName},n.prototype.setTrace=function(e){e?(null!==this._tracer&&this.removeParseListener(this._tracer),this._tracer=new r(this),this.addParseListener(this._tracer)):(this.removeParseListener(this._tracer),this._tracer=null)},o.Parser=n},{"./Lexer":16,"./Recognizer":20,"./Token":22,"./atn/ATNDeserializationOptions":27,"./atn/ATNDeserializer":28,"./error/ErrorStrategy":46,"./tree/Tree":52}],18:[function(e,t,o){function r(e,t){e=e||null,t=t||null,p.call(this,e,t),this.ruleIndex=-1,this.children=null,this.start=null,this.stop=null,this.exception=null}function n(e,t,o){return r.call(e,t),this.ruleIndex=o,this}var p=e("./RuleContext").RuleContext,a=e("./tree/Tree"),i=a.INVALID_INTERVAL,s=a.TerminalNode,d=a.TerminalNodeImpl,c=a.ErrorNodeImpl,l=e("./IntervalSet").Interval;r.prototype=Object.create(p.prototype),r.prototype.constructor=r,r.prototype.copyFrom=function(e){this.parentCtx=e.parentCtx,this.invokingState=e.invokingState,this.children=null,this.start=e.start,this.stop=e.stop,e.children&&(this.children=[],e.children.map(function(e){e instanceof c&&(this.children.push(e),e.parentCtx=this)},this))},r.prototype.enterRule=function(){},r.prototype.exitRule=function(){},r.prototype.addChild=function(e){return null===this.children&&(this.children=[]),this.children.push(e),e},r.prototype.removeLastChild=function(){null!==this.children&&this.children.pop()},r.prototype.addTokenNode=function(e){var t=new d(e);return this.addChild(t),t.parentCtx=this,t},r.prototype.addErrorNode=function(e){var t=new c(e);return this.addChild(t),t.parentCtx=this,t},r.prototype.getChild=function(e,t){if(t=t||null,null===this.children||0>e||e>=this.children.length)return null;if(null===t)return this.children[e];for(var o=0,r;o<this.children.length;o++)if(r=this.children[o],r instanceof t){if(0===e)return r;e-=1}return null},r.prototype.getToken=function(e,t){if(null===this.children||0>t||t>=this.children.length)return null;for(var o=0,r;o<this.children.length;o++)if(r=this.children[o],r instanceof s&&r.symbol.type===e){if(0===t)return r;t-=1}return null},r.prototype.getTokens=function(e){if(null===this.children)return[];for(var t=[],o=0,r;o<this.children.length;o++)r=this.children[o],r instanceof s&&r.symbol.type===e&&t.push(r);return t},r.prototype.getTypedRuleContext=function(e,t){return this.getChild(t,e)},r.prototype.getTypedRuleContexts=function(e){if(null===this.children)return[];for(var t=[],o=0,r;o<this.children.length;o++)r=this.children[o],r instanceof e&&t.push(r);return t},r.prototype.getChildCount=function(){return null===this.children?0:this.children.length},r.prototype.getSourceInterval=function(){return null===this.start||null===this.stop?i:new l(this.start.tokenIndex,this.stop.tokenIndex)},p.EMPTY=new r,n.prototype=Object.create(r.prototype),n.prototype.constructor=n,o.ParserRuleContext=r},{"./IntervalSet":14,"./RuleContext":21,"./tree/Tree":52}],19:[function(e,t,o){function r(e){this.cachedHashCode=e}function n(){return this.cache={},this}function p(e,t){var o=0;if(null!==e){var n=new x;n.update(e,t),o=n.finish()}r.call(this,o),this.parentCtx=e,this.returnState=t}function i(){return p.call(this,null,r.EMPTY_RETURN_STATE),this}function s(e,t){var o=new x;o.update(e,t);var n=o.finish();return r.call(this,n),this.parents=e,this.returnStates=t,this}function a(e,t){if((void 0===t||null===t)&&(t=T.EMPTY),null===t.parentCtx||t===T.EMPTY)return r.EMPTY;var o=a(e,t.parentCtx),n=e.states[t.invokingState],i=n.transitions[0];return p.create(o,i.followState.stateNumber)}function d(e,t,o,r){if(e===t)return e;if(e instanceof p&&t instanceof p)return c(e,t,o,r);if(o){if(e instanceof i)return e;if(t instanceof i)return t}return e instanceof p&&(e=new s([e.getParent()],[e.returnState])),t instanceof p&&(t=new s([t.getParent()],[t.returnState])),u(e,t,o,r)}function c(e,t,o,r){if(null!==r){var n=r.get(e,t);if(null!==n)return n;if(n=r.get(t,e),null!==n)return n}var a=l(e,t,o);if(null!==a)return null!==r&&r.set(e,t,a),a;if(e.returnState===t.returnState){var i=d(e.parentCtx,t.parentCtx,o,r);if(i===e.parentCtx)return e;if(i===t.parentCtx)return t;var c=p.create(i,e.returnState);return null!==r&&r.set(e,t,c),c}var u=null;if((e===t||null!==e.parentCtx&&e.parentCtx===t.parentCtx)&&(u=e.parentCtx),null!==u){var y=[e.returnState,t.returnState];e.returnState>t.returnState&&(y[0]=t.returnState,y[1]=e.returnState);var g=[u,u],T=new s(g,y);return null!==r&&r.set(e,t,T),T}var y=[e.returnState,t.returnState],g=[e.parentCtx,t.parentCtx];e.returnState>t.returnState&&(y[0]=t.returnState,y[1]=e.returnState,g=[t.parentCtx,e.parentCtx]);var x=new s(g,y);return null!==r&&r.set(e,t,x),x}function l(e,t,o){if(o){if(e===r.EMPTY)return r.EMPTY;if(t===r.EMPTY)return r.EMPTY}else{if(e===r.EMPTY&&t===r.EMPTY)return r.EMPTY;if(e===r.EMPTY){var n=[t.returnState,r.EMPTY_RETURN_STATE],p=[t.parentCtx,null];return new s(p,n)}if(t===r.EMPTY){var n=[e.returnState,r.EMPTY_RETURN_STATE],p=[e.parentCtx,null];return new s(p,n)}}return null}function u(e,t,o,n){if(null!==n){var a=n.get(e,t);if(null!==a)return a;if(a=n.get(t,e),null!==a)return a}for(var c=0,i=0,l=0,u=[],g=[];c<e.returnStates.length&&i<t.returnStates.length;){var T=e.parents[c],x=t.parents[i];if(e.returnStates[c]===t.returnStates[i]){var m=e.returnStates[c],_=m===r.EMPTY_RETURN_STATE&&null===T&&null===x;if(_||null!==T&&null!==x&&T===x)g[l]=T,u[l]=m;else{var S=d(T,x,o,n);g[l]=S,u[l]=m}c+=1,i+=1}else e.returnStates[c]<t.returnStates[i]?(g[l]=T,u[l]=e.returnStates[c],c+=1):(g[l]=x,u[l]=t.returnStates[i],i+=1);l+=1}if(c<e.returnStates.length)for(var f=c;f<e.returnStates.length;f++)g[l]=e.parents[f],u[l]=e.returnStates[f],l+=1;else for(var f=i;f<t.returnStates.length;f++)g[l]=t.parents[f],u[l]=t.returnStates[f],l+=1;if(l<g.length){if(1==l){var h=p.create(g[0],u[0]);return null!==n&&n.set(e,t,h),h}g=g.slice(0,l),u=u.slice(0,l)}var E=new s(g,u);return E===e?(null!==n&&n.set(e,t,e),e):E===t?(null!==n&&n.set(e,t,t),t):(y(g),null!==n&&n.set(e,t,E),E)}function y(e){for(var t={},o=0,r;o<e.length;o++)r=e[o],r in t||(t[r]=r);for(var n=0;n<e.length;n++)e[n]=t[e[n]]}function g(e,t,o){if(e.isEmpty())return e;var n=o[e]||null;if(null!==n)return n;if(n=t.get(e),null!==n)return o[e]=n,n;for(var a=!1,d=[],c=0,i;c<d.length;c++)if(i=g(e.getParent(c),t,o),a||i!==e.getParent(c)){if(!a){d=[];for(var l=0;l<e.length;l++)d[l]=e.getParent(l);a=!0}d[c]=i}if(!a)return t.add(e),o[e]=e,e;var u=null;return u=0===d.length?r.EMPTY:1===d.length?p.create(d[0],e.getReturnState(0)):new s(d,e.returnStates),t.add(u),o[u]=u,o[e]=u,u}var T=e("./RuleContext").RuleContext,x=e("./Utils").Hash;r.EMPTY=null,r.EMPTY_RETURN_STATE=2147483647,r.globalNodeCount=1,r.id=r.globalNodeCount,r.prototype.isEmpty=function(){return this===r.EMPTY},r.prototype.hasEmptyPath=function(){return this.getReturnState(this.length-1)===r.EMPTY_RETURN_STATE},r.prototype.hashCode=function(){return this.cachedHashCode},r.prototype.updateHashCode=function(e){e.update(this.cachedHashCode)},n.prototype.add=function(e){if(e===r.EMPTY)return r.EMPTY;var t=this.cache[e]||null;return null===t?(this.cache[e]=e,e):t},n.prototype.get=function(e){return this.cache[e]||null},Object.defineProperty(n.prototype,"length",{get:function(){return this.cache.length}}),p.prototype=Object.create(r.prototype),p.prototype.contructor=p,p.create=function(e,t){return t===r.EMPTY_RETURN_STATE&&null===e?r.EMPTY:new p(e,t)},Object.defineProperty(p.prototype,"length",{get:function(){return 1}}),p.prototype.getParent=function(){return this.parentCtx},p.prototype.getReturnState=function(){return this.returnState},p.prototype.equals=function(e){return!(this!==e)||!!(e instanceof p)&&this.hashCode()===e.hashCode()&&this.returnState===e.returnState&&(null==this.parentCtx?null==e.parentCtx:this.parentCtx.equals(e.parentCtx))},p.prototype.toString=function(){var e=null===this.parentCtx?"":this.parentCtx.toString();return 0===e.length?this.returnState===r.EMPTY_RETURN_STATE?"$":""+this.returnState:""+this.returnState+" "+e},i.prototype=Object.create(p.prototype),i.prototype.constructor=i,i.prototype.isEmpty=function(){return!0},i.prototype.getParent=function(){return null},i.prototype.getReturnState=function(){return this.returnState},i.prototype.equals=function(e){return this===e},i.prototype.toString=function(){return"$"},r.EMPTY=new i,s.prototype=Object.create(r.prototype),s.prototype.constructor=s,s.prototype.isEmpty=function(){return this.returnStates[0]===r.EMPTY_RETURN_STATE},Object.defineProperty(s.prototype,"length",{get:function(){return this.returnStates.length}}),s.prototype.getParent=function(e){return this.parents[e]},s.prototype.getReturnState=function(e){return this.returnStates[e]},s.prototype.equals=function(e){return!(this!==e)||!!(e instanceof s)&&this.hashCode()===e.hashCode()&&this.returnStates===e.returnStates&&this.parents===e.parents},s.prototype.toString=function(){if(this.isEmpty())return"[]";for(var e="[",t=0;t<this.returnStates.length;t++){if(0<t&&(e+=", "),this.returnStates[t]===r.EMPTY_RETURN_STATE){e+="$";continue}e+=this.returnStates[t],null===this.parents[t]?e+="null":e=e+" "+this.parents[t]}return e+"]"},o.merge=d,o.PredictionContext=r,o.PredictionContextCache=n,o.SingletonPredictionContext=p,o.predictionContextFromRuleContext=a,o.getCachedPredictionContext=g},{"./RuleContext":21,"./Utils":23}],20:[function(e,t,o){function r(){return this._listeners=[p.INSTANCE],this._interp=null,this._stateNumber=-1,this}var n=e("./Token").Token,p=e("./error/ErrorListener").ConsoleErrorListener,a=e("./error/ErrorListener").ProxyErrorListener;r.tokenTypeMapCache={},r.ruleIndexMapCache={},r.prototype.checkVersion=function(e){var t="4.7.1";t!==e&&console.log("ANTLR runtime and generated code versions disagree: "+t+"!="+e)},r.prototype.addErrorListener=function(e){this._listeners.push(e)},r.prototype.removeErrorListeners=function(){this._listeners=[]},r.prototype.getTokenTypeMap=function(){var e=this.getTokenNames();if(null===e)throw"The current recognizer does not provide a list of token names.";var t=this.tokenTypeMapCache[e];return void 0===t&&(t=e.reduce(function(e,t,o){e[t]=o}),t.EOF=n.EOF,this.tokenTypeMapCache[e]=t),t},r.prototype.getRuleIndexMap=function(){var e=this.ruleNames;if(null===e)throw"The current recognizer does not provide a list of rule names.";var t=this.ruleIndexMapCache[e];return void 0===t&&(t=e.reduce(function(e,t,o){e[t]=o}),this.ruleIndexMapCache[e]=t),t},r.prototype.getTokenType=function(e){var t=this.getTokenTypeMap()[e];return void 0===t?n.INVALID_TYPE:t},r.prototype.getErrorHeader=function(t){var e=t.getOffendingToken().line,o=t.getOffendingToken().column;return"line "+e+":"+o},r.prototype.getTokenErrorDisplay=function(e){if(null===e)return"<no token>";var t=e.text;return null===t&&(e.type===n.EOF?t="<EOF>":t="<"+e.type+">"),t=t.replace("\n","\\n").replace("\r","\\r").replace("\t","\\t"),"'"+t+"'"},r.prototype.getErrorListenerDispatch=function(){return new a(this._listeners)},r.prototype.sempred=function(){return!0},r.prototype.precpred=function(){return!0},Object.defineProperty(r.prototype,"state",{get:function(){return this._stateNumber},set:function(e){this._stateNumber=e}}),o.Recognizer=r},{"./Token":22,"./error/ErrorListener":45}],21:[function(e,t,o){function r(e,t){return n.call(this),this.parentCtx=e||null,this.invokingState=t||-1,this}var n=e("./tree/Tree").RuleNode,p=e("./tree/Tree").INVALID_INTERVAL,a=e("./atn/ATN").INVALID_ALT_NUMBER;r.prototype=Object.create(n.prototype),r.prototype.constructor=r,r.prototype.depth=function(){for(var e=0,t=this;null!==t;)t=t.parentCtx,e+=1;return e},r.prototype.isEmpty=function(){return-1===this.invokingState},r.prototype.getSourceInterval=function(){return p},r.prototype.getRuleContext=function(){return this},r.prototype.getPayload=function(){return this},r.prototype.getText=function(){return 0===this.getChildCount()?"":this.children.map(function(e){return e.getText()}).join("")},r.prototype.getAltNumber=function(){return a},r.prototype.setAltNumber=function(){},r.prototype.getChild=function(){return null},r.prototype.getChildCount=function(){return 0},r.prototype.accept=function(e){return e.visitChildren(this)},o.RuleContext=r;var i=e("./tree/Trees").Trees;r.prototype.toStringTree=function(e,t){return i.toStringTree(this,e,t)},r.prototype.toString=function(e,t){e=e||null,t=t||null;for(var o=this,r="[";null!==o&&o!==t;){if(null===e)o.isEmpty()||(r+=o.invokingState);else{var n=o.ruleIndex,p=0<=n&&n<e.length?e[n]:""+n;r+=p}null===o.parentCtx||null===e&&o.parentCtx.isEmpty()||(r+=" "),o=o.parentCtx}return r+="]",r}},{"./atn/ATN":24,"./tree/Tree":52,"./tree/Trees":53}],22:[function(e,t,o){function r(){return this.source=null,this.type=null,this.channel=null,this.start=null,this.stop=null,this.tokenIndex=null,this.line=null,this.column=null,this._text=null,this}function n(e,t,o,p,a){return r.call(this),this.source=void 0===e?n.EMPTY_SOURCE:e,this.type=void 0===t?null:t,this.channel=void 0===o?r.DEFAULT_CHANNEL:o,this.start=void 0===p?-1:p,this.stop=void 0===a?-1:a,this.tokenIndex=-1,null===this.source[0]?this.column=-1:(this.line=e[0].line,this.column=e[0].column),this}r.INVALID_TYPE=0,r.EPSILON=-2,r.MIN_USER_TOKEN_TYPE=1,r.EOF=-1,r.DEFAULT_CHANNEL=0,r.HIDDEN_CHANNEL=1,Object.defineProperty(r.prototype,"text",{get:function(){return this._text},set:function(e){this._text=e}}),r.prototype.getTokenSource=function(){return this.source[0]},r.prototype.getInputStream=function(){return this.source[1]},n.prototype=Object.create(r.prototype),n.prototype.constructor=n,n.EMPTY_SOURCE=[null,null],n.prototype.clone=function(){var e=new n(this.source,this.type,this.channel,this.start,this.stop);return e.tokenIndex=this.tokenIndex,e.line=this.line,e.column=this.column,e.text=this.text,e},Object.defineProperty(n.prototype,"text",{get:function(){if(null!==this._text)return this._text;var e=this.getInputStream();if(null===e)return null;var t=e.size;return this.start<t&&this.stop<t?e.getText(this.start,this.stop):"<EOF>"},set:function(e){this._text=e}}),n.prototype.toString=function(){var e=this.text;return e=null===e?"<no text>":e.replace(/\n/g,"\\n").replace(/\r/g,"\\r").replace(/\t/g,"\\t"),"[@"+this.tokenIndex+","+this.start+":"+this.stop+"='"+e+"',<"+this.type+">"+(0<this.channel?",channel="+this.channel:"")+","+this.line+":"+this.column+"]"},o.Token=r,o.CommonToken=n},{}],23:[function(e,t,o){function r(e){return"["+e.join(", ")+"]"}function n(e,t){return e.equals(t)}function p(e){return e.hashCode()}function a(e,t){return this.data={},this.hashFunction=e||p,this.equalsFunction=t||n,this}function i(){return this.data=[],this}function s(e,t){return this.data={},this.hashFunction=e||p,this.equalsFunction=t||n,this}function d(){return this.data={},this}function c(){return this}function l(){return this.count=0,this.hash=0,this}var u=String.prototype;u.seed=u.seed||Math.round(4294967296*Math.random()),u.hashCode=function(){var e=this.toString(),t,o,r,n,p,a,s,d;for(t=3&e.length,o=e.length-t,r=u.seed,p=3432918353,a=461845907,d=0;d<o;)s=255&e.charCodeAt(d)|(255&e.charCodeAt(++d))<<8|(255&e.charCodeAt(++d))<<16|(255&e.charCodeAt(++d))<<24,++d,s=4294967295&(65535&s)*p+((65535&(s>>>16)*p)<<16),s=s<<15|s>>>17,s=4294967295&(65535&s)*a+((65535&(s>>>16)*a)<<16),r^=s,r=r<<13|r>>>19,n=4294967295&5*(65535&r)+((65535&5*(r>>>16))<<16),r=(65535&n)+27492+((65535&(n>>>16)+58964)<<16);switch(s=0,t){case 3:s^=(255&e.charCodeAt(d+2))<<16;case 2:s^=(255&e.charCodeAt(d+1))<<8;case 1:s^=255&e.charCodeAt(d),s=4294967295&(65535&s)*p+((65535&(s>>>16)*p)<<16),s=s<<15|s>>>17,s=4294967295&(65535&s)*a+((65535&(s>>>16)*a)<<16),r^=s;}return r^=e.length,r^=r>>>16,r=4294967295&2246822507*(65535&r)+((65535&2246822507*(r>>>16))<<16),r^=r>>>13,r=4294967295&3266489909*(65535&r)+((65535&3266489909*(r>>>16))<<16),r^=r>>>16,r>>>0},Object.defineProperty(a.prototype,"length",{get:function(){var e=0;for(var t in this.data)0===t.indexOf("hash_")&&(e+=this.data[t].length);return e}}),a.prototype.add=function(e){var t=this.hashFunction(e),o="hash_"+t;if(o in this.data){for(var r=this.data[o],n=0;n<r.length;n++)if(this.equalsFunction(e,r[n]))return r[n];return r.push(e),e}return this.data[o]=[e],e},a.prototype.contains=function(e){return null!=this.get(e)},a.prototype.get=function(e){var t=this.hashFunction(e),o="hash_"+t;if(o in this.data)for(var r=this.data[o],n=0;n<r.length;n++)if(this.equalsFunction(e,r[n]))return r[n];return null},a.prototype.values=function(){var e=[];for(var t in this.data)0===t.indexOf("hash_")&&(e=e.concat(this.data[t]));return e},a.prototype.toString=function(){return r(this.values())},i.prototype.add=function(e){this.data[e]=!0},i.prototype.or=function(e){var t=this;Object.keys(e.data).map(function(e){t.add(e)})},i.prototype.remove=function(e){delete this.data[e]},i.prototype.contains=function(e){return!0===this.data[e]},i.prototype.values=function(){return Object.keys(this.data)},i.prototype.minValue=function(){return Math.min.apply(null,this.values())},i.prototype.hashCode=function(){var e=new l;return e.update(this.values()),e.finish()},i.prototype.equals=function(e){return!!(e instanceof i)&&this.hashCode()===e.hashCode()},Object.defineProperty(i.prototype,"length",{get:function(){return this.values().length}}),i.prototype.toString=function(){return"{"+this.values().join(", ")+"}"},Object.defineProperty(s.prototype,"length",{get:function(){var e=0;for(var t in this.data)0===t.indexOf("hash_")&&(e+=this.data[t].length);return e}}),s.prototype.put=function(e,t){var o="hash_"+this.hashFunction(e);if(o in this.data){for(var r=this.data[o],n=0,p;n<r.length;n++)if(p=r[n],this.equalsFunction(e,p.key)){var a=p.value;return p.value=t,a}return r.push({key:e,value:t}),t}return this.data[o]=[{key:e,value:t}],t},s.prototype.containsKey=function(e){var t="hash_"+this.hashFunction(e);if(t in this.data)for(var o=this.data[t],r=0,n;r<o.length;r++)if(n=o[r],this.equalsFunction(e,n.key))return!0;return!1},s.prototype.get=function(e){var t="hash_"+this.hashFunction(e);if(t in this.data)for(var o=this.data[t],r=0,n;r<o.length;r++)if(n=o[r],this.equalsFunction(e,n.key))return n.value;return null},s.prototype.entries=function(){var e=[];for(var t in this.data)0===t.indexOf("hash_")&&(e=e.concat(this.data[t]));return e},s.prototype.getKeys=function(){return this.entries().map(function(t){return t.key})},s.prototype.getValues=function(){return this.entries().map(function(t){return t.value})},s.prototype.toString=function(){var e=this.entries().map(function(e){return"{"+e.key+":"+e.value+"}"});return"["+e.join(", ")+"]"},d.prototype.get=function(e){return e="k-"+e,e in this.data?this.data[e]:null},d.prototype.put=function(e,t){e="k-"+e,this.data[e]=t},d.prototype.values=function(){var e=this.data,t=Object.keys(this.data);return t.map(function(t){return e[t]})},l.prototype.update=function(){for(var e=0,t;e<arguments.length;e++)if(t=arguments[e],null!=t)if(Array.isArray(t))this.update.apply(t);else{var o=0;switch(typeof t){case"undefined":case"function":continue;case"number":case"boolean":o=t;break;case"string":o=t.hashCode();break;default:t.updateHashCode(this);continue;}o*=3432918353,o=o<<15|o>>>17,o*=461845907,++this.count;var r=this.hash^o;r=r<<13|r>>>19,r=5*r+3864292196,this.hash=r}},l.prototype.finish=function(){var e=this.hash^4*this.count;return e^=e>>>16,e*=2246822507,e^=e>>>13,e*=3266489909,e^=e>>>16,e},c.prototype.get=function(e,t){var o=this[e]||null;return null===o?null:o[t]||null},c.prototype.set=function(e,t,r){var o=this[e]||null;null===o&&(o={},this[e]=o),o[t]=r};o.Hash=l,o.Set=a,o.Map=s,o.BitSet=i,o.AltDict=d,o.DoubleDict=c,o.hashStuff=function(){var e=new l;return e.update.apply(arguments),e.finish()},o.escapeWhitespace=function(e,t){return e=e.replace(/\t/g,"\\t").replace(/\n/g,"\\n").replace(/\r/g,"\\r"),t&&(e=e.replace(/ /g,"\xB7")),e},o.arrayToString=r,o.titleCase=function(e){return e.replace(/\w\S*/g,function(e){return e.charAt(0).toUpperCase()+e.substr(1)})},o.equalArrays=function(e,t){if(!Array.isArray(e)||!Array.isArray(t))return!1;if(e==t)return!0;if(e.length!=t.length)return!1;for(var o=0;o<e.length;o++)if(e[o]!=t[o]&&!e[o].equals(t[o]))return!1;return!0}},{}],24:[function(e,t,o){function r(e,t){return this.grammarType=e,this.maxTokenType=t,this.states=[],this.decisionToState=[],this.ruleToStartState=[],this.ruleToStopState=null,this.modeNameToStartState={},this.ruleToTokenType=null,this.lexerActions=null,this.modeToStartState=[],this}var n=e("./../LL1Analyzer").LL1Analyzer,p=e("./../IntervalSet").IntervalSet;r.prototype.nextTokensInContext=function(e,t){var o=new n(this);return o.LOOK(e,null,t)},r.prototype.nextTokensNoContext=function(e){return null===e.nextTokenWithinRule?(e.nextTokenWithinRule=this.nextTokensInContext(e,null),e.nextTokenWithinRule.readOnly=!0,e.nextTokenWithinRule):e.nextTokenWithinRule},r.prototype.nextTokens=function(e,t){return void 0===t?this.nextTokensNoContext(e):this.nextTokensInContext(e,t)},r.prototype.addState=function(e){null!==e&&(e.atn=this,e.stateNumber=this.states.length),this.states.push(e)},r.prototype.removeState=function(e){this.states[e.stateNumber]=null},r.prototype.defineDecisionState=function(e){return this.decisionToState.push(e),e.decision=this.decisionToState.length-1,e.decision},r.prototype.getDecisionState=function(e){return 0===this.decisionToState.length?null:this.decisionToState[e]};var a=e("./../Token").Token;r.prototype.getExpectedTokens=function(e,t){if(0>e||e>=this.states.length)throw"Invalid state number.";var o=this.states[e],r=this.nextTokens(o);if(!r.contains(a.EPSILON))return r;var n=new p;for(n.addSet(r),n.removeOne(a.EPSILON);null!==t&&0<=t.invokingState&&r.contains(a.EPSILON);){var i=this.states[t.invokingState],s=i.transitions[0];r=this.nextTokens(s.followState),n.addSet(r),n.removeOne(a.EPSILON),t=t.parentCtx}return r.contains(a.EPSILON)&&n.addOne(a.EOF),n},r.INVALID_ALT_NUMBER=0,o.ATN=r},{"./../IntervalSet":14,"./../LL1Analyzer":15,"./../Token":22}],25:[function(e,t,o){function r(e,t){if(null===e){var o={state:null,alt:null,context:null,semanticContext:null};return t&&(o.reachesIntoOuterContext=0),o}var r={};return r.state=e.state||null,r.alt=void 0===e.alt?null:e.alt,r.context=e.context||null,r.semanticContext=e.semanticContext||null,t&&(r.reachesIntoOuterContext=e.reachesIntoOuterContext||0,r.precedenceFilterSuppressed=e.precedenceFilterSuppressed||!1),r}function n(e,t){return this.checkContext(e,t),e=r(e),t=r(t,!0),this.state=null===e.state?t.state:e.state,this.alt=null===e.alt?t.alt:e.alt,this.context=null===e.context?t.context:e.context,this.semanticContext=null===e.semanticContext?null===t.semanticContext?i.NONE:t.semanticContext:e.semanticContext,this.reachesIntoOuterContext=t.reachesIntoOuterContext,this.precedenceFilterSuppressed=t.precedenceFilterSuppressed,this}function p(e,t){n.call(this,e,t);var o=e.lexerActionExecutor||null;return this.lexerActionExecutor=o||(null===t?null:t.lexerActionExecutor),this.passedThroughNonGreedyDecision=null!==t&&this.checkNonGreedyDecision(t,this.state),this}var a=e("./ATNState").DecisionState,i=e("./SemanticContext").SemanticContext,s=e("../Utils").Hash;n.prototype.checkContext=function(e,t){(null===e.context||e.context===void 0)&&(null===t||null===t.context||t.context===void 0)&&(this.context=null)},n.prototype.hashCode=function(){var e=new s;return this.updateHashCode(e),e.finish()},n.prototype.updateHashCode=function(e){e.update(this.state.stateNumber,this.alt,this.context,this.semanticContext)},n.prototype.equals=function(e){return!(this!==e)||!!(e instanceof n)&&this.state.stateNumber===e.state.stateNumber&&this.alt===e.alt&&(null===this.context?null===e.context:this.context.equals(e.context))&&this.semanticContext.equals(e.semanticContext)&&this.precedenceFilterSuppressed===e.precedenceFilterSuppressed},n.prototype.hashCodeForConfigSet=function(){var e=new s;return e.update(this.state.stateNumber,this.alt,this.semanticContext),e.finish()},n.prototype.equalsForConfigSet=function(e){return!(this!==e)||!!(e instanceof n)&&this.state.stateNumber===e.state.stateNumber&&this.alt===e.alt&&this.semanticContext.equals(e.semanticContext)},n.prototype.toString=function(){return"("+this.state+","+this.alt+(null===this.context?"":",["+this.context.toString()+"]")+(this.semanticContext===i.NONE?"":","+this.semanticContext.toString())+(0<this.reachesIntoOuterContext?",up="+this.reachesIntoOuterContext:"")+")"},p.prototype=Object.create(n.prototype),p.prototype.constructor=p,p.prototype.updateHashCode=function(e){e.update(this.state.stateNumber,this.alt,this.context,this.semanticContext,this.passedThroughNonGreedyDecision,this.lexerActionExecutor)},p.prototype.equals=function(e){return this===e||e instanceof p&&this.passedThroughNonGreedyDecision==e.passedThroughNonGreedyDecision&&(this.lexerActionExecutor?this.lexerActionExecutor.equals(e.lexerActionExecutor):!e.lexerActionExecutor)&&n.prototype.equals.call(this,e)},p.prototype.hashCodeForConfigSet=p.prototype.hashCode,p.prototype.equalsForConfigSet=p.prototype.equals,p.prototype.checkNonGreedyDecision=function(e,t){return e.passedThroughNonGreedyDecision||t instanceof a&&t.nonGreedy},o.ATNConfig=n,o.LexerATNConfig=p},{"../Utils":23,"./ATNState":30,"./SemanticContext":37}],26:[function(e,t,o){function r(e){return e.hashCodeForConfigSet()}function n(e,t){return!(e!==t)||null!==e&&null!==t&&e.equalsForConfigSet(t)}function p(e){return this.configLookup=new c(r,n),this.fullCtx=void 0===e||e,this.readOnly=!1,this.configs=[],this.uniqueAlt=0,this.conflictingAlts=null,this.hasSemanticContext=!1,this.dipsIntoOuterContext=!1,this.cachedHashCode=-1,this}function a(){return p.call(this),this.configLookup=new c,this}var i=e("./ATN").ATN,s=e("./../Utils"),d=s.Hash,c=s.Set,l=e("./SemanticContext").SemanticContext,u=e("./../PredictionContext").merge;p.prototype.add=function(e,t){if(void 0===t&&(t=null),this.readOnly)throw"This set is readonly";e.semanticContext!==l.NONE&&(this.hasSemanticContext=!0),0<e.reachesIntoOuterContext&&(this.dipsIntoOuterContext=!0);var o=this.configLookup.add(e);if(o===e)return this.cachedHashCode=-1,this.configs.push(e),!0;var r=!this.fullCtx,n=u(o.context,e.context,r,t);return o.reachesIntoOuterContext=Math.max(o.reachesIntoOuterContext,e.reachesIntoOuterContext),e.precedenceFilterSuppressed&&(o.precedenceFilterSuppressed=!0),o.context=n,!0},p.prototype.getStates=function(){for(var e=new c,t=0;t<this.configs.length;t++)e.add(this.configs[t].state);return e},p.prototype.getPredicates=function(){for(var e=[],t=0,o;t<this.configs.length;t++)o=this.configs[t].semanticContext,o!==l.NONE&&e.push(o.semanticContext);return e},Object.defineProperty(p.prototype,"items",{get:function(){return this.configs}}),p.prototype.optimizeConfigs=function(e){if(this.readOnly)throw"This set is readonly";if(0!==this.configLookup.length)for(var t=0,o;t<this.configs.length;t++)o=this.configs[t],o.context=e.getCachedContext(o.context)},p.prototype.addAll=function(e){for(var t=0;t<e.length;t++)this.add(e[t]);return!1},p.prototype.equals=function(e){return this===e||e instanceof p&&s.equalArrays(this.configs,e.configs)&&this.fullCtx===e.fullCtx&&this.uniqueAlt===e.uniqueAlt&&this.conflictingAlts===e.conflictingAlts&&this.hasSemanticContext===e.hasSemanticContext&&this.dipsIntoOuterContext===e.dipsIntoOuterContext},p.prototype.hashCode=function(){var e=new d;return this.updateHashCode(e),e.finish()},p.prototype.updateHashCode=function(e){if(this.readOnly){if(-1===this.cachedHashCode){var e=new d;e.update(this.configs),this.cachedHashCode=e.finish()}e.update(this.cachedHashCode)}else e.update(this.configs)},Object.defineProperty(p.prototype,"length",{get:function(){return this.configs.length}}),p.prototype.isEmpty=function(){return 0===this.configs.length},p.prototype.contains=function(e){if(null===this.configLookup)throw"This method is not implemented for readonly sets.";return this.configLookup.contains(e)},p.prototype.containsFast=function(e){if(null===this.configLookup)throw"This method is not implemented for readonly sets.";return this.configLookup.containsFast(e)},p.prototype.clear=function(){if(this.readOnly)throw"This set is readonly";this.configs=[],this.cachedHashCode=-1,this.configLookup=new c},p.prototype.setReadonly=function(e){this.readOnly=e,e&&(this.configLookup=null)},p.prototype.toString=function(){return s.arrayToString(this.configs)+(this.hasSemanticContext?",hasSemanticContext="+this.hasSemanticContext:"")+(this.uniqueAlt===i.INVALID_ALT_NUMBER?"":",uniqueAlt="+this.uniqueAlt)+(null===this.conflictingAlts?"":",conflictingAlts="+this.conflictingAlts)+(this.dipsIntoOuterContext?",dipsIntoOuterContext":"")},a.prototype=Object.create(p.prototype),a.prototype.constructor=a,o.ATNConfigSet=p,o.OrderedATNConfigSet=a},{"./../PredictionContext":19,"./../Utils":23,"./ATN":24,"./SemanticContext":37}],27:[function(e,t,o){function r(e){return void 0===e&&(e=null),this.readOnly=!1,this.verifyATN=null===e||e.verifyATN,this.generateRuleBypassTransitions=null!==e&&e.generateRuleBypassTransitions,this}r.defaultOptions=new r,r.defaultOptions.readOnly=!0,o.ATNDeserializationOptions=r},{}],28:[function(e,t,o){function r(e,t){var o=[];return o[e-1]=t,o.map(function(){return t})}function n(e){return(void 0===e||null===e)&&(e=B.defaultOptions),this.deserializationOptions=e,this.stateFactories=null,this.actionFactories=null,this}var p=e("./../Token").Token,a=e("./ATN").ATN,d=e("./ATNType").ATNType,i=e("./ATNState"),c=i.ATNState,s=i.BasicState,l=i.DecisionState,u=i.BlockStartState,y=i.BlockEndState,g=i.LoopEndState,T=i.RuleStartState,x=i.RuleStopState,m=i.TokensStartState,_=i.PlusLoopbackState,S=i.StarLoopbackState,f=i.StarLoopEntryState,h=i.PlusBlockStartState,E=i.StarBlockStartState,A=i.BasicBlockStartState,C=e("./Transition"),N=C.Transition,R=C.AtomTransition,L=C.SetTransition,I=C.NotSetTransition,k=C.RuleTransition,P=C.RangeTransition,D=C.ActionTransition,O=C.EpsilonTransition,F=C.WildcardTransition,b=C.PredicateTransition,v=C.PrecedencePredicateTransition,M=e("./../IntervalSet").IntervalSet,U=e("./../IntervalSet").Interval,B=e("./ATNDeserializationOptions").ATNDeserializationOptions,H=e("./LexerAction"),V=H.LexerActionType,z=H.LexerSkipAction,G=H.LexerChannelAction,K=H.LexerCustomAction,q=H.LexerMoreAction,W=H.LexerTypeAction,Y=H.LexerPushModeAction,w=H.LexerPopModeAction,j=H.LexerModeAction,$="59627784-3BE5-417A-B9EB-8131A7286089",X=["AADB8D7E-AEEF-4415-AD2B-8204D6CF042E",$],Q=3,J=$;n.prototype.isFeatureSupported=function(e,t){var o=X.indexOf(e);if(0>o)return!1;var r=X.indexOf(t);return r>=o},n.prototype.deserialize=function(e){this.reset(e),this.checkVersion(),this.checkUUID();var t=this.readATN();this.readStates(t),this.readRules(t),this.readModes(t);var o=[];return this.readSets(t,o,this.readInt.bind(this)),this.isFeatureSupported($,this.uuid)&&this.readSets(t,o,this.readInt32.bind(this)),this.readEdges(t,o),this.readDecisions(t),this.readLexerActions(t),this.markPrecedenceDecisions(t),this.verifyATN(t),this.deserializationOptions.generateRuleBypassTransitions&&t.grammarType===d.PARSER&&(this.generateRuleBypassTransitions(t),this.verifyATN(t)),t},n.prototype.reset=function(e){var t=e.split("").map(function(e){var t=e.charCodeAt(0);return 1<t?t-2:t+65533});t[0]=e.charCodeAt(0),this.data=t,this.pos=0},n.prototype.checkVersion=function(){var e=this.readInt();if(e!==Q)throw"Could not deserialize ATN with version "+e+" (expected "+Q+")."},n.prototype.checkUUID=function(){var e=this.readUUID();if(0>X.indexOf(e))throw"Could not deserialize ATN with UUID: "+e+" (expected "+J+" or a legacy UUID).",e,J;this.uuid=e},n.prototype.readATN=function(){var e=this.readInt(),t=this.readInt();return new a(e,t)},n.prototype.readStates=function(e){for(var t=[],o=[],r=this.readInt(),n=0,p,a,i,d;n<r;n++){if(d=this.readInt(),d===c.INVALID_TYPE){e.addState(null);continue}var l=this.readInt();65535===l&&(l=-1);var y=this.stateFactory(d,l);if(d===c.LOOP_END){var s=this.readInt();t.push([y,s])}else if(y instanceof u){var g=this.readInt();o.push([y,g])}e.addState(y)}for(p=0;p<t.length;p++)a=t[p],a[0].loopBackState=e.states[a[1]];for(p=0;p<o.length;p++)a=o[p],a[0].endState=e.states[a[1]];var T=this.readInt();for(p=0;p<T;p++)i=this.readInt(),e.states[i].nonGreedy=!0;var x=this.readInt();for(p=0;p<x;p++)i=this.readInt(),e.states[i].isPrecedenceRule=!0},n.prototype.readRules=function(e){var t=this.readInt(),o;for(e.grammarType===d.LEXER&&(e.ruleToTokenType=r(t,0)),e.ruleToStartState=r(t,0),o=0;o<t;o++){var n=this.readInt(),a=e.states[n];if(e.ruleToStartState[o]=a,e.grammarType===d.LEXER){var i=this.readInt();65535===i&&(i=p.EOF),e.ruleToTokenType[o]=i}}for(e.ruleToStopState=r(t,0),o=0;o<e.states.length;o++){var s=e.states[o];s instanceof x&&(e.ruleToStopState[s.ruleIndex]=s,e.ruleToStartState[s.ruleIndex].stopState=s)}},n.prototype.readModes=function(e){for(var t=this.readInt(),o=0,r;o<t;o++)r=this.readInt(),e.modeToStartState.push(e.states[r])},n.prototype.readSets=function(e,t,o){for(var r=this.readInt(),p=0,a;p<r;p++){a=new M,t.push(a);var i=this.readInt(),n=this.readInt();0!==n&&a.addOne(-1);for(var s=0;s<i;s++){var d=o(),c=o();a.addRange(d,c)}}},n.prototype.readEdges=function(e,o){var r=this.readInt(),n,p,a,i,s;for(n=0;n<r;n++){var d=this.readInt(),c=this.readInt(),l=this.readInt(),y=this.readInt(),g=this.readInt(),T=this.readInt();i=this.edgeFactory(e,l,d,c,y,g,T,o);var x=e.states[d];x.addTransition(i)}for(n=0;n<e.states.length;n++)for(a=e.states[n],p=0;p<a.transitions.length;p++){var m=a.transitions[p];if(m instanceof k){var t=-1;e.ruleToStartState[m.target.ruleIndex].isPrecedenceRule&&0===m.precedence&&(t=m.target.ruleIndex),i=new O(m.followState,t),e.ruleToStopState[m.target.ruleIndex].addTransition(i)}}for(n=0;n<e.states.length;n++){if(a=e.states[n],a instanceof u){if(null===a.endState)throw"IllegalState";if(null!==a.endState.startState)throw"IllegalState";a.endState.startState=a}if(a instanceof _)for(p=0;p<a.transitions.length;p++)s=a.transitions[p].target,s instanceof h&&(s.loopBackState=a);else if(a instanceof S)for(p=0;p<a.transitions.length;p++)s=a.transitions[p].target,s instanceof f&&(s.loopBackState=a)}},n.prototype.readDecisions=function(e){for(var t=this.readInt(),o=0;o<t;o++){var r=this.readInt(),n=e.states[r];e.decisionToState.push(n),n.decision=o}},n.prototype.readLexerActions=function(e){if(e.grammarType===d.LEXER){var t=this.readInt();e.lexerActions=r(t,null);for(var o=0;o<t;o++){var n=this.readInt(),p=this.readInt();65535===p&&(p=-1);var a=this.readInt();65535===a&&(a=-1);var i=this.lexerActionFactory(n,p,a);e.lexerActions[o]=i}}},n.prototype.generateRuleBypassTransitions=function(e){var t=e.ruleToStartState.length,o;for(o=0;o<t;o++)e.ruleToTokenType[o]=e.maxTokenType+o+1;for(o=0;o<t;o++)this.generateRuleBypassTransition(e,o)},n.prototype.generateRuleBypassTransition=function(e,t){var o=new A,r,n;o.ruleIndex=t,e.addState(o);var p=new y;p.ruleIndex=t,e.addState(p),o.endState=p,e.defineDecisionState(o),p.startState=o;var a=null,i=null;if(e.ruleToStartState[t].isPrecedenceRule){for(i=null,r=0;r<e.states.length;r++)if(n=e.states[r],this.stateIsEndStateFor(n,t)){i=n,a=n.loopBackState.transitions[0];break}if(null===a)throw"Couldn't identify final state of the precedence rule prefix section."}else i=e.ruleToStopState[t];for(r=0;r<e.states.length;r++){n=e.states[r];for(var d=0,c;d<n.transitions.length;d++)(c=n.transitions[d],c!==a)&&c.target===i&&(c.target=p)}for(var l=e.ruleToStartState[t],u=l.transitions.length;0<u;)o.addTransition(l.transitions[u-1]),l.transitions=l.transitions.slice(-1);e.ruleToStartState[t].addTransition(new O(o)),p.addTransition(new O(i));var g=new s;e.addState(g),g.addTransition(new R(p,e.ruleToTokenType[t])),o.addTransition(new O(g))},n.prototype.stateIsEndStateFor=function(e,t){if(e.ruleIndex!==t)return null;if(!(e instanceof f))return null;var o=e.transitions[e.transitions.length-1].target;return o instanceof g?o.epsilonOnlyTransitions&&o.transitions[0].target instanceof x?e:null:null},n.prototype.markPrecedenceDecisions=function(e){for(var t=0,o;t<e.states.length;t++)if((o=e.states[t],!!(o instanceof f))&&e.ruleToStartState[o.ruleIndex].isPrecedenceRule){var r=o.transitions[o.transitions.length-1].target;r instanceof g&&r.epsilonOnlyTransitions&&r.transitions[0].target instanceof x&&(o.isPrecedenceDecision=!0)}},n.prototype.verifyATN=function(e){if(this.deserializationOptions.verifyATN)for(var t=0,o;t<e.states.length;t++)if(o=e.states[t],null!==o)if(this.checkCondition(o.epsilonOnlyTransitions||1>=o.transitions.length),o instanceof h)this.checkCondition(null!==o.loopBackState);else if(!(o instanceof f))o instanceof S?(this.checkCondition(1===o.transitions.length),this.checkCondition(o.transitions[0].target instanceof f)):o instanceof g?this.checkCondition(null!==o.loopBackState):o instanceof T?this.checkCondition(null!==o.stopState):o instanceof u?this.checkCondition(null!==o.endState):o instanceof y?this.checkCondition(null!==o.startState):o instanceof l?this.checkCondition(1>=o.transitions.length||0<=o.decision):this.checkCondition(1>=o.transitions.length||o instanceof x);else if(this.checkCondition(null!==o.loopBackState),this.checkCondition(2===o.transitions.length),o.transitions[0].target instanceof E)this.checkCondition(o.transitions[1].target instanceof g),this.checkCondition(!o.nonGreedy);else if(o.transitions[0].target instanceof g)this.checkCondition(o.transitions[1].target instanceof E),this.checkCondition(o.nonGreedy);else throw"IllegalState"},n.prototype.checkCondition=function(e,t){if(!e)throw(void 0===t||null===t)&&(t="IllegalState"),t},n.prototype.readInt=function(){return this.data[this.pos++]},n.prototype.readInt32=function(){var e=this.readInt(),t=this.readInt();return e|t<<16},n.prototype.readLong=function(){var e=this.readInt32(),t=this.readInt32();return 4294967295&e|t<<32};var Z=function(){for(var e=[],t=0;256>t;t++)e[t]=(t+256).toString(16).substr(1).toUpperCase();return e}();n.prototype.readUUID=function(){for(var e=[],t=7,o;0<=t;t--)o=this.readInt(),e[2*t+1]=255&o,e[2*t]=255&o>>8;return Z[e[0]]+Z[e[1]]+Z[e[2]]+Z[e[3]]+"-"+Z[e[4]]+Z[e[5]]+"-"+Z[e[6]]+Z[e[7]]+"-"+Z[e[8]]+Z[e[9]]+"-"+Z[e[10]]+Z[e[11]]+Z[e[12]]+Z[e[13]]+Z[e[14]]+Z[e[15]]},n.prototype.edgeFactory=function(e,t,o,r,n,a,i,s){var d=e.states[r];switch(t){case N.EPSILON:return new O(d);case N.RANGE:return 0===i?new P(d,n,a):new P(d,p.EOF,a);case N.RULE:return new k(e.states[n],a,i,d);case N.PREDICATE:return new b(d,n,a,0!==i);case N.PRECEDENCE:return new v(d,n);case N.ATOM:return 0===i?new R(d,n):new R(d,p.EOF);case N.ACTION:return new D(d,n,a,0!==i);case N.SET:return new L(d,s[n]);case N.NOT_SET:return new I(d,s[n]);case N.WILDCARD:return new F(d);default:throw"The specified transition type: "+t+" is not valid.";}},n.prototype.stateFactory=function(e,t){if(null===this.stateFactories){var o=[];o[c.INVALID_TYPE]=null,o[c.BASIC]=function(){return new s},o[c.RULE_START]=function(){return new T},o[c.BLOCK_START]=function(){return new A},o[c.PLUS_BLOCK_START]=function(){return new h},o[c.STAR_BLOCK_START]=function(){return new E},o[c.TOKEN_START]=function(){return new m},o[c.RULE_STOP]=function(){return new x},o[c.BLOCK_END]=function(){return new y},o[c.STAR_LOOP_BACK]=function(){return new S},o[c.STAR_LOOP_ENTRY]=function(){return new f},o[c.PLUS_LOOP_BACK]=function(){return new _},o[c.LOOP_END]=function(){return new g},this.stateFactories=o}if(e>this.stateFactories.length||null===this.stateFactories[e])throw"The specified state type "+e+" is not valid.";else{var r=this.stateFactories[e]();if(null!==r)return r.ruleIndex=t,r}},n.prototype.lexerActionFactory=function(e,t,o){if(null===this.actionFactories){var r=[];r[V.CHANNEL]=function(e){return new G(e)},r[V.CUSTOM]=function(e,t){return new K(e,t)},r[V.MODE]=function(e){return new j(e)},r[V.MORE]=function(){return q.INSTANCE},r[V.POP_MODE]=function(){return w.INSTANCE},r[V.PUSH_MODE]=function(e){return new Y(e)},r[V.SKIP]=function(){return z.INSTANCE},r[V.TYPE]=function(e){return new W(e)},this.actionFactories=r}if(e>this.actionFactories.length||null===this.actionFactories[e])throw"The specified lexer action type "+e+" is not valid.";else return this.actionFactories[e](t,o)},o.ATNDeserializer=n},{"./../IntervalSet":14,"./../Token":22,"./ATN":24,"./ATNDeserializationOptions":27,"./ATNState":30,"./ATNType":31,"./LexerAction":33,"./Transition":38}],29:[function(e,t,o){function r(e,t){return this.atn=e,this.sharedContextCache=t,this}var n=e("./../dfa/DFAState").DFAState,p=e("./ATNConfigSet").ATNConfigSet,a=e("./../PredictionContext").getCachedPredictionContext;r.ERROR=new n(2147483647,new p()),r.prototype.getCachedContext=function(e){if(null===this.sharedContextCache)return e;return a(e,this.sharedContextCache,{})},o.ATNSimulator=r},{"./../PredictionContext":19,"./../dfa/DFAState":42,"./ATNConfigSet":26}],30:[function(e,t,o){function r(){return this.atn=null,this.stateNumber=r.INVALID_STATE_NUMBER,this.stateType=null,this.ruleIndex=0,this.epsilonOnlyTransitions=!1,this.transitions=[],this.nextTokenWithinRule=null,this}function n(){return r.call(this),this.stateType=r.BASIC,this}function p(){return r.call(this),this.decision=-1,this.nonGreedy=!1,this}function a(){return p.call(this),this.endState=null,this}function i(){return a.call(this),this.stateType=r.BLOCK_START,this}function s(){return r.call(this),this.stateType=r.BLOCK_END,this.startState=null,this}function d(){return r.call(this),this.stateType=r.RULE_STOP,this}function c(){return r.call(this),this.stateType=r.RULE_START,this.stopState=null,this.isPrecedenceRule=!1,this}function l(){return p.call(this),this.stateType=r.PLUS_LOOP_BACK,this}function u(){return a.call(this),this.stateType=r.PLUS_BLOCK_START,this.loopBackState=null,this}function y(){return a.call(this),this.stateType=r.STAR_BLOCK_START,this}function g(){return r.call(this),this.stateType=r.STAR_LOOP_BACK,this}function T(){return p.call(this),this.stateType=r.STAR_LOOP_ENTRY,this.loopBackState=null,this.isPrecedenceDecision=null,this}function x(){return r.call(this),this.stateType=r.LOOP_END,this.loopBackState=null,this}function m(){return p.call(this),this.stateType=r.TOKEN_START,this}r.INVALID_TYPE=0,r.BASIC=1,r.RULE_START=2,r.BLOCK_START=3,r.PLUS_BLOCK_START=4,r.STAR_BLOCK_START=5,r.TOKEN_START=6,r.RULE_STOP=7,r.BLOCK_END=8,r.STAR_LOOP_BACK=9,r.STAR_LOOP_ENTRY=10,r.PLUS_LOOP_BACK=11,r.LOOP_END=12,r.serializationNames=["INVALID","BASIC","RULE_START","BLOCK_START","PLUS_BLOCK_START","STAR_BLOCK_START","TOKEN_START","RULE_STOP","BLOCK_END","STAR_LOOP_BACK","STAR_LOOP_ENTRY","PLUS_LOOP_BACK","LOOP_END"],r.INVALID_STATE_NUMBER=-1,r.prototype.toString=function(){return this.stateNumber},r.prototype.equals=function(e){return!!(e instanceof r)&&this.stateNumber===e.stateNumber},r.prototype.isNonGreedyExitState=function(){return!1},r.prototype.addTransition=function(e,t){t===void 0&&(t=-1),0===this.transitions.length?this.epsilonOnlyTransitions=e.isEpsilon:this.epsilonOnlyTransitions!==e.isEpsilon&&(this.epsilonOnlyTransitions=!1),-1===t?this.transitions.push(e):this.transitions.splice(t,1,e)},n.prototype=Object.create(r.prototype),n.prototype.constructor=n,p.prototype=Object.create(r.prototype),p.prototype.constructor=p,a.prototype=Object.create(p.prototype),a.prototype.constructor=a,i.prototype=Object.create(a.prototype),i.prototype.constructor=i,s.prototype=Object.create(r.prototype),s.prototype.constructor=s,d.prototype=Object.create(r.prototype),d.prototype.constructor=d,c.prototype=Object.create(r.prototype),c.prototype.constructor=c,l.prototype=Object.create(p.prototype),l.prototype.constructor=l,u.prototype=Object.create(a.prototype),u.prototype.constructor=u,y.prototype=Object.create(a.prototype),y.prototype.constructor=y,g.prototype=Object.create(r.prototype),g.prototype.constructor=g,T.prototype=Object.create(p.prototype),T.prototype.constructor=T,x.prototype=Object.create(r.prototype),x.prototype.constructor=x,m.prototype=Object.create(p.prototype),m.prototype.constructor=m,o.ATNState=r,o.BasicState=n,o.DecisionState=p,o.BlockStartState=a,o.BlockEndState=s,o.LoopEndState=x,o.RuleStartState=c,o.RuleStopState=d,o.TokensStartState=m,o.PlusLoopbackState=l,o.StarLoopbackState=g,o.StarLoopEntryState=T,o.PlusBlockStartState=u,o.StarBlockStartState=y,o.BasicBlockStartState=i},{}],31:[function(e,t,o){function r(){}r.LEXER=0,r.PARSER=1,o.ATNType=r},{}],32:[function(e,t,o){function r(e){e.index=-1,e.line=0,e.column=-1,e.dfaState=null}function n(){return r(this),this}function p(e,t,o,r){return d.call(this,t,r),this.decisionToDFA=o,this.recog=e,this.startIndex=-1,this.line=1,this.column=0,this.mode=i.DEFAULT_MODE,this.prevAccept=new n,this}var a=e("./../Token").Token,i=e("./../Lexer").Lexer,s=e("./ATN").ATN,d=e("./ATNSimulator").ATNSimulator,c=e("./../dfa/DFAState").DFAState,l=e("./ATNConfigSet").ATNConfigSet,u=e("./ATNConfigSet").OrderedATNConfigSet,y=e("./../PredictionContext").PredictionContext,g=e("./../PredictionContext").SingletonPredictionContext,T=e("./ATNState").RuleStopState,x=e("./ATNConfig").LexerATNConfig,m=e("./Transition").Transition,_=e("./LexerActionExecutor").LexerActionExecutor,S=e("./../error/Errors").LexerNoViableAltException;n.prototype.reset=function(){r(this)},p.prototype=Object.create(d.prototype),p.prototype.constructor=p,p.debug=!1,p.dfa_debug=!1,p.MIN_DFA_EDGE=0,p.MAX_DFA_EDGE=127,p.match_calls=0,p.prototype.copyState=function(e){this.column=e.column,this.line=e.line,this.mode=e.mode,this.startIndex=e.startIndex},p.prototype.match=function(e,t){this.match_calls+=1,this.mode=t;var o=e.mark();try{this.startIndex=e.index,this.prevAccept.reset();var r=this.decisionToDFA[t];return null===r.s0?this.matchATN(e):this.execATN(e,r.s0)}finally{e.release(o)}},p.prototype.reset=function(){this.prevAccept.reset(),this.startIndex=-1,this.line=1,this.column=0,this.mode=i.DEFAULT_MODE},p.prototype.matchATN=function(e){var t=this.atn.modeToStartState[this.mode];p.debug&&console.log("matchATN mode "+this.mode+" start: "+t);var o=this.mode,r=this.computeStartState(e,t),n=r.hasSemanticContext;r.hasSemanticContext=!1;var a=this.addDFAState(r);n||(this.decisionToDFA[this.mode].s0=a);var i=this.execATN(e,a);return p.debug&&console.log("DFA after matchATN: "+this.decisionToDFA[o].toLexerString()),i},p.prototype.execATN=function(e,o){p.debug&&console.log("start state closure="+o.configs),o.isAcceptState&&this.captureSimState(this.prevAccept,e,o);for(var r=e.LA(1),t=o;;){p.debug&&console.log("execATN loop starting closure: "+t.configs);var n=this.getExistingTargetState(t,r);if(null===n&&(n=this.computeTargetState(e,t,r)),n===d.ERROR)break;if(r!==a.EOF&&this.consume(e),n.isAcceptState&&(this.captureSimState(this.prevAccept,e,n),r===a.EOF))break;r=e.LA(1),t=n}return this.failOrAccept(this.prevAccept,e,t.configs,r)},p.prototype.getExistingTargetState=function(e,o){if(null===e.edges||o<p.MIN_DFA_EDGE||o>p.MAX_DFA_EDGE)return null;var t=e.edges[o-p.MIN_DFA_EDGE];return void 0===t&&(t=null),p.debug&&null!==t&&console.log("reuse state "+e.stateNumber+" edge to "+t.stateNumber),t},p.prototype.computeTargetState=function(e,o,r){var t=new u;return this.getReachableConfigSet(e,o.configs,t,r),0===t.items.length?(t.hasSemanticContext||this.addDFAEdge(o,r,d.ERROR),d.ERROR):this.addDFAEdge(o,r,null,t)},p.prototype.failOrAccept=function(e,o,r,n){if(null!==this.prevAccept.dfaState){var t=e.dfaState.lexerActionExecutor;return this.accept(o,t,this.startIndex,e.index,e.line,e.column),e.dfaState.prediction}if(n===a.EOF&&o.index===this.startIndex)return a.EOF;throw new S(this.recog,o,this.startIndex,r)},p.prototype.getReachableConfigSet=function(e,o,r,n){for(var t=s.INVALID_ALT_NUMBER,d=0;d<o.items.length;d++){var i=o.items[d],c=i.alt===t;if(!(c&&i.passedThroughNonGreedyDecision)){p.debug&&console.log("testing %s at %s\n",this.getTokenName(n),i.toString(this.recog,!0));for(var l=0;l<i.state.transitions.length;l++){var u=i.state.transitions[l],y=this.getReachableTarget(u,n);if(null!==y){var g=i.lexerActionExecutor;null!==g&&(g=g.fixOffsetBeforeMatch(e.index-this.startIndex));var T=n===a.EOF,m=new x({state:y,lexerActionExecutor:g},i);this.closure(e,m,r,c,!0,T)&&(t=i.alt)}}}}},p.prototype.accept=function(e,t,o,r,n,a){p.debug&&console.log("ACTION %s\n",t),e.seek(r),this.line=n,this.column=a,null!==t&&null!==this.recog&&t.execute(this.recog,e,o)},p.prototype.getReachableTarget=function(e,o){return e.matches(o,0,i.MAX_CHAR_VALUE)?e.target:null},p.prototype.computeStartState=function(e,t){for(var o=y.EMPTY,r=new u,n=0;n<t.transitions.length;n++){var p=t.transitions[n].target,a=new x({state:p,alt:n+1,context:o},null);this.closure(e,a,r,!1,!1,!1)}return r},p.prototype.closure=function(e,t,o,r,n,a){var s=null;if(p.debug&&console.log("closure("+t.toString(this.recog,!0)+")"),t.state instanceof T){if(p.debug&&(null===this.recog?console.log("closure at rule stop %s\n",t):console.log("closure at %s rule stop %s\n",this.recog.ruleNames[t.state.ruleIndex],t)),null===t.context||t.context.hasEmptyPath()){if(null===t.context||t.context.isEmpty())return o.add(t),!0;o.add(new x({state:t.state,context:y.EMPTY},t)),r=!0}if(null!==t.context&&!t.context.isEmpty())for(var d=0;d<t.context.length;d++)if(t.context.getReturnState(d)!==y.EMPTY_RETURN_STATE){var i=t.context.getParent(d),c=this.atn.states[t.context.getReturnState(d)];s=new x({state:c,context:i},t),r=this.closure(e,s,o,r,n,a)}return r}t.state.epsilonOnlyTransitions||r&&t.passedThroughNonGreedyDecision||o.add(t);for(var l=0,u;l<t.state.transitions.length;l++)u=t.state.transitions[l],s=this.getEpsilonTarget(e,t,u,o,n,a),null!==s&&(r=this.closure(e,s,o,r,n,a));return r},p.prototype.getEpsilonTarget=function(e,t,o,r,n,s){var d=null;if(o.serializationType===m.RULE){var c=g.create(t.context,o.followState.stateNumber);d=new x({state:o.target,context:c},t)}else if(o.serializationType===m.PRECEDENCE)throw"Precedence predicates are not supported in lexers.";else if(o.serializationType===m.PREDICATE)p.debug&&console.log("EVAL rule "+o.ruleIndex+":"+o.predIndex),r.hasSemanticContext=!0,this.evaluatePredicate(e,o.ruleIndex,o.predIndex,n)&&(d=new x({state:o.target},t));else if(!(o.serializationType===m.ACTION))o.serializationType===m.EPSILON?d=new x({state:o.target},t):(o.serializationType===m.ATOM||o.serializationType===m.RANGE||o.serializationType===m.SET)&&s&&o.matches(a.EOF,0,i.MAX_CHAR_VALUE)&&(d=new x({state:o.target},t));else if(null===t.context||t.context.hasEmptyPath()){var l=_.append(t.lexerActionExecutor,this.atn.lexerActions[o.actionIndex]);d=new x({state:o.target,lexerActionExecutor:l},t)}else d=new x({state:o.target},t);return d},p.prototype.evaluatePredicate=function(e,t,o,r){if(null===this.recog)return!0;if(!r)return this.recog.sempred(null,t,o);var n=this.column,p=this.line,a=e.index,i=e.mark();try{return this.consume(e),this.recog.sempred(null,t,o)}finally{this.column=n,this.line=p,e.seek(a),e.release(i)}},p.prototype.captureSimState=function(e,t,o){e.index=t.index,e.line=this.line,e.column=this.column,e.dfaState=o},p.prototype.addDFAEdge=function(e,t,o,r){if(void 0===o&&(o=null),void 0===r&&(r=null),null===o&&null!==r){var n=r.hasSemanticContext;if(r.hasSemanticContext=!1,o=this.addDFAState(r),n)return o}return t<p.MIN_DFA_EDGE||t>p.MAX_DFA_EDGE?o:(p.debug&&console.log("EDGE "+e+" -> "+o+" upon "+t),null===e.edges&&(e.edges=[]),e.edges[t-p.MIN_DFA_EDGE]=o,o)},p.prototype.addDFAState=function(e){for(var t=new c(null,e),o=null,r=0,n;r<e.items.length;r++)if(n=e.items[r],n.state instanceof T){o=n;break}null!==o&&(t.isAcceptState=!0,t.lexerActionExecutor=o.lexerActionExecutor,t.prediction=this.atn.ruleToTokenType[o.state.ruleIndex]);var p=this.decisionToDFA[this.mode],a=p.states.get(t);if(null!==a)return a;var i=t;return i.stateNumber=p.states.length,e.setReadonly(!0),i.configs=e,p.states.add(i),i},p.prototype.getDFA=function(e){return this.decisionToDFA[e]},p.prototype.getText=function(e){return e.getText(this.startIndex,e.index-1)},p.prototype.consume=function(e){var t=e.LA(1);t===10?(this.line+=1,this.column=0):this.column+=1,e.consume()},p.prototype.getTokenName=function(e){return-1===e?"EOF":"'"+String.fromCharCode(e)+"'"},o.LexerATNSimulator=p},{"./../Lexer":16,"./../PredictionContext":19,"./../Token":22,"./../dfa/DFAState":42,"./../error/Errors":47,"./ATN":24,"./ATNConfig":25,"./ATNConfigSet":26,"./ATNSimulator":29,"./ATNState":30,"./LexerActionExecutor":34,"./Transition":38}],33:[function(e,t,o){function r(){}function n(e){return this.actionType=e,this.isPositionDependent=!1,this}function p(){return n.call(this,r.SKIP),this}function a(e){return n.call(this,r.TYPE),this.type=e,this}function i(e){return n.call(this,r.PUSH_MODE),this.mode=e,this}function s(){return n.call(this,r.POP_MODE),this}function d(){return n.call(this,r.MORE),this}function c(e){return n.call(this,r.MODE),this.mode=e,this}function l(e,t){return n.call(this,r.CUSTOM),this.ruleIndex=e,this.actionIndex=t,this.isPositionDependent=!0,this}function u(e){return n.call(this,r.CHANNEL),this.channel=e,this}function y(e,t){return n.call(this,t.actionType),this.offset=e,this.action=t,this.isPositionDependent=!0,this}r.CHANNEL=0,r.CUSTOM=1,r.MODE=2,r.MORE=3,r.POP_MODE=4,r.PUSH_MODE=5,r.SKIP=6,r.TYPE=7,n.prototype.hashCode=function(){var e=new Hash;return this.updateHashCode(e),e.finish()},n.prototype.updateHashCode=function(e){e.update(this.actionType)},n.prototype.equals=function(e){return this===e},p.prototype=Object.create(n.prototype),p.prototype.constructor=p,p.INSTANCE=new p,p.prototype.execute=function(e){e.skip()},p.prototype.toString=function(){return"skip"},a.prototype=Object.create(n.prototype),a.prototype.constructor=a,a.prototype.execute=function(e){e.type=this.type},a.prototype.updateHashCode=function(e){e.update(this.actionType,this.type)},a.prototype.equals=function(e){return!(this!==e)||!!(e instanceof a)&&this.type===e.type},a.prototype.toString=function(){return"type("+this.type+")"},i.prototype=Object.create(n.prototype),i.prototype.constructor=i,i.prototype.execute=function(e){e.pushMode(this.mode)},i.prototype.updateHashCode=function(e){e.update(this.actionType,this.mode)},i.prototype.equals=function(e){return!(this!==e)||!!(e instanceof i)&&this.mode===e.mode},i.prototype.toString=function(){return"pushMode("+this.mode+")"},s.prototype=Object.create(n.prototype),s.prototype.constructor=s,s.INSTANCE=new s,s.prototype.execute=function(e){e.popMode()},s.prototype.toString=function(){return"popMode"},d.prototype=Object.create(n.prototype),d.prototype.constructor=d,d.INSTANCE=new d,d.prototype.execute=function(e){e.more()},d.prototype.toString=function(){return"more"},c.prototype=Object.create(n.prototype),c.prototype.constructor=c,c.prototype.execute=function(e){e.mode(this.mode)},c.prototype.updateHashCode=function(e){e.update(this.actionType,this.mode)},c.prototype.equals=function(e){return!(this!==e)||!!(e instanceof c)&&this.mode===e.mode},c.prototype.toString=function(){return"mode("+this.mode+")"},l.prototype=Object.create(n.prototype),l.prototype.constructor=l,l.prototype.execute=function(e){e.action(null,this.ruleIndex,this.actionIndex)},l.prototype.updateHashCode=function(e){e.update(this.actionType,this.ruleIndex,this.actionIndex)},l.prototype.equals=function(e){return!(this!==e)||!!(e instanceof l)&&this.ruleIndex===e.ruleIndex&&this.actionIndex===e.actionIndex},u.prototype=Object.create(n.prototype),u.prototype.constructor=u,u.prototype.execute=function(e){e._channel=this.channel},u.prototype.updateHashCode=function(e){e.update(this.actionType,this.channel)},u.prototype.equals=function(e){return!(this!==e)||!!(e instanceof u)&&this.channel===e.channel},u.prototype.toString=function(){return"channel("+this.channel+")"},y.prototype=Object.create(n.prototype),y.prototype.constructor=y,y.prototype.execute=function(e){this.action.execute(e)},y.prototype.updateHashCode=function(e){e.update(this.actionType,this.offset,this.action)},y.prototype.equals=function(e){return!(this!==e)||!!(e instanceof y)&&this.offset===e.offset&&this.action===e.action},o.LexerActionType=r,o.LexerSkipAction=p,o.LexerChannelAction=u,o.LexerCustomAction=l,o.LexerIndexedCustomAction=y,o.LexerMoreAction=d,o.LexerTypeAction=a,o.LexerPushModeAction=i,o.LexerPopModeAction=s,o.LexerModeAction=c},{}],34:[function(e,t,o){function r(e){return this.lexerActions=null===e?[]:e,this.cachedHashCode=n(e),this}var n=e("../Utils").hashStuff,p=e("./LexerAction").LexerIndexedCustomAction;r.append=function(e,t){if(null===e)return new r([t]);var o=e.lexerActions.concat([t]);return new r(o)},r.prototype.fixOffsetBeforeMatch=function(e){for(var t=null,o=0;o<this.lexerActions.length;o++)this.lexerActions[o].isPositionDependent&&!(this.lexerActions[o]instanceof p)&&(null===t&&(t=this.lexerActions.concat([])),t[o]=new p(e,this.lexerActions[o]));return null===t?this:new r(t)},r.prototype.execute=function(e,t,o){var r=!1,n=t.index;try{for(var a=0,i;a<this.lexerActions.length;a++){if(i=this.lexerActions[a],i instanceof p){var s=i.offset;t.seek(o+s),i=i.action,r=o+s!==n}else i.isPositionDependent&&(t.seek(n),r=!1);i.execute(e)}}finally{r&&t.seek(n)}},r.prototype.hashCode=function(){return this.cachedHashCode},r.prototype.updateHashCode=function(e){e.update(this.cachedHashCode)},r.prototype.equals=function(e){if(this===e)return!0;if(!(e instanceof r))return!1;if(this.cachedHashCode!=e.cachedHashCode)return!1;if(this.lexerActions.length!=e.lexerActions.length)return!1;for(var t=this.lexerActions.length,o=0;o<t;++o)if(!this.lexerActions[o].equals(e.lexerActions[o]))return!1;return!0},o.LexerActionExecutor=r},{"../Utils":23,"./LexerAction":33}],35:[function(e,t,o){function r(e,t,o,r){return T.call(this,t,r),this.parser=e,this.decisionToDFA=o,this.predictionMode=x.LL,this._input=null,this._startIndex=0,this._outerContext=null,this._dfa=null,this.mergeCache=null,this}var n=e("./../Utils"),a=n.Set,p=n.BitSet,s=n.DoubleDict,d=e("./ATN").ATN,c=e("./ATNState").ATNState,l=e("./ATNConfig").ATNConfig,u=e("./ATNConfigSet").ATNConfigSet,y=e("./../Token").Token,i=e("./../dfa/DFAState").DFAState,g=e("./../dfa/DFAState").PredPrediction,T=e("./ATNSimulator").ATNSimulator,x=e("./PredictionMode").PredictionMode,m=e("./../RuleContext").RuleContext,_=e("./../ParserRuleContext").ParserRuleContext,S=e("./SemanticContext").SemanticContext,f=e("./ATNState").StarLoopEntryState,h=e("./ATNState").RuleStopState,E=e("./../PredictionContext").PredictionContext,A=e("./../IntervalSet").Interval,C=e("./Transition"),N=C.Transition,R=C.SetTransition,L=C.NotSetTransition,I=C.RuleTransition,k=C.ActionTransition,P=e("./../error/Errors").NoViableAltException,D=e("./../PredictionContext").SingletonPredictionContext,O=e("./../PredictionContext").predictionContextFromRuleContext;r.prototype=Object.create(T.prototype),r.prototype.constructor=r,r.prototype.debug=!1,r.prototype.debug_closure=!1,r.prototype.debug_add=!1,r.prototype.debug_list_atn_decisions=!1,r.prototype.dfa_debug=!1,r.prototype.retry_debug=!1,r.prototype.reset=function(){},r.prototype.adaptivePredict=function(e,t,o){(this.debug||this.debug_list_atn_decisions)&&console.log("adaptivePredict decision "+t+" exec LA(1)=="+this.getLookaheadName(e)+" line "+e.LT(1).line+":"+e.LT(1).column),this._input=e,this._startIndex=e.index,this._outerContext=o;var r=this.decisionToDFA[t];this._dfa=r;var n=e.mark(),p=e.index;try{var a;if(a=r.precedenceDfa?r.getPrecedenceStartState(this.parser.getPrecedence()):r.s0,null===a){null===o&&(o=m.EMPTY),(this.debug||this.debug_list_atn_decisions)&&console.log("predictATN decision "+r.decision+" exec LA(1)=="+this.getLookaheadName(e)+", outerContext="+o.toString(this.parser.ruleNames));var s=this.computeStartState(r.atnStartState,m.EMPTY,!1);r.precedenceDfa?(r.s0.configs=s,s=this.applyPrecedenceFilter(s),a=this.addDFAState(r,new i(null,s)),r.setPrecedenceStartState(this.parser.getPrecedence(),a)):(a=this.addDFAState(r,new i(null,s)),r.s0=a)}var d=this.execATN(r,a,e,p,o);return this.debug&&console.log("DFA after predictATN: "+r.toString(this.parser.literalNames)),d}finally{this._dfa=null,this.mergeCache=null,e.seek(p),e.release(n)}},r.prototype.execATN=function(o,r,n,p,a){(this.debug||this.debug_list_atn_decisions)&&console.log("execATN decision "+o.decision+" exec LA(1)=="+this.getLookaheadName(n)+" line "+n.LT(1).line+":"+n.LT(1).column);var i=r,s;this.debug&&console.log("s0 = "+r);for(var c=n.LA(1),t;;){if(t=this.getExistingTargetState(i,c),null===t&&(t=this.computeTargetState(o,i,c)),t===T.ERROR){var l=this.noViableAlt(n,a,i.configs,p);if(n.seek(p),s=this.getSynValidOrSemInvalidAltThatFinishedDecisionEntryRule(i.configs,a),s!==d.INVALID_ALT_NUMBER)return s;throw l}if(t.requiresFullContext&&this.predictionMode!==x.SLL){var e=null;if(null!==t.predicates){this.debug&&console.log("DFA state has preds in DFA sim LL failover");var u=n.index;if(u!==p&&n.seek(p),e=this.evalSemanticContext(t.predicates,a,!0),1===e.length)return this.debug&&console.log("Full LL avoided"),e.minValue();u!==p&&n.seek(u)}this.dfa_debug&&console.log("ctx sensitive state "+a+" in "+t);var g=this.computeStartState(o.atnStartState,a,!0);return this.reportAttemptingFullContext(o,e,t.configs,p,n.index),s=this.execATNWithFullContext(o,t,g,n,p,a),s}if(t.isAcceptState){if(null===t.predicates)return t.prediction;var m=n.index;n.seek(p);var _=this.evalSemanticContext(t.predicates,a,!0);if(0===_.length)throw this.noViableAlt(n,a,t.configs,p);else return 1===_.length?_.minValue():(this.reportAmbiguity(o,t,p,m,!1,_,t.configs),_.minValue())}i=t,c!==y.EOF&&(n.consume(),c=n.LA(1))}},r.prototype.getExistingTargetState=function(e,o){var t=e.edges;return null===t?null:t[o+1]||null},r.prototype.computeTargetState=function(e,o,r){var t=this.computeReachSet(o.configs,r,!1);if(null===t)return this.addDFAEdge(e,o,r,T.ERROR),T.ERROR;var p=new i(null,t),a=this.getUniqueAlt(t);if(this.debug){var s=x.getConflictingAltSubsets(t);console.log("SLL altSubSets="+n.arrayToString(s)+", previous="+o.configs+", configs="+t+", predict="+a+", allSubsetsConflict="+x.allSubsetsConflict(s)+", conflictingAlts="+this.getConflictingAlts(t))}return a===d.INVALID_ALT_NUMBER?x.hasSLLConflictTerminatingPrediction(this.predictionMode,t)&&(p.configs.conflictingAlts=this.getConflictingAlts(t),p.requiresFullContext=!0,p.isAcceptState=!0,p.prediction=p.configs.conflictingAlts.minValue()):(p.isAcceptState=!0,p.configs.uniqueAlt=a,p.prediction=a),p.isAcceptState&&p.configs.hasSemanticContext&&(this.predicateDFAState(p,this.atn.getDecisionState(e.decision)),null!==p.predicates&&(p.prediction=d.INVALID_ALT_NUMBER)),p=this.addDFAEdge(e,o,r,p),p},r.prototype.predicateDFAState=function(e,t){var o=t.transitions.length,r=this.getConflictingAltsOrUniqueAlt(e.configs),n=this.getPredsForAmbigAlts(r,e.configs,o);null===n?e.prediction=r.minValue():(e.predicates=this.getPredicatePredictions(r,n),e.prediction=d.INVALID_ALT_NUMBER)},r.prototype.execATNWithFullContext=function(o,r,n,p,a,i){(this.debug||this.debug_list_atn_decisions)&&console.log("execATNWithFullContext "+n);var s=!1,c=null,l=n;p.seek(a);for(var u=p.LA(1),t=-1;;){if(c=this.computeReachSet(l,u,!0),null===c){var g=this.noViableAlt(p,i,l,a);p.seek(a);var e=this.getSynValidOrSemInvalidAltThatFinishedDecisionEntryRule(l,i);if(e!==d.INVALID_ALT_NUMBER)return e;throw g}var T=x.getConflictingAltSubsets(c);if(this.debug&&console.log("LL altSubSets="+T+", predict="+x.getUniqueAlt(T)+", resolvesToJustOneViableAlt="+x.resolvesToJustOneViableAlt(T)),c.uniqueAlt=this.getUniqueAlt(c),c.uniqueAlt!==d.INVALID_ALT_NUMBER){t=c.uniqueAlt;break}else if(this.predictionMode!==x.LL_EXACT_AMBIG_DETECTION){if(t=x.resolvesToJustOneViableAlt(T),t!==d.INVALID_ALT_NUMBER)break;}else if(x.allSubsetsConflict(T)&&x.allSubsetsEqual(T)){s=!0,t=x.getSingleViableAlt(T);break}l=c,u!==y.EOF&&(p.consume(),u=p.LA(1))}return c.uniqueAlt===d.INVALID_ALT_NUMBER?(this.reportAmbiguity(o,r,a,p.index,s,null,c),t):(this.reportContextSensitivity(o,t,c,a,p.index),t)},r.prototype.computeReachSet=function(e,o,t){this.debug&&console.log("in computeReachSet, starting closure: "+e),null===this.mergeCache&&(this.mergeCache=new s);for(var r=new u(t),n=null,p=0,i;p<e.items.length;p++){if(i=e.items[p],this.debug_add&&console.log("testing "+this.getTokenName(o)+" at "+i),i.state instanceof h){(t||o===y.EOF)&&(null==n&&(n=[]),n.push(i),this.debug_add&&console.log("added "+i+" to skippedStopStates"));continue}for(var c=0;c<i.state.transitions.length;c++){var g=i.state.transitions[c],T=this.getReachableTarget(g,o);if(null!==T){var m=new l({state:T},i);r.add(m,this.mergeCache),this.debug_add&&console.log("added "+m+" to intermediate")}}}var _=null;if(null===n&&o!==y.EOF&&(1===r.items.length?_=r:this.getUniqueAlt(r)!==d.INVALID_ALT_NUMBER&&(_=r)),null===_){_=new u(t);for(var S=new a,f=o===y.EOF,E=0;E<r.items.length;E++)this.closure(r.items[E],_,S,!1,t,f)}if(o===y.EOF&&(_=this.removeAllConfigsNotInRuleStopState(_,_===r)),null!==n&&(!t||!x.hasConfigInRuleStopState(_)))for(var A=0;A<n.length;A++)_.add(n[A],this.mergeCache);return 0===_.items.length?null:_},r.prototype.removeAllConfigsNotInRuleStopState=function(e,t){if(x.allConfigsInRuleStopStates(e))return e;for(var o=new u(e.fullCtx),r=0,n;r<e.items.length;r++){if(n=e.items[r],n.state instanceof h){o.add(n,this.mergeCache);continue}if(t&&n.state.epsilonOnlyTransitions){var p=this.atn.nextTokens(n.state);if(p.contains(y.EPSILON)){var a=this.atn.ruleToStopState[n.state.ruleIndex];o.add(new l({state:a},n),this.mergeCache)}}}return o},r.prototype.computeStartState=function(e,t,o){for(var r=O(this.atn,t),n=new u(o),p=0;p<e.transitions.length;p++){var i=e.transitions[p].target,s=new l({state:i,alt:p+1,context:r},null),d=new a;this.closure(s,n,d,!0,o,!1)}return n},r.prototype.applyPrecedenceFilter=function(e){for(var t=[],o=new u(e.fullCtx),r=0,n;r<e.items.length;r++)if(n=e.items[r],1===n.alt){var p=n.semanticContext.evalPrecedence(this.parser,this._outerContext);null!==p&&(t[n.state.stateNumber]=n.context,p===n.semanticContext?o.add(n,this.mergeCache):o.add(new l({semanticContext:p},n),this.mergeCache))}for(r=0;r<e.items.length;r++)if(n=e.items[r],1!==n.alt){if(!n.precedenceFilterSuppressed){var a=t[n.state.stateNumber]||null;if(null!==a&&a.equals(n.context))continue}o.add(n,this.mergeCache)}return o},r.prototype.getReachableTarget=function(e,t){return e.matches(t,0,this.atn.maxTokenType)?e.target:null},r.prototype.getPredsForAmbigAlts=function(e,t,o){for(var r=[],p=0,a;p<t.items.length;p++)a=t.items[p],e.contains(a.alt)&&(r[a.alt]=S.orContext(r[a.alt]||null,a.semanticContext));var i=0;for(p=1;p<o+1;p++){var s=r[p]||null;null===s?r[p]=S.NONE:s!==S.NONE&&(i+=1)}return 0==i&&(r=null),this.debug&&console.log("getPredsForAmbigAlts result "+n.arrayToString(r)),r},r.prototype.getPredicatePredictions=function(e,t){for(var o=[],r=!1,n=1,p;n<t.length;n++)p=t[n],null!==e&&e.contains(n)&&o.push(new g(p,n)),p!==S.NONE&&(r=!0);return r?o:null},r.prototype.getSynValidOrSemInvalidAltThatFinishedDecisionEntryRule=function(e,t){var o=this.splitAccordingToSemanticValidity(e,t),r=o[0],n=o[1],p=this.getAltThatFinishedDecisionEntryRule(r);return p===d.INVALID_ALT_NUMBER?0<n.items.length&&(p=this.getAltThatFinishedDecisionEntryRule(n),p!==d.INVALID_ALT_NUMBER)?p:d.INVALID_ALT_NUMBER:p},r.prototype.getAltThatFinishedDecisionEntryRule=function(e){for(var t=[],o=0,r;o<e.items.length;o++)r=e.items[o],(0<r.reachesIntoOuterContext||r.state instanceof h&&r.context.hasEmptyPath())&&0>t.indexOf(r.alt)&&t.push(r.alt);return 0===t.length?d.INVALID_ALT_NUMBER:Math.min.apply(null,t)},r.prototype.splitAccordingToSemanticValidity=function(e,t){for(var o=new u(e.fullCtx),r=new u(e.fullCtx),n=0,p;n<e.items.length;n++)if(p=e.items[n],p.semanticContext!==S.NONE){var a=p.semanticContext.evaluate(this.parser,t);a?o.add(p):r.add(p)}else o.add(p);return[o,r]},r.prototype.evalSemanticContext=function(e,t,o){for(var r=new p,n=0,a;n<e.length;n++){if(a=e[n],a.pred===S.NONE){if(r.add(a.alt),!o)break;continue}var i=a.pred.evaluate(this.parser,t);if((this.debug||this.dfa_debug)&&console.log("eval pred "+a+"="+i),i&&((this.debug||this.dfa_debug)&&console.log("PREDICT "+a.alt),r.add(a.alt),!o))break}return r},r.prototype.closure=function(e,t,o,r,n,p){this.closureCheckingStopState(e,t,o,r,n,0,p)},r.prototype.closureCheckingStopState=function(e,t,o,r,n,p,a){if((this.debug||this.debug_closure)&&(console.log("closure("+e.toString(this.parser,!0)+")"),50<e.reachesIntoOuterContext))throw"problem";if(e.state instanceof h){if(!e.context.isEmpty()){for(var s=0;s<e.context.length;s++){if(e.context.getReturnState(s)===E.EMPTY_RETURN_STATE){if(n){t.add(new l({state:e.state,context:E.EMPTY},e),this.mergeCache);continue}else this.debug&&console.log("FALLING off rule "+this.getRuleName(e.state.ruleIndex)),this.closure_(e,t,o,r,n,p,a);continue}var i=this.atn.states[e.context.getReturnState(s)],d=e.context.getParent(s),u={state:i,alt:e.alt,context:d,semanticContext:e.semanticContext},y=new l(u,null);y.reachesIntoOuterContext=e.reachesIntoOuterContext,this.closureCheckingStopState(y,t,o,r,n,p-1,a)}return}if(n)return void t.add(e,this.mergeCache);this.debug&&console.log("FALLING off rule "+this.getRuleName(e.state.ruleIndex))}this.closure_(e,t,o,r,n,p,a)},r.prototype.closure_=function(e,o,r,n,a,s,d){var l=e.state;l.epsilonOnlyTransitions||o.add(e,this.mergeCache);for(var p=0;p<l.transitions.length;p++)if(!(0==p&&this.canDropLoopEntryEdgeInLeftRecursiveRule(e))){var i=l.transitions[p],t=n&&!(i instanceof k),u=this.getEpsilonTarget(e,i,t,0===s,a,d);if(null!==u){if(!i.isEpsilon&&r.add(u)!==u)continue;var c=s;if(e.state instanceof h){if(r.add(u)!==u)continue;null!==this._dfa&&this._dfa.precedenceDfa&&i.outermostPrecedenceReturn===this._dfa.atnStartState.ruleIndex&&(u.precedenceFilterSuppressed=!0),u.reachesIntoOuterContext+=1,o.dipsIntoOuterContext=!0,c-=1,this.debug&&console.log("dips into outer ctx: "+u)}else i instanceof I&&0<=c&&(c+=1);this.closureCheckingStopState(u,o,r,t,a,c,d)}}},r.prototype.canDropLoopEntryEdgeInLeftRecursiveRule=function(e){var t=e.state;if(t.stateType!=c.STAR_LOOP_ENTRY)return!1;if(t.stateType!=c.STAR_LOOP_ENTRY||!t.isPrecedenceDecision||e.context.isEmpty()||e.context.hasEmptyPath())return!1;for(var o=e.context.length,r=0,n;r<o;r++)if(n=this.atn.states[e.context.getReturnState(r)],n.ruleIndex!=t.ruleIndex)return!1;for(var p=t.transitions[0].target,a=p.endState.stateNumber,i=this.atn.states[a],r=0;r<o;r++){var s=e.context.getReturnState(r),n=this.atn.states[s];if(1!=n.transitions.length||!n.transitions[0].isEpsilon)return!1;var d=n.transitions[0].target;if((n.stateType!=c.BLOCK_END||d!=t)&&n!=i&&d!=i&&!(d.stateType==c.BLOCK_END&&1==d.transitions.length&&d.transitions[0].isEpsilon&&d.transitions[0].target==t))return!1}return!0},r.prototype.getRuleName=function(e){return null!==this.parser&&0<=e?this.parser.ruleNames[e]:"<rule "+e+">"},r.prototype.getEpsilonTarget=function(e,o,t,r,n,p){switch(o.serializationType){case N.RULE:return this.ruleTransition(e,o);case N.PRECEDENCE:return this.precedenceTransition(e,o,t,r,n);case N.PREDICATE:return this.predTransition(e,o,t,r,n);case N.ACTION:return this.actionTransition(e,o);case N.EPSILON:return new l({state:o.target},e);case N.ATOM:case N.RANGE:case N.SET:return p&&o.matches(y.EOF,0,1)?new l({state:o.target},e):null;default:return null;}},r.prototype.actionTransition=function(e,o){if(this.debug){var t=-1==o.actionIndex?65535:o.actionIndex;console.log("ACTION edge "+o.ruleIndex+":"+t)}return new l({state:o.target},e)},r.prototype.precedenceTransition=function(e,t,o,r,p){this.debug&&(console.log("PRED (collectPredicates="+o+") "+t.precedence+">=_p, ctx dependent=true"),null!==this.parser&&console.log("context surrounding pred is "+n.arrayToString(this.parser.getRuleInvocationStack())));var a=null;if(!(o&&r))a=new l({state:t.target},e);else if(p){var i=this._input.index;this._input.seek(this._startIndex);var s=t.getPredicate().evaluate(this.parser,this._outerContext);this._input.seek(i),s&&(a=new l({state:t.target},e))}else{var d=S.andContext(e.semanticContext,t.getPredicate());a=new l({state:t.target,semanticContext:d},e)}return this.debug&&console.log("config from pred transition="+a),a},r.prototype.predTransition=function(e,t,o,r,p){this.debug&&(console.log("PRED (collectPredicates="+o+") "+t.ruleIndex+":"+t.predIndex+", ctx dependent="+t.isCtxDependent),null!==this.parser&&console.log("context surrounding pred is "+n.arrayToString(this.parser.getRuleInvocationStack())));var a=null;if(!(o&&(t.isCtxDependent&&r||!t.isCtxDependent)))a=new l({state:t.target},e);else if(p){var i=this._input.index;this._input.seek(this._startIndex);var s=t.getPredicate().evaluate(this.parser,this._outerContext);this._input.seek(i),s&&(a=new l({state:t.target},e))}else{var d=S.andContext(e.semanticContext,t.getPredicate());a=new l({state:t.target,semanticContext:d},e)}return this.debug&&console.log("config from pred transition="+a),a},r.prototype.ruleTransition=function(e,o){this.debug&&console.log("CALL rule "+this.getRuleName(o.target.ruleIndex)+", ctx="+e.context);var t=o.followState,r=D.create(e.context,t.stateNumber);return new l({state:o.target,context:r},e)},r.prototype.getConflictingAlts=function(e){var t=x.getConflictingAltSubsets(e);return x.getAlts(t)},r.prototype.getConflictingAltsOrUniqueAlt=function(e){var t=null;return e.uniqueAlt===d.INVALID_ALT_NUMBER?t=e.conflictingAlts:(t=new p,t.add(e.uniqueAlt)),t},r.prototype.getTokenName=function(e){if(e===y.EOF)return"EOF";if(null!==this.parser&&null!==this.parser.literalNames)if(e>=this.parser.literalNames.length&&e>=this.parser.symbolicNames.length)console.log(""+e+" ttype out of range: "+this.parser.literalNames),console.log(""+this.parser.getInputStream().getTokens());else{var t=this.parser.literalNames[e]||this.parser.symbolicNames[e];return t+"<"+e+">"}return""+e},r.prototype.getLookaheadName=function(e){return this.getTokenName(e.LA(1))},r.prototype.dumpDeadEndConfigs=function(e){console.log("dead end configs: ");for(var o=e.getDeadEndConfigs(),r=0;r<o.length;r++){var n=o[r],p="no edges";if(0<n.state.transitions.length){var a=n.state.transitions[0];if(a instanceof AtomTransition)p="Atom "+this.getTokenName(a.label);else if(a instanceof R){p=(a instanceof L?"~":"")+"Set "+a.set}}console.error(n.toString(this.parser,!0)+":"+p)}},r.prototype.noViableAlt=function(e,t,o,r){return new P(this.parser,e,e.get(r),e.LT(1),o,t)},r.prototype.getUniqueAlt=function(e){for(var t=d.INVALID_ALT_NUMBER,o=0,r;o<e.items.length;o++)if(r=e.items[o],t===d.INVALID_ALT_NUMBER)t=r.alt;else if(r.alt!==t)return d.INVALID_ALT_NUMBER;return t},r.prototype.addDFAEdge=function(e,o,r,t){if(this.debug&&console.log("EDGE "+o+" -> "+t+" upon "+this.getTokenName(r)),null===t)return null;if(t=this.addDFAState(e,t),null===o||-1>r||r>this.atn.maxTokenType)return t;if(null===o.edges&&(o.edges=[]),o.edges[r+1]=t,this.debug){var n=null===this.parser?null:this.parser.literalNames,p=null===this.parser?null:this.parser.symbolicNames;console.log("DFA=\n"+e.toString(n,p))}return t},r.prototype.addDFAState=function(e,t){if(t==T.ERROR)return t;var o=e.states.get(t);return null===o?(t.stateNumber=e.states.length,t.configs.readOnly||(t.configs.optimizeConfigs(this),t.configs.setReadonly(!0)),e.states.add(t),this.debug&&console.log("adding new DFA state: "+t),t):o},r.prototype.reportAttemptingFullContext=function(e,t,o,r,n){if(this.debug||this.retry_debug){var p=new A(r,n+1);console.log("reportAttemptingFullContext decision="+e.decision+":"+o+", input="+this.parser.getTokenStream().getText(p))}null!==this.parser&&this.parser.getErrorListenerDispatch().reportAttemptingFullContext(this.parser,e,r,n,t,o)},r.prototype.reportContextSensitivity=function(e,t,o,r,n){if(this.debug||this.retry_debug){var p=new A(r,n+1);console.log("reportContextSensitivity decision="+e.decision+":"+o+", input="+this.parser.getTokenStream().getText(p))}null!==this.parser&&this.parser.getErrorListenerDispatch().reportContextSensitivity(this.parser,e,r,n,t,o)},r.prototype.reportAmbiguity=function(e,t,o,r,n,p,a){if(this.debug||this.retry_debug){var i=new A(o,r+1);console.log("reportAmbiguity "+p+":"+a+", input="+this.parser.getTokenStream().getText(i))}null!==this.parser&&this.parser.getErrorListenerDispatch().reportAmbiguity(this.parser,e,o,r,n,p,a)},o.ParserATNSimulator=r},{"./../IntervalSet":14,"./../ParserRuleContext":18,"./../PredictionContext":19,"./../RuleContext":21,"./../Token":22,"./../Utils":23,"./../dfa/DFAState":42,"./../error/Errors":47,"./ATN":24,"./ATNConfig":25,"./ATNConfigSet":26,"./ATNSimulator":29,"./ATNState":30,"./PredictionMode":36,"./SemanticContext":37,"./Transition":38}],36:[function(e,t,o){function r(){return this}var n=e("./../Utils").Set,p=e("./../Utils").Map,a=e("./../Utils").BitSet,i=e("./../Utils").AltDict,s=e("./ATN").ATN,d=e("./ATNState").RuleStopState,l=e("./ATNConfigSet").ATNConfigSet,u=e("./ATNConfig").ATNConfig,y=e("./SemanticContext").SemanticContext,c=e("../Utils").Hash,g=e("./../Utils").hashStuff,T=e("./../Utils").equalArrays;r.SLL=0,r.LL=1,r.LL_EXACT_AMBIG_DETECTION=2,r.hasSLLConflictTerminatingPrediction=function(e,t){if(r.allConfigsInRuleStopStates(t))return!0;if(e===r.SLL&&t.hasSemanticContext){for(var o=new l,n=0,p;n<t.items.length;n++)p=t.items[n],p=new u({semanticContext:y.NONE},p),o.add(p);t=o}var a=r.getConflictingAltSubsets(t);return r.hasConflictingAltSet(a)&&!r.hasStateAssociatedWithOneAlt(t)},r.hasConfigInRuleStopState=function(e){for(var t=0,o;t<e.items.length;t++)if(o=e.items[t],o.state instanceof d)return!0;return!1},r.allConfigsInRuleStopStates=function(e){for(var t=0,o;t<e.items.length;t++)if(o=e.items[t],!(o.state instanceof d))return!1;return!0},r.resolvesToJustOneViableAlt=function(e){return r.getSingleViableAlt(e)},r.allSubsetsConflict=function(e){return!r.hasNonConflictingAltSet(e)},r.hasNonConflictingAltSet=function(e){for(var t=0,o;t<e.length;t++)if(o=e[t],1===o.length)return!0;return!1},r.hasConflictingAltSet=function(e){for(var t=0,o;t<e.length;t++)if(o=e[t],1<o.length)return!0;return!1},r.allSubsetsEqual=function(e){for(var t=null,o=0,r;o<e.length;o++)if(r=e[o],null===t)t=r;else if(r!==t)return!1;return!0},r.getUniqueAlt=function(e){var t=r.getAlts(e);return 1===t.length?t.minValue():s.INVALID_ALT_NUMBER},r.getAlts=function(e){var t=new a;return e.map(function(e){t.or(e)}),t},r.getConflictingAltSubsets=function(e){var t=new p;return t.hashFunction=function(e){g(e.state.stateNumber,e.context)},t.equalsFunction=function(e,t){return e.state.stateNumber==t.state.stateNumber&&e.context.equals(t.context)},e.items.map(function(e){var o=t.get(e);null===o&&(o=new a,t.put(e,o)),o.add(e.alt)}),t.getValues()},r.getStateToAltMap=function(e){var t=new i;return e.items.map(function(e){var o=t.get(e.state);null===o&&(o=new a,t.put(e.state,o)),o.add(e.alt)}),t},r.hasStateAssociatedWithOneAlt=function(e){for(var t=r.getStateToAltMap(e).values(),o=0;o<t.length;o++)if(1===t[o].length)return!0;return!1},r.getSingleViableAlt=function(e){for(var t=null,o=0;o<e.length;o++){var r=e[o],n=r.minValue();if(null===t)t=n;else if(t!==n)return s.INVALID_ALT_NUMBER}return t},o.PredictionMode=r},{"../Utils":23,"./../Utils":23,"./ATN":24,"./ATNConfig":25,"./ATNConfigSet":26,"./ATNState":30,"./SemanticContext":37}],37:[function(e,t,o){function r(){return this}function n(e,t,o){return r.call(this),this.ruleIndex=void 0===e?-1:e,this.predIndex=void 0===t?-1:t,this.isCtxDependent=void 0!==o&&o,this}function p(e){r.call(this),this.precedence=e===void 0?0:e}function i(e,t){r.call(this);var n=new c;e instanceof i?e.opnds.map(function(e){n.add(e)}):n.add(e),t instanceof i?t.opnds.map(function(e){n.add(e)}):n.add(t);var o=p.filterPrecedencePredicates(n);if(0<o.length){var a=null;o.map(function(e){(null===a||e.precedence<a.precedence)&&(a=e)}),n.add(a)}return this.opnds=n.values(),this}function d(e,t){r.call(this);var n=new c;e instanceof d?e.opnds.map(function(e){n.add(e)}):n.add(e),t instanceof d?t.opnds.map(function(e){n.add(e)}):n.add(t);var o=p.filterPrecedencePredicates(n);if(0<o.length){var a=o.sort(function(e,t){return e.compareTo(t)}),i=a[a.length-1];n.add(i)}return this.opnds=n.values(),this}var c=e("./../Utils").Set,a=e("./../Utils").Hash;r.prototype.hashCode=function(){var e=new a;return this.updateHashCode(e),e.finish()},r.prototype.evaluate=function(){},r.prototype.evalPrecedence=function(){return this},r.andContext=function(e,t){if(null===e||e===r.NONE)return t;if(null===t||t===r.NONE)return e;var o=new i(e,t);return 1===o.opnds.length?o.opnds[0]:o},r.orContext=function(e,t){if(null===e)return t;if(null===t)return e;if(e===r.NONE||t===r.NONE)return r.NONE;var o=new d(e,t);return 1===o.opnds.length?o.opnds[0]:o},n.prototype=Object.create(r.prototype),n.prototype.constructor=n,r.NONE=new n,n.prototype.evaluate=function(e,t){var o=this.isCtxDependent?t:null;return e.sempred(o,this.ruleIndex,this.predIndex)},n.prototype.updateHashCode=function(e){e.update(this.ruleIndex,this.predIndex,this.isCtxDependent)},n.prototype.equals=function(e){return!(this!==e)||!!(e instanceof n)&&this.ruleIndex===e.ruleIndex&&this.predIndex===e.predIndex&&this.isCtxDependent===e.isCtxDependent},n.prototype.toString=function(){return"{"+this.ruleIndex+":"+this.predIndex+"}?"},p.prototype=Object.create(r.prototype),p.prototype.constructor=p,p.prototype.evaluate=function(e,t){return e.precpred(t,this.precedence)},p.prototype.evalPrecedence=function(e,t){return e.precpred(t,this.precedence)?r.NONE:null},p.prototype.compareTo=function(e){return this.precedence-e.precedence},p.prototype.updateHashCode=function(e){e.update(31)},p.prototype.equals=function(e){return!(this!==e)||!!(e instanceof p)&&this.precedence===e.precedence},p.prototype.toString=function(){return"{"+this.precedence+">=prec}?"},p.filterPrecedencePredicates=function(e){var t=[];return e.values().map(function(e){e instanceof p&&t.push(e)}),t},i.prototype=Object.create(r.prototype),i.prototype.constructor=i,i.prototype.equals=function(e){return!(this!==e)||!!(e instanceof i)&&this.opnds===e.opnds},i.prototype.updateHashCode=function(e){e.update(this.opnds,"AND")},i.prototype.evaluate=function(e,t){for(var o=0;o<this.opnds.length;o++)if(!this.opnds[o].evaluate(e,t))return!1;return!0},i.prototype.evalPrecedence=function(e,t){for(var o=!1,n=[],p=0;p<this.opnds.length;p++){var a=this.opnds[p],i=a.evalPrecedence(e,t);if(o|=i!==a,null===i)return null;i!==r.NONE&&n.push(i)}if(!o)return this;if(0===n.length)return r.NONE;var s=null;return n.map(function(e){s=null===s?e:r.andContext(s,e)}),s},i.prototype.toString=function(){var e="";return this.opnds.map(function(t){e+="&& "+t.toString()}),3<e.length?e.slice(3):e},d.prototype=Object.create(r.prototype),d.prototype.constructor=d,d.prototype.constructor=function(e){return!(this!==e)||!!(e instanceof d)&&this.opnds===e.opnds},d.prototype.updateHashCode=function(e){e.update(this.opnds,"OR")},d.prototype.evaluate=function(e,t){for(var o=0;o<this.opnds.length;o++)if(this.opnds[o].evaluate(e,t))return!0;return!1},d.prototype.evalPrecedence=function(e,t){for(var o=!1,n=[],p=0;p<this.opnds.length;p++){var a=this.opnds[p],i=a.evalPrecedence(e,t);if(o|=i!==a,i===r.NONE)return r.NONE;null!==i&&n.push(i)}if(!o)return this;if(0===n.length)return null;var s=null;return n.map(function(e){return e}),s},d.prototype.toString=function(){var e="";return this.opnds.map(function(t){e+="|| "+t.toString()}),3<e.length?e.slice(3):e},o.SemanticContext=r,o.PrecedencePredicate=p,o.Predicate=n},{"./../Utils":23}],38:[function(e,t,o){function r(e){if(void 0===e||null===e)throw"target cannot be null.";return this.target=e,this.isEpsilon=!1,this.label=null,this}function n(e,t){return r.call(this,e),this.label_=t,this.label=this.makeLabel(),this.serializationType=r.ATOM,this}function p(e,t,o,n){return r.call(this,e),this.ruleIndex=t,this.precedence=o,this.followState=n,this.serializationType=r.RULE,this.isEpsilon=!0,this}function a(e,t){return r.call(this,e),this.serializationType=r.EPSILON,this.isEpsilon=!0,this.outermostPrecedenceReturn=t,this}function i(e,t,o){return r.call(this,e),this.serializationType=r.RANGE,this.start=t,this.stop=o,this.label=this.makeLabel(),this}function s(e){return r.call(this,e),this}function d(e,t,o,n){return s.call(this,e),this.serializationType=r.PREDICATE,this.ruleIndex=t,this.predIndex=o,this.isCtxDependent=n,this.isEpsilon=!0,this}function c(e,t,o,n){return r.call(this,e),this.serializationType=r.ACTION,this.ruleIndex=t,this.actionIndex=void 0===o?-1:o,this.isCtxDependent=void 0!==n&&n,this.isEpsilon=!0,this}function l(e,t){return r.call(this,e),this.serializationType=r.SET,void 0!==t&&null!==t?this.label=t:(this.label=new _,this.label.addOne(x.INVALID_TYPE)),this}function u(e,t){return l.call(this,e,t),this.serializationType=r.NOT_SET,this}function y(e){return r.call(this,e),this.serializationType=r.WILDCARD,this}function g(e,t){return s.call(this,e),this.serializationType=r.PRECEDENCE,this.precedence=t,this.isEpsilon=!0,this}var T=String.fromCharCode,x=e("./../Token").Token,m=e("./../IntervalSet").Interval,_=e("./../IntervalSet").IntervalSet,S=e("./SemanticContext").Predicate,f=e("./SemanticContext").PrecedencePredicate;r.EPSILON=1,r.RANGE=2,r.RULE=3,r.PREDICATE=4,r.ATOM=5,r.ACTION=6,r.SET=7,r.NOT_SET=8,r.WILDCARD=9,r.PRECEDENCE=10,r.serializationNames=["INVALID","EPSILON","RANGE","RULE","PREDICATE","ATOM","ACTION","SET","NOT_SET","WILDCARD","PRECEDENCE"],r.serializationTypes={EpsilonTransition:r.EPSILON,RangeTransition:r.RANGE,RuleTransition:r.RULE,PredicateTransition:r.PREDICATE,AtomTransition:r.ATOM,ActionTransition:r.ACTION,SetTransition:r.SET,NotSetTransition:r.NOT_SET,WildcardTransition:r.WILDCARD,PrecedencePredicateTransition:r.PRECEDENCE},n.prototype=Object.create(r.prototype),n.prototype.constructor=n,n.prototype.makeLabel=function(){var e=new _;return e.addOne(this.label_),e},n.prototype.matches=function(e){return this.label_===e},n.prototype.toString=function(){return this.label_},p.prototype=Object.create(r.prototype),p.prototype.constructor=p,p.prototype.matches=function(){return!1},a.prototype=Object.create(r.prototype),a.prototype.constructor=a,a.prototype.matches=function(){return!1},a.prototype.toString=function(){return"epsilon"},i.prototype=Object.create(r.prototype),i.prototype.constructor=i,i.prototype.makeLabel=function(){var e=new _;return e.addRange(this.start,this.stop),e},i.prototype.matches=function(e){return e>=this.start&&e<=this.stop},i.prototype.toString=function(){return"'"+T(this.start)+"'..'"+T(this.stop)+"'"},s.prototype=Object.create(r.prototype),s.prototype.constructor=s,d.prototype=Object.create(s.prototype),d.prototype.constructor=d,d.prototype.matches=function(){return!1},d.prototype.getPredicate=function(){return new S(this.ruleIndex,this.predIndex,this.isCtxDependent)},d.prototype.toString=function(){return"pred_"+this.ruleIndex+":"+this.predIndex},c.prototype=Object.create(r.prototype),c.prototype.constructor=c,c.prototype.matches=function(){return!1},c.prototype.toString=function(){return"action_"+this.ruleIndex+":"+this.actionIndex},l.prototype=Object.create(r.prototype),l.prototype.constructor=l,l.prototype.matches=function(e){return this.label.contains(e)},l.prototype.toString=function(){return this.label.toString()},u.prototype=Object.create(l.prototype),u.prototype.constructor=u,u.prototype.matches=function(e,t,o){return e>=t&&e<=o&&!l.prototype.matches.call(this,e,t,o)},u.prototype.toString=function(){return"~"+l.prototype.toString.call(this)},y.prototype=Object.create(r.prototype),y.prototype.constructor=y,y.prototype.matches=function(e,t,o){return e>=t&&e<=o},y.prototype.toString=function(){return"."},g.prototype=Object.create(s.prototype),g.prototype.constructor=g,g.prototype.matches=function(){return!1},g.prototype.getPredicate=function(){return new f(this.precedence)},g.prototype.toString=function(){return this.precedence+" >= _p"},o.Transition=r,o.AtomTransition=n,o.SetTransition=l,o.NotSetTransition=u,o.RuleTransition=p,o.ActionTransition=c,o.EpsilonTransition=a,o.RangeTransition=i,o.WildcardTransition=y,o.PredicateTransition=d,o.PrecedencePredicateTransition=g,o.AbstractPredicateTransition=s},{"./../IntervalSet":14,"./../Token":22,"./SemanticContext":37}],39:[function(e,t,o){o.ATN=e("./ATN").ATN,o.ATNDeserializer=e("./ATNDeserializer").ATNDeserializer,o.LexerATNSimulator=e("./LexerATNSimulator").LexerATNSimulator,o.ParserATNSimulator=e("./ParserATNSimulator").ParserATNSimulator,o.PredictionMode=e("./PredictionMode").PredictionMode},{"./ATN":24,"./ATNDeserializer":28,"./LexerATNSimulator":32,"./ParserATNSimulator":35,"./PredictionMode":36}],40:[function(e,t,o){function r(e,t){if(void 0===t&&(t=0),this.atnStartState=e,this.decision=t,this._states=new n,this.s0=null,this.precedenceDfa=!1,e instanceof a&&e.isPrecedenceDecision){this.precedenceDfa=!0;var o=new p(null,new i());o.edges=[],o.isAcceptState=!1,o.requiresFullContext=!1,this.s0=o}return this}var n=e("../Utils").Set,p=e("./DFAState").DFAState,a=e("../atn/ATNState").StarLoopEntryState,i=e("./../atn/ATNConfigSet").ATNConfigSet,s=e("./DFASerializer").DFASerializer,d=e("./DFASerializer").LexerDFASerializer;r.prototype.getPrecedenceStartState=function(e){if(!this.precedenceDfa)throw"Only precedence DFAs may contain a precedence start state.";return 0>e||e>=this.s0.edges.length?null:this.s0.edges[e]||null},r.prototype.setPrecedenceStartState=function(e,t){if(!this.precedenceDfa)throw"Only precedence DFAs may contain a precedence start state.";0>e||(this.s0.edges[e]=t)},r.prototype.setPrecedenceDfa=function(e){if(this.precedenceDfa!==e){if(this._states=new DFAStatesSet,e){var t=new p(null,new i());t.edges=[],t.isAcceptState=!1,t.requiresFullContext=!1,this.s0=t}else this.s0=null;this.precedenceDfa=e}},Object.defineProperty(r.prototype,"states",{get:function(){return this._states}}),r.prototype.sortedStates=function(){var e=this._states.values();return e.sort(function(e,t){return e.stateNumber-t.stateNumber})},r.prototype.toString=function(e,t){if(e=e||null,t=t||null,null===this.s0)return"";var o=new s(this,e,t);return o.toString()},r.prototype.toLexerString=function(){if(null===this.s0)return"";var e=new d(this);return e.toString()},o.DFA=r},{"../Utils":23,"../atn/ATNState":30,"./../atn/ATNConfigSet":26,"./DFASerializer":41,"./DFAState":42}],41:[function(e,t,o){function r(e,t,o){return this.dfa=e,this.literalNames=t||[],this.symbolicNames=o||[],this}function n(e){return r.call(this,e,null),this}var p=String.fromCharCode;r.prototype.toString=function(){if(null===this.dfa.s0)return null;for(var e="",o=this.dfa.sortedStates(),r=0,p;r<o.length;r++)if(p=o[r],null!==p.edges)for(var a=p.edges.length,n=0,i;n<a;n++)i=p.edges[n]||null,null!==i&&2147483647!==i.stateNumber&&(e=e.concat(this.getStateString(p)),e=e.concat("-"),e=e.concat(this.getEdgeLabel(n)),e=e.concat("->"),e=e.concat(this.getStateString(i)),e=e.concat("\n"));return 0===e.length?null:e},r.prototype.getEdgeLabel=function(e){return 0===e?"EOF":null!==this.literalNames||null!==this.symbolicNames?this.literalNames[e-1]||this.symbolicNames[e-1]:p(e-1)},r.prototype.getStateString=function(e){var t=(e.isAcceptState?":":"")+"s"+e.stateNumber+(e.requiresFullContext?"^":"");return e.isAcceptState?null===e.predicates?t+"=>"+e.prediction.toString():t+"=>"+e.predicates.toString():t},n.prototype=Object.create(r.prototype),n.prototype.constructor=n,n.prototype.getEdgeLabel=function(e){return"'"+p(e)+"'"},o.DFASerializer=r,o.LexerDFASerializer=n},{}],42:[function(e,t,o){function r(e,t){return this.alt=t,this.pred=e,this}function n(e,t){return null===e&&(e=-1),null===t&&(t=new p),this.stateNumber=e,this.configs=t,this.edges=null,this.isAcceptState=!1,this.prediction=0,this.lexerActionExecutor=null,this.requiresFullContext=!1,this.predicates=null,this}var p=e("./../atn/ATNConfigSet").ATNConfigSet,a=e("./../Utils"),i=a.Hash,s=a.Set;r.prototype.toString=function(){return"("+this.pred+", "+this.alt+")"},n.prototype.getAltSet=function(){var e=new s;if(null!==this.configs)for(var t=0,o;t<this.configs.length;t++)o=this.configs[t],e.add(o.alt);return 0===e.length?null:e},n.prototype.equals=function(e){return this===e||e instanceof n&&this.configs.equals(e.configs)},n.prototype.toString=function(){var e=""+this.stateNumber+":"+this.configs;return this.isAcceptState&&(e+="=>",e+=null===this.predicates?this.prediction:this.predicates),e},n.prototype.hashCode=function(){var e=new i;return e.update(this.configs),this.isAcceptState&&(null===this.predicates?e.update(this.prediction):e.update(this.predicates)),e.finish()},o.DFAState=n,o.PredPrediction=r},{"./../Utils":23,"./../atn/ATNConfigSet":26}],43:[function(e,t,o){o.DFA=e("./DFA").DFA,o.DFASerializer=e("./DFASerializer").DFASerializer,o.LexerDFASerializer=e("./DFASerializer").LexerDFASerializer,o.PredPrediction=e("./DFAState").PredPrediction},{"./DFA":40,"./DFASerializer":41,"./DFAState":42}],44:[function(e,t,o){function r(e){return p.call(this),e=e||!0,this.exactOnly=e,this}var n=e("./../Utils").BitSet,p=e("./ErrorListener").ErrorListener,a=e("./../IntervalSet").Interval;r.prototype=Object.create(p.prototype),r.prototype.constructor=r,r.prototype.reportAmbiguity=function(e,t,o,r,n,p,i){if(!this.exactOnly||n){var s="reportAmbiguity d="+this.getDecisionDescription(e,t)+": ambigAlts="+this.getConflictingAlts(p,i)+", input='"+e.getTokenStream().getText(new a(o,r))+"'";e.notifyErrorListeners(s)}},r.prototype.reportAttemptingFullContext=function(e,t,o,r){var n="reportAttemptingFullContext d="+this.getDecisionDescription(e,t)+", input='"+e.getTokenStream().getText(new a(o,r))+"'";e.notifyErrorListeners(n)},r.prototype.reportContextSensitivity=function(e,t,o,r){var n="reportContextSensitivity d="+this.getDecisionDescription(e,t)+", input='"+e.getTokenStream().getText(new a(o,r))+"'";e.notifyErrorListeners(n)},r.prototype.getDecisionDescription=function(e,t){var o=t.decision,r=t.atnStartState.ruleIndex,n=e.ruleNames;if(0>r||r>=n.length)return""+o;var p=n[r]||null;return null===p||0===p.length?""+o:""+o+" ("+p+")"},r.prototype.getConflictingAlts=function(e,t){if(null!==e)return e;for(var o=new n,r=0;r<t.items.length;r++)o.add(t.items[r].alt);return"{"+o.values().join(", ")+"}"},o.DiagnosticErrorListener=r},{"./../IntervalSet":14,"./../Utils":23,"./ErrorListener":45}],45:[function(e,t,o){function r(){return this}function n(){return r.call(this),this}function p(e){if(r.call(this),null===e)throw"delegates";return this.delegates=e,this}r.prototype.syntaxError=function(){},r.prototype.reportAmbiguity=function(){},r.prototype.reportAttemptingFullContext=function(){},r.prototype.reportContextSensitivity=function(){},n.prototype=Object.create(r.prototype),n.prototype.constructor=n,n.INSTANCE=new n,n.prototype.syntaxError=function(e,t,o,r,n){console.error("line "+o+":"+r+" "+n)},p.prototype=Object.create(r.prototype),p.prototype.constructor=p,p.prototype.syntaxError=function(t,o,r,n,p,a){this.delegates.map(function(e){e.syntaxError(t,o,r,n,p,a)})},p.prototype.reportAmbiguity=function(e,t,o,r,n,p,a){this.delegates.map(function(i){i.reportAmbiguity(e,t,o,r,n,p,a)})},p.prototype.reportAttemptingFullContext=function(e,t,o,r,n,p){this.delegates.map(function(a){a.reportAttemptingFullContext(e,t,o,r,n,p)})},p.prototype.reportContextSensitivity=function(e,t,o,r,n,p){this.delegates.map(function(a){a.reportContextSensitivity(e,t,o,r,n,p)})},o.ErrorListener=r,o.ConsoleErrorListener=n,o.ProxyErrorListener=p},{}],46:[function(e,t,o){function r(){}function n(){return r.call(this),this.errorRecoveryMode=!1,this.lastErrorIndex=-1,this.lastErrorStates=null,this}function p(){return n.call(this),this}var a=e("./../Token").Token,i=e("./Errors"),s=i.NoViableAltException,d=i.InputMismatchException,c=i.FailedPredicateException,l=i.ParseCancellationException,u=e("./../atn/ATNState").ATNState,y=e("./../IntervalSet").Interval,g=e("./../IntervalSet").IntervalSet;r.prototype.reset=function(){},r.prototype.recoverInline=function(){},r.prototype.recover=function(){},r.prototype.sync=function(){},r.prototype.inErrorRecoveryMode=function(){},r.prototype.reportError=function(){},n.prototype=Object.create(r.prototype),n.prototype.constructor=n,n.prototype.reset=function(e){this.endErrorCondition(e)},n.prototype.beginErrorCondition=function(){this.errorRecoveryMode=!0},n.prototype.inErrorRecoveryMode=function(){return this.errorRecoveryMode},n.prototype.endErrorCondition=function(){this.errorRecoveryMode=!1,this.lastErrorStates=null,this.lastErrorIndex=-1},n.prototype.reportMatch=function(e){this.endErrorCondition(e)},n.prototype.reportError=function(t,o){this.inErrorRecoveryMode(t)||(this.beginErrorCondition(t),o instanceof s?this.reportNoViableAlternative(t,o):o instanceof d?this.reportInputMismatch(t,o):o instanceof c?this.reportFailedPredicate(t,o):(console.log("unknown recognition error type: "+o.constructor.name),console.log(o.stack),t.notifyErrorListeners(o.getOffendingToken(),o.getMessage(),o)))},n.prototype.recover=function(e){this.lastErrorIndex===e.getInputStream().index&&null!==this.lastErrorStates&&0<=this.lastErrorStates.indexOf(e.state)&&e.consume(),this.lastErrorIndex=e._input.index,null===this.lastErrorStates&&(this.lastErrorStates=[]),this.lastErrorStates.push(e.state);var t=this.getErrorRecoverySet(e);this.consumeUntil(e,t)},n.prototype.sync=function(e){if(!this.inErrorRecoveryMode(e)){var t=e._interp.atn.states[e.state],o=e.getTokenStream().LA(1),r=e.atn.nextTokens(t);if(!(r.contains(a.EPSILON)||r.contains(o)))switch(t.stateType){case u.BLOCK_START:case u.STAR_BLOCK_START:case u.PLUS_BLOCK_START:case u.STAR_LOOP_ENTRY:if(null!==this.singleTokenDeletion(e))return;throw new d(e);break;case u.PLUS_LOOP_BACK:case u.STAR_LOOP_BACK:this.reportUnwantedToken(e);var n=new g;n.addSet(e.getExpectedTokens());var p=n.addSet(this.getErrorRecoverySet(e));this.consumeUntil(e,p);break;default:}}},n.prototype.reportNoViableAlternative=function(t,o){var e=t.getTokenStream(),r;r=null===e?"<unknown input>":o.startToken.type===a.EOF?"<EOF>":e.getText(new y(o.startToken.tokenIndex,o.offendingToken.tokenIndex));var n="no viable alternative at input "+this.escapeWSAndQuote(r);t.notifyErrorListeners(n,o.offendingToken,o)},n.prototype.reportInputMismatch=function(t,o){var e="mismatched input "+this.getTokenErrorDisplay(o.offendingToken)+" expecting "+o.getExpectedTokens().toString(t.literalNames,t.symbolicNames);t.notifyErrorListeners(e,o.offendingToken,o)},n.prototype.reportFailedPredicate=function(t,o){var e=t.ruleNames[t._ctx.ruleIndex],r="rule "+e+" "+o.message;t.notifyErrorListeners(r,o.offendingToken,o)},n.prototype.reportUnwantedToken=function(e){if(!this.inErrorRecoveryMode(e)){this.beginErrorCondition(e);var o=e.getCurrentToken(),t=this.getTokenErrorDisplay(o),r=this.getExpectedTokens(e),n="extraneous input "+t+" expecting "+r.toString(e.literalNames,e.symbolicNames);e.notifyErrorListeners(n,o,null)}},n.prototype.reportMissingToken=function(e){if(!this.inErrorRecoveryMode(e)){this.beginErrorCondition(e);var o=e.getCurrentToken(),t=this.getExpectedTokens(e),r="missing "+t.toString(e.literalNames,e.symbolicNames)+" at "+this.getTokenErrorDisplay(o);e.notifyErrorListeners(r,o,null)}},n.prototype.recoverInline=function(e){var t=this.singleTokenDeletion(e);if(null!==t)return e.consume(),t;if(this.singleTokenInsertion(e))return this.getMissingSymbol(e);throw new d(e)},n.prototype.singleTokenInsertion=function(e){var t=e.getTokenStream().LA(1),o=e._interp.atn,r=o.states[e.state],n=r.transitions[0].target,p=o.nextTokens(n,e._ctx);return!!p.contains(t)&&(this.reportMissingToken(e),!0)},n.prototype.singleTokenDeletion=function(e){var t=e.getTokenStream().LA(2),o=this.getExpectedTokens(e);if(o.contains(t)){this.reportUnwantedToken(e),e.consume();var r=e.getCurrentToken();return this.reportMatch(e),r}return null},n.prototype.getMissingSymbol=function(e){var t=e.getCurrentToken(),o=this.getExpectedTokens(e),r=o.first(),n;n=r===a.EOF?"<missing EOF>":"<missing "+e.literalNames[r]+">";var p=t,i=e.getTokenStream().LT(-1);return p.type===a.EOF&&null!==i&&(p=i),e.getTokenFactory().create(p.source,r,n,a.DEFAULT_CHANNEL,-1,-1,p.line,p.column)},n.prototype.getExpectedTokens=function(e){return e.getExpectedTokens()},n.prototype.getTokenErrorDisplay=function(e){if(null===e)return"<no token>";var t=e.text;return null===t&&(e.type===a.EOF?t="<EOF>":t="<"+e.type+">"),this.escapeWSAndQuote(t)},n.prototype.escapeWSAndQuote=function(e){return e=e.replace(/\n/g,"\\n"),e=e.replace(/\r/g,"\\r"),e=e.replace(/\t/g,"\\t"),"'"+e+"'"},n.prototype.getErrorRecoverySet=function(e){for(var t=e._interp.atn,o=e._ctx,r=new g;null!==o&&0<=o.invokingState;){var n=t.states[o.invokingState],p=n.transitions[0],i=t.nextTokens(p.followState);r.addSet(i),o=o.parentCtx}return r.removeOne(a.EPSILON),r},n.prototype.consumeUntil=function(e,t){for(var o=e.getTokenStream().LA(1);o!==a.EOF&&!t.contains(o);)e.consume(),o=e.getTokenStream().LA(1)},p.prototype=Object.create(n.prototype),p.prototype.constructor=p,p.prototype.recover=function(t,o){for(var e=t._ctx;null!==e;)e.exception=o,e=e.parentCtx;throw new l(o)},p.prototype.recoverInline=function(e){this.recover(e,new d(e))},p.prototype.sync=function(){},o.BailErrorStrategy=p,o.DefaultErrorStrategy=n},{"./../IntervalSet":14,"./../Token":22,"./../atn/ATNState":30,"./Errors":47}],47:[function(e,t,o){function r(e){if(Error.call(this),!!Error.captureStackTrace)Error.captureStackTrace(this,r);else new Error().stack;return this.message=e.message,this.recognizer=e.recognizer,this.input=e.input,this.ctx=e.ctx,this.offendingToken=null,this.offendingState=-1,null!==this.recognizer&&(this.offendingState=this.recognizer.state),this}function n(e,t,o,n){return r.call(this,{message:"",recognizer:e,input:t,ctx:null}),this.startIndex=o,this.deadEndConfigs=n,this}function p(e,t,o,n,p,a){a=a||e._ctx,n=n||e.getCurrentToken(),o=o||e.getCurrentToken(),t=t||e.getInputStream(),r.call(this,{message:"",recognizer:e,input:t,ctx:a}),this.deadEndConfigs=p,this.startToken=o,this.offendingToken=n}function a(e){r.call(this,{message:"",recognizer:e,input:e.getInputStream(),ctx:e._ctx}),this.offendingToken=e.getCurrentToken()}function i(e,t,o){r.call(this,{message:this.formatMessage(t,o||null),recognizer:e,input:e.getInputStream(),ctx:e._ctx});var n=e._interp.atn.states[e.state],p=n.transitions[0];return p instanceof d?(this.ruleIndex=p.ruleIndex,this.predicateIndex=p.predIndex):(this.ruleIndex=0,this.predicateIndex=0),this.predicate=t,this.offendingToken=e.getCurrentToken(),this}function s(){return Error.call(this),Error.captureStackTrace(this,s),this}var d=e("./../atn/Transition").PredicateTransition;r.prototype=Object.create(Error.prototype),r.prototype.constructor=r,r.prototype.getExpectedTokens=function(){return null===this.recognizer?null:this.recognizer.atn.getExpectedTokens(this.offendingState,this.ctx)},r.prototype.toString=function(){return this.message},n.prototype=Object.create(r.prototype),n.prototype.constructor=n,n.prototype.toString=function(){var e="";return 0<=this.startIndex&&this.startIndex<this.input.size&&(e=this.input.getText((this.startIndex,this.startIndex))),"LexerNoViableAltException"+e},p.prototype=Object.create(r.prototype),p.prototype.constructor=p,a.prototype=Object.create(r.prototype),a.prototype.constructor=a,i.prototype=Object.create(r.prototype),i.prototype.constructor=i,i.prototype.formatMessage=function(e,t){return null===t?"failed predicate: {"+e+"}?":t},s.prototype=Object.create(Error.prototype),s.prototype.constructor=s,o.RecognitionException=r,o.NoViableAltException=p,o.LexerNoViableAltException=n,o.InputMismatchException=a,o.FailedPredicateException=i,o.ParseCancellationException=s},{"./../atn/Transition":38}],48:[function(e,t,o){o.RecognitionException=e("./Errors").RecognitionException,o.NoViableAltException=e("./Errors").NoViableAltException,o.LexerNoViableAltException=e("./Errors").LexerNoViableAltException,o.InputMismatchException=e("./Errors").InputMismatchException,o.FailedPredicateException=e("./Errors").FailedPredicateException,o.DiagnosticErrorListener=e("./DiagnosticErrorListener").DiagnosticErrorListener,o.BailErrorStrategy=e("./ErrorStrategy").BailErrorStrategy,o.ErrorListener=e("./ErrorListener").ErrorListener},{"./DiagnosticErrorListener":44,"./ErrorListener":45,"./ErrorStrategy":46,"./Errors":47}],49:[function(e,t,o){o.atn=e("./atn/index"),o.codepointat=e("./polyfills/codepointat"),o.dfa=e("./dfa/index"),o.fromcodepoint=e("./polyfills/fromcodepoint"),o.tree=e("./tree/index"),o.error=e("./error/index"),o.Token=e("./Token").Token,o.CharStreams=e("./CharStreams").CharStreams,o.CommonToken=e("./Token").CommonToken,o.InputStream=e("./InputStream").InputStream,o.FileStream=e("./FileStream").FileStream,o.CommonTokenStream=e("./CommonTokenStream").CommonTokenStream,o.Lexer=e("./Lexer").Lexer,o.Parser=e("./Parser").Parser;var r=e("./PredictionContext");o.PredictionContextCache=r.PredictionContextCache,o.ParserRuleContext=e("./ParserRuleContext").ParserRuleContext,o.Interval=e("./IntervalSet").Interval,o.Utils=e("./Utils")},{"./CharStreams":9,"./CommonTokenStream":11,"./FileStream":12,"./InputStream":13,"./IntervalSet":14,"./Lexer":16,"./Parser":17,"./ParserRuleContext":18,"./PredictionContext":19,"./Token":22,"./Utils":23,"./atn/index":39,"./dfa/index":43,"./error/index":48,"./polyfills/codepointat":50,"./polyfills/fromcodepoint":51,"./tree/index":54}],50:[function(){var e=String.prototype;e.codePointAt||function(){"use strict";var t=function(){try{var e={},t=Object.defineProperty,o=t(e,e,e)&&t}catch(e){}return o}(),o=function(e){if(null==this)throw TypeError();var t=this+"",o=t.length,r=e?+e:0;if(r!=r&&(r=0),!(0>r||r>=o)){var n=t.charCodeAt(r),p;return 55296<=n&&56319>=n&&o>r+1&&(p=t.charCodeAt(r+1),56320<=p&&57343>=p)?1024*(n-55296)+p-56320+65536:n}};t?t(String.prototype,"codePointAt",{value:o,configurable:!0,writable:!0}):e.codePointAt=o}()},{}],51:[function(){var e=String.fromCodePoint;e||function(){var t=function(){try{var e={},t=Object.defineProperty,o=t(e,e,e)&&t}catch(e){}return o}(),o=String.fromCharCode,r=Math.floor,n=function(){var e=[],t=-1,n=arguments.length,p,a;if(!n)return"";for(var i="";++t<n;){var s=+arguments[t];if(!isFinite(s)||0>s||1114111<s||r(s)!=s)throw RangeError("Invalid code point: "+s);65535>=s?e.push(s):(s-=65536,p=(s>>10)+55296,a=s%1024+56320,e.push(p,a)),(t+1==n||e.length>16384)&&(i+=o.apply(null,e),e.length=0)}return i};t?t(String,"fromCodePoint",{value:n,configurable:!0,writable:!0}):e=n}()},{}],52:[function(e,t,o){function r(){return this}function n(){return r.call(this),this}function p(){return n.call(this),this}function a(){return p.call(this),this}function s(){return p.call(this),this}function d(){return s.call(this),this}function i(){return this}function c(){return this}function l(e){return s.call(this),this.parentCtx=null,this.symbol=e,this}function u(e){return l.call(this,e),this}function y(){return this}var g=e("./../Token").Token,T=e("./../IntervalSet").Interval,x=new T(-1,-2),m=e("../Utils.js");n.prototype=Object.create(r.prototype),n.prototype.constructor=n,p.prototype=Object.create(n.prototype),p.prototype.constructor=p,a.prototype=Object.create(p.prototype),a.prototype.constructor=a,s.prototype=Object.create(p.prototype),s.prototype.constructor=s,d.prototype=Object.create(s.prototype),d.prototype.constructor=d,i.prototype.visit=function(e){return Array.isArray(e)?e.map(function(e){return e.accept(this)},this):e.accept(this)},i.prototype.visitChildren=function(e){return this.visit(e.children)},i.prototype.visitTerminal=function(){},i.prototype.visitErrorNode=function(){},c.prototype.visitTerminal=function(){},c.prototype.visitErrorNode=function(){},c.prototype.enterEveryRule=function(){},c.prototype.exitEveryRule=function(){},l.prototype=Object.create(s.prototype),l.prototype.constructor=l,l.prototype.getChild=function(){return null},l.prototype.getSymbol=function(){return this.symbol},l.prototype.getParent=function(){return this.parentCtx},l.prototype.getPayload=function(){return this.symbol},l.prototype.getSourceInterval=function(){if(null===this.symbol)return x;var e=this.symbol.tokenIndex;return new T(e,e)},l.prototype.getChildCount=function(){return 0},l.prototype.accept=function(e){return e.visitTerminal(this)},l.prototype.getText=function(){return this.symbol.text},l.prototype.toString=function(){return this.symbol.type===g.EOF?"<EOF>":this.symbol.text},u.prototype=Object.create(l.prototype),u.prototype.constructor=u,u.prototype.isErrorNode=function(){return!0},u.prototype.accept=function(e){return e.visitErrorNode(this)},y.prototype.walk=function(e,o){var t=o instanceof d||o.isErrorNode!==void 0&&o.isErrorNode();if(t)e.visitErrorNode(o);else if(o instanceof s)e.visitTerminal(o);else{this.enterRule(e,o);for(var r=0,n;r<o.getChildCount();r++)n=o.getChild(r),this.walk(e,n);this.exitRule(e,o)}},y.prototype.enterRule=function(e,t){var o=t.getRuleContext();e.enterEveryRule(o),o.enterRule(e)},y.prototype.exitRule=function(e,t){var o=t.getRuleContext();o.exitRule(e),e.exitEveryRule(o)},y.DEFAULT=new y,o.RuleNode=a,o.ErrorNode=d,o.TerminalNode=s,o.ErrorNodeImpl=u,o.TerminalNodeImpl=l,o.ParseTreeListener=c,o.ParseTreeVisitor=i,o.ParseTreeWalker=y,o.INVALID_INTERVAL=x},{"../Utils.js":23,"./../IntervalSet":14,"./../Token":22}],53:[function(e,t,o){function r(){}var n=e("./../Utils"),p=e("./../Token").Token,a=e("./Tree").RuleNode,i=e("./Tree").ErrorNode,s=e("./Tree").TerminalNode,d=e("./../ParserRuleContext").ParserRuleContext,c=e("./../RuleContext").RuleContext,l=e("./../atn/ATN").INVALID_ALT_NUMBER;r.toStringTree=function(e,t,o){t=t||null,o=o||null,null!==o&&(t=o.ruleNames);var p=r.getNodeText(e,t);p=n.escapeWhitespace(p,!1);var a=e.getChildCount();if(0===a)return p;var s="("+p+" ";0<a&&(p=r.toStringTree(e.getChild(0),t),s=s.concat(p));for(var d=1;d<a;d++)p=r.toStringTree(e.getChild(d),t),s=s.concat(" "+p);return s=s.concat(")"),s},r.getNodeText=function(e,t,o){if(t=t||null,o=o||null,null!==o&&(t=o.ruleNames),null!==t){if(e instanceof c){var r=e.getAltNumber();return r==l?t[e.ruleIndex]:t[e.ruleIndex]+":"+r}if(e instanceof i)return e.toString();if(e instanceof s&&null!==e.symbol)return e.symbol.text}var n=e.getPayload();return n instanceof p?n.text:e.getPayload().toString()},r.getChildren=function(e){for(var t=[],o=0;o<e.getChildCount();o++)t.push(e.getChild(o));return t},r.getAncestors=function(e){var t=[];for(e=e.getParent();null!==e;)t=[e].concat(t),e=e.getParent();return t},r.findAllTokenNodes=function(e,t){return r.findAllNodes(e,t,!0)},r.findAllRuleNodes=function(e,t){return r.findAllNodes(e,t,!1)},r.findAllNodes=function(e,t,o){var n=[];return r._findAllNodes(e,t,o,n),n},r._findAllNodes=function(e,t,o,n){o&&e instanceof s?e.symbol.type===t&&n.push(e):!o&&e instanceof d&&e.ruleIndex===t&&n.push(e);for(var p=0;p<e.getChildCount();p++)r._findAllNodes(e.getChild(p),t,o,n)},r.descendants=function(e){for(var t=[e],o=0;o<e.getChildCount();o++)t=t.concat(r.descendants(e.getChild(o)));return t},o.Trees=r},{"./../ParserRuleContext":18,"./../RuleContext":21,"./../Token":22,"./../Utils":23,"./../atn/ATN":24,"./Tree":52}],54:[function(e,t,o){var r=e("./Tree");o.Trees=e("./Trees").Trees,o.RuleNode=r.RuleNode,o.ParseTreeListener=r.ParseTreeListener,o.ParseTreeVisitor=r.ParseTreeVisitor,o.ParseTreeWalker=r.ParseTreeWalker},{"./Tree":52,"./Trees":53}],55:[function(){},{}]},{},[4]);
\ No newline at end of file
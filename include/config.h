@@ -23,11 +23,19 @@ typedef struct config_t {
 	uint32_t motor_tick_interval;   // The number of ms in each interval of the stepper motor timer.
 	uint32_t acceleration_duration; // The number of ticks taken to ramp up to full speed.
 	uint32_t move_pause_duration;   // The number of ms to pause after a motor movement.
+	uint32_t exec_time_budget;      // The number of us the VM may execute instructions for per task.
+	uint32_t telemetry_rate;        // The maximum number of program status updates sent per second.
+	uint32_t hardware_tick_interval; // The number of us in each interval of the hardware stepper
+	                                 // motor timer, or 0 to use the ms stepper motor timer.
+	uint32_t full_step_travel;      // 1 to move in full steps whilst the pen is up, 0 for half steps.
+	uint32_t servo_overlap;         // 1 to move the pen whilst travelling, 0 to only move it whilst
+	                                // the turtle is stationary.
 } config_t;
 
 /*
  * Retrieves the values for the number of steps for each motor to move 100mm. The values are written
- * to the supplied pointers.
+ * to the supplied pointers. All step counts are in half steps, which the motors convert when
+ * moving in full steps.
  */
 void get_straight_steps(uint32_t *left, uint32_t *right);
 
@@ -72,6 +80,36 @@ uint32_t get_acceleration_duration();
  */
 uint32_t get_move_pause_duration();
 
+/*
+ * Retrieves the value for the VM execution time budget, in microseconds.
+ */
+uint32_t get_exec_time_budget();
+
+/*
+ * Retrieves the value for the maximum program status telemetry rate, in Hz.
+ */
+uint32_t get_telemetry_rate();
+
+/*
+ * Retrieves the value for the hardware stepper motor timer interval, in microseconds. A value of 0
+ * means the stepper motors are driven by the software timer with the motor tick interval instead.
+ * The hardware timer (FRC1) is also used by the servo's PWM, so the value is ignored whilst the
+ * servo's PWM is running.
+ */
+uint32_t get_hardware_tick_interval();
+
+/*
+ * Retrieves whether the stepper motors move in full steps, rather than half steps, whilst the pen is
+ * up.
+ */
+bool get_full_step_travel();
+
+/*
+ * Retrieves whether the pen servo is moved whilst the turtle is travelling, lifting the pen as the
+ * travel starts and lowering it as the travel stops, rather than between the movements.
+ */
+bool get_servo_overlap();
+
 /*
  * Retrieves the values for the current configuration.
  */
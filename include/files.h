@@ -57,6 +57,12 @@ int ICACHE_FLASH_ATTR list_files(file_t *files, uint8_t file_count);
  */
 bool ICACHE_FLASH_ATTR load_file(uint8_t file_number, char *contents, uint32_t offset, uint32_t max_size);
 
+/*
+ * Retrieves the flash memory address of a file's contents, and its size in bytes.
+ * Returns 0 if the file is not in use.
+ */
+uint32_t ICACHE_FLASH_ATTR get_file_address(uint8_t file_number, uint32_t *size);
+
 /*
  * Prepares the storage to hold a new file.
  */
@@ -0,0 +1,60 @@
+/*
+ * json_writer.h: Lightweight way to format JSON into a caller-provided fixed size buffer, without
+ * any memory allocation.
+ *
+ * The writer doesn't track the JSON's structure: literal text (keys, punctuation) is written with
+ * json_write_raw, and values with the typed helpers. Once anything doesn't fit in the buffer, the
+ * writer is marked as overflowed and everything after is dropped, so callers need only check
+ * json_writer.overflow once all the JSON has been written.
+ *
+ * Author: Ian Marshall
+ * Date: 16/10/2026
+ */
+#ifndef _JSON_WRITER_H
+#define _JSON_WRITER_H
+
+#include "ets_sys.h"
+#include "osapi.h"
+#include "os_type.h"
+#include "espmissingincludes.h"
+
+/*
+ * Structure for JSON writers.
+ */
+typedef struct json_writer {
+	char *buf;     // The buffer that holds the JSON. This will always be a valid C string.
+	int size;      // The size of the buffer, including the NULL terminator.
+	int len;       // The number of characters written, *NOT* including the NULL terminator.
+	bool overflow; // Flag set once something hasn't fitted in the buffer.
+} json_writer;
+
+/*
+ * Initialises a JSON writer to write into a buffer of the given size, which must be at least 1.
+ */
+void ICACHE_FLASH_ATTR init_json_writer(json_writer *jw, char *buf, int size);
+
+/*
+ * Writes literal text, such as keys and punctuation, without escaping it.
+ * Returns false if the writer has overflowed.
+ */
+bool ICACHE_FLASH_ATTR json_write_raw(json_writer *jw, const char *str);
+
+/*
+ * Writes a string value, quoted and with any characters that JSON requires escaped.
+ * Returns false if the writer has overflowed.
+ */
+bool ICACHE_FLASH_ATTR json_write_string(json_writer *jw, const char *str);
+
+/*
+ * Writes a 32-bit signed integer value.
+ * Returns false if the writer has overflowed.
+ */
+bool ICACHE_FLASH_ATTR json_write_int32(json_writer *jw, int32_t val);
+
+/*
+ * Writes a 32-bit unsigned integer value.
+ * Returns false if the writer has overflowed.
+ */
+bool ICACHE_FLASH_ATTR json_write_uint32(json_writer *jw, uint32_t val);
+
+#endif
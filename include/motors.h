@@ -8,12 +8,71 @@
 #ifndef _MOTORS_H
 #define _MOTORS_H
 
+// Define MOTOR_TRACE (e.g. with -DMOTOR_TRACE in the build's CFLAGS) to record the most recent step
+// events in a trace, which can be downloaded from /trace.cgi. It is a debugging aid, off by default,
+// as recording takes a few cycles per step and MOTOR_TRACE_COUNT * 4 bytes of memory.
+//#define MOTOR_TRACE
+
+// The number of step events held by the trace. This must be a power of two.
+#define MOTOR_TRACE_COUNT 2048
+
 // Definition of callback function for motor movement completion events.
 typedef void motor_callback_t();
 
 // Type to hold the position of the servo holding the pen.
 typedef enum servo_position_t {UP, DOWN} servo_position_t;
 
+// The types of motion that can be queued for the motors.
+typedef enum motion_type_t {
+	MOTION_STEPS,
+	MOTION_PEN_UP,
+	MOTION_PEN_DOWN,
+	MOTION_PAUSE
+} motion_type_t;
+
+// Type to hold a motion queued for the motors, tagged with the location that requested it.
+typedef struct motion_t {
+	motion_type_t type;  // The type of motion.
+	int32_t left_steps;  // The number of steps for the left stepper motor (MOTION_STEPS).
+	int32_t right_steps; // The number of steps for the right stepper motor (MOTION_STEPS).
+	uint32_t duration;   // The duration of the pause in ms (MOTION_PAUSE).
+	uint16_t func;       // The ID of the function that queued the motion.
+	uint16_t offset;     // The offset of the instruction that queued the motion.
+} motion_t;
+
+// Definition of callback function for queued motion start events.
+typedef void motion_callback_t(const motion_t *motion);
+
+// Definition of the function called on each tick of the motor control's tick source.
+typedef void motor_tick_t(void *arg);
+
+// Type to hold a source of motor control ticks, which calls a tick function at a fixed interval.
+typedef struct tick_source_t {
+	void (*start)(uint32_t interval, motor_tick_t *tick); // Starts the ticks, interval is in µs.
+	void (*stop)();                                        // Stops the ticks.
+} tick_source_t;
+
+// Type to hold the estimated duration of a motion.
+typedef struct motion_estimate_t {
+	uint32_t ticks; // The number of motor timer ticks that the stepper motors move for.
+	uint32_t ms;    // The duration of the motion, in ms.
+} motion_estimate_t;
+
+// The speed of one half step every tick in velocity mode, whose speeds are in half steps per 100
+// ticks.
+#define VELOCITY_FULL_SPEED 100
+
+// The time without a velocity command after which the motors ramp down to a stop, in ms.
+#define VELOCITY_TIMEOUT 500
+
+// Type to hold the statistics of velocity mode's remote control commands.
+typedef struct velocity_stats_t {
+	uint32_t commands;    // The number of velocity commands received.
+	uint32_t timeouts;    // The number of times the motors were stopped for lack of commands.
+	uint32_t latency;     // The time from the last command to the motors acting on it, in µs.
+	uint32_t max_latency; // The longest time from a command to the motors acting on it, in µs.
+} velocity_stats_t;
+
 /*
  * Sets the servo to the "up" position.
  *
@@ -59,11 +118,139 @@ void ICACHE_FLASH_ATTR drive_motors(
 	bool accelerate,
 	motor_callback_t *cb);
 
+/*
+ * Estimates the duration of a movement of the stepper motors, as made by drive_motors with the same
+ * parameters, using the current configuration. The number of ticks is exact, and the duration is
+ * the ticks at the motor timer's tick interval. The motors are not affected.
+ *
+ * Parameters:
+ * left_steps  - the number of steps for the left stepper motor to advance
+ * right_steps - the number of steps for the right stepper motor to advance
+ * tick_count  - the number of ticks over which the left and right steppers are moving
+ *               This is not used when acceleration is enabled
+ * accelerate  - flag set when acceleration is required
+ * estimate    - the estimate to write
+ */
+void ICACHE_FLASH_ATTR estimate_movement(
+	int32_t left_steps,
+	int32_t right_steps,
+	uint16_t tick_count,
+	bool accelerate,
+	motion_estimate_t *estimate);
+
+/*
+ * Estimates the duration of a motion performed by the motion queue, starting and finishing
+ * stationary, including the post movement pause. Queued movements that carry their speed on to the
+ * next, and pen movements that overlap travel, take less time than estimated.
+ *
+ * Parameters:
+ * motion   - the motion to estimate
+ * pen      - the position of the pen when the motion starts, which sets the drive mode of travel
+ * estimate - the estimate to write
+ */
+void ICACHE_FLASH_ATTR estimate_motion(
+	const motion_t *motion, servo_position_t pen, motion_estimate_t *estimate);
+
+/*
+ * Drives the stepper motors continuously in velocity mode, for remote control. The motors ramp
+ * smoothly from their current speeds to the new ones, starting within a few ticks of the call. If
+ * no further call is made within VELOCITY_TIMEOUT ms, the motors ramp down to a stop. Any movement
+ * in progress is abandoned, and driving the motors with drive_motors ends velocity mode.
+ *
+ * Parameters:
+ * left  - the speed of the left stepper motor, in half steps per 100 ticks
+ * right - the speed of the right stepper motor, in half steps per 100 ticks
+ */
+void ICACHE_FLASH_ATTR drive_velocity(int16_t left, int16_t right);
+
+/*
+ * Retrieves the statistics of velocity mode's remote control commands.
+ */
+void ICACHE_FLASH_ATTR get_velocity_stats(velocity_stats_t *stats);
+
+/*
+ * Retrieves the net number of half steps each motor has moved forwards since the motors were
+ * initialised, as they were written to the motors. This is the turtle's odometry, from which its
+ * pose can be derived using the calibrated steps for moving and turning.
+ */
+void ICACHE_FLASH_ATTR get_odometry(int32_t *left, int32_t *right);
+
+/*
+ * Adds a motion to the end of the motion queue. The motion is started immediately if the motors are
+ * not performing a queued motion, otherwise it is started once the motions before it have
+ * completed, including the post movement pause for stepper and servo movements. When the servo
+ * overlap is configured, pen movements overlap the travel movements next to them instead.
+ * Returns false if the queue is full, in which case the motion is not queued.
+ *
+ * Parameters:
+ * motion - the motion to queue, which is copied into the queue.
+ */
+bool ICACHE_FLASH_ATTR queue_motion(const motion_t *motion);
+
+/*
+ * Returns true if there are no queued motions, including one in progress.
+ */
+bool ICACHE_FLASH_ATTR is_motion_queue_empty();
+
+/*
+ * Discards all queued motions, and stops the motors and any pause in progress.
+ */
+void ICACHE_FLASH_ATTR clear_motion_queue();
+
+/*
+ * Sets the functions called as each queued motion starts and after it has completed.
+ *
+ * Parameters:
+ * start_cb    - the call-back function to be invoked when a queued motion starts.
+ * complete_cb - the call-back function to be invoked when a queued motion has completed.
+ */
+void ICACHE_FLASH_ATTR set_motion_callbacks(
+	motion_callback_t *start_cb,
+	motor_callback_t *complete_cb);
+
 /*
  * (Re)initialises the motor timer.
  */
 void ICACHE_FLASH_ATTR init_motor_timer();
 
+/*
+ * Replaces the source of the motor control's ticks, such as with a simulated clock, and restarts the
+ * motor timer with it if it is running. Passing NULL restores the configured hardware or software
+ * timer.
+ */
+void ICACHE_FLASH_ATTR set_tick_source(const tick_source_t *source);
+
+/*
+ * Returns the number of times the motor timer callback has been called. The motor timer only runs
+ * whilst the motors are moving, so this shows how many idle ticks are being avoided.
+ */
+uint32_t ICACHE_FLASH_ATTR get_motor_timer_callbacks();
+
+#ifdef MOTOR_TRACE
+/*
+ * Retrieves the number of step events recorded in the trace since the motors were initialised, and
+ * the interval of the motor ticks in µs.
+ */
+void ICACHE_FLASH_ATTR get_motor_trace_info(uint32_t *count, uint32_t *tick_interval);
+
+/*
+ * Copies the step events recorded in the trace, oldest first, from the index'th event recorded up to
+ * (but not including) the end'th. Events that have already been overwritten are skipped, and the
+ * index is advanced past the copied events.
+ *
+ * Each event is packed into 32 bits:
+ * - Bits 16-31: the number of ticks after the previous event, saturating at 0xFFFF for longer gaps.
+ * - Bits 8-15:  the step sequence positions after the event, left motor in the low 4 bits.
+ * - Bits 0-7:   flags - bit 0 left steps, bit 1 right steps, bit 2 left reverses, bit 3 right
+ *               reverses, bit 4 velocity command acted on, bits 5-6 phase (0 steady velocity mode,
+ *               1 accelerating, 2 cruising, 3 decelerating), bit 7 last event of the movement.
+ *
+ * Returns the number of events copied, up to length.
+ */
+uint32_t ICACHE_FLASH_ATTR read_motor_trace(
+		uint32_t *index, uint32_t end, uint32_t *events, uint32_t length);
+#endif
+
 /*
  * Initialises the GPIO values for the stepper motors.
  * This requires the gpio_init() function to be called *before* this function.
@@ -0,0 +1,64 @@
+/*
+ * program_image.h: Header file for loading programs from the binary program image format.
+ *
+ * The binary program image is a compact alternative to the JSON program format. All multi-byte
+ * values are big-endian, matching the byte code's operands.
+ *
+ *   Offset  Size  Field
+ *   0       4     Magic value "MTPI"
+ *   4       1     Format version (PROGRAM_IMAGE_VERSION)
+ *   5       1     Number of global variables
+ *   6       1     Number of functions
+ *   7       1     Reserved (0)
+ *   8       6*n   Function table, one entry per function in ID order:
+ *                   argument count (1), local count (1), stack size (1), reserved (1),
+ *                   code length in bytes (2)
+ *   8+6*n   ...   The byte code of each function, in ID order
+ *   end-4   4     CRC-32 (IEEE 802.3) of all preceding bytes
+ *
+ * Author: Ian Marshall
+ * Date: 15/10/2026
+ */
+#ifndef __PROGRAM_IMAGE_H
+#define __PROGRAM_IMAGE_H
+
+#include "vm.h"
+
+// The version of the binary program image format.
+#define PROGRAM_IMAGE_VERSION 1
+
+// The maximum number of bytes in a binary program image.
+#define MAX_PROGRAM_IMAGE_SIZE 4096
+
+/*
+ * Loads a program from a binary program image, validating the image's structure and checksum. The
+ * byte code itself is verified when the program is run.
+ * Returns the program, or NULL with a description of the problem in error if the image is invalid.
+ */
+program_t * ICACHE_FLASH_ATTR load_program_image(
+		const uint8_t *image, uint32_t length, const char **error);
+
+/*
+ * Loads a program from a binary program image saved in a file. Only the image's header and function
+ * table are held in memory; each function's byte code is read from flash by load_function_code when
+ * the program is verified and decoded, using a single buffer the size of the longest function.
+ * This saves holding the image in memory, but does not give the program a fixed footprint: once
+ * decoded, every instruction of every function takes a cell in memory (about 20 bytes each) for as
+ * long as the program runs, so the size of a program is still limited by the free heap.
+ * Returns the program, or NULL with a description of the problem in error if the image is invalid.
+ */
+program_t * ICACHE_FLASH_ATTR load_program_file(uint8_t file_number, const char **error);
+
+/*
+ * Reads the byte code of one function of a program loaded by load_program_file into the program's
+ * code buffer, which replaces the previously read function's code.
+ * Returns false if the flash memory could not be read.
+ */
+bool ICACHE_FLASH_ATTR load_function_code(program_t *prog, uint32_t func);
+
+/*
+ * Calculates the CRC-32 (IEEE 802.3) of a block of data.
+ */
+uint32_t ICACHE_FLASH_ATTR crc32(const uint8_t *data, uint32_t length);
+
+#endif
@@ -0,0 +1,106 @@
+/*
+ * program_json.h: Header file for the incremental decoding of programs from the JSON program
+ * format.
+ *
+ * The JSON is decoded a character at a time, so a program can be decoded from the chunks of an HTTP
+ * upload as they arrive, without holding the JSON in memory:
+ *
+ *   {"program":{
+ *     "globals": <globals>, "functions": [
+ *       {"args": <arg_count>,
+ *        "locals": <local_var_count>,
+ *        "stack": <stack_size>,
+ *        "codes": [<function_bytecode>]
+ *       }, ...]
+ *   }}
+ *
+ * The program is created up front, sized from the length of the upload up to the code size of the
+ * largest program image, and each function's byte code is written straight into it as it is
+ * decoded. Once the JSON is complete the program is trimmed to the functions and code it holds.
+ *
+ * Author: Ian Marshall
+ * Date: 16/10/2026
+ */
+#ifndef __PROGRAM_JSON_H
+#define __PROGRAM_JSON_H
+
+#include "program_image.h"
+#include "vm.h"
+
+// The maximum length of a key in the program JSON.
+#define PROGRAM_JSON_KEY_LEN 9
+
+// The maximum length of an uploaded program's JSON (or the HTML form holding it), which allows each
+// byte code of the largest program image eight characters, such as "255%2C+" once URL encoded.
+#define MAX_PROGRAM_JSON_SIZE (8 * MAX_PROGRAM_IMAGE_SIZE)
+
+/*
+ * Type for the status of decoding a program.
+ */
+typedef enum {
+	PROGRAM_JSON_MORE,  // The program is incomplete, more JSON is needed.
+	PROGRAM_JSON_DONE,  // The program is complete.
+	PROGRAM_JSON_ERROR  // The JSON is invalid, and the reason is held in the decoder's error.
+} program_json_status_t;
+
+/*
+ * Type for decoding a program from its JSON. The fields are private to program_json.c.
+ */
+typedef struct program_json_t {
+	program_t *program;          // The program being decoded, which is created up front.
+	uint32_t function_count;     // The number of functions started.
+	uint32_t code_len;           // The number of byte codes decoded for the current function.
+	const char *error;           // The reason the JSON was rejected.
+	program_json_status_t status; // The status of the decoding.
+	uint8_t state;               // The next token expected by the decoder.
+	uint8_t key;                 // The key whose value is being decoded.
+	uint8_t fields;              // Flags for the keys seen in the program and current function.
+	uint8_t token;               // The token being read, which may span chunks of JSON.
+	bool negative;               // Flag set when the number being read is negative.
+	int32_t number;              // The number being read.
+	uint8_t key_len;             // The number of characters in the key being read.
+	char key_buf[PROGRAM_JSON_KEY_LEN];  // The key being read.
+	uint8_t form_state;          // The part of the HTML form being read.
+	uint8_t form_match;          // The number of characters of a field name matching "code".
+	uint8_t escape_len;          // The number of hexadecimal digits read of a %XX escape.
+	uint8_t escape;              // The character being read from a %XX escape.
+} program_json_t;
+
+/*
+ * Prepares to decode a program from JSON (or an HTML form holding it) of the given length, creating
+ * the program with room for the most functions and byte code that the JSON could hold. The byte
+ * code is limited to MAX_PROGRAM_IMAGE_SIZE, the same as a binary program image, and the length
+ * should be checked against MAX_PROGRAM_JSON_SIZE first.
+ * Returns false if the program could not be allocated.
+ */
+bool ICACHE_FLASH_ATTR init_program_json(program_json_t *pj, uint32_t length);
+
+/*
+ * Decodes the next chunk of a program's JSON.
+ * Returns whether the program is complete, needs more JSON, or the JSON is invalid.
+ */
+program_json_status_t ICACHE_FLASH_ATTR parse_program_json(
+		program_json_t *pj, const char *data, uint32_t length);
+
+/*
+ * Decodes the next chunk of a URL encoded HTML form, where the "code" field holds the program's
+ * JSON. Any other fields are ignored.
+ * Returns whether the program is complete, needs more JSON, or the JSON is invalid.
+ */
+program_json_status_t ICACHE_FLASH_ATTR parse_program_form(
+		program_json_t *pj, const char *data, uint32_t length);
+
+/*
+ * Finishes decoding a program, once all of its JSON has been passed to the decoder. The program is
+ * trimmed to the space it requires, and must be run (or freed) by the caller.
+ * Returns the program, or NULL with a description of the problem in pj->error if it is invalid.
+ */
+program_t * ICACHE_FLASH_ATTR finish_program_json(program_json_t *pj);
+
+/*
+ * Frees the program held by a decoder that has not been finished, for when the decoding is
+ * abandoned.
+ */
+void ICACHE_FLASH_ATTR free_program_json(program_json_t *pj);
+
+#endif
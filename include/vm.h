@@ -9,6 +9,9 @@
 
 #include "motors.h"
 
+// The maximum number of functions allowed in the program (including main).
+#define MAX_FUNC_COUNT 64
+
 /*
  * Type for defining a function.
  */
@@ -28,6 +31,10 @@ typedef struct program_t {
 	uint32_t global_count;
 	uint32_t function_count;
 	function_t *functions;
+	uint32_t size;       // Size of the program's single allocation, in bytes.
+	uint32_t code_used;  // Number of bytes of the code area assigned to functions.
+	uint32_t code_size;  // Size of the code area following the function table, in bytes.
+	uint32_t flash_address; // Flash address of the program's image, or 0 if its code is in memory.
 } program_t;
 
 /*
@@ -39,10 +46,72 @@ typedef enum prog_status_t {
 	ERROR
 } prog_status_t;
 
+/*
+ * The superinstructions that common byte code sequences are fused into when a program is loaded.
+ */
+typedef enum fusion_t {
+	FUSE_ADD_LOCAL,  // ILOAD x; ICONST n; IADD/ISUB; ISTORE x
+	FUSE_BR_LOCALS,  // ILOAD x; ILOAD y; <compare>; BRT/BRF
+	FUSE_BR_CONST,   // ILOAD x; ICONST n; <compare>; BRT/BRF
+	FUSE_MOVE_CONST, // ICONST n; FD/BK/LT/RT
+	FUSION_COUNT
+} fusion_t;
+
+/*
+ * Type for the execution statistics of the current (or most recent) program.
+ */
+typedef struct vm_stats_t {
+	uint32_t instruction_count;       // Number of instructions executed.
+	uint32_t batch_count;             // Number of execution task invocations that ran instructions.
+	uint32_t execution_time;          // Time spent executing instructions, in us.
+	uint32_t instructions_per_second; // Execution rate whilst executing instructions.
+	uint32_t program_size;            // Size of the program's byte code allocation, in bytes.
+	uint32_t cells_size;              // Size of the decoded cells, in bytes.
+	uint32_t arena_size;              // Size of the stack frame arena, in bytes.
+	uint32_t arena_peak;              // Peak number of stack frame arena bytes in use.
+	uint32_t fusion_sites[FUSION_COUNT]; // Number of sequences fused into each superinstruction.
+	uint32_t fusion_hits[FUSION_COUNT];  // Number of times each superinstruction was executed.
+} vm_stats_t;
+
+/*
+ * Type for the estimated progress of the current (or most recent) program, from the estimated
+ * duration of each of its motions. The estimate assumes each motion starts and finishes stationary,
+ * so the program usually finishes early.
+ */
+typedef struct program_progress_t {
+	bool estimating;       // Flag set whilst the program's duration is being estimated.
+	bool estimated;        // Flag set when the program's duration could be estimated.
+	uint32_t total_ms;     // The estimated duration of the program's motions, in ms.
+	uint32_t completed_ms; // The estimated duration of the motions that have completed, in ms.
+} program_progress_t;
+
+/*
+ * Creates an empty program in a single allocation holding the program, its function table and
+ * code_size bytes for the functions' byte code. The function table is zeroed, and each function's
+ * code is assigned from the allocation with allocate_function_code.
+ * Returns NULL if the memory could not be allocated.
+ */
+program_t *create_program(uint32_t global_count, uint32_t function_count, uint32_t code_size);
+
+/*
+ * Assigns length bytes of a program's code area to a function's byte code. Returns the function's
+ * code, or NULL if the program's code area does not have the space remaining.
+ */
+uint8_t *allocate_function_code(program_t *prog, function_t *function, uint32_t length);
+
+/*
+ * Trims a program created with a function table and code area larger than required, once its first
+ * function_count functions have been assigned their code, in order. The unused space is released, which may
+ * move the program, so the trimmed program is returned in its place.
+ */
+program_t *trim_program(program_t *prog, uint32_t function_count);
+
 /*
  * Runs a program on the micro-turtle in the background. The supplied program information is used
- * directoy, so the memory cannot be modified. The memory will automatically be freed when the
- * program's execution has halted.
+ * directoy, so the memory cannot be modified. The program must have been created with
+ * create_program, and will automatically be freed when the program's execution has halted.
+ * The program is verified before it is run. If it is rejected, false is returned, the program is
+ * freed and the reason is available from get_vm_error.
  */
 bool run_program(program_t *prog);
 
@@ -51,6 +120,29 @@ bool run_program(program_t *prog);
  */
 void stop_program();
 
+/*
+ * Retrieves a description of why the most recent program was rejected or halted with an error. The
+ * description is empty if the program was accepted and has not had an error.
+ */
+const char *get_vm_error();
+
+/*
+ * Retrieves the execution statistics for the current (or most recent) program.
+ */
+void get_vm_stats(vm_stats_t *stats);
+
+/*
+ * Retrieves the estimated progress of the current (or most recent) program. The program's duration
+ * is estimated when it is run, by executing it in the background without moving the turtle before
+ * it starts.
+ */
+void get_program_progress(program_progress_t *progress);
+
+/*
+ * Retrieves the name of a superinstruction, for reporting its statistics.
+ */
+const char *get_fusion_name(fusion_t fusion);
+
 /*
  * Initialise the Virtual Machine at system start-up.
  */
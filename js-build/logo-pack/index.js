@@ -7,6 +7,28 @@ var asmParser = require('./asmParser');
 var asmListener = require('./asmListener').asmListener;
 var errorListener = antlr4.error.ErrorListener;
 
+/*
+ * The built-in commands that are invoked like procedures, rather than being
+ * keywords of the grammar, mapped to their parameter counts. Their names are
+ * case insensitive, and a procedure defined with the same name is called in
+ * their place.
+ *   arc <radius> <angle>: moves along an arc of radius mm, turning right by
+ *                         angle degrees (left if negative).
+ */
+var builtInCommands = new Map([["arc", 2]]);
+
+/*
+ * Resolves an invocation of a built-in command, returning its parameter count,
+ * or undefined if the name is not a built-in command or has been defined as a
+ * procedure.
+ */
+function resolveBuiltIn(scope, name) {
+    if (scope.resolveProcedure(name) !== undefined) {
+        return undefined;
+    }
+    return builtInCommands.get(name.toLowerCase());
+}
+
 /*
  * Scope objects are used to store variables and functions (separate name 
  * spaces) in the different program scopes, and look them up later.
@@ -255,6 +277,9 @@ AssemblerFactory.prototype.instrLt = function() {
 AssemblerFactory.prototype.instrRt = function() {
     this._currentSegment.push("  rt");
 };
+AssemblerFactory.prototype.instrArc = function() {
+    this._currentSegment.push("  arc");
+};
 AssemblerFactory.prototype.instrPu = function() {
     this._currentSegment.push("  pu");
 };
@@ -569,7 +594,16 @@ LogoRefs.prototype.exitProcedureDef = function(ctx) {
 LogoRefs.prototype.enterProcedureInvoke = function(ctx) {
     var name = ctx.STRING().getText();
     var proc = this._currentScope.resolveProcedure(name);
-    if (proc === undefined) {
+    var builtIn = resolveBuiltIn(this._currentScope, name);
+    if (builtIn !== undefined) {
+        if (ctx.expr().length !== builtIn) {
+            var start = ctx.start;
+            this._exceptions.push({line: start.line, col: start.column + 1,
+                    message: "Incorrect parameter count for \"" + name +
+                    "\", " + ctx.expr().length + " instead of " + builtIn + 
+                    "."});
+        }
+    } else if (proc === undefined) {
         var start = ctx.start;
         this._exceptions.push({line: start.line, col: start.column + 1,
                 message: "Unknown procedure name \"" + name + "\"."});
@@ -584,7 +618,11 @@ LogoRefs.prototype.enterProcedureInvoke = function(ctx) {
 LogoRefs.prototype.exitProcedureInvoke = function(ctx) {
     var name = ctx.STRING().getText();
     var proc = this._currentScope.resolveProcedure(name);
-	if (proc !== undefined) {
+    var builtIn = resolveBuiltIn(this._currentScope, name);
+	if (builtIn !== undefined) {
+		// Update the stack count.
+		this.decrementStack(ctx, builtIn);
+	} else if (proc !== undefined) {
 		// Update the stack count.
 		this.decrementStack(ctx, proc.paramCount);
 	}
@@ -829,7 +867,12 @@ LogoAssembler.prototype.exitCombine = function(ctx) {
 /* --- Simple instruction generation functions below --- */
 LogoAssembler.prototype.exitProcedureInvoke = function(ctx) {
     var name = ctx.STRING().getText();
-    this._asm.instrCall(name);
+    if (resolveBuiltIn(this._currentScope, name) !== undefined) {
+        // The only built-in command is arc.
+        this._asm.instrArc();
+    } else {
+        this._asm.instrCall(name);
+    }
 };
 LogoAssembler.prototype.exitFD = function(ctx) {
     this._asm.instrFd();
@@ -967,7 +1010,7 @@ function AsmCompiler() {
 		// Raw op-codes, these move the set number of steps, not mm.
 		["fdraw", 44, 0], ["bkraw", 45, 0], ["ltraw", 46, 0], ["rtraw", 47, 0], 
 		// Other op-codes.
-		["wait", 48, 0]];
+		["wait", 48, 0], ["arc", 49, 0]];
 
         // Populate the instruction map with the above op-codes.
         this._instrMap = new Map();
@@ -1241,6 +1284,55 @@ function verifyProgram(input) {
     return results.exceptions;
 }
 
+/*
+ * Calculates the CRC-32 (IEEE 802.3) of an array of bytes, matching crc32 in
+ * the turtle's program_image.c.
+ */
+function _crc32(data) {
+    var crc = 0xFFFFFFFF;
+    for (var ii = 0; ii < data.length; ii++) {
+        crc ^= data[ii];
+        for (var jj = 0; jj < 8; jj++) {
+            crc = (crc >>> 1) ^ (0xEDB88320 & -(crc & 1));
+        }
+    }
+    return (crc ^ 0xFFFFFFFF) >>> 0;
+}
+
+/*
+ * Creates a binary program image from compiled bytecode, for sending to the 
+ * turtle as application/octet-stream. The format is described in the turtle's
+ * program_image.h.
+ */
+function createProgramImage(bytecode) {
+    var functions = bytecode.functions;
+    var length = 8 + (6 * functions.length) + 4;
+    for (var ii = 0; ii < functions.length; ii++) {
+        length += functions[ii].codes.length;
+    }
+
+    // Write the header ("MTPI", version 1) and the function table.
+    var image = new Uint8Array(length);
+    image.set([0x4D, 0x54, 0x50, 0x49, 1, bytecode.globals, functions.length, 0]);
+    var index = 8;
+    for (var ii = 0; ii < functions.length; ii++) {
+        var len = functions[ii].codes.length;
+        image.set([functions[ii].args, functions[ii].locals, functions[ii].stack, 0,
+                (len >> 8) & 0xFF, len & 0xFF], index);
+        index += 6;
+    }
+
+    // Write the code for each function, followed by the CRC.
+    for (var ii = 0; ii < functions.length; ii++) {
+        image.set(functions[ii].codes, index);
+        index += functions[ii].codes.length;
+    }
+    var crc = _crc32(image.subarray(0, index));
+    image.set([(crc >>> 24) & 0xFF, (crc >>> 16) & 0xFF, (crc >>> 8) & 0xFF, crc & 0xFF], 
+            index);
+    return image;
+}
+
 /*
  * Compiles a program to bytecode, returning the bytecode, or the syntax 
  * exceptions if any are found.
@@ -1279,3 +1371,4 @@ function compileProgram() {
 logo = {};
 logo.verifyProgram = verifyProgram;
 logo.compileProgram = compileProgram;
+logo.createProgramImage = createProgramImage;
@@ -44,7 +44,8 @@ paramDef
     : ':' STRING
     ;
 
-/* Invocation of a procedure, where it is called by the program. */
+/* Invocation of a procedure, where it is called by the program. This also invokes the built-in
+ * commands that aren't keywords, such as "arc", which the compiler recognises by name. */
 procedureInvoke
     : STRING expr*
     ;
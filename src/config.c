@@ -43,6 +43,36 @@ static uint8_t const DEFAULT_ACCELERATION_DURATION = 200;
 // The default value to use for the number of ms to pause after a motor movement.
 static uint32_t const DEFAULT_MOVE_PAUSE_DURATION = 200;
 
+// The default value to use for the number of us the VM may execute instructions for in one task.
+static uint32_t const DEFAULT_EXEC_TIME_BUDGET = 2000;
+
+// The maximum value for the VM execution time budget, beyond which WiFi and HTTP processing suffer.
+static uint32_t const MAX_EXEC_TIME_BUDGET = 20000;
+
+// The default value to use for the maximum number of program status updates sent per second.
+static uint32_t const DEFAULT_TELEMETRY_RATE = 10;
+
+// The maximum value for the program status telemetry rate, beyond which slow browsers fall behind.
+static uint32_t const MAX_TELEMETRY_RATE = 50;
+
+// The default value for the hardware stepper motor timer interval, which uses the software timer.
+static uint32_t const DEFAULT_HARDWARE_TICK_INTERVAL = 0;
+
+// The minimum value for the hardware stepper motor timer interval, leaving time between the timer's
+// interrupts for everything else.
+static uint32_t const MIN_HARDWARE_TICK_INTERVAL = 100;
+
+// The maximum value for the hardware stepper motor timer interval.
+static uint32_t const MAX_HARDWARE_TICK_INTERVAL = 10000;
+
+// The default value for whether the stepper motors move in full steps whilst the pen is up, which is
+// off until it is turned on from the configuration page.
+static uint32_t const DEFAULT_FULL_STEP_TRAVEL = 0;
+
+// The default value for whether the pen servo moves whilst the turtle is travelling, which is off
+// until it is turned on from the configuration page.
+static uint32_t const DEFAULT_SERVO_OVERLAP = 0;
+
 /*
  * Structure for the physical storage of configuration parameters in the flash. This includes a "magic" value that is
  * also stored in the flash to test if the configuration is stored, or if the flash is simply uninitialised, or random.
@@ -54,6 +84,9 @@ typedef struct config_storage_t {
 
 LOCAL config_t current_config;
 
+// Forward definitions.
+LOCAL void ICACHE_FLASH_ATTR validate_configuration(config_t *config);
+
 /*
  * Retrieves the values for the number of steps for each motor to move 100mm. The values are written to the supplied
  * pointers.
@@ -121,6 +154,41 @@ uint32_t get_move_pause_duration() {
 	return current_config.move_pause_duration;
 }
 
+/*
+ * Retrieves the value for the VM execution time budget, in microseconds.
+ */
+uint32_t get_exec_time_budget() {
+	return current_config.exec_time_budget;
+}
+
+/*
+ * Retrieves the value for the maximum program status telemetry rate, in Hz.
+ */
+uint32_t get_telemetry_rate() {
+	return current_config.telemetry_rate;
+}
+
+/*
+ * Retrieves the value for the hardware stepper motor timer interval, in microseconds.
+ */
+uint32_t get_hardware_tick_interval() {
+	return current_config.hardware_tick_interval;
+}
+
+/*
+ * Retrieves whether the stepper motors move in full steps whilst the pen is up.
+ */
+bool get_full_step_travel() {
+	return current_config.full_step_travel != 0;
+}
+
+/*
+ * Retrieves whether the pen servo moves whilst the turtle is travelling.
+ */
+bool get_servo_overlap() {
+	return current_config.servo_overlap != 0;
+}
+
 /*
  * Retrieves the values for the current configuration.
  */
@@ -147,6 +215,7 @@ bool ICACHE_FLASH_ATTR store_configuration(config_t *config) {
 	*/
 
 	// Store the values in flash memory.
+	validate_configuration(config);
 	config_storage_t storage;
 	os_memcpy(&storage.config, config, sizeof(config_t));
 	storage.magic = CONFIG_MAGIC_VALUE;
@@ -161,6 +230,32 @@ bool ICACHE_FLASH_ATTR store_configuration(config_t *config) {
 	return true;
 }
 
+/*
+ * Replaces any configuration values that are out of range with their defaults. This covers both
+ * invalid user input and configurations stored before a parameter was added, where the flash
+ * holds arbitrary data for the new field.
+ */
+LOCAL void ICACHE_FLASH_ATTR validate_configuration(config_t *config) {
+	if ((config->exec_time_budget == 0) || (config->exec_time_budget > MAX_EXEC_TIME_BUDGET)) {
+		config->exec_time_budget = DEFAULT_EXEC_TIME_BUDGET;
+	}
+	if ((config->telemetry_rate == 0) || (config->telemetry_rate > MAX_TELEMETRY_RATE)) {
+		config->telemetry_rate = DEFAULT_TELEMETRY_RATE;
+	}
+	if (config->hardware_tick_interval > MAX_HARDWARE_TICK_INTERVAL) {
+		config->hardware_tick_interval = DEFAULT_HARDWARE_TICK_INTERVAL;
+	} else if ((config->hardware_tick_interval > 0) &&
+			(config->hardware_tick_interval < MIN_HARDWARE_TICK_INTERVAL)) {
+		config->hardware_tick_interval = MIN_HARDWARE_TICK_INTERVAL;
+	}
+	if (config->full_step_travel > 1) {
+		config->full_step_travel = DEFAULT_FULL_STEP_TRAVEL;
+	}
+	if (config->servo_overlap > 1) {
+		config->servo_overlap = DEFAULT_SERVO_OVERLAP;
+	}
+}
+
 /*
  * Initialises the configuration management system by loading the configuration into RAM.
  */
@@ -186,11 +281,19 @@ void ICACHE_FLASH_ATTR init_config() {
 		current_config.motor_tick_interval = DEFAULT_MOTOR_TICK_INTERVAL;
 		current_config.acceleration_duration = DEFAULT_ACCELERATION_DURATION;
 		current_config.move_pause_duration = DEFAULT_MOVE_PAUSE_DURATION;
+		current_config.exec_time_budget = DEFAULT_EXEC_TIME_BUDGET;
+		current_config.telemetry_rate = DEFAULT_TELEMETRY_RATE;
+		current_config.hardware_tick_interval = DEFAULT_HARDWARE_TICK_INTERVAL;
+		current_config.full_step_travel = DEFAULT_FULL_STEP_TRAVEL;
+		current_config.servo_overlap = DEFAULT_SERVO_OVERLAP;
 	} else {
 		// Store the flash configuration in RAM for fast/easy access.
 		os_memcpy(&current_config, &storage.config, sizeof(config_t));
 	}
 
+	// Parameters added after the first release are missing from older stored configurations.
+	validate_configuration(&current_config);
+
 	os_printf("Straight steps - left: %d, right: %d.\n",
 			current_config.straight_steps_left, current_config.straight_steps_right);
 	os_printf("Turn steps - left: %d, right: %d.\n",
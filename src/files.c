@@ -135,6 +135,32 @@ bool ICACHE_FLASH_ATTR load_file(uint8_t file_number, char *contents, uint32_t o
 	return true;
 }
 
+/*
+ * Retrieves the flash memory address of a file's contents, and its size in bytes.
+ */
+uint32_t ICACHE_FLASH_ATTR get_file_address(uint8_t file_number, uint32_t *size) {
+	// Verify the parameters.
+	if (file_number >= FILE_COUNT) {
+		debug_print("Bad file number received: %d.\n", file_number);
+		return 0;
+	}
+
+	// Get the file information.
+	file_t directory[FILE_COUNT + 1];
+	if (list_files(directory, FILE_COUNT + 1) != (FILE_COUNT + 1)) {
+		debug_print("Unable to load directory to locate file %d.\n", file_number);
+		return 0;
+	}
+	if (!directory[file_number].in_use) {
+		debug_print("Request to locate file %d, which is not in use.\n", file_number);
+		return 0;
+	}
+
+	*size = directory[file_number].size;
+	uint16_t start_sector = FILE_BASE_SECTOR + (directory[file_number].slot * MAX_FILE_SECTORS);
+	return start_sector * SPI_FLASH_SEC_SIZE;
+}
+
 /*
  * Prepares the storage to hold a new file.
  */
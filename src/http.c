@@ -26,6 +26,9 @@
 
 #include "config.h"
 #include "files.h"
+#include "json_writer.h"
+#include "program_image.h"
+#include "program_json.h"
 #include "string_builder.h"
 #include "udp_debug.h"
 #include "vm.h"
@@ -39,35 +42,89 @@
 // The buffer size used when saving files to flash.
 #define UPLOAD_BUFLEN 1024
 
-LOCAL const uint16_t TICK_COUNT = 100;
-LOCAL const uint16_t CODE_LEN = 1024;
-LOCAL const uint16_t CONFIG_LEN = 512;
+// The buffer sizes used for the JSON of notifications and status requests.
+#define SERVO_JSON_LEN 32
+#define PROGRAM_STATUS_JSON_LEN 128
+#define WIFI_STATUS_JSON_LEN 512
+#define STATISTICS_JSON_LEN 1024
+
+// The binary web socket protocol. A client opts in by sending a HELLO message, which is answered with
+// a HELLO, after which the notifications to that client are binary messages rather than JSON. Each
+// message is a one byte type followed by fixed big-endian fields (sizes in bytes):
+//   HELLO    - version (1). Sent by the client, and echoed back.
+//   DRIVE    - left speed (2), right speed (2). Sent by the client, as the JSON "drive" command.
+//   PEN      - position (1), WS_PEN_*. Sent by the client to move the pen or request its position,
+//              and sent to the client with the position.
+//   STATUS   - program status (1, prog_status_t), function (2), instruction index (2).
+//   PROGRESS - percent complete (1), estimated time remaining in ms (4). Follows a running STATUS
+//              when the program's duration could be estimated.
+//   POSE     - left motor half steps (4), right motor half steps (4), the odometry. Follows each
+//              STATUS, and sent in reply to a POSE (with no fields) from the client.
+#define WS_MSG_HELLO 0x01
+#define WS_MSG_DRIVE 0x02
+#define WS_MSG_PEN 0x03
+#define WS_MSG_STATUS 0x04
+#define WS_MSG_PROGRESS 0x05
+#define WS_MSG_POSE 0x06
+
+// The number of binary message types. Binary messages start with a byte below this, whereas JSON
+// messages start with '{' or whitespace.
+#define WS_MSG_COUNT 0x07
+
+// The length of each binary message, including its type.
+#define WS_HELLO_LEN 2
+#define WS_DRIVE_LEN 5
+#define WS_PEN_LEN 2
+#define WS_STATUS_LEN 6
+#define WS_PROGRESS_LEN 6
+#define WS_POSE_LEN 9
+
+// The version of the binary web socket protocol.
+#define WS_PROTOCOL_VERSION 1
+
+// The pen positions of PEN messages.
+#define WS_PEN_UP 0
+#define WS_PEN_DOWN 1
+#define WS_PEN_REQUEST 2
+
+// The maximum number of web socket clients, which is the HTTP server's connection limit.
+#define WS_MAX_CLIENTS 8
 
-// Current values used for remote control of the turtle.
-LOCAL int16_t rc_left = 0;
-LOCAL int16_t rc_right = 0;
+LOCAL const uint16_t CONFIG_LEN = 512;
 
 // Forward definitions.
 LOCAL int cgiRunBytecode(HttpdConnData *connData);
+LOCAL int cgiRunProgramImage(HttpdConnData *connData);
+LOCAL int cgiRunProgramJson(HttpdConnData *connData);
 LOCAL int cgiListFiles(HttpdConnData *connData);
 LOCAL int cgiLoadFile(HttpdConnData *connData);
 LOCAL int cgiSaveFile(HttpdConnData *connData);
+LOCAL int cgiRunFile(HttpdConnData *connData);
 LOCAL int cgiCalibrateLine(HttpdConnData *connData);
 LOCAL int cgiCalibrateTurn(HttpdConnData *connData);
 LOCAL int tpl_get_configuration(HttpdConnData *connData, char *token, void **arg);
 LOCAL int cgiSetConfiguration(HttpdConnData *connData);
 LOCAL int cgiWifiStatus(HttpdConnData *connData);
+LOCAL int cgiStatistics(HttpdConnData *connData);
+LOCAL int cgiMotorTrace(HttpdConnData *connData);
 LOCAL int cgiConnectNetwork(HttpdConnData *connData);
 LOCAL void drive(Websock *ws, char *data, int len, int index);
 LOCAL void get_pen();
 LOCAL void move_pen(Websock *ws, char *data, int len, int index);
-LOCAL void steps_complete();
 LOCAL void ws_connected(Websock *ws);
+LOCAL void ws_closed(Websock *ws);
+LOCAL void ws_recv_binary(Websock *ws, uint8_t *data, int len);
+LOCAL bool ws_has_clients(bool binary);
+LOCAL void ws_broadcast(char *json, int json_len, uint8_t *message, int message_len);
+LOCAL void send_pose(Websock *ws);
 LOCAL void wifi_event_cb(System_Event_t *event);
 LOCAL void httpCodeReturn(HttpdConnData *connData, uint16_t code, char *title, char *message);
+LOCAL void program_started_return(HttpdConnData *connData);
+LOCAL void send_program_status();
+LOCAL void telemetry_timer_cb(void *arg);
 LOCAL inline void store_int_32(uint8_t *array, uint8_t index, int32_t value);
-LOCAL int json_parse_functions(
-		int *index, char *data, int max_index, program_t *program, HttpdConnData *connData);
+LOCAL inline void store_int_16(uint8_t *array, uint8_t index, int16_t value);
+LOCAL inline int16_t read_int_16(const uint8_t *array, uint8_t index);
 LOCAL int json_check_key(int *index, char *data, int max_index, int count, ...);
 LOCAL int json_skip_whitespace(int index, char *data, int max_index);
 LOCAL int32_t json_read_int_32(int *index, char *data, int max_index);
@@ -81,6 +138,7 @@ HttpdBuiltInUrl builtInUrls[]={
 	{"/file/ls.cgi", cgiListFiles, NULL},
 	{"/file/load.cgi", cgiLoadFile, NULL},
 	{"/file/save.cgi", cgiSaveFile, NULL},
+	{"/file/run.cgi", cgiRunFile, NULL},
 	{"/configuration", cgiRedirect, "/configuration/configure.tpl"},
 	{"/configuration/", cgiRedirect, "/configuration/configure.tpl"},
 	{"/configuration/calibrate.tpl", cgiEspFsTemplate, tpl_get_configuration},
@@ -91,6 +149,8 @@ HttpdBuiltInUrl builtInUrls[]={
 	{"/configuration/scan.cgi", cgiWiFiScan, NULL},
 	{"/configuration/status.cgi", cgiWifiStatus, NULL},
 	{"/configuration/connect.cgi", cgiConnectNetwork, NULL},
+	{"/statistics.cgi", cgiStatistics, NULL},
+	{"/trace.cgi", cgiMotorTrace, NULL},
 	{"*", cgiEspFsHook, NULL}, //Catch-all cgi function for the filesystem
 	{NULL, NULL, NULL}
 };
@@ -102,6 +162,14 @@ typedef struct {
 	uint32_t size;
 } file_tracker_t;
 
+#ifdef MOTOR_TRACE
+// Type used for motor trace transfers.
+typedef struct {
+	uint32_t index; // The index of the next step event to send.
+	uint32_t end;   // The index after the last step event to send.
+} trace_tracker_t;
+#endif
+
 typedef enum {
 	INITIALISE,
 	IN_PROGRESS,
@@ -122,65 +190,108 @@ typedef struct {
 	char buf[UPLOAD_BUFLEN];
 } file_upload_t;
 
+// Type used for receiving binary program images.
+typedef struct {
+	uint32_t length;
+	uint32_t received;
+	uint8_t image[];
+} image_upload_t;
+
+// Type used for receiving programs as JSON.
+typedef struct {
+	bool form;              // Flag set when the JSON is the "code" parameter of a form.
+	program_json_t decoder; // The decoder of the JSON, which holds the program.
+} json_upload_t;
+
+// Type used for rate limiting the program status notifications. Only the latest status is kept, and
+// sent when the rate allows.
+typedef struct {
+	prog_status_t status;       // The latest program status.
+	uint32_t function;          // The latest function being executed.
+	uint32_t index;             // The latest index of the instruction being executed.
+	bool pending;               // Flag set when the latest status has not yet been sent.
+	prog_status_t sent_status;  // The program status most recently sent.
+	uint32_t sent_time;         // The system time when the most recent status was sent, in us.
+	bool timer_armed;           // Flag set when the timer is waiting to send the pending status.
+	uint32_t frames_sent;       // Number of status notifications sent.
+	uint32_t frames_suppressed; // Number of status notifications replaced before they were sent.
+} telemetry_t;
+
+// The rate limiting state for program status notifications.
+LOCAL telemetry_t telemetry;
+
+// The timer used to send a pending program status notification.
+LOCAL os_timer_t telemetry_timer;
+
+// Type to hold a web socket client, and the protocol that its notifications are sent with.
+typedef struct {
+	Websock *ws; // The web socket, or NULL if the entry is unused.
+	bool binary; // Flag set once the client has opted in to the binary protocol.
+} ws_client_t;
+
+// The connected web socket clients.
+LOCAL ws_client_t ws_clients[WS_MAX_CLIENTS];
+
 //------------------
 // Public functions.
 //------------------
 
 /*
  * Notifies any listeners via web socket connections the current program's execution status.
+ * Notifications whilst running are limited to the configured telemetry rate, with only the latest
+ * being sent, but a change of status is always sent immediately.
  */
 void ICACHE_FLASH_ATTR notify_program_status(prog_status_t status, uint32_t function, uint32_t index) {
-	string_builder *sb = create_string_builder(48);
-	if (sb == NULL) {
-		os_printf("Unable to create string builder for program status notification.\n");
-		return;
-	}
-	append_string_builder(sb, "{\"program\":{\"status\":\"");
-	switch (status) {
-		case IDLE:
-			append_string_builder(sb, "idle\"}}");
-			break;
-		case RUNNING:
-			append_string_builder(sb, "running\",\"function\":");
-			append_int32_string_builder(sb, function);
-			append_string_builder(sb, ", \"index\": ");
-			append_int32_string_builder(sb, index);
-			append_string_builder(sb, "}}");
-			break;
-		case ERROR:
-			append_string_builder(sb, "error\"}}");
-			break;
-		default:
-			append_string_builder(sb, "unknown\"}}");
-			break;
+	if (telemetry.pending) {
+		// The pending notification is replaced by this one.
+		telemetry.frames_suppressed++;
+	}
+	telemetry.status = status;
+	telemetry.function = function;
+	telemetry.index = index;
+	telemetry.pending = true;
+
+	uint32_t interval = 1000000 / get_telemetry_rate();
+	uint32_t elapsed = system_get_time() - telemetry.sent_time;
+	if ((status != telemetry.sent_status) || (elapsed >= interval)) {
+		send_program_status();
+	} else if (!telemetry.timer_armed) {
+		// Send the latest status once the interval has passed.
+		telemetry.timer_armed = true;
+		os_timer_arm(&telemetry_timer, ((interval - elapsed) + 999) / 1000, false);
 	}
-	cgiWebsockBroadcast("/ws.cgi", sb->buf, sb->len, WEBSOCK_FLAG_NONE);
-	free_string_builder(sb);
 }
 
 /*
  * Notifies any listeners via web socket connections the current servo position (up/down).
  */
 void ICACHE_FLASH_ATTR notify_servo_position(servo_position_t pos) {
-	string_builder *sb = create_string_builder(32);
-	if (sb == NULL) {
-		os_printf("Unable to create string builder for servo position notification.\n");
+	uint8_t message[WS_PEN_LEN] = {WS_MSG_PEN, (pos == DOWN) ? WS_PEN_DOWN : WS_PEN_UP};
+	ws_broadcast(NULL, 0, message, WS_PEN_LEN);
+	if (!ws_has_clients(false)) {
 		return;
 	}
-	append_string_builder(sb, "{\"servo\":{\"position\":\"");
+
+	char buf[SERVO_JSON_LEN];
+	json_writer jw;
+	init_json_writer(&jw, buf, sizeof(buf));
+	json_write_raw(&jw, "{\"servo\":{\"position\":\"");
 	switch (pos) {
 		case UP:
-			append_string_builder(sb, "up\"}}");
+			json_write_raw(&jw, "up\"}}");
 			break;
 		case DOWN:
-			append_string_builder(sb, "down\"}}");
+			json_write_raw(&jw, "down\"}}");
 			break;
 		default:
-			append_string_builder(sb, "unknown\"}}");
+			json_write_raw(&jw, "unknown\"}}");
 			break;
 	}
-	cgiWebsockBroadcast("/ws.cgi", sb->buf, sb->len, WEBSOCK_FLAG_NONE);
-	free_string_builder(sb);
+	if (jw.overflow) {
+		os_printf("Unable to fit servo position notification in buffer.\n");
+		return;
+	}
+	ws_broadcast(jw.buf, jw.len, NULL, 0);
 }
 
 /*
@@ -222,6 +333,10 @@ void ICACHE_FLASH_ATTR http_init() {
 	// Initialise the HTTP server.
 	espFsInit((void*)(webpages_espfs_start));
 	httpdInit(builtInUrls, 80);
+
+	// Prepare the timer for rate limited program status notifications.
+	os_timer_disarm(&telemetry_timer);
+	os_timer_setfn(&telemetry_timer, (os_timer_func_t *)telemetry_timer_cb, (void *)0);
 }
 
 //------------------------------------------------------------------------------
@@ -229,112 +344,150 @@ void ICACHE_FLASH_ATTR http_init() {
 //------------------------------------------------------------------------------
 
 /*
- * Runs a program using the supplied bytecode instructions.
+ * Runs a program using the supplied bytecode instructions. The program is either a binary program
+ * image (sent as application/octet-stream), the program as JSON (sent as application/json), or the
+ * "code" parameter of a form holding the program as JSON.
  */
 LOCAL int ICACHE_FLASH_ATTR cgiRunBytecode(HttpdConnData *connData) {
-	// Get the bytecode.
-	char code[CODE_LEN];
-	if (httpdFindArg(connData->post->buff, "code", code, CODE_LEN) == -1) {
-		httpCodeReturn(connData, 400, "Missing parameter", "Missing the \"code\" parameter.");
-		return HTTPD_CGI_DONE;
+	// Choose the handler from the content type, which then receives the rest of the POST data.
+	char content_type[32];
+	if (!httpdGetHeader(connData, "Content-Type", content_type, sizeof(content_type))) {
+		content_type[0] = '\0';
+	}
+	if (os_strncmp(content_type, "application/octet-stream", 24) == 0) {
+		connData->cgi = cgiRunProgramImage;
+	} else {
+		connData->cgi = cgiRunProgramJson;
 	}
+	return connData->cgi(connData);
+}
 
-	// Convert the bytecode into a program_t structure.
-	// We expect the following JSON format:
-	// {"program":{
-	//   {"globals": <globals>, "functions": [
-	//     {"args": <arg_count>,
-	//      "locals": <local_var_count>, 
-	//      "stack": <stack_size>,
-	//      "codes": [<function_bytecode>]
-	//     }, ...]
-	//   }
-	// }}
-	// First, check we are an object.
-	int index = 0;
-	index = json_skip_whitespace(0, code, CODE_LEN);
-	if (index == -1) {
-		httpCodeReturn(connData, 400, "Bad parameter", "Invalid \"code\" parameter preamble.");
+/*
+ * Runs a program from its JSON, which is decoded as each chunk of the POST data is received, so the
+ * JSON is never held in memory. See program_json.h for the JSON format.
+ */
+LOCAL int ICACHE_FLASH_ATTR cgiRunProgramJson(HttpdConnData *connData) {
+	json_upload_t *upl = connData->cgiData;
+	if (connData->conn == NULL) {
+		// The connection was aborted.
+		if (upl != NULL) {
+			free_program_json(&upl->decoder);
+			os_free(upl);
+		}
 		return HTTPD_CGI_DONE;
 	}
-	if (code[index++] != '{') {
-		// We must start with an object.
-		httpCodeReturn(connData, 400, "Bad parameter", "Invalid \"code\" parameter opening.");
-		return HTTPD_CGI_DONE;
+
+	if (upl == NULL) {
+		// Set up the decoder, which creates the program that the functions are decoded into.
+		if (connData->post->len > MAX_PROGRAM_JSON_SIZE) {
+			httpCodeReturn(connData, 400, "Invalid program", "Program JSON is too large.");
+			return HTTPD_CGI_DONE;
+		}
+		upl = (json_upload_t *)os_malloc(sizeof(json_upload_t));
+		if ((upl == NULL) || !init_program_json(&upl->decoder, connData->post->len)) {
+			if (upl != NULL) {
+				os_free(upl);
+			}
+			httpCodeReturn(connData, 500, "Internal error",
+					"Unable to allocate memory to process program.");
+			return HTTPD_CGI_DONE;
+		}
+		char content_type[32];
+		upl->form = !httpdGetHeader(connData, "Content-Type", content_type, sizeof(content_type)) ||
+				(os_strncmp(content_type, "application/json", 16) != 0);
+		connData->cgiData = upl;
+	}
+
+	// Decode the received data. Once the JSON is found to be invalid the rest is ignored, but it is
+	// still received before the error is returned.
+	if (upl->form) {
+		parse_program_form(&upl->decoder, connData->post->buff, connData->post->buffLen);
+	} else {
+		parse_program_json(&upl->decoder, connData->post->buff, connData->post->buffLen);
+	}
+	if (connData->post->received < connData->post->len) {
+		// Wait for the rest of the JSON.
+		return HTTPD_CGI_MORE;
 	}
 
-	// See if this is the program command.
-	if (json_check_key(&index, code, CODE_LEN, 1, "program") == -1) {
-		// Currently, only the program command is supported, and this is not it.
-		httpCodeReturn(connData, 400, "Bad parameter", "Invalid \"code\" parameter - not a program.");
+	// The program is complete.
+	program_t *program = finish_program_json(&upl->decoder);
+	const char *error = upl->decoder.error;
+	os_free(upl);
+	connData->cgiData = NULL;
+	if (program == NULL) {
+		httpCodeReturn(connData, 400, "Bad parameter", (char *)error);
 		return HTTPD_CGI_DONE;
 	}
 
-	if (code[index++] != '{') {
-		// All programs must be objects.
-		httpCodeReturn(connData, 400, "Bad parameter", 
-				"Invalid \"code\" parameter - program command must be an object.");
+	// Start execution of the program.
+	if (!run_program(program)) {
+		httpCodeReturn(connData, 400, "Invalid program", (char *)get_vm_error());
 		return HTTPD_CGI_DONE;
 	}
-	program_t *program;
-	program = (program_t *)os_malloc(sizeof(program_t));
-	if (program == NULL) {
-		httpCodeReturn(connData, 500, "Internal error", 
-				"Unable to allocate memory to process program.");
+	program_started_return(connData);
+	return HTTPD_CGI_DONE;
+}
+
+/*
+ * Runs a program from a binary program image, which may be received over several invocations.
+ */
+LOCAL int ICACHE_FLASH_ATTR cgiRunProgramImage(HttpdConnData *connData) {
+	image_upload_t *upl = connData->cgiData;
+	if (connData->conn == NULL) {
+		// The connection was aborted.
+		if (upl != NULL) {
+			os_free(upl);
+		}
 		return HTTPD_CGI_DONE;
 	}
 
-	// Handle the top-level properties.
-	int match_index;
-	bool have_globals = false;
-	bool have_functions = false;
-	while (true) {
-		match_index = json_check_key(&index, code, CODE_LEN, 2, "globals", "functions");
-		switch (match_index) {
-			case 0: {
-				// This is the global information.
-				int32_t count = json_read_int_32(&index, code, CODE_LEN);
-				if (count < 0) {
-					httpCodeReturn(connData, 400, "Bad parameter", 
-							"Invalid global count in \"code\" parameter.");
-					return HTTPD_CGI_DONE;
-				}
-				program->global_count = (uint32_t)count;
-				have_globals = true;
-				} break;
-			case 1: {
-				// This is the function definition.
-				int ret = json_parse_functions(&index, code, CODE_LEN, program, connData);
-				if (ret == -1) {
-					// An error occurred (which is reported inside json_parse_functions).
-					return HTTPD_CGI_DONE;
-				}
-				have_functions = true;
-				} break;
-			default:
-				// Unknown property.
-				httpCodeReturn(connData, 400, "Bad parameter", 
-						"Invalid \"code\" parameter - unknown program field.");
-				return HTTPD_CGI_DONE;
+	if (upl == NULL) {
+		// Set up the buffer for the whole image.
+		uint32_t length = connData->post->len;
+		if ((length == 0) || (length > MAX_PROGRAM_IMAGE_SIZE)) {
+			httpCodeReturn(connData, 400, "Invalid program", "Invalid program image size.");
+			return HTTPD_CGI_DONE;
 		}
-		if (code[index] == ',') {
-			// There are more key/value pairs to check.
-			index++;
-		} else {
-			// There are no more key/value pairs to check.
-			break;
+		upl = (image_upload_t *)os_malloc(sizeof(image_upload_t) + length);
+		if (upl == NULL) {
+			httpCodeReturn(connData, 500, "Internal error",
+					"Unable to allocate memory to process program.");
+			return HTTPD_CGI_DONE;
 		}
+		upl->length = length;
+		upl->received = 0;
+		connData->cgiData = upl;
 	}
 
-	if ((!have_globals) || (!have_functions)) {
-		httpCodeReturn(connData, 400, "Bad parameter", 
-				"Invalid \"code\" parameter, missing globals or functions.");
+	// Add the received data to the image.
+	uint32_t len = connData->post->buffLen;
+	if (len > (upl->length - upl->received)) {
+		len = upl->length - upl->received;
+	}
+	os_memcpy(&upl->image[upl->received], connData->post->buff, len);
+	upl->received += len;
+	if (upl->received < upl->length) {
+		// Wait for the rest of the image.
+		return HTTPD_CGI_MORE;
+	}
+
+	// Load the program from the complete image.
+	const char *error = NULL;
+	program_t *program = load_program_image(upl->image, upl->length, &error);
+	os_free(upl);
+	connData->cgiData = NULL;
+	if (program == NULL) {
+		httpCodeReturn(connData, 400, "Invalid program", (char *)error);
 		return HTTPD_CGI_DONE;
 	}
 
-	// We now have a valid program structure, start execution of the program.
-	run_program(program);
-	httpCodeReturn(connData, 200, "OK", "OK");
+	// Start execution of the program.
+	if (!run_program(program)) {
+		httpCodeReturn(connData, 400, "Invalid program", (char *)get_vm_error());
+		return HTTPD_CGI_DONE;
+	}
+	program_started_return(connData);
 	return HTTPD_CGI_DONE;
 }
 
@@ -494,6 +647,44 @@ LOCAL int ICACHE_FLASH_ATTR cgiLoadFile(HttpdConnData *connData) {
 	}
 }
 
+/*
+ * Runs a program image saved in a file, reading its byte code from the flash memory a function at
+ * a time as it is verified and decoded rather than loading the whole image into memory.
+ */
+LOCAL int ICACHE_FLASH_ATTR cgiRunFile(HttpdConnData *connData) {
+	if (connData->conn == NULL) {
+		return HTTPD_CGI_DONE;
+	}
+
+	// Get the parameters.
+	char num_buf[12];
+	if (httpdFindArg(connData->getArgs, "file_number", num_buf, 12) == -1) {
+		httpCodeReturn(connData, 400, "Missing parameter", "Missing the \"file_number\" parameter.");
+		return HTTPD_CGI_DONE;
+	}
+	uint32_t file_number = atoi(num_buf);
+	if (file_number >= FILE_COUNT) {
+		httpCodeReturn(connData, 400, "Invalid parameter", "The selected file number is invalid.");
+		return HTTPD_CGI_DONE;
+	}
+
+	// Load the program from the file.
+	const char *error = NULL;
+	program_t *program = load_program_file((uint8_t)file_number, &error);
+	if (program == NULL) {
+		httpCodeReturn(connData, 400, "Invalid program", (char *)error);
+		return HTTPD_CGI_DONE;
+	}
+
+	// Start execution of the program.
+	if (!run_program(program)) {
+		httpCodeReturn(connData, 400, "Invalid program", (char *)get_vm_error());
+		return HTTPD_CGI_DONE;
+	}
+	program_started_return(connData);
+	return HTTPD_CGI_DONE;
+}
+
 /*
  * Saves a file to the flash memory.
  */
@@ -705,35 +896,17 @@ LOCAL int ICACHE_FLASH_ATTR cgiCalibrateLine(HttpdConnData *connData) {
 	uint32_t right = atoi(r_buf);
 
 	// Create the program to draw the line.
-	program_t *program;
-	program = (program_t *)os_malloc(sizeof(program_t));
+	program_t *program = create_program(0, 1, 14);
 	if (program == NULL) {
 		httpCodeReturn(connData, 500, "Internal error", 
 				"Unable to allocate memory to process calibration request.");
 		return HTTPD_CGI_DONE;
 	}
-	program->global_count = 0;
-	program->function_count = 1;
-	program->functions = (function_t *)os_malloc(sizeof(function_t));
-	if (program->functions == NULL) {
-		os_free(program);
-		httpCodeReturn(connData, 500, "Internal error", 
-				"Unable to allocate memory to process calibration request.");
-		return HTTPD_CGI_DONE;
-	}
 	program->functions[0].id = 0;
 	program->functions[0].argument_count = 0;
 	program->functions[0].local_count = 0;
 	program->functions[0].stack_size = 2;
-	program->functions[0].length = 14;
-	program->functions[0].code = (uint8_t *)os_malloc(13);
-	if (program->functions[0].code == NULL) {
-		os_free(program->functions);
-		os_free(program);
-		httpCodeReturn(connData, 500, "Internal error", 
-				"Unable to allocate memory to process calibration request.");
-		return HTTPD_CGI_DONE;
-	}
+	allocate_function_code(program, &program->functions[0], 14);
 	program->functions[0].code[0]  = 6;   // PD
 	program->functions[0].code[1]  = 15;  // IConst (left)
 	store_int_32(program->functions[0].code, 2, left);
@@ -744,8 +917,11 @@ LOCAL int ICACHE_FLASH_ATTR cgiCalibrateLine(HttpdConnData *connData) {
 	program->functions[0].code[13] = 40; // STOP
 
 	// Begin the line sequence.
-	run_program(program);
-	httpCodeReturn(connData, 200, "OK", "OK");
+	if (!run_program(program)) {
+		httpCodeReturn(connData, 500, "Internal error", (char *)get_vm_error());
+		return HTTPD_CGI_DONE;
+	}
+	program_started_return(connData);
 	return HTTPD_CGI_DONE;
 }
 
@@ -782,35 +958,17 @@ LOCAL int ICACHE_FLASH_ATTR cgiCalibrateTurn(HttpdConnData *connData) {
 	uint32_t rightStraight = atoi(r_buf);
 
 	// Create the program to draw the lines.
-	program_t *program;
-	program = (program_t *)os_malloc(sizeof(program_t));
+	program_t *program = create_program(0, 1, 36);
 	if (program == NULL) {
 		httpCodeReturn(connData, 500, "Internal error", 
 				"Unable to allocate memory to process calibration request.");
 		return HTTPD_CGI_DONE;
 	}
-	program->global_count = 0;
-	program->function_count = 1;
-	program->functions = (function_t *)os_malloc(sizeof(function_t));
-	if (program->functions == NULL) {
-		os_free(program);
-		httpCodeReturn(connData, 500, "Internal error", 
-				"Unable to allocate memory to process calibration request.");
-		return HTTPD_CGI_DONE;
-	}
 	program->functions[0].id = 0;
 	program->functions[0].argument_count = 0;
 	program->functions[0].local_count = 0;
 	program->functions[0].stack_size = 2;
-	program->functions[0].length = 36;
-	program->functions[0].code = (uint8_t *)os_malloc(33);
-	if (program->functions[0].code == NULL) {
-		os_free(program->functions);
-		os_free(program);
-		httpCodeReturn(connData, 500, "Internal error", 
-				"Unable to allocate memory to process calibration request.");
-		return HTTPD_CGI_DONE;
-	}
+	allocate_function_code(program, &program->functions[0], 36);
 	program->functions[0].code[0] = 6;   // PD
 
 	program->functions[0].code[1] = 15;  // IConst (left straight)
@@ -835,8 +993,11 @@ LOCAL int ICACHE_FLASH_ATTR cgiCalibrateTurn(HttpdConnData *connData) {
 	program->functions[0].code[35] = 40; // STOP
 
 	// Begin the line sequence.
-	run_program(program);
-	httpCodeReturn(connData, 200, "OK", "OK");
+	if (!run_program(program)) {
+		httpCodeReturn(connData, 500, "Internal error", (char *)get_vm_error());
+		return HTTPD_CGI_DONE;
+	}
+	program_started_return(connData);
 	return HTTPD_CGI_DONE;
 }
 
@@ -877,6 +1038,16 @@ LOCAL int ICACHE_FLASH_ATTR tpl_get_configuration(HttpdConnData *connData, char
 		os_sprintf(buf, "%d", config.acceleration_duration);
 	} else if (os_strcmp(token, "movementPause") == 0) {
 		os_sprintf(buf, "%d", config.move_pause_duration);
+	} else if (os_strcmp(token, "execTimeBudget") == 0) {
+		os_sprintf(buf, "%d", config.exec_time_budget);
+	} else if (os_strcmp(token, "telemetryRate") == 0) {
+		os_sprintf(buf, "%d", config.telemetry_rate);
+	} else if (os_strcmp(token, "hardwareTickInterval") == 0) {
+		os_sprintf(buf, "%d", config.hardware_tick_interval);
+	} else if (os_strcmp(token, "fullStepTravel") == 0) {
+		os_sprintf(buf, "%d", config.full_step_travel);
+	} else if (os_strcmp(token, "servoOverlap") == 0) {
+		os_sprintf(buf, "%d", config.servo_overlap);
 	} else {
 		return HTTPD_CGI_DONE;
 	}
@@ -914,7 +1085,12 @@ LOCAL int ICACHE_FLASH_ATTR cgiSetConfiguration(HttpdConnData *connData) {
 	//    "servoTickInterval": <servo_tick_interval>, (optional)
 	//    "motorTickInterval": <motor_tick_interval>, (optional)
 	//    "accelerationDuration": <accel_duration>,   (optional)
-	//    "movementPause": <movement_pause>           (optional)
+	//    "movementPause": <movement_pause>,          (optional)
+	//    "execTimeBudget": <exec_time_budget>,       (optional)
+	//    "telemetryRate": <telemetry_rate>,          (optional)
+	//    "hardwareTickInterval": <hw_tick_interval>, (optional)
+	//    "fullStepTravel": <full_step_travel>,       (optional)
+	//    "servoOverlap": <servo_overlap>             (optional)
 	//   }
 	// }}
 	// First, check we are an object.
@@ -931,7 +1107,7 @@ LOCAL int ICACHE_FLASH_ATTR cgiSetConfiguration(HttpdConnData *connData) {
 	}
 
 	// See if this is the configuration command.
-	if (json_check_key(&index, configuration, CODE_LEN, 1, "configuration") == -1) {
+	if (json_check_key(&index, configuration, CONFIG_LEN, 1, "configuration") == -1) {
 		// Currently, only the drive command is supported, and this is not it.
 		httpCodeReturn(connData, 400, "Bad parameter", "Invalid \"configuration\" parameter - not a configuration.");
 		return HTTPD_CGI_DONE;
@@ -954,12 +1130,13 @@ LOCAL int ICACHE_FLASH_ATTR cgiSetConfiguration(HttpdConnData *connData) {
 	bool have_tsl = false;
 	bool have_tsr = false;
 	while (true) {
-		match_index = json_check_key(&index, configuration, CONFIG_LEN, 11,
+		match_index = json_check_key(&index, configuration, CONFIG_LEN, 16,
 				"straightStepsLeft", "straightStepsRight", "turnStepsLeft", "turnStepsRight",
 				"servoUpAngle", "servoDownAngle", "servoMoveSteps", "servoTickInterval",
-				"motorTickInterval", "accelerationDuration", "movementPause");
+				"motorTickInterval", "accelerationDuration", "movementPause", "execTimeBudget",
+				"telemetryRate", "hardwareTickInterval", "fullStepTravel", "servoOverlap");
 
-		if ((match_index >= 0) && (match_index < 11)) {
+		if ((match_index >= 0) && (match_index < 16)) {
 			int32_t value = json_read_int_32(&index, configuration, CONFIG_LEN);
 			if ((value < 100) && (match_index < 4)) {
 				// The step counts must be > 100 to make any kind of sense.
@@ -1043,6 +1220,26 @@ LOCAL int ICACHE_FLASH_ATTR cgiSetConfiguration(HttpdConnData *connData) {
 					// Servo step pause.
 					config.move_pause_duration = value;
 					break;
+				case 11:
+					// VM execution time budget.
+					config.exec_time_budget = value;
+					break;
+				case 12:
+					// Program status telemetry rate.
+					config.telemetry_rate = value;
+					break;
+				case 13:
+					// Hardware stepper motor timer interval.
+					config.hardware_tick_interval = value;
+					break;
+				case 14:
+					// Full steps whilst the pen is up.
+					config.full_step_travel = value;
+					break;
+				case 15:
+					// Pen servo movements overlapping travel.
+					config.servo_overlap = value;
+					break;
 			}
 		} else {
 			httpCodeReturn(connData, 400, "Bad parameter",
@@ -1079,150 +1276,293 @@ LOCAL int ICACHE_FLASH_ATTR cgiSetConfiguration(HttpdConnData *connData) {
  * CGI function to return the current status of the WiFi connection as JSON data.
  */
 LOCAL int cgiWifiStatus(HttpdConnData *connData) {
-	string_builder *sb = create_string_builder(128);
-	if (sb == NULL) {
-		httpCodeReturn(connData, 500, "Resource error", "Unable to allocate internal memory for request.");
-		return HTTPD_CGI_DONE;
-	}
+	char json[WIFI_STATUS_JSON_LEN];
+	json_writer jw;
+	init_json_writer(&jw, json, sizeof(json));
 
 	// Get the operating mode status.
 	uint8_t mode = wifi_get_opmode_default();
-	append_string_builder(sb, "{\"opmode\": \"");
+	json_write_raw(&jw, "{\"opmode\": \"");
 	switch (mode) {
 		case STATION_MODE:
-			append_string_builder(sb, "Station");
+			json_write_raw(&jw, "Station");
 			break;
 		case SOFTAP_MODE:
-			append_string_builder(sb, "Access Point");
+			json_write_raw(&jw, "Access Point");
 			break;
 		case STATIONAP_MODE:
-			append_string_builder(sb, "Station and Access Point");
+			json_write_raw(&jw, "Station and Access Point");
 			break;
 		default:
-			append_string_builder(sb, "Unknown");
+			json_write_raw(&jw, "Unknown");
 			break;
 	}
 
 	// Get the access point information.
-	append_string_builder(sb, "\", \"ap\": { ");
+	json_write_raw(&jw, "\", \"ap\": { ");
 	struct softap_config apConfig;
 	bool res = wifi_softap_get_config(&apConfig);
 	if (res) {
-		append_string_builder(sb, "\"ssid\": \"");
-		append_string_builder(sb, apConfig.ssid);
-		append_string_builder(sb, "\", \"ssidHidden\": \"");
-		append_string_builder(sb, (apConfig.ssid_hidden == 0) ? "No" : "Yes");
-		append_string_builder(sb, "\", \"password\": \"");
-		append_string_builder(sb, apConfig.password);
-		append_string_builder(sb, "\", \"channel\": ");
-		append_int32_string_builder(sb, (int32_t)apConfig.channel);
-		append_string_builder(sb, ", \"auth\": \"");
+		json_write_raw(&jw, "\"ssid\": ");
+		json_write_string(&jw, apConfig.ssid);
+		json_write_raw(&jw, ", \"ssidHidden\": \"");
+		json_write_raw(&jw, (apConfig.ssid_hidden == 0) ? "No" : "Yes");
+		json_write_raw(&jw, "\", \"password\": ");
+		json_write_string(&jw, apConfig.password);
+		json_write_raw(&jw, ", \"channel\": ");
+		json_write_int32(&jw, (int32_t)apConfig.channel);
+		json_write_raw(&jw, ", \"auth\": \"");
 		switch (apConfig.authmode) {
 			case AUTH_OPEN:
-				append_string_builder(sb, "Open");
+				json_write_raw(&jw, "Open");
 				break;
 			case AUTH_WEP:
-				append_string_builder(sb, "WEP");
+				json_write_raw(&jw, "WEP");
 				break;
 			case AUTH_WPA_PSK:
-				append_string_builder(sb, "WPA PSK");
+				json_write_raw(&jw, "WPA PSK");
 				break;
 			case AUTH_WPA2_PSK:
-				append_string_builder(sb, "WPA2 PSK");
+				json_write_raw(&jw, "WPA2 PSK");
 				break;
 			case AUTH_WPA_WPA2_PSK:
-				append_string_builder(sb, "WPA/WPA2 PSK");
+				json_write_raw(&jw, "WPA/WPA2 PSK");
 				break;
 			default:
-				append_string_builder(sb, "Unknown");
+				json_write_raw(&jw, "Unknown");
 				break;
 		}
-		append_string_builder(sb, "\", ");
+		json_write_raw(&jw, "\", ");
 	}
     struct ip_info info;
 	res = wifi_get_ip_info(SOFTAP_IF, &info);
 	if (!res) {
-		append_string_builder(sb, "\"ip\": \"Unknown\"");
+		json_write_raw(&jw, "\"ip\": \"Unknown\"");
 	} else {
 		char buf[20];
 		os_sprintf(buf, IPSTR, IP2STR(&info.ip));
-		append_string_builder(sb, "\"ip\": \"");
-		append_string_builder(sb, buf);
-		append_string_builder(sb, "\", ");
+		json_write_raw(&jw, "\"ip\": \"");
+		json_write_raw(&jw, buf);
+		json_write_raw(&jw, "\", ");
 	}
 	uint8_t mac[6];
 	char mac_str[18];
 	wifi_get_macaddr(SOFTAP_IF, mac);
-	append_string_builder(sb, "\"mac\": \"");
+	json_write_raw(&jw, "\"mac\": \"");
 	os_sprintf(mac_str, MACSTR, MAC2STR(mac));
-	append_string_builder(sb, mac_str);
+	json_write_raw(&jw, mac_str);
 	int32_t clients = (int32_t)wifi_softap_get_station_num();
-	append_string_builder(sb, "\", \"clientCount\": ");
-	append_int32_string_builder(sb, clients);
-	append_string_builder(sb, "}");
+	json_write_raw(&jw, "\", \"clientCount\": ");
+	json_write_int32(&jw, clients);
+	json_write_raw(&jw, "}");
 
 	// Get the station information.
-	append_string_builder(sb, ", \"station\": { \"status\": ");
+	json_write_raw(&jw, ", \"station\": { \"status\": ");
 	int stnStatus = wifi_station_get_connect_status();
 	switch (stnStatus) {
 		case STATION_IDLE:
-			append_string_builder(sb, "\"Idle\"");
+			json_write_raw(&jw, "\"Idle\"");
 			break;
 		case STATION_CONNECTING:
-			append_string_builder(sb, "\"Connecting\"");
+			json_write_raw(&jw, "\"Connecting\"");
 			break;
 		case STATION_WRONG_PASSWORD:
-			append_string_builder(sb, "\"Incorrect password\"");
+			json_write_raw(&jw, "\"Incorrect password\"");
 			break;
 		case STATION_NO_AP_FOUND:
-			append_string_builder(sb, "\"Access point not found\"");
+			json_write_raw(&jw, "\"Access point not found\"");
 			break;
 		case STATION_CONNECT_FAIL:
-			append_string_builder(sb, "\"Connection failed\"");
+			json_write_raw(&jw, "\"Connection failed\"");
 			break;
 		case STATION_GOT_IP:
-			append_string_builder(sb, "\"Connected\", \"ip\": \"");
+			json_write_raw(&jw, "\"Connected\", \"ip\": \"");
 			res = wifi_get_ip_info(STATION_IF, &info);
 			if (!res) {
-				append_string_builder(sb, "Unknown\"");
+				json_write_raw(&jw, "Unknown\"");
 			} else {
 				char buf[20];
 				os_sprintf(buf, IPSTR, IP2STR(&info.ip));
-				append_string_builder(sb, buf);
-				append_string_builder(sb, "\"");
+				json_write_raw(&jw, buf);
+				json_write_raw(&jw, "\"");
 			}
 			break;
 	}
 	struct station_config config;
 	res = wifi_station_get_config(&config);
 	if (res) {
-		append_string_builder(sb, ", \"ssid\": \"");
-		append_string_builder(sb, config.ssid);
-		append_string_builder(sb, "\"");
+		json_write_raw(&jw, ", \"ssid\": ");
+		json_write_string(&jw, config.ssid);
 	}
 	wifi_get_macaddr(STATION_IF, mac);
-	append_string_builder(sb, ", \"mac\": \"");
+	json_write_raw(&jw, ", \"mac\": \"");
 	os_sprintf(mac_str, MACSTR, MAC2STR(mac));
-	append_string_builder(sb, mac_str);
-	append_string_builder(sb, "\", \"rssi\": ");
+	json_write_raw(&jw, mac_str);
+	json_write_raw(&jw, "\", \"rssi\": ");
 	int8_t rssi = wifi_station_get_rssi();
 	if (rssi == 31) {
-		append_string_builder(sb, "\"Unknown\" }");
+		json_write_raw(&jw, "\"Unknown\" }");
 	} else {
-		append_int32_string_builder(sb, (int32_t)rssi);
-		append_string_builder(sb, " }");
+		json_write_int32(&jw, (int32_t)rssi);
+		json_write_raw(&jw, " }");
 	}
 
 	// Send the JSON response.
-	append_string_builder(sb, "}");
+	json_write_raw(&jw, "}");
+	if (jw.overflow) {
+		httpCodeReturn(connData, 500, "Resource error", "Unable to fit WiFi status in buffer.");
+		return HTTPD_CGI_DONE;
+	}
 	httpdStartResponse(connData, 200);
 	httpdHeader(connData, "Content-Type", "text/json");
 	httpdEndHeaders(connData);
-	httpdSend(connData, sb->buf, sb->len);
-	free_string_builder(sb);
+	httpdSend(connData, jw.buf, jw.len);
+	return HTTPD_CGI_DONE;
+}
+
+/*
+ * CGI function to return the execution statistics as JSON data.
+ */
+LOCAL int ICACHE_FLASH_ATTR cgiStatistics(HttpdConnData *connData) {
+	char json[STATISTICS_JSON_LEN];
+	json_writer jw;
+	init_json_writer(&jw, json, sizeof(json));
+
+	// Get the virtual machine statistics.
+	vm_stats_t vm_stats;
+	get_vm_stats(&vm_stats);
+	json_write_raw(&jw, "{\"vm\": {\"instructionCount\": ");
+	json_write_uint32(&jw, vm_stats.instruction_count);
+	json_write_raw(&jw, ", \"batchCount\": ");
+	json_write_uint32(&jw, vm_stats.batch_count);
+	json_write_raw(&jw, ", \"executionTime\": ");
+	json_write_uint32(&jw, vm_stats.execution_time);
+	json_write_raw(&jw, ", \"instructionsPerSecond\": ");
+	json_write_uint32(&jw, vm_stats.instructions_per_second);
+	json_write_raw(&jw, ", \"programSize\": ");
+	json_write_uint32(&jw, vm_stats.program_size);
+	json_write_raw(&jw, ", \"cellsSize\": ");
+	json_write_uint32(&jw, vm_stats.cells_size);
+	json_write_raw(&jw, ", \"arenaSize\": ");
+	json_write_uint32(&jw, vm_stats.arena_size);
+	json_write_raw(&jw, ", \"arenaPeak\": ");
+	json_write_uint32(&jw, vm_stats.arena_peak);
+
+	// Add the superinstruction fusion counts.
+	json_write_raw(&jw, ", \"fusion\": {");
+	for (uint32_t ii = 0; ii < FUSION_COUNT; ii++) {
+		json_write_raw(&jw, (ii == 0) ? "" : ", ");
+		json_write_string(&jw, get_fusion_name(ii));
+		json_write_raw(&jw, ": {\"sites\": ");
+		json_write_uint32(&jw, vm_stats.fusion_sites[ii]);
+		json_write_raw(&jw, ", \"hits\": ");
+		json_write_uint32(&jw, vm_stats.fusion_hits[ii]);
+		json_write_raw(&jw, "}");
+	}
+	json_write_raw(&jw, "}}");
+
+	// Get the program status telemetry statistics.
+	json_write_raw(&jw, ", \"telemetry\": {\"framesSent\": ");
+	json_write_uint32(&jw, telemetry.frames_sent);
+	json_write_raw(&jw, ", \"framesSuppressed\": ");
+	json_write_uint32(&jw, telemetry.frames_suppressed);
+	json_write_raw(&jw, "}");
+
+	// Get the motor timer statistics.
+	json_write_raw(&jw, ", \"motorTimer\": {\"callbacks\": ");
+	json_write_uint32(&jw, get_motor_timer_callbacks());
+	json_write_raw(&jw, "}");
+
+	// Get the remote control velocity command statistics.
+	velocity_stats_t velocity;
+	get_velocity_stats(&velocity);
+	json_write_raw(&jw, ", \"remoteControl\": {\"commands\": ");
+	json_write_uint32(&jw, velocity.commands);
+	json_write_raw(&jw, ", \"timeouts\": ");
+	json_write_uint32(&jw, velocity.timeouts);
+	json_write_raw(&jw, ", \"latency\": ");
+	json_write_uint32(&jw, velocity.latency);
+	json_write_raw(&jw, ", \"maxLatency\": ");
+	json_write_uint32(&jw, velocity.max_latency);
+	json_write_raw(&jw, "}");
+
+	// Send the JSON response.
+	json_write_raw(&jw, "}");
+	if (jw.overflow) {
+		httpCodeReturn(connData, 500, "Resource error", "Unable to fit statistics in buffer.");
+		return HTTPD_CGI_DONE;
+	}
+	httpdStartResponse(connData, 200);
+	httpdHeader(connData, "Content-Type", "text/json");
+	httpdEndHeaders(connData);
+	httpdSend(connData, jw.buf, jw.len);
 	return HTTPD_CGI_DONE;
 }
 
+/*
+ * CGI function to download the motor's step event trace, as a binary blob of big-endian 32-bit
+ * values: the characters "MTRC", the format version (1), the motor tick interval in µs and the total
+ * number of events recorded, followed by the recorded events, oldest first, until the end of the
+ * response. Each event is packed as described for read_motor_trace.
+ * The trace is only recorded when the firmware is built with MOTOR_TRACE defined.
+ */
+LOCAL int ICACHE_FLASH_ATTR cgiMotorTrace(HttpdConnData *connData) {
+#ifndef MOTOR_TRACE
+	if (connData->conn != NULL) {
+		httpCodeReturn(connData, 501, "Not implemented",
+				"Motor tracing is not compiled in, rebuild with MOTOR_TRACE defined.");
+	}
+	return HTTPD_CGI_DONE;
+#else
+	trace_tracker_t *track = connData->cgiData;
+	if (connData->conn == NULL) {
+		if (track != NULL) {
+			free(track);
+		}
+		return HTTPD_CGI_DONE;
+	}
+
+	uint32_t buf[MAX_TRANSFER_SIZE / 4];
+	uint32_t words = 0;
+	if (track == NULL) {
+		track = malloc(sizeof(trace_tracker_t));
+		if (track == NULL) {
+			httpCodeReturn(connData, 500, "Resource error", "Unable to allocate internal memory for request.");
+			return HTTPD_CGI_DONE;
+		}
+		uint32_t tick_interval;
+		get_motor_trace_info(&track->end, &tick_interval);
+		track->index = 0;
+		connData->cgiData = track;
+
+		// Write the response header, and the trace's header.
+		httpdStartResponse(connData, 200);
+		httpdHeader(connData, "Content-Type", "application/octet-stream");
+		httpdEndHeaders(connData);
+		os_memcpy(buf, "MTRC", 4);
+		store_int_32((uint8_t *)buf, 4, 1);
+		store_int_32((uint8_t *)buf, 8, tick_interval);
+		store_int_32((uint8_t *)buf, 12, track->end);
+		words = 4;
+	}
+
+	// Send the next block of events, converting them to big-endian in place.
+	uint32_t count = read_motor_trace(&track->index, track->end, buf + words,
+			(MAX_TRANSFER_SIZE / 4) - words);
+	for (uint32_t ii = 0; ii < count; ii++, words++) {
+		store_int_32((uint8_t *)(buf + words), 0, buf[words]);
+	}
+	httpdSend(connData, (char *)buf, words * 4);
+
+	if (count == 0) {
+		// Transfer complete.
+		free(track);
+		return HTTPD_CGI_DONE;
+	}
+	return HTTPD_CGI_MORE;
+#endif
+}
+
 /*
  * CGI function to configure the network, connecting to a station if required.
  * All required parameters are sourced from the HTML connection.
@@ -1315,6 +1655,11 @@ LOCAL int ICACHE_FLASH_ATTR cgiConnectNetwork(HttpdConnData *connData) {
  * Processes the reception of a message from a web socket.
  */
 LOCAL void ICACHE_FLASH_ATTR ws_recv(Websock *ws, char *data, int len, int flags) {
+	if ((len > 0) && ((uint8_t)data[0] < WS_MSG_COUNT)) {
+		ws_recv_binary(ws, (uint8_t *)data, len);
+		return;
+	}
+
 	// First, check we are an object.
 	int index = 0;
 	index = json_skip_whitespace(0, data, len);
@@ -1344,10 +1689,54 @@ LOCAL void ICACHE_FLASH_ATTR ws_recv(Websock *ws, char *data, int len, int flags
 	}
 }
 
+/*
+ * Processes the reception of a binary message from a web socket, decoding it by its type. Messages
+ * that are too short for their type are ignored.
+ */
+LOCAL void ICACHE_FLASH_ATTR ws_recv_binary(Websock *ws, uint8_t *data, int len) {
+	switch (data[0]) {
+		case WS_MSG_HELLO: {
+			// Switch the client to the binary protocol, and confirm it.
+			if (len < WS_HELLO_LEN) {
+				return;
+			}
+			for (uint8_t ii = 0; ii < WS_MAX_CLIENTS; ii++) {
+				if (ws_clients[ii].ws == ws) {
+					ws_clients[ii].binary = true;
+				}
+			}
+			uint8_t message[WS_HELLO_LEN] = {WS_MSG_HELLO, WS_PROTOCOL_VERSION};
+			cgiWebsocketSend(ws, (char *)message, WS_HELLO_LEN, WEBSOCK_FLAG_BIN);
+			} break;
+		case WS_MSG_DRIVE:
+			if (len >= WS_DRIVE_LEN) {
+				drive_velocity(read_int_16(data, 1), read_int_16(data, 3));
+			}
+			break;
+		case WS_MSG_PEN:
+			if (len < WS_PEN_LEN) {
+				return;
+			}
+			if (data[1] == WS_PEN_UP) {
+				servo_up(NULL);
+			} else if (data[1] == WS_PEN_DOWN) {
+				servo_down(NULL);
+			} else {
+				get_pen();
+			}
+			break;
+		case WS_MSG_POSE:
+			send_pose(ws);
+			break;
+	}
+}
+
 /*
  * Processes the reception of a message from a web socket containing remote control drive instructions.
  * We expect the following JSON command:
  *     {"drive": {"left": <left>, "right": <right>}}
+ * The values are the speeds of each motor in half steps per 100 ticks. The command must be repeated
+ * within VELOCITY_TIMEOUT ms to keep the turtle moving.
  */
 LOCAL void ICACHE_FLASH_ATTR drive(Websock *ws, char *data, int len, int index) {
 	// Read the drive data
@@ -1389,10 +1778,8 @@ LOCAL void ICACHE_FLASH_ATTR drive(Websock *ws, char *data, int len, int index)
 		return;
 	}
 
-	// Drive the stepper motors for the new values.
-	rc_left = left;
-	rc_right = right;
-	drive_motors(left, right, TICK_COUNT, false, steps_complete);
+	// Drive the stepper motors at the new speeds.
+	drive_velocity(left, right);
 }
 
 /*
@@ -1431,23 +1818,32 @@ LOCAL void ICACHE_FLASH_ATTR move_pen(Websock *ws, char *data, int len, int inde
 //---------------------
 
 /*
- * Callback function for when the motor's steps have completed in remote control driving mode.
+ * Processes the connection for a web socket.
  */
-LOCAL void ICACHE_FLASH_ATTR steps_complete() {
-	if ((rc_left == 0) && (rc_right == 0)) {
-		// Don't start a new cycle, as we don't want to move.
-		return;
+LOCAL void ws_connected(Websock *ws) {
+	ws->recvCb=ws_recv;
+	ws->closeCb=ws_closed;
+
+	// Track the client, which uses JSON until it opts in to the binary protocol.
+	for (uint8_t ii = 0; ii < WS_MAX_CLIENTS; ii++) {
+		if (ws_clients[ii].ws == NULL) {
+			ws_clients[ii].ws = ws;
+			ws_clients[ii].binary = false;
+			return;
+		}
 	}
-
-	// Start up a new cycle.
-	drive_motors(rc_left, rc_right, TICK_COUNT, false, steps_complete);
+	os_printf("Unable to track web socket client, it will not receive notifications.\n");
 }
 
 /*
- * Processes the connection for a web socket.
+ * Processes the closure of a web socket, forgetting the client.
  */
-LOCAL void ws_connected(Websock *ws) {
-	ws->recvCb=ws_recv;
+LOCAL void ws_closed(Websock *ws) {
+	for (uint8_t ii = 0; ii < WS_MAX_CLIENTS; ii++) {
+		if (ws_clients[ii].ws == ws) {
+			ws_clients[ii].ws = NULL;
+		}
+	}
 }
 
 /*
@@ -1504,6 +1900,139 @@ LOCAL void ICACHE_FLASH_ATTR wifi_event_cb(System_Event_t *event) {
 // Helper functions.
 //------------------------------------------------------------------------------
 
+/*
+ * Sends the latest program status notification to any listeners via web socket connections.
+ */
+LOCAL void ICACHE_FLASH_ATTR send_program_status() {
+	// The latest status is no longer pending, even if it can't be sent.
+	os_timer_disarm(&telemetry_timer);
+	telemetry.timer_armed = false;
+	telemetry.pending = false;
+	telemetry.sent_status = telemetry.status;
+	telemetry.sent_time = system_get_time();
+
+	// Get the progress through the program, if its duration could be estimated.
+	program_progress_t progress;
+	get_program_progress(&progress);
+	bool has_progress = (telemetry.status == RUNNING) && progress.estimated;
+	uint32_t percent = (progress.total_ms > 0) ?
+			(uint32_t)(((uint64_t)progress.completed_ms * 100) / progress.total_ms) : 100;
+	uint32_t remaining = progress.total_ms - progress.completed_ms;
+
+	// Send the binary messages to the clients using the binary protocol.
+	if (ws_has_clients(true)) {
+		uint8_t message[WS_STATUS_LEN];
+		message[0] = WS_MSG_STATUS;
+		message[1] = (uint8_t)telemetry.status;
+		store_int_16(message, 2, (telemetry.status == RUNNING) ? telemetry.function : 0);
+		store_int_16(message, 4, (telemetry.status == RUNNING) ? telemetry.index : 0);
+		ws_broadcast(NULL, 0, message, WS_STATUS_LEN);
+		if (has_progress) {
+			message[0] = WS_MSG_PROGRESS;
+			message[1] = (uint8_t)percent;
+			store_int_32(message, 2, remaining);
+			ws_broadcast(NULL, 0, message, WS_PROGRESS_LEN);
+		}
+		send_pose(NULL);
+	}
+
+	// Send the JSON to the other clients.
+	if (ws_has_clients(false)) {
+		char buf[PROGRAM_STATUS_JSON_LEN];
+		json_writer jw;
+		init_json_writer(&jw, buf, sizeof(buf));
+		json_write_raw(&jw, "{\"program\":{\"status\":\"");
+		switch (telemetry.status) {
+			case IDLE:
+				json_write_raw(&jw, "idle\"}}");
+				break;
+			case RUNNING:
+				json_write_raw(&jw, "running\",\"function\":");
+				json_write_uint32(&jw, telemetry.function);
+				json_write_raw(&jw, ", \"index\": ");
+				json_write_uint32(&jw, telemetry.index);
+				if (has_progress) {
+					json_write_raw(&jw, ", \"percent\": ");
+					json_write_uint32(&jw, percent);
+					json_write_raw(&jw, ", \"remaining\": ");
+					json_write_uint32(&jw, remaining);
+				}
+				json_write_raw(&jw, "}}");
+				break;
+			case ERROR:
+				json_write_raw(&jw, "error\"}}");
+				break;
+			default:
+				json_write_raw(&jw, "unknown\"}}");
+				break;
+		}
+		if (jw.overflow) {
+			os_printf("Unable to fit program status notification in buffer.\n");
+			return;
+		}
+		ws_broadcast(jw.buf, jw.len, NULL, 0);
+	}
+	telemetry.frames_sent++;
+}
+
+/*
+ * Sends the odometry as a binary POSE message, to a web socket client or (if NULL) to all the clients
+ * using the binary protocol.
+ */
+LOCAL void ICACHE_FLASH_ATTR send_pose(Websock *ws) {
+	int32_t left;
+	int32_t right;
+	get_odometry(&left, &right);
+	uint8_t message[WS_POSE_LEN];
+	message[0] = WS_MSG_POSE;
+	store_int_32(message, 1, left);
+	store_int_32(message, 5, right);
+	if (ws != NULL) {
+		cgiWebsocketSend(ws, (char *)message, WS_POSE_LEN, WEBSOCK_FLAG_BIN);
+	} else {
+		ws_broadcast(NULL, 0, message, WS_POSE_LEN);
+	}
+}
+
+/*
+ * Returns whether there are any web socket clients using the binary protocol (or using JSON).
+ */
+LOCAL bool ICACHE_FLASH_ATTR ws_has_clients(bool binary) {
+	for (uint8_t ii = 0; ii < WS_MAX_CLIENTS; ii++) {
+		if ((ws_clients[ii].ws != NULL) && (ws_clients[ii].binary == binary)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/*
+ * Sends a notification to the web socket clients, as the binary message to the clients using the
+ * binary protocol and as the JSON to the others. Passing NULL for either skips those clients.
+ */
+LOCAL void ICACHE_FLASH_ATTR ws_broadcast(char *json, int json_len, uint8_t *message, int message_len) {
+	for (uint8_t ii = 0; ii < WS_MAX_CLIENTS; ii++) {
+		if (ws_clients[ii].ws == NULL) {
+			continue;
+		}
+		if (ws_clients[ii].binary && (message != NULL)) {
+			cgiWebsocketSend(ws_clients[ii].ws, (char *)message, message_len, WEBSOCK_FLAG_BIN);
+		} else if (!ws_clients[ii].binary && (json != NULL)) {
+			cgiWebsocketSend(ws_clients[ii].ws, json, json_len, WEBSOCK_FLAG_NONE);
+		}
+	}
+}
+
+/*
+ * Sends the pending program status notification once the telemetry interval has passed.
+ */
+LOCAL void ICACHE_FLASH_ATTR telemetry_timer_cb(void *arg) {
+	telemetry.timer_armed = false;
+	if (telemetry.pending) {
+		send_program_status();
+	}
+}
+
 /*
  * Creates a return web page with the specified return code and text.
  */
@@ -1521,6 +2050,30 @@ LOCAL void ICACHE_FLASH_ATTR httpCodeReturn(HttpdConnData *connData, uint16_t co
 	httpdSend(connData, "</p></body></html>", -1);
 }
 
+/*
+ * Sends the OK response for a program that has started running, reporting its memory footprint
+ * and estimated duration.
+ */
+LOCAL void ICACHE_FLASH_ATTR program_started_return(HttpdConnData *connData) {
+	vm_stats_t stats;
+	get_vm_stats(&stats);
+	program_progress_t progress;
+	get_program_progress(&progress);
+	char message[160];
+	int len = os_sprintf(message, "OK - program memory: %d bytes (%d program, %d decoded, %d stack)",
+			stats.program_size + stats.cells_size + stats.arena_size, stats.program_size,
+			stats.cells_size, stats.arena_size);
+	if (progress.estimated) {
+		os_sprintf(message + len, ", estimated duration: %d.%d s", progress.total_ms / 1000,
+				(progress.total_ms % 1000) / 100);
+	} else if (progress.estimating) {
+		os_sprintf(message + len, ", estimated duration: pending");
+	} else {
+		os_sprintf(message + len, ", estimated duration: unknown");
+	}
+	httpCodeReturn(connData, 200, "OK", message);
+}
+
 /*
  * Stores a 32-bit signed integer into an array as four 8-bit unsigned integers.
  */
@@ -1531,190 +2084,24 @@ LOCAL inline void store_int_32(uint8_t *array, uint8_t index, int32_t value) {
 	array[index + 3] = (value & 0x000000FF);
 }
 
-//------------------------------------------------------------------------------
-// JSON parsing functions.
-//------------------------------------------------------------------------------
-LOCAL int ICACHE_FLASH_ATTR json_parse_functions(
-	int *index, char *data, int max_index, program_t *program, HttpdConnData *connData) {
-	// Functions must reside in an array, see how many there are.
-	if (data[*index] != '[') {
-		httpCodeReturn(connData, 400, "Bad parameter", 
-				"Non-array for functions in \"code\" parameter.");
-		return -1;
-	}
-	(*index)++;
-	int16_t bracket_depth = 1;
-	int16_t brace_depth = 0;
-	uint16_t function_count = 0;
-	for (int ii = *index; ii < max_index; ii++) {
-		if (data[ii] == ']') {
-			bracket_depth--;
-			if (bracket_depth == 0) {
-				break;
-			}
-		} else if (data[ii] == '[') {
-			bracket_depth++;
-		} else if (data[ii] == '{') {
-			if (brace_depth == 0) {
-				function_count++;
-			}
-			brace_depth++;
-		} else if (data[ii] == '}') {
-			brace_depth--;
-		}
-	}
-	if (function_count == 0) {
-		httpCodeReturn(connData, 400, "Bad parameter", 
-				"No functions found in \"code\" parameter.");
-		return -1;
-	}
-	program->function_count = function_count;
-	program->functions = (function_t *)os_malloc(function_count * sizeof(function_t));
-	if (program->functions == NULL) {
-		httpCodeReturn(connData, 500, "Internal error", 
-				"Unable to allocate memory to process program function.");
-		return -1;
-	}
-
-	int match_index;
-	for (int ii = 0; ii < function_count; ii++) {
-		// Store the function's ID, which is simply the index.
-		program->functions[ii].id = ii;
-
-		if (data[*index] != '{') {
-			httpCodeReturn(connData, 400, "Bad parameter",
-					"Invalid \"code\" parameter - function object.");
-			return -1;
-		}
-		(*index)++;
-
-		// Read the values for this function.
-		bool have_args, have_locals, have_stack, have_code = false;
-		while (true) {
-			match_index = json_check_key(index, data, max_index, 4, "args", "locals", "stack", "codes");
-			switch (match_index) {
-				case 0: {
-					// Argument count.
-					program->functions[ii].argument_count = json_read_int_32(index, data, max_index);
-					have_args = true;
-					} break;
-				case 1: {
-					// Locals count.
-					program->functions[ii].local_count = json_read_int_32(index, data, max_index);
-					have_locals = true;
-					} break;
-				case 2: {
-					// Maximum stack size.
-					program->functions[ii].stack_size = json_read_int_32(index, data, max_index);
-					have_stack = true;
-					} break;
-				case 3: {
-					// The bytecode for this function.
-					if (data[*index] != '[') {
-						httpCodeReturn(connData, 400, "Bad parameter",
-								"Bytecode for functions must be in an array.");
-						return -1;
-					}
-					(*index)++;
-
-					// Find out how many bytes are in the bytecode.
-					int tmp_index = *index;
-					int len = 0;
-					bool in_number = false;
-					for (int jj = *index; jj < max_index; jj++) {
-						if ((data[jj] >= '0') && (data[jj] <= '9')) {
-							// This is a numeric digit.
-							if (!in_number) {
-								in_number = true;
-								len++;
-							}
-						} else if (data[jj] == ',') {
-							if (!in_number) {
-								// This is an invalid array.
-								httpCodeReturn(connData, 400, "Bad parameter",
-										"Bytecode for functions must not hold empty numbers.");
-								return -1;
-							}
-							in_number = false;
-						} else if (data[jj] == ']') {
-							// We've reached the end of the array.
-							break;
-						} else if ((data[jj] == ' ') || (data[jj] == '\n') || 
-								(data[jj] == '\r') || (data[jj] == '\t')) {
-							// Ignore whitespace.
-							continue;
-						} else {
-							// This is an invalid array.
-							httpCodeReturn(connData, 400, "Bad parameter",
-									"Bytecode for functions must be in a valid array.");
-							return -1;
-						}
-					}
-
-					// Copy the bytecode into the function's code.
-					program->functions[ii].length = len;
-					program->functions[ii].code = (uint8_t *)os_malloc(len);
-					if (program->functions[ii].code == NULL) {
-						httpCodeReturn(connData, 500, "Internal error", 
-								"Unable to allocate memory to process program funtion's code.");
-						return -1;
-					}
-					for (int jj = 0; jj < len; jj++) {
-						program->functions[ii].code[jj] = (uint8_t)json_read_int_32(
-								index, data, max_index);
-						// Skip the comma and end of array characters.
-						(*index)++;
-					}
-
-					have_code = true;
-					} break;
-				default:
-					httpCodeReturn(connData, 400, "Bad parameter",
-							"Invalid \"code\" parameter - unknown function field.");
-					return -1;
-			}
-			if (data[*index] == ',') {
-				// There are more key/value pairs to check.
-				(*index)++;
-			} else {
-				// There are no more key/value pairs to check.
-				break;
-			}
-		}
-
-		// Ensure we got everything we needed.
-		if ((!have_args) || (!have_locals) || (!have_stack) || (!have_code)) {
-			httpCodeReturn(connData, 400, "Bad parameter",
-					"Invalid \"code\" parameter: missing required function parameter.");
-			return -1;
-		}
-
-		// Read through to the end of the object.
-		*index = json_skip_whitespace(*index, data, max_index);
-		if (data[*index] != '}') {
-			httpCodeReturn(connData, 400, "Bad parameter",
-					"Invalid \"code\" parameter: missing end to function object.");
-			return -1;
-		}
-		(*index)++;
-
-		// Ensure we have a comma at the end of the object, if there are more functions to be read.
-		*index = json_skip_whitespace(*index, data, max_index);
-		if ((ii < (function_count - 1)) && (data[*index] != ',')) {
-			httpCodeReturn(connData, 400, "Bad parameter",
-					"Invalid \"code\" parameter: missing end to function object.");
-			return -1;
-		}
-		(*index)++;
-
-		// Skip any trailing whitespace.
-		*index = json_skip_whitespace(*index, data, max_index);
-	}
+/*
+ * Stores a 16-bit signed integer into an array as two 8-bit unsigned integers.
+ */
+LOCAL inline void store_int_16(uint8_t *array, uint8_t index, int16_t value) {
+	array[index]     = (value & 0xFF00) >> 8;
+	array[index + 1] = (value & 0x00FF);
+}
 
-	// If we get here, all is good.
-	return (int)function_count;
+/*
+ * Reads a 16-bit signed integer from two 8-bit unsigned integers in an array.
+ */
+LOCAL inline int16_t read_int_16(const uint8_t *array, uint8_t index) {
+	return (int16_t)((array[index] << 8) | array[index + 1]);
 }
 
+//------------------------------------------------------------------------------
+// JSON parsing functions.
+//------------------------------------------------------------------------------
 LOCAL int ICACHE_FLASH_ATTR json_check_key(int *index, char *data, int max_index, int count, ...) {
 	// Ignore any leading whitespace.
 	int new_index = *index;
@@ -0,0 +1,118 @@
+/*
+ * json_writer.c: Lightweight way to format JSON into a caller-provided fixed size buffer, without
+ * any memory allocation.
+ *
+ * Author: Ian Marshall
+ * Date: 16/10/2026
+ */
+#include "ets_sys.h"
+#include "osapi.h"
+#include "os_type.h"
+#include "espmissingincludes.h"
+
+#include "json_writer.h"
+
+LOCAL bool ICACHE_FLASH_ATTR json_write_bytes(json_writer *jw, const char *str, int len);
+
+// The hexadecimal digits, for escaping control characters.
+LOCAL const char hex_digits[] = "0123456789abcdef";
+
+/*
+ * Initialises a JSON writer to write into a buffer of the given size.
+ */
+void ICACHE_FLASH_ATTR init_json_writer(json_writer *jw, char *buf, int size) {
+	jw->buf = buf;
+	jw->size = size;
+	jw->len = 0;
+	jw->overflow = false;
+	buf[0] = '\0';
+}
+
+/*
+ * Writes literal text without escaping it.
+ */
+bool ICACHE_FLASH_ATTR json_write_raw(json_writer *jw, const char *str) {
+	return json_write_bytes(jw, str, os_strlen(str));
+}
+
+/*
+ * Writes a string value, quoted and escaped. Quotes, backslashes and control characters are escaped,
+ * and all other characters (including UTF-8 sequences) are written as they are.
+ */
+bool ICACHE_FLASH_ATTR json_write_string(json_writer *jw, const char *str) {
+	json_write_bytes(jw, "\"", 1);
+	const char *start = str;
+	for (const char *p = str; *p != '\0'; p++) {
+		unsigned char c = (unsigned char)*p;
+		if ((c >= 0x20) && (c != '"') && (c != '\\')) {
+			continue;
+		}
+
+		// Write the characters that don't need escaping, then the escaped character.
+		json_write_bytes(jw, start, p - start);
+		start = p + 1;
+		char escape[6] = {'\\', (char)c, '0', '0', '0', '0'};
+		switch (c) {
+			case '"':
+			case '\\':
+				json_write_bytes(jw, escape, 2);
+				break;
+			case '\n':
+				json_write_bytes(jw, "\\n", 2);
+				break;
+			case '\r':
+				json_write_bytes(jw, "\\r", 2);
+				break;
+			case '\t':
+				json_write_bytes(jw, "\\t", 2);
+				break;
+			default:
+				escape[1] = 'u';
+				escape[4] = hex_digits[c >> 4];
+				escape[5] = hex_digits[c & 0x0F];
+				json_write_bytes(jw, escape, 6);
+				break;
+		}
+	}
+	json_write_bytes(jw, start, os_strlen(start));
+	return json_write_bytes(jw, "\"", 1);
+}
+
+/*
+ * Writes a 32-bit signed integer value.
+ */
+bool ICACHE_FLASH_ATTR json_write_int32(json_writer *jw, int32_t val) {
+	if (val < 0) {
+		json_write_bytes(jw, "-", 1);
+		return json_write_uint32(jw, -(uint32_t)val);
+	}
+	return json_write_uint32(jw, (uint32_t)val);
+}
+
+/*
+ * Writes a 32-bit unsigned integer value, converting it from the last digit backwards.
+ */
+bool ICACHE_FLASH_ATTR json_write_uint32(json_writer *jw, uint32_t val) {
+	char digits[10];
+	int count = 0;
+	do {
+		digits[sizeof(digits) - ++count] = '0' + (val % 10);
+		val /= 10;
+	} while (val > 0);
+	return json_write_bytes(jw, &digits[sizeof(digits) - count], count);
+}
+
+/*
+ * Writes a number of characters to the buffer, or marks the writer as overflowed if they don't fit
+ * (or it already has). The buffer is always left holding a valid C string.
+ */
+LOCAL bool ICACHE_FLASH_ATTR json_write_bytes(json_writer *jw, const char *str, int len) {
+	if (jw->overflow || ((jw->size - jw->len - 1) < len)) {
+		jw->overflow = true;
+		return false;
+	}
+	os_memcpy(&jw->buf[jw->len], str, len);
+	jw->len += len;
+	jw->buf[jw->len] = '\0';
+	return true;
+}
@@ -25,9 +25,18 @@
 // The number of stepper motors that this program is using.
 #define STEPPER_MOTOR_COUNT 2
 
-// The maximum number of timer ticks that must pass without movement before the motors are turned 
-// off to save energy. This value is equal to 5 seconds.
-#define MAX_IDLE_COUNT 5000
+// The time that must pass without movement before the motors are turned off to save energy, in ms.
+// This value is equal to 5 seconds.
+#define MAX_IDLE_TIME 5000
+
+// The priority of the task that reports the completion of motor movements.
+#define MOTOR_TASK_PRI 0
+
+// The FRC1 hardware timer control register's flags, and its tick rate with the clock divided by 16.
+#define FRC1_CTRL_ENABLE BIT7
+#define FRC1_CTRL_AUTO_LOAD BIT6
+#define FRC1_CTRL_DIV_16 4
+#define FRC1_TICKS_PER_US 5
 
 // Structure used to hold information for the internal workigs of the motor movement.
 // This data is per-motor.
@@ -37,26 +46,87 @@ typedef struct {
 	int32_t step;
 	int32_t last_step;
 	uint8_t direction;
+	int32_t half_steps; // The number of half steps remaining for the motor to move.
 } tick_data_t;
 
+// The drive modes of the stepper motors: half steps alternate between one and two coils being on,
+// and full steps move between the positions with two coils on, covering twice the distance.
+typedef enum {
+	HALF_STEP,
+	FULL_STEP
+} step_mode_t;
+
 // Structure used to hold phase information for acceleration.
 // This data is per-movement sequence.
+// Speeds are expressed as positions along the acceleration curve, in steps, from stationary (0) to
+// one step per tick (the acceleration table's number of steps).
 typedef struct {
-	uint32_t accel_limit;     // The actual acceleration duration for short runs.
-	uint32_t accel_duration;  // The duration the acceleration curve is over.
+	uint32_t entry_speed;     // The speed at the start of the acceleration.
+	uint32_t exit_speed;      // The speed at the end of the deceleration.
+	uint32_t accel_limit;     // The duration of the acceleration.
+	uint32_t accel_steps;     // The number of steps taken whilst accelerating.
+	uint32_t accel_base;      // The tick of the acceleration curve at the entry speed.
 	uint32_t cruise_duration; // The duration the cruise runs for.
+	uint32_t cruise_interval; // The number of ticks between each step of the cruise.
+	uint32_t decel_limit;     // The duration of the deceleration.
+	uint32_t decel_steps;     // The number of steps taken whilst decelerating.
+	uint32_t decel_base;      // The tick of the acceleration curve at the exit speed.
 	uint32_t phase_tick;      // The current tick in this phase.
-	float last_position;     // The position of the last step for this phase.
+	uint32_t phase_step;      // The number of steps taken in this phase.
 } phase_data_t;
 
+// Type to hold a planned step event, which the timer callback writes to the GPIO outputs once the
+// event's number of ticks has passed since the previous event.
+typedef struct {
+	uint16_t ticks;       // The number of ticks after the previous event that this event occurs.
+	uint8_t flags;        // The STEP_EVENT_* flags describing the event.
+	uint32_t set_mask;    // The GPIO outputs to set.
+	uint32_t clear_mask;  // The GPIO outputs to clear.
+	uint32_t enable_mask; // The GPIO outputs to enable, which is zero when there is nothing to write.
+	uint8_t positions;    // The step sequence positions after the event, left in the low 4 bits.
+	int8_t strides[STEPPER_MOTOR_COUNT]; // The half steps moved by each motor, negative reversing.
+} step_event_t;
+
+// The step event flags: whether each motor steps (and in reverse), whether the event is the first to
+// act on a velocity command, the phase of the movement that planned it, and whether the event is the
+// last of its movement.
+#define STEP_EVENT_LEFT BIT0
+#define STEP_EVENT_RIGHT BIT1
+#define STEP_EVENT_LEFT_REVERSE BIT2
+#define STEP_EVENT_RIGHT_REVERSE BIT3
+#define STEP_EVENT_COMMAND BIT4
+#define STEP_EVENT_PHASE_SHIFT 5
+#define STEP_EVENT_LAST BIT7
+
+// The number of step events in the step event buffer. This must be a power of two, up to 128.
+#define STEP_EVENT_COUNT 32
+
+// The number of step events remaining in the buffer below which the planner is asked to refill it.
+#define STEP_EVENT_REFILL 16
+
+// The number of step events, each of one tick, that are planned ahead in velocity mode. This bounds
+// the delay before a velocity command is acted on.
+#define VELOCITY_LEAD 2
+
+// The number of step events remaining in the buffer below which velocity mode plans more.
+#define VELOCITY_REFILL 1
+
+// The fixed point representation of one half step per tick, for velocity mode's speeds.
+#define VELOCITY_UNIT (1 << 16)
+
+// Structure used to hold the speeds of a motor in velocity mode, in VELOCITY_UNITs.
+typedef struct {
+	int32_t speed;     // The current speed, negative when reversing.
+	int32_t target;    // The speed being ramped towards.
+	uint32_t distance; // The distance moved towards the next half step.
+} velocity_data_t;
+
 // The various phases that a motor movement can go through.
 typedef enum {
 	STATIONARY,
-	ACCEL_1,
-	ACCEL_2,
+	ACCELERATING,
 	CRUISING,
-	DECEL_1,
-	DECEL_2
+	DECELERATING
 } phases_t;
 
 // Stepper data used in the control of motor movement.
@@ -65,14 +135,25 @@ LOCAL tick_data_t stepper_data[STEPPER_MOTOR_COUNT];
 // Phase information used in the control of accelerated motor movement.
 LOCAL phase_data_t phase_data;
 
+// The tick of the acceleration curve at which each of its steps is taken. The curve accelerates
+// over the acceleration duration with a cubic S-curve, reaching one step per tick by the end.
+LOCAL uint16_t *accel_table = NULL;
+
+// The number of steps in the acceleration curve, which is half of its duration in ticks.
+LOCAL uint32_t accel_table_steps = 0;
+
+// The acceleration duration that the acceleration table was calculated for.
+LOCAL uint32_t accel_table_duration = 0;
+
 // The current phase of the accelerated movement.
 LOCAL phases_t current_phase = STATIONARY;
 
 // The current tick that the motor control is up to.
 LOCAL uint32_t current_tick = 0;
 
-// The total number of ticks in the motor control's current sequence.
-LOCAL uint32_t total_ticks = 0;
+// The total number of ticks in the motor control's current sequence, which is zero once the whole
+// sequence has been planned.
+LOCAL volatile uint32_t total_ticks = 0;
 
 // The total number of steps in the motor control's current sequence.
 LOCAL uint32_t total_steps = 0;
@@ -83,18 +164,97 @@ LOCAL bool acceleration_active = false;
 // The callback function to call when the motor control's sequence is complete.
 LOCAL motor_callback_t *motor_cb = NULL;
 
+// The callback function of a completed sequence, waiting to be called by the motor task.
+LOCAL motor_callback_t * volatile completed_cb = NULL;
+
+// The queue for the motor task's events.
+LOCAL os_event_t motor_task_queue[1];
+
+// Flag set whilst the motor task has been posted, and has not yet run.
+LOCAL volatile bool motor_task_posted = false;
+
+// The planned step events, as a circular buffer written by the planner and read by the timer.
+LOCAL step_event_t step_events[STEP_EVENT_COUNT];
+
+// The number of step events read from the buffer by the timer callback, which wraps around.
+LOCAL volatile uint8_t step_read = 0;
+
+// The number of step events written to the buffer by the planner, which wraps around.
+LOCAL volatile uint8_t step_write = 0;
+
+// The number of ticks that have passed since the last step event was written to the GPIO outputs.
+LOCAL uint16_t event_tick = 0;
+
 // The total number of ticks for the next motor control sequence.
 LOCAL int32_t next_total_ticks = 0;
 
 // The number of steps of each stepper motor for the next motor control sequence.
 LOCAL int32_t next_steps[STEPPER_MOTOR_COUNT] = {0, 0};
 
+// Flag set whilst the motors are being driven in velocity mode.
+LOCAL volatile bool velocity_active = false;
+
+// The speeds of each stepper motor in velocity mode.
+LOCAL velocity_data_t velocity_data[STEPPER_MOTOR_COUNT];
+
+// The change in speed allowed in each tick in velocity mode, in VELOCITY_UNITs.
+LOCAL int32_t velocity_ramp = VELOCITY_UNIT;
+
+// The timer used to stop the motors if velocity commands stop arriving.
+LOCAL os_timer_t velocity_timer;
+
+// Flag set when a velocity command has been received, but not yet planned.
+LOCAL bool velocity_command_pending = false;
+
+// The system time that the last velocity command was received, in µs.
+LOCAL uint32_t velocity_command_time = 0;
+
+// The statistics of the velocity commands.
+LOCAL velocity_stats_t velocity_stats;
+
 // The callback function to call when the servo's movement sequence is complete.
 LOCAL motor_callback_t *servo_cb = NULL;
 
-// The timer used for moving the stepper motors.
+// The software timer used for moving the stepper motors.
 LOCAL os_timer_t motor_timer;
 
+// The source of the motor control's ticks.
+LOCAL const tick_source_t *tick_source = NULL;
+
+// The tick source set with set_tick_source, which replaces the configured timer when not NULL.
+LOCAL const tick_source_t *custom_tick_source = NULL;
+
+// The tick function called by the hardware timer's interrupt.
+LOCAL motor_tick_t *hardware_tick = NULL;
+
+// Flag set once the servo's PWM has started. The SDK's PWM driver drives its output from the FRC1
+// hardware timer's interrupt, so the hardware tick source can't be used from then on.
+LOCAL bool servo_pwm_active = false;
+
+// The interval of the tick source's ticks, in µs.
+LOCAL uint32_t tick_interval = 1000;
+
+// Flag set whilst the tick source is running, which is only whilst there is a movement to perform.
+LOCAL bool motor_timer_running = false;
+
+// The number of times the motor timer callback has been called.
+LOCAL volatile uint32_t motor_timer_callbacks = 0;
+
+#ifdef MOTOR_TRACE
+// The most recent step events written to the GPIO outputs, as a circular buffer written by the timer
+// callback, packed as described for read_motor_trace.
+LOCAL uint32_t trace_events[MOTOR_TRACE_COUNT];
+
+// The number of step events recorded in the trace, which wraps around.
+LOCAL volatile uint32_t trace_count = 0;
+
+// The ticks of the events since the last recorded event, which aren't recorded as they don't step.
+LOCAL uint32_t trace_ticks = 0;
+#endif
+
+// The timer used to turn off the motors once they have been idle for long enough.
+LOCAL os_timer_t power_down_timer;
+
 // The timer used for moving the servo motor.
 LOCAL os_timer_t servo_timer;
 
@@ -113,6 +273,9 @@ LOCAL int8_t servo_step_size;
 // The current position of the servo.
 LOCAL servo_position_t servo_pos; 
 
+// Flag set whilst the servo is moving.
+LOCAL bool servo_moving = false;
+
 // S1 - GPIO 2, 15, 12, 14
 // S2 - GPIO 3,  5,  4,  0
 #define STEP_SEQUENCE_COUNT 8
@@ -143,11 +306,129 @@ LOCAL uint32_t step_values[STEPPER_MOTOR_COUNT][STEP_SEQUENCE_COUNT] = {
 	}
 };
 
-// The current step in the step sequence for each motor.
+// The current step in the step sequence for each motor, as planned.
 LOCAL int8_t current_step[STEPPER_MOTOR_COUNT] = {0, 0};
 
-// Calculates the maximum value of two 16-bit integers.
-LOCAL int16_t ICACHE_FLASH_ATTR max16(int16_t a, int16_t b) {
+// The step sequence positions that have been written to the GPIO outputs, in the format of
+// step_event_t's positions. Planned steps that are discarded are rewound to these.
+LOCAL volatile uint8_t output_positions = 0;
+
+// The net number of half steps each motor has moved forwards, from the step events written to the
+// GPIO outputs.
+LOCAL volatile int32_t odometry[STEPPER_MOTOR_COUNT] = {0, 0};
+
+// The drive mode of the current movement.
+LOCAL step_mode_t current_step_mode = HALF_STEP;
+
+// The maximum number of motions that can be queued, including the one in progress.
+#define MOTION_QUEUE_LEN 8
+
+// The queued motions, as a circular buffer.
+LOCAL motion_t motion_queue[MOTION_QUEUE_LEN];
+
+// The index of the motion at the head of the queue, which is in progress when motion_active is set.
+LOCAL uint8_t motion_head = 0;
+
+// The number of motions in the queue.
+LOCAL uint8_t motion_count = 0;
+
+// Flag set whilst the motion at the head of the queue is in progress.
+LOCAL bool motion_active = false;
+
+// The timer used for pauses, both queued and after each movement.
+LOCAL os_timer_t motion_pause_timer;
+
+// The callback function to call when a queued motion starts.
+LOCAL motion_callback_t *motion_start_cb = NULL;
+
+// The callback function to call when a queued motion has completed.
+LOCAL motor_callback_t *motion_complete_cb = NULL;
+
+// The speed that the motion in progress finishes at, which the next motion starts at.
+LOCAL uint32_t motion_exit_speed = 0;
+
+// The timer used to lower the pen ahead of the end of a travel movement.
+LOCAL os_timer_t pen_down_timer;
+
+// Flag set whilst the travel movement in progress lowers the pen for the next motion as it stops.
+LOCAL bool overlap_pen_down = false;
+
+// Flag set once the pen has been lowered ahead of the pen down motion at the head of the queue.
+LOCAL bool pen_lowered_early = false;
+
+// Forward definitions.
+LOCAL void ICACHE_FLASH_ATTR plan_steps();
+LOCAL void ICACHE_FLASH_ATTR plan_velocity();
+LOCAL void ICACHE_FLASH_ATTR discard_step_events();
+LOCAL uint32_t ICACHE_FLASH_ATTR ticks_to_ms(uint32_t ticks);
+LOCAL uint32_t ICACHE_FLASH_ATTR servo_duration();
+LOCAL void ICACHE_FLASH_ATTR start_motor_timer();
+LOCAL void ICACHE_FLASH_ATTR start_next_motion();
+LOCAL void ICACHE_FLASH_ATTR end_motion();
+LOCAL void ICACHE_FLASH_ATTR motion_pause_timer_cb(void *arg);
+
+/*
+ * Calculates the acceleration table for an acceleration duration, if it hasn't already been.
+ *
+ * With a duration of 2A ticks, the position (in steps) after t ticks of the curve is
+ *   P(t) = t^3 / 6A^2                                      for t <= A
+ *   P(t) = A/6 - s^3 / 6A^2 + s^2 / 2A + s/2, with s = t-A for A < t <= 2A
+ * reaching A steps after 2A ticks. The positions are scaled by 6A^2 so that they are calculated
+ * exactly in integer arithmetic, and each step is taken on the first tick that reaches it.
+ * Returns false if the memory for the table could not be allocated.
+ */
+LOCAL bool ICACHE_FLASH_ATTR build_acceleration_table(uint32_t duration) {
+	if ((accel_table_duration == duration) && ((accel_table != NULL) || (accel_table_steps == 0))) {
+		// The table is already calculated.
+		return true;
+	}
+	if (accel_table != NULL) {
+		os_free(accel_table);
+		accel_table = NULL;
+	}
+	accel_table_duration = duration;
+	accel_table_steps = duration / 2;
+	if (accel_table_steps == 0) {
+		// There is no acceleration curve.
+		return true;
+	}
+	accel_table = (uint16_t *)os_malloc(accel_table_steps * sizeof(uint16_t));
+	if (accel_table == NULL) {
+		os_printf("Unable to allocate the acceleration table for %d steps.\n", accel_table_steps);
+		accel_table_steps = 0;
+		accel_table_duration = 0;
+		return false;
+	}
+
+	uint64_t a = accel_table_steps;
+	uint64_t scale = 6 * a * a;
+	uint32_t step = 1;
+	for (uint64_t t = 1; (t <= 2 * a) && (step <= accel_table_steps); t++) {
+		uint64_t position;
+		if (t <= a) {
+			position = t * t * t;
+		} else {
+			uint64_t s = t - a;
+			position = (a * a * a) - (s * s * s) + (3 * a * s * s) + (3 * a * a * s);
+		}
+		if (position >= scale * step) {
+			accel_table[step - 1] = t;
+			step++;
+		}
+	}
+	return true;
+}
+
+/*
+ * Returns the tick of the acceleration curve at which a speed is reached, which is the tick of the
+ * speed's step.
+ */
+LOCAL uint32_t ICACHE_FLASH_ATTR accel_tick(uint32_t speed) {
+	return (speed > 0) ? accel_table[speed - 1] : 0;
+}
+
+// Calculates the maximum value of two 32-bit integers.
+LOCAL int32_t ICACHE_FLASH_ATTR max32(int32_t a, int32_t b) {
 	return (a < b) ? b : a;
 }
 
@@ -176,6 +457,7 @@ LOCAL void ICACHE_FLASH_ATTR set_servo(int8_t position, motor_callback_t *cb) {
 	}
 	servo_step_size = (destination_angle - servo_angle) / steps;
 	servo_step = 0;
+	servo_moving = true;
 
 	// Start the servo timer.
 	uint32_t interval = get_servo_tick_interval();
@@ -209,6 +491,7 @@ LOCAL void ICACHE_FLASH_ATTR servo_timer_cb(void *arg) {
 	if (servo_step >= get_servo_move_steps()) {
 		// We're finished with the servo movement steps.
 		os_timer_disarm(&servo_timer);
+		servo_moving = false;
 		if (servo_cb != NULL) {
 			// Invoke the callback function.
 			servo_cb();
@@ -242,82 +525,182 @@ servo_position_t get_servo(){
 }
 
 /*
- * Performs the actual step of one or both stepper motors.
+ * Calculates the GPIO outputs for a step of one or both stepper motors into a step event.
  * The values passed for each stepper motor has a value that fall into one of three categories:
  * - Positive value - step forwards
  * - Negative value - step backwards
  * - Zero - no step.
  *
- * The magnitude of the number has no bearing on the steps of the motor.
+ * The magnitude of the number is the number of half steps to move through the step sequence.
  *
  * Parameters:
  * stepper1 - number to control the first stepper's movements.
  * stepper2 - number to control the second stepper's movements.
+ * event    - the step event to hold the GPIO outputs.
  */
-LOCAL void ICACHE_FLASH_ATTR step_motors(int8_t stepper1, int8_t stepper2) {
-	uint32_t set_mask = 0;
-	uint32_t clear_mask = 0;
-	uint32_t enable_mask = 0;
-
-	if ((stepper1 == 0) && (stepper2 == 0)) {
-		// Nothing to do, no motor has been asked to move.
-		return;
-	}
-
+LOCAL void ICACHE_FLASH_ATTR plan_step_masks(int8_t stepper1, int8_t stepper2, step_event_t *event) {
 	// Calculate the values for the left stepper motor.
 	if (stepper1 != 0) {
-		int8_t step = (stepper1 < 0) ? 1 : -1;
+		int8_t step = -stepper1;
 		current_step[0] = (current_step[0] + step + STEP_SEQUENCE_COUNT) % STEP_SEQUENCE_COUNT;
-		set_mask |= step_values[0][current_step[0]];
-		clear_mask |= STEPPER_1_MASK & ~step_values[0][current_step[0]];
-		enable_mask |= STEPPER_1_MASK;
+		event->set_mask |= step_values[0][current_step[0]];
+		event->clear_mask |= STEPPER_1_MASK & ~step_values[0][current_step[0]];
+		event->enable_mask |= STEPPER_1_MASK;
+		event->flags |= STEP_EVENT_LEFT | ((stepper1 < 0) ? STEP_EVENT_LEFT_REVERSE : 0);
+		event->strides[0] = stepper1;
 	}
 
 	// Calculate the values for the right stepper motor.
 	if (stepper2 != 0) {
-		int8_t step = (stepper2 < 0) ? 1 : -1;
+		int8_t step = -stepper2;
 		current_step[1] = (current_step[1] + step + STEP_SEQUENCE_COUNT) % STEP_SEQUENCE_COUNT;
-		set_mask |= step_values[1][current_step[1]];
-		clear_mask |= STEPPER_2_MASK & ~step_values[1][current_step[1]];
-		enable_mask |= STEPPER_2_MASK;
+		event->set_mask |= step_values[1][current_step[1]];
+		event->clear_mask |= STEPPER_2_MASK & ~step_values[1][current_step[1]];
+		event->enable_mask |= STEPPER_2_MASK;
+		event->flags |= STEP_EVENT_RIGHT | ((stepper2 < 0) ? STEP_EVENT_RIGHT_REVERSE : 0);
+		event->strides[1] = stepper2;
 	}
+}
 
-	// Set the GPIO outputs to move the selected stepper motors.
-	gpio_output_set(set_mask, clear_mask, enable_mask, 0);
+/*
+ * Calculates the number of half steps that a stepper motor moves by on its next step. Full steps
+ * move by two half steps, except when the motor is first brought to a position with two coils on,
+ * or has only one half step left to move.
+ */
+LOCAL int8_t ICACHE_FLASH_ATTR next_stride(uint8_t motor) {
+	if ((current_step_mode == FULL_STEP) && ((current_step[motor] & 1) != 0) &&
+			(stepper_data[motor].half_steps > 1)) {
+		return 2;
+	}
+	return 1;
+}
+
+/*
+ * Calculates the number of steps a stepper motor takes to move by a number of half steps in a drive
+ * mode, from its current position.
+ */
+LOCAL int32_t ICACHE_FLASH_ATTR mode_steps(uint8_t motor, int32_t half_steps, step_mode_t mode) {
+	if ((mode == HALF_STEP) || (half_steps == 0)) {
+		return half_steps;
+	} else if ((current_step[motor] & 1) != 0) {
+		// Already at a full step position.
+		return (half_steps + 1) / 2;
+	} else {
+		// Take a half step to reach a full step position first.
+		return 1 + (half_steps / 2);
+	}
 }
 
 /*
  * Stops all stepper motors by turning off the current to their coils.
  * This de-enerises the motors, so they will not consume engery, but will also not resist movement.
  */
-void ICACHE_FLASH_ATTR stop_motors() {
+void stop_motors() {
 	gpio_output_set(0, STEPPER_1_MASK | STEPPER_2_MASK, STEPPER_1_MASK | STEPPER_2_MASK, 0);
 }
 
 /*
- * Instructs the stepper motors to move a set amount.
+ * Discards the step events of any movement in progress, and ends velocity mode. The timer may be
+ * reading them from an interrupt, so interrupts are disabled whilst the buffer is emptied, and the
+ * motors' positions are rewound to those last written to the GPIO outputs.
+ */
+LOCAL void ICACHE_FLASH_ATTR discard_step_events() {
+	ETS_INTR_LOCK();
+	step_read = step_write;
+	event_tick = 0;
+	completed_cb = NULL;
+	velocity_active = false;
+	current_step[0] = output_positions & 0x0F;
+	current_step[1] = output_positions >> 4;
+	ETS_INTR_UNLOCK();
+	os_timer_disarm(&velocity_timer);
+}
+
+/*
+ * Calculates the phases of a movement of a number of steps, in the steps of its drive mode. When
+ * accelerating, the acceleration table must already be built, and the movement is entered and left
+ * at speeds along the acceleration curve.
+ */
+LOCAL void ICACHE_FLASH_ATTR plan_phases(
+	uint32_t steps,
+	uint32_t tick_count,
+	bool accelerate,
+	uint32_t entry_speed,
+	uint32_t exit_speed,
+	phase_data_t *phases) {
+	os_memset(phases, 0, sizeof(phase_data_t));
+	phases->cruise_interval = 1;
+	if (accelerate) {
+		// Keep the entry and exit speeds on the curve, and within reach of each other.
+		uint32_t max_speed = accel_table_steps;
+		uint32_t entry = (entry_speed < max_speed) ? entry_speed : max_speed;
+		uint32_t exit = (exit_speed < max_speed) ? exit_speed : max_speed;
+		if (exit > entry + steps) {
+			exit = entry + steps;
+		} else if (entry > exit + steps) {
+			exit = entry - steps;
+		}
+
+		// Find the peak speed, which is one step per tick if there are enough steps to reach it.
+		uint32_t peak = max_speed;
+		if ((2 * max_speed) - entry - exit > steps) {
+			// We don't finish accelerating before it's time to decelerate, so accelerate for half
+			// of the remaining steps, finishing on the tick that the acceleration table takes the
+			// last one.
+			peak = (steps + entry + exit) / 2;
+		}
+		phases->entry_speed = entry;
+		phases->exit_speed = exit;
+		phases->accel_base = accel_tick(entry);
+		phases->accel_steps = peak - entry;
+		phases->accel_limit = accel_tick(peak) - phases->accel_base;
+		phases->decel_base = accel_tick(exit);
+		phases->decel_steps = peak - exit;
+		phases->decel_limit = accel_tick(peak) - phases->decel_base;
+
+		// Cruise at the peak speed, which is the interval of the curve's next step below full speed.
+		if (peak < max_speed) {
+			phases->cruise_interval = accel_table[peak] - accel_tick(peak);
+		}
+		phases->cruise_duration = (steps - (2 * peak) + entry + exit) *
+				phases->cruise_interval;
+	} else {
+		phases->cruise_duration = tick_count;
+	}
+}
+
+/*
+ * Instructs the stepper motors to move a set amount, entering and leaving the movement at a speed
+ * along the acceleration curve when accelerating.
  *
  * Parameters:
  * left_steps  - the number of steps for the left stepper motor to advance
  * right_steps - the number of steps for the right stepper motor to advance
  * tick_count  - the number of ticks over which the left and right steppers are moving
-                 This is not used when acceleration is enabled
+ *               This is not used when acceleration is enabled
  * accelerate  - flag set when acceleration is required
+ * entry_speed - the speed at the start of the movement, when accelerating
+ * exit_speed  - the speed at the end of the movement, when accelerating
+ * mode        - the drive mode of the stepper motors, the step counts are always in half steps
  * cb          - the call-back function to be invoked when the steps have been completed.
  */
-void ICACHE_FLASH_ATTR drive_motors(
-	int16_t left_steps, 
-	int16_t right_steps,
-	uint16_t tick_count,
+LOCAL void ICACHE_FLASH_ATTR plan_movement(
+	int32_t left_steps,
+	int32_t right_steps,
+	uint32_t tick_count,
 	bool accelerate,
+	uint32_t entry_speed,
+	uint32_t exit_speed,
+	step_mode_t mode,
 	motor_callback_t *cb) {
 
+	discard_step_events();
+
 	// Set the global variables.
 	total_ticks = 0;
 	total_steps = 0;
 	current_tick = 0;
-	current_phase = accelerate ? ACCEL_1 : CRUISING;
-	acceleration_active = accelerate;
+	current_phase = STATIONARY;
 	motor_cb = cb;
 
 	//os_printf("drive_motors, l=%d, r=%d, tc=%d, a=%d.\n", left_steps, right_steps, tick_count, accelerate);
@@ -326,59 +709,27 @@ void ICACHE_FLASH_ATTR drive_motors(
 		return;
 	}
 
-	// Set the phases.
-	uint32_t steps = max16(ABS(left_steps), ABS(right_steps));
-	if (accelerate) {
-		phase_data.accel_limit = get_acceleration_duration();
-		phase_data.accel_duration = phase_data.accel_limit / 2;
-		phase_data.cruise_duration = steps - (2 * phase_data.accel_duration);
-		phase_data.phase_tick = 0;
-		os_printf("al=%d, ad=%d, cd=%d.\n", phase_data.accel_limit, phase_data.accel_duration, phase_data.cruise_duration);
-		if (phase_data.accel_duration > (steps/2)) {
-			// We don't finish accelerating before it's time to decelerate.
-			uint32_t target = steps / 2;
-			uint32_t left = 0;
-			uint32_t right = get_acceleration_duration();
-			uint32_t mid;
-			float crossover = phase_data.accel_duration;
-			crossover = (crossover * crossover * crossover) /
-				(6 * phase_data.accel_duration * phase_data.accel_duration);
-			float m_value;
-			os_printf("a_d: %d, st: %d, t: %d.\n",
-					phase_data.accel_duration, steps, target);
-			while (left < right) {
-				mid = (left + right) / 2;
-				m_value = (float)mid;
-				if (mid <= phase_data.accel_duration) {
-					m_value = (m_value * m_value * m_value) /
-						(6 * phase_data.accel_duration * phase_data.accel_duration);
-				} else {
-					m_value -= phase_data.accel_duration;
-					m_value = -((m_value * m_value * m_value) / 
-						(6 * phase_data.accel_duration * phase_data.accel_duration)) +
-						((m_value * m_value) / (2 * phase_data.accel_duration)) +
-						(m_value / 2) +
-						crossover;
-				}
-				os_printf("left=%d, right=%d, mid=%d, m_v=%.4lf.\n", 
-						left, right, mid, m_value);
-				if (((uint32_t)m_value) < target) {
-					left = mid + 1;
-				} else {
-					right = mid;
-				}
-			}
-			mid = left;
-			phase_data.accel_limit = mid;
-			phase_data.cruise_duration = steps - (2*target);
-			os_printf("mid=%d, a_l=%d, c_d=%d.\n",
-					mid, phase_data.accel_limit, phase_data.cruise_duration);
-		}
+	// Convert the half steps to the steps of the drive mode, then set the phases.
+	current_step_mode = mode;
+	int32_t half_steps[] = {ABS(left_steps), ABS(right_steps)};
+	left_steps = (left_steps < 0) ? -mode_steps(0, half_steps[0], mode) :
+			mode_steps(0, half_steps[0], mode);
+	right_steps = (right_steps < 0) ? -mode_steps(1, half_steps[1], mode) :
+			mode_steps(1, half_steps[1], mode);
+	uint32_t steps = max32(ABS(left_steps), ABS(right_steps));
+	if (accelerate && !build_acceleration_table(get_acceleration_duration())) {
+		// Without the acceleration table, move at a constant speed.
+		accelerate = false;
+		tick_count = steps;
+	}
+	acceleration_active = accelerate;
+	plan_phases(steps, tick_count, accelerate, entry_speed, exit_speed, &phase_data);
+	if (phase_data.accel_limit > 0) {
+		current_phase = ACCELERATING;
+	} else if (phase_data.cruise_duration > 0) {
+		current_phase = CRUISING;
 	} else {
-		phase_data.accel_limit = 0;
-		phase_data.accel_duration = 0;
-		phase_data.cruise_duration = tick_count;
-		phase_data.phase_tick = 0;
+		current_phase = DECELERATING;
 	}
 
 	// Set the per-stepper values, first for the left stepper.
@@ -387,6 +738,7 @@ void ICACHE_FLASH_ATTR drive_motors(
 	stepper_data[0].step = 0;
 	stepper_data[0].last_step = -1;
 	stepper_data[0].direction = (left_steps > 0) ? 1 : -1;
+	stepper_data[0].half_steps = half_steps[0];
 
 	// Now for the right stepper
 	stepper_data[1].steps = ABS(right_steps);
@@ -394,126 +746,102 @@ void ICACHE_FLASH_ATTR drive_motors(
 	stepper_data[1].step = 0;
 	stepper_data[1].last_step = -1;
 	stepper_data[1].direction = (right_steps > 0) ? 1 : -1;
+	stepper_data[1].half_steps = half_steps[1];
 
-	// Finally, set the totals, and we're good to go.
+	// Finally, set the totals, and plan the first of the steps.
 	total_steps = steps;
-	if (accelerate) {
-		total_ticks = 2*phase_data.accel_limit + phase_data.cruise_duration;
-	} else {
-		total_ticks = tick_count;
-	}
+	total_ticks = phase_data.accel_limit + phase_data.cruise_duration + phase_data.decel_limit;
+	plan_steps();
+	start_motor_timer();
 }
 
 /*
- * Timer callback used to determine if any stepper needs to move to the next step.
+ * Instructs the stepper motors to move a set amount, accelerating from and decelerating to a stop.
+ *
+ * Parameters:
+ * left_steps  - the number of steps for the left stepper motor to advance
+ * right_steps - the number of steps for the right stepper motor to advance
+ * tick_count  - the number of ticks over which the left and right steppers are moving
+                 This is not used when acceleration is enabled
+ * accelerate  - flag set when acceleration is required
+ * cb          - the call-back function to be invoked when the steps have been completed.
  */
-LOCAL void ICACHE_FLASH_ATTR motor_timer_cb(void *arg) {
-	// Count of the number of idle cycles for the motors.
-	// This value is stored between calls to this method.
-	static uint32_t idle_count = 0;
-
-	// Make sure we have something to do.
-	if (total_ticks <= 0) {
-		if (++idle_count > MAX_IDLE_COUNT) {
-			// The motors have been idle for too long, turn them off to save electricity.
-			stop_motors();
-			idle_count = 0;
-		}
-		return;
-	} else {
-		// We have something to do, so we're not idle.
-		idle_count = 0;
-	}
+void ICACHE_FLASH_ATTR drive_motors(
+	int16_t left_steps, 
+	int16_t right_steps,
+	uint16_t tick_count,
+	bool accelerate,
+	motor_callback_t *cb) {
+	plan_movement(left_steps, right_steps, tick_count, accelerate, 0, 0, HALF_STEP, cb);
+}
 
-	float position;
-	float tick = ++phase_data.phase_tick;
+/*
+ * Plans one tick of the current movement, determining whether any stepper needs to move to the next
+ * step on it. The GPIO outputs for the steps are added to the step event.
+ * Returns true if the movement is complete after this tick.
+ */
+LOCAL bool ICACHE_FLASH_ATTR plan_tick(step_event_t *event) {
+	// Determine whether to step this tick from the phase of the movement. The acceleration curve is
+	// looked up from the acceleration table, and deceleration mirrors it.
+	phases_t phase = current_phase;
+	uint32_t tick = ++phase_data.phase_tick;
 	current_tick++;
-	bool reset = false;
+	bool step = false;
 	bool complete = false;
 	switch (current_phase) {
-		case ACCEL_1:
-			position = (tick * tick * tick) /
-				(6 * phase_data.accel_duration * phase_data.accel_duration);
+		case ACCELERATING:
+			if ((phase_data.phase_step < phase_data.accel_steps) && (tick + phase_data.accel_base >=
+					accel_table[phase_data.entry_speed + phase_data.phase_step])) {
+				step = true;
+			}
 			if (tick >= phase_data.accel_limit) {
-				// We've passed the acceleration limit, skip ahead.
-				if (phase_data.cruise_duration > 0) {
-					current_phase = CRUISING;
-				} else {
-					current_phase = DECEL_1;
-				}
-				reset = true;
-			} else if (tick >= phase_data.accel_duration) {
 				// Move to the next phase of the movement.
-				current_phase = ACCEL_2;
-				reset = true;
-			}
-			break;
-		case ACCEL_2:
-			position = -((tick * tick * tick) / 
-					(6 * phase_data.accel_duration * phase_data.accel_duration)) +
-				((tick * tick) / (2 * phase_data.accel_duration)) +
-				(tick / 2);
-			//os_printf("p=%.4lf, t=%.2lf, a_d=%d, a_l=%d.\n",
-			//		position, tick, phase_data.accel_duration, phase_data.accel_limit);
-			if ((tick + phase_data.accel_duration) >= phase_data.accel_limit) {
-				// We've passed the acceleration limit, skip ahead.
 				if (phase_data.cruise_duration > 0) {
 					current_phase = CRUISING;
+				} else if (phase_data.decel_limit > 0) {
+					current_phase = DECELERATING;
 				} else {
-					current_phase = DECEL_1;
+					complete = true;
+					current_phase = STATIONARY;
 				}
-				reset = true;
-			} else if (tick >= phase_data.accel_limit) {
-				// Move to the next phase of the movement.
-				current_phase = CRUISING;
-				reset = true;
 			}
 			break;
 		case CRUISING:
-			position = phase_data.last_position + 1;
+			step = (tick % phase_data.cruise_interval) == 0;
 			if (tick >= phase_data.cruise_duration) {
 				// Move to the next phase of the movement.
-				if (!acceleration_active) {
-					// There is no next phase without acceleration.
+				if ((!acceleration_active) || (phase_data.decel_limit == 0)) {
+					// There is no next phase without deceleration.
 					complete = true;
 					current_phase = STATIONARY;
 				} else {
-					current_phase = DECEL_1;
+					current_phase = DECELERATING;
 				}
-				reset = true;
 			}
 			break;
-		case DECEL_1:
-			position = -((tick * tick * tick) /
-					(6 * phase_data.accel_duration * phase_data.accel_duration)) +
-				tick;
-			if (tick >= phase_data.accel_duration) {
-				// Move to the next phase of the movement.
-				current_phase = DECEL_2;
-				reset = true;
+		case DECELERATING: {
+			// Step when the remaining ticks fall below the curve's tick for the remaining steps,
+			// measured from the exit speed.
+			uint32_t remaining = phase_data.decel_steps - phase_data.phase_step;
+			if ((remaining > 0) && ((phase_data.decel_limit - tick) <
+					accel_table[phase_data.exit_speed + remaining - 1] - phase_data.decel_base)) {
+				step = true;
 			}
-			break;
-		case DECEL_2:
-			position = (tick * tick * tick) /
-				(6 * phase_data.accel_duration * phase_data.accel_duration) -
-				((tick * tick) / (2 * phase_data.accel_duration)) + 
-				(tick / 2);
-			if (tick >= phase_data.accel_duration) {
+			if (tick >= phase_data.decel_limit) {
 				// We are now done.
 				complete = true;
 				current_phase = STATIONARY;
-				reset = true;
 			}
-			break;
-		defaule:
+			} break;
+		default:
 			// We shouldn't get here.
+			complete = true;
 			current_phase = STATIONARY;
-			reset = true;
 	}
 
 	// See if we need to step.
-	if ((position - phase_data.last_position) >= 1.0) {
-		phase_data.last_position += 1.0;
+	if (step) {
+		phase_data.phase_step++;
 
 		// Determine whether which of the motors should be stepping this tick.
 		bool steps[] = {false, false};
@@ -547,65 +875,791 @@ LOCAL void ICACHE_FLASH_ATTR motor_timer_cb(void *arg) {
 
 		// Step the appropriate motor(s).
 		if ((steps[0]) || (steps[1])) {
-			step_motors((steps[0]) ? stepper_data[0].direction : 0,
-						(steps[1]) ? stepper_data[1].direction : 0);
+			int8_t strides[] = {0, 0};
+			for (uint8_t ii = 0; ii <= 1; ii++) {
+				if (steps[ii]) {
+					strides[ii] = next_stride(ii);
+					stepper_data[ii].half_steps -= strides[ii];
+					strides[ii] *= (int8_t)stepper_data[ii].direction;
+				}
+			}
+			plan_step_masks(strides[0], strides[1], event);
+			event->flags |= phase << STEP_EVENT_PHASE_SHIFT;
 		}
 	}
 
 	// If we're at the end of a phase, we reset the counters.
-	if (reset) {
+	if (current_phase != phase) {
 		phase_data.phase_tick = 0;
-		if (phase_data.accel_limit != (2*phase_data.accel_duration)) {
-			if (current_phase == DECEL_1) {
-				float correction;
-				if (phase_data.accel_limit <= phase_data.accel_duration) {
-					// We need to skip the deceleration 1 phase.
-					current_phase = DECEL_2;
-					phase_data.phase_tick = phase_data.accel_duration - phase_data.accel_limit;
-					correction = phase_data.phase_tick;
-					correction = (correction * correction * correction) /
-						(6 * phase_data.accel_duration * phase_data.accel_duration) -
-						((correction * correction) / (2 * phase_data.accel_duration)) + 
-						(correction / 2);
-				} else {
-					// Count the ticks remaining from the end of the phase.
-					phase_data.phase_tick = (2*phase_data.accel_duration) - phase_data.accel_limit;
-					correction = phase_data.phase_tick;
-					correction = -((correction * correction * correction) /
-							(6 * phase_data.accel_duration * phase_data.accel_duration)) +
-							correction;
-				}
-				phase_data.last_position += correction;
-			} else if ((current_phase == DECEL_2) &&
-					(phase_data.accel_limit < phase_data.accel_duration)) {
-				// Count the ticks remaining from the end of the phase.
-				phase_data.phase_tick = phase_data.accel_duration - phase_data.accel_limit;
+		phase_data.phase_step = 0;
+	}
+
+	return complete;
+}
+
+/*
+ * Plans the ticks of velocity mode into the step event buffer, a tick per event, up to VELOCITY_LEAD
+ * ticks ahead. Each motor's speed is ramped towards its target by the acceleration allowed in a
+ * tick, and the motor takes a half step each time its speeds add up to one. Velocity mode ends once
+ * both motors have stopped with no speed to ramp towards.
+ */
+LOCAL void ICACHE_FLASH_ATTR plan_velocity() {
+	while (velocity_active && ((uint8_t)(step_write - step_read) < VELOCITY_LEAD)) {
+		step_event_t *event = &step_events[step_write % STEP_EVENT_COUNT];
+		os_memset(event, 0, sizeof(step_event_t));
+		event->ticks = 1;
+
+		bool moving = false;
+		phases_t phase = STATIONARY;
+		int8_t strides[] = {0, 0};
+		for (uint8_t ii = 0; ii < STEPPER_MOTOR_COUNT; ii++) {
+			velocity_data_t *data = &velocity_data[ii];
+			if (data->speed != data->target) {
+				phase = (ABS(data->target) > ABS(data->speed)) ? ACCELERATING : DECELERATING;
+			}
+			if (data->speed < data->target) {
+				data->speed = ((data->target - data->speed) > velocity_ramp) ?
+						data->speed + velocity_ramp : data->target;
+			} else if (data->speed > data->target) {
+				data->speed = ((data->speed - data->target) > velocity_ramp) ?
+						data->speed - velocity_ramp : data->target;
 			}
+			if ((data->speed != 0) || (data->target != 0)) {
+				moving = true;
+			}
+			data->distance += ABS(data->speed);
+			if (data->distance >= VELOCITY_UNIT) {
+				data->distance -= VELOCITY_UNIT;
+				strides[ii] = (data->speed > 0) ? 1 : -1;
+			}
+		}
+		plan_step_masks(strides[0], strides[1], event);
+		event->flags |= phase << STEP_EVENT_PHASE_SHIFT;
+		event->positions = current_step[0] | (current_step[1] << 4);
+		if (velocity_command_pending) {
+			event->flags |= STEP_EVENT_COMMAND;
+			velocity_command_pending = false;
+		}
+		if (!moving) {
+			event->flags |= STEP_EVENT_LAST;
+			velocity_active = false;
+			os_timer_disarm(&velocity_timer);
+		}
+		step_write++;
+	}
+}
+
+/*
+ * Plans the steps of the current movement into the step event buffer, until either the buffer is
+ * full or the whole movement has been planned. Each event is the next tick that steps either motor,
+ * or the movement's last tick.
+ */
+LOCAL void ICACHE_FLASH_ATTR plan_steps() {
+	if (velocity_active) {
+		plan_velocity();
+		return;
+	}
+	while ((total_ticks > 0) && ((uint8_t)(step_write - step_read) < STEP_EVENT_COUNT)) {
+		step_event_t *event = &step_events[step_write % STEP_EVENT_COUNT];
+		os_memset(event, 0, sizeof(step_event_t));
+		bool complete = false;
+		while ((!complete) && (event->enable_mask == 0) && (event->ticks < 0xFFFF)) {
+			event->ticks++;
+			complete = plan_tick(event);
+		}
+		event->positions = current_step[0] | (current_step[1] << 4);
+		if (complete) {
+			event->flags |= STEP_EVENT_LAST;
+			total_ticks = 0;
+			total_steps = 0;
+		}
+		step_write++;
+	}
+}
+
+/*
+ * Posts the motor task, if it is not already waiting to run.
+ */
+LOCAL void post_motor_task() {
+	if (!motor_task_posted) {
+		motor_task_posted = system_os_post(MOTOR_TASK_PRI, 0, 0);
+	}
+}
+
+/*
+ * Timer callback that writes each planned step event to the GPIO outputs once its tick is reached.
+ * This is called from the hardware timer's interrupt, so it and the functions it calls must not be
+ * in flash memory.
+ */
+LOCAL void motor_timer_cb(void *arg) {
+	motor_timer_callbacks++;
+
+	// Make sure we have something to do, otherwise have the motor task stop the timer.
+	if (step_read == step_write) {
+		post_motor_task();
+		return;
+	}
+
+	step_event_t *event = &step_events[step_read % STEP_EVENT_COUNT];
+	if (++event_tick < event->ticks) {
+		// It's not yet time for this event.
+		return;
+	}
+	event_tick = 0;
+	if (event->enable_mask != 0) {
+		gpio_output_set(event->set_mask, event->clear_mask, event->enable_mask, 0);
+		output_positions = event->positions;
+		odometry[0] += event->strides[0];
+		odometry[1] += event->strides[1];
+	}
+#ifdef MOTOR_TRACE
+	// Record the event in the trace, adding in the ticks of the preceding events without steps. Gaps
+	// too long to record (after a pause or a slow start) are saturated.
+	trace_ticks += event->ticks;
+	if (event->flags & (STEP_EVENT_LEFT | STEP_EVENT_RIGHT | STEP_EVENT_LAST)) {
+		uint32_t ticks = (trace_ticks > 0xFFFF) ? 0xFFFF : trace_ticks;
+		trace_events[trace_count++ % MOTOR_TRACE_COUNT] =
+				(ticks << 16) | (event->positions << 8) | event->flags;
+		trace_ticks = 0;
+	}
+#endif
+	if (event->flags & STEP_EVENT_COMMAND) {
+		// Record how long the velocity command took to act on.
+		velocity_stats.latency = system_get_time() - velocity_command_time;
+		if (velocity_stats.latency > velocity_stats.max_latency) {
+			velocity_stats.max_latency = velocity_stats.latency;
 		}
-		phase_data.last_position -= position;
 	}
+	if ((event->flags & STEP_EVENT_LAST) && (motor_cb != NULL)) {
+		// Invoke the callback function from the motor task, outside of any interrupt.
+		completed_cb = motor_cb;
+	}
+	step_read++;
+
+	uint8_t buffered = step_write - step_read;
+	if ((completed_cb != NULL) || (buffered == 0) ||
+			((total_ticks > 0) && (buffered <= STEP_EVENT_REFILL)) ||
+			(velocity_active && (buffered <= VELOCITY_REFILL))) {
+		// Have the motor task plan more steps, report the completed movement, or stop the timer.
+		post_motor_task();
+	}
+}
 
-	if (complete) {
+/*
+ * Starts the motor timer for a movement, if it's not already running.
+ */
+LOCAL void ICACHE_FLASH_ATTR start_motor_timer() {
+	os_timer_disarm(&power_down_timer);
+	if (!motor_timer_running && (tick_source != NULL)) {
+		motor_timer_running = true;
+		tick_source->start(tick_interval, motor_timer_cb);
+	}
+}
+
+/*
+ * Stops the motor timer once there are no movements left to perform, and starts the timer to turn
+ * the motors off if they stay idle.
+ */
+LOCAL void ICACHE_FLASH_ATTR stop_motor_timer() {
+	if (motor_timer_running) {
+		motor_timer_running = false;
+		tick_source->stop();
+		os_timer_arm(&power_down_timer, MAX_IDLE_TIME, false);
+	}
+}
+
+/*
+ * Timer callback used to turn the motors off to save electricity, once they have been idle for too
+ * long.
+ */
+LOCAL void ICACHE_FLASH_ATTR power_down_timer_cb(void *arg) {
+	stop_motors();
+}
+
+/*
+ * Task used to plan further steps of the current motor control sequence, to invoke the callback
+ * function of a completed sequence, and to stop the motor timer when there is nothing left to do.
+ */
+LOCAL void ICACHE_FLASH_ATTR motor_task(os_event_t *event) {
+	motor_task_posted = false;
+	plan_steps();
+
+	motor_callback_t *cb = completed_cb;
+	completed_cb = NULL;
+	if (cb != NULL) {
+		cb();
+	}
+
+	// The callback may have started another movement.
+	if ((step_read == step_write) && (total_ticks == 0) && !velocity_active) {
+		stop_motor_timer();
+	}
+}
+
+/*
+ * Starts the software timer's ticks, rounding the interval to whole milliseconds.
+ */
+LOCAL void ICACHE_FLASH_ATTR software_timer_start(uint32_t interval, motor_tick_t *tick) {
+	interval /= 1000;
+	if (interval <= 0) {
+		interval = 1;
+	}
+	os_timer_disarm(&motor_timer);
+	os_timer_setfn(&motor_timer, (os_timer_func_t *)tick, (void *)0);
+	os_timer_arm(&motor_timer, interval, 1);
+}
+
+/*
+ * Stops the software timer's ticks.
+ */
+LOCAL void ICACHE_FLASH_ATTR software_timer_stop() {
+	os_timer_disarm(&motor_timer);
+}
+
+// The millisecond software timer tick source.
+LOCAL const tick_source_t software_tick_source = {software_timer_start, software_timer_stop};
+
+/*
+ * Interrupt handler for the FRC1 hardware timer.
+ */
+LOCAL void hardware_timer_isr(void *arg) {
+	RTC_CLR_REG_MASK(FRC1_INT_ADDRESS, FRC1_INT_CLR_MASK);
+	if (hardware_tick != NULL) {
+		hardware_tick(arg);
+	}
+}
+
+/*
+ * Starts the FRC1 hardware timer's ticks, with an interval in µs.
+ */
+LOCAL void ICACHE_FLASH_ATTR hardware_timer_start(uint32_t interval, motor_tick_t *tick) {
+	ETS_FRC1_INTR_DISABLE();
+	hardware_tick = tick;
+	ETS_FRC_TIMER1_INTR_ATTACH(hardware_timer_isr, NULL);
+	RTC_REG_WRITE(FRC1_CTRL_ADDRESS, FRC1_CTRL_ENABLE | FRC1_CTRL_AUTO_LOAD | FRC1_CTRL_DIV_16);
+	RTC_REG_WRITE(FRC1_LOAD_ADDRESS, interval * FRC1_TICKS_PER_US);
+	TM1_EDGE_INT_ENABLE();
+	ETS_FRC1_INTR_ENABLE();
+}
+
+/*
+ * Stops the FRC1 hardware timer's ticks.
+ */
+LOCAL void ICACHE_FLASH_ATTR hardware_timer_stop() {
+	ETS_FRC1_INTR_DISABLE();
+	TM1_EDGE_INT_DISABLE();
+	RTC_REG_WRITE(FRC1_CTRL_ADDRESS, 0);
+	hardware_tick = NULL;
+}
+
+// The microsecond FRC1 hardware timer tick source.
+LOCAL const tick_source_t hardware_tick_source = {hardware_timer_start, hardware_timer_stop};
+
+/*
+ * Timer callback used to stop the motors in velocity mode when velocity commands stop arriving, such
+ * as when the remote control's connection is lost.
+ */
+LOCAL void ICACHE_FLASH_ATTR velocity_timer_cb(void *arg) {
+	velocity_stats.timeouts++;
+	velocity_data[0].target = 0;
+	velocity_data[1].target = 0;
+}
+
+/*
+ * Converts a speed in half steps per 100 ticks to VELOCITY_UNITs, limited to one step per tick.
+ */
+LOCAL int32_t ICACHE_FLASH_ATTR velocity_speed(int16_t speed) {
+	if (speed > VELOCITY_FULL_SPEED) {
+		speed = VELOCITY_FULL_SPEED;
+	} else if (speed < -VELOCITY_FULL_SPEED) {
+		speed = -VELOCITY_FULL_SPEED;
+	}
+	return (int32_t)speed * VELOCITY_UNIT / VELOCITY_FULL_SPEED;
+}
+
+/*
+ * Converts a number of motor timer ticks to ms.
+ */
+LOCAL uint32_t ICACHE_FLASH_ATTR ticks_to_ms(uint32_t ticks) {
+	return (uint32_t)(((uint64_t)ticks * tick_interval) / 1000);
+}
+
+/*
+ * Estimates the duration of a movement of the stepper motors, as made by drive_motors.
+ */
+void ICACHE_FLASH_ATTR estimate_movement(
+		int32_t left_steps,
+		int32_t right_steps,
+		uint16_t tick_count,
+		bool accelerate,
+		motion_estimate_t *estimate) {
+	uint32_t steps = max32(ABS(left_steps), ABS(right_steps));
+	estimate->ticks = 0;
+	if (steps > 0) {
+		if (accelerate && !build_acceleration_table(get_acceleration_duration())) {
+			accelerate = false;
+			tick_count = steps;
+		}
+		phase_data_t phases;
+		plan_phases(steps, tick_count, accelerate, 0, 0, &phases);
+		estimate->ticks = phases.accel_limit + phases.cruise_duration + phases.decel_limit;
+	}
+	estimate->ms = ticks_to_ms(estimate->ticks);
+}
+
+/*
+ * Estimates the duration of a queued motion, including its post movement pause.
+ */
+void ICACHE_FLASH_ATTR estimate_motion(
+		const motion_t *motion, servo_position_t pen, motion_estimate_t *estimate) {
+	estimate->ticks = 0;
+	estimate->ms = 0;
+	switch (motion->type) {
+		case MOTION_STEPS: {
+			// Travel with the pen up may be in full steps, which cover two half steps each.
+			int32_t left = motion->left_steps;
+			int32_t right = motion->right_steps;
+			if ((pen == UP) && get_full_step_travel()) {
+				left = (ABS(left) + 1) / 2;
+				right = (ABS(right) + 1) / 2;
+			}
+			estimate_movement(left, right, 0, true, estimate);
+			estimate->ms += get_move_pause_duration();
+			} break;
+		case MOTION_PEN_UP:
+		case MOTION_PEN_DOWN:
+			estimate->ms = servo_duration() + get_move_pause_duration();
+			break;
+		case MOTION_PAUSE:
+			estimate->ms = motion->duration;
+			break;
+	}
+}
+
+/*
+ * Drives the stepper motors continuously in velocity mode, ramping to the new speeds.
+ */
+void ICACHE_FLASH_ATTR drive_velocity(int16_t left, int16_t right) {
+	velocity_stats.commands++;
+	if (!velocity_active) {
+		if ((left == 0) && (right == 0)) {
+			// There's nothing to do.
+			return;
+		}
+
+		// Abandon any movement in progress, and start from stationary.
+		discard_step_events();
 		total_ticks = 0;
 		total_steps = 0;
-		if (motor_cb != NULL) {
-			// Invoke the callback function.
-			motor_cb();
+		current_phase = STATIONARY;
+		motor_cb = NULL;
+		current_step_mode = HALF_STEP;
+		os_memset(velocity_data, 0, sizeof(velocity_data));
+		uint32_t duration = get_acceleration_duration();
+		velocity_ramp = (duration > 0) ? (VELOCITY_UNIT / duration) : VELOCITY_UNIT;
+		if (velocity_ramp <= 0) {
+			velocity_ramp = 1;
 		}
+		velocity_active = true;
+	}
+	velocity_data[0].target = velocity_speed(left);
+	velocity_data[1].target = velocity_speed(right);
+	velocity_command_time = system_get_time();
+	velocity_command_pending = true;
+
+	// Restart the dead-man timeout.
+	os_timer_disarm(&velocity_timer);
+	os_timer_arm(&velocity_timer, VELOCITY_TIMEOUT, false);
+
+	plan_steps();
+	start_motor_timer();
+}
+
+/*
+ * Retrieves the statistics of velocity mode's remote control commands.
+ */
+void ICACHE_FLASH_ATTR get_velocity_stats(velocity_stats_t *stats) {
+	os_memcpy(stats, &velocity_stats, sizeof(velocity_stats_t));
+}
+
+/*
+ * Retrieves the net number of half steps each motor has moved forwards.
+ */
+void ICACHE_FLASH_ATTR get_odometry(int32_t *left, int32_t *right) {
+	// Re-read the values if the timer callback updated them whilst they were being read.
+	do {
+		*left = odometry[0];
+		*right = odometry[1];
+	} while ((*left != odometry[0]) || (*right != odometry[1]));
+}
+
+/*
+ * Adds a motion to the end of the motion queue, starting it if the motors are not busy with a
+ * queued motion. Returns false if the queue is full.
+ */
+bool ICACHE_FLASH_ATTR queue_motion(const motion_t *motion) {
+	if (motion_count >= MOTION_QUEUE_LEN) {
+		return false;
+	}
+	uint8_t tail = (motion_head + motion_count) % MOTION_QUEUE_LEN;
+	os_memcpy(&motion_queue[tail], motion, sizeof(motion_t));
+	motion_count++;
+	if (!motion_active) {
+		start_next_motion();
+	}
+	return true;
+}
+
+/*
+ * Returns true if there are no queued motions, including one in progress.
+ */
+bool ICACHE_FLASH_ATTR is_motion_queue_empty() {
+	return motion_count == 0;
+}
+
+/*
+ * Discards all queued motions, and stops the motors and any pause in progress.
+ */
+void ICACHE_FLASH_ATTR clear_motion_queue() {
+	motion_count = 0;
+	motion_active = false;
+	motion_exit_speed = 0;
+	os_timer_disarm(&motion_pause_timer);
+	os_timer_disarm(&pen_down_timer);
+	overlap_pen_down = false;
+	pen_lowered_early = false;
+
+	// Stop the stepper motors, and ignore the completion of any servo movement in progress.
+	drive_motors(0, 0, 1, false, NULL);
+	servo_cb = NULL;
+}
+
+/*
+ * Sets the functions called as each queued motion starts and after it has completed.
+ */
+void ICACHE_FLASH_ATTR set_motion_callbacks(
+		motion_callback_t *start_cb, motor_callback_t *complete_cb) {
+	motion_start_cb = start_cb;
+	motion_complete_cb = complete_cb;
+}
+
+/*
+ * Returns the number of steps of a queued motion, or zero if it doesn't move the stepper motors.
+ */
+LOCAL uint32_t ICACHE_FLASH_ATTR motion_steps(const motion_t *motion) {
+	if (motion->type != MOTION_STEPS) {
+		return 0;
 	}
+	return max32(ABS(motion->left_steps), ABS(motion->right_steps));
 }
 
 /*
- * (Re)initialises the motor timer.
+ * Calculates the maximum speed at the junction between two queued motions.
+ *
+ * Each motor's speed at the junction is its share of the motions' steps, so the junction is limited
+ * by the largest change in a motor's share: motions that keep the same proportions between the
+ * motors join at full speed, and those that reverse a motor, or are not stepper motor movements,
+ * join stationary.
+ */
+LOCAL uint32_t ICACHE_FLASH_ATTR junction_speed(const motion_t *from, const motion_t *to) {
+	uint64_t from_steps = motion_steps(from);
+	uint64_t to_steps = motion_steps(to);
+	if ((from_steps == 0) || (to_steps == 0)) {
+		return 0;
+	}
+
+	// The change in each motor's share of the steps, scaled by the product of the step counts.
+	int64_t left = ((int64_t)from->left_steps * to_steps) - ((int64_t)to->left_steps * from_steps);
+	int64_t right = ((int64_t)from->right_steps * to_steps) - ((int64_t)to->right_steps * from_steps);
+	uint64_t change = (uint64_t)((ABS(left) > ABS(right)) ? ABS(left) : ABS(right));
+	uint64_t scale = from_steps * to_steps;
+	if (change >= scale) {
+		return 0;
+	}
+	return accel_table_steps - (uint32_t)((accel_table_steps * change + scale - 1) / scale);
+}
+
+/*
+ * Calculates the speed that the motion at the head of the queue can finish at, looking ahead over
+ * the queued motions. Working back from the last queued motion, which must finish stationary, each
+ * motion can start no faster than its junction with the previous motion allows, nor faster than it
+ * can decelerate from over its steps. The head motion's finishing speed is further limited to what
+ * it can accelerate to from its starting speed.
+ */
+LOCAL uint32_t ICACHE_FLASH_ATTR plan_exit_speed(uint32_t entry_speed, step_mode_t mode) {
+	// The motions that the head motion can join all share its drive mode, as a pen movement between
+	// motions stops the turtle.
+	uint32_t divisor = (mode == FULL_STEP) ? 2 : 1;
+	uint32_t speed = 0;
+	for (int ii = motion_count - 1; ii >= 1; ii--) {
+		const motion_t *motion = &motion_queue[(motion_head + ii) % MOTION_QUEUE_LEN];
+		const motion_t *previous = &motion_queue[(motion_head + ii - 1) % MOTION_QUEUE_LEN];
+		uint32_t limit = junction_speed(previous, motion);
+		speed += motion_steps(motion) / divisor;
+		if (speed > limit) {
+			speed = limit;
+		}
+	}
+	uint32_t reachable = entry_speed + (motion_steps(&motion_queue[motion_head]) / divisor);
+	return (speed < reachable) ? speed : reachable;
+}
+
+/*
+ * Returns the type of the motion following the one at the head of the queue, or MOTION_PAUSE if
+ * there isn't one yet.
+ */
+LOCAL motion_type_t ICACHE_FLASH_ATTR next_motion_type() {
+	if (motion_count < 2) {
+		return MOTION_PAUSE;
+	}
+	return motion_queue[(motion_head + 1) % MOTION_QUEUE_LEN].type;
+}
+
+/*
+ * Returns the time that the planned stepper motor movement takes, in ms.
+ */
+LOCAL uint32_t ICACHE_FLASH_ATTR movement_duration() {
+	return ticks_to_ms(phase_data.accel_limit + phase_data.cruise_duration + phase_data.decel_limit);
+}
+
+/*
+ * Returns the time that the servo takes to move between positions, in ms, matching set_servo.
+ */
+LOCAL uint32_t ICACHE_FLASH_ATTR servo_duration() {
+	uint8_t steps = get_servo_move_steps();
+	if (steps <= 1) {
+		return 1;
+	}
+	return steps * get_servo_tick_interval();
+}
+
+/*
+ * Lowers the pen ahead of the end of a travel movement, so that it lands as the movement stops. The
+ * pen down motion that follows the movement then only waits for the servo. A pen that is still
+ * being lifted finishes lifting first.
+ */
+LOCAL void ICACHE_FLASH_ATTR lower_pen_early() {
+	if (!overlap_pen_down) {
+		return;
+	}
+	if (servo_moving) {
+		servo_cb = lower_pen_early;
+		return;
+	}
+	pen_lowered_early = true;
+	servo_down(NULL);
+}
+
+/*
+ * Timer callback used to lower the pen ahead of the end of a travel movement.
+ */
+LOCAL void ICACHE_FLASH_ATTR pen_down_timer_cb(void *arg) {
+	lower_pen_early();
+}
+
+/*
+ * Lowers the pen for the pen down motion at the head of the queue.
+ */
+LOCAL void ICACHE_FLASH_ATTR lower_pen() {
+	servo_down(end_motion);
+}
+
+/*
+ * Starts the motion at the head of the queue, if there is one.
+ *
+ * When the servo overlap is configured, the pen is lifted as the travel movement after it starts,
+ * and lowered during a travel movement so that it lands as the movement stops. Drawing movements
+ * still wait for the pen to settle after it has been lowered.
+ */
+LOCAL void ICACHE_FLASH_ATTR start_next_motion() {
+	if (motion_count == 0) {
+		motion_active = false;
+		return;
+	}
+	motion_t *motion = &motion_queue[motion_head];
+	motion_active = true;
+	if (motion_start_cb != NULL) {
+		motion_start_cb(motion);
+	}
+
+	switch (motion->type) {
+		case MOTION_STEPS:
+			if ((motion->left_steps == 0) && (motion->right_steps == 0)) {
+				// There's no movement, so there will be no callback from the motors.
+				motion_exit_speed = 0;
+				end_motion();
+			} else {
+				// Travel with the pen up in full steps if configured, and draw in half steps. Carry
+				// the speed across from the previous motion, and on to the next.
+				step_mode_t mode = ((servo_pos == UP) && get_full_step_travel()) ?
+						FULL_STEP : HALF_STEP;
+				uint32_t entry_speed = motion_exit_speed;
+				build_acceleration_table(get_acceleration_duration());
+				motion_exit_speed = plan_exit_speed(entry_speed, mode);
+				plan_movement(motion->left_steps, motion->right_steps, motion_steps(motion), true,
+						entry_speed, motion_exit_speed, mode, end_motion);
+
+				if (get_servo_overlap() && (servo_pos == UP) && (motion_exit_speed == 0) &&
+						(next_motion_type() == MOTION_PEN_DOWN)) {
+					// Lower the pen so that it lands as this travel movement stops.
+					uint32_t duration = movement_duration();
+					uint32_t lead = servo_duration();
+					overlap_pen_down = true;
+					if (duration > lead) {
+						os_timer_arm(&pen_down_timer, duration - lead, false);
+					} else {
+						lower_pen_early();
+					}
+				}
+			}
+			break;
+		case MOTION_PEN_UP:
+			motion_exit_speed = 0;
+			if (get_servo_overlap() && (next_motion_type() == MOTION_STEPS)) {
+				// Lift the pen whilst the travel movement that follows starts.
+				servo_up(NULL);
+				motion_pause_timer_cb(NULL);
+			} else {
+				servo_up(end_motion);
+			}
+			break;
+		case MOTION_PEN_DOWN:
+			motion_exit_speed = 0;
+			if (pen_lowered_early) {
+				// The pen was lowered during the travel movement, so wait for it to land, if it
+				// hasn't already.
+				pen_lowered_early = false;
+				if (servo_moving) {
+					servo_cb = end_motion;
+				} else {
+					end_motion();
+				}
+			} else if (servo_moving) {
+				// The pen is still being lifted from before the travel movement.
+				servo_cb = lower_pen;
+			} else {
+				lower_pen();
+			}
+			break;
+		case MOTION_PAUSE:
+			motion_exit_speed = 0;
+			os_timer_arm(&motion_pause_timer, motion->duration, false);
+			break;
+	}
+}
+
+/*
+ * Waits for the post movement pause after a stepper or servo movement, so that one movement doesn't
+ * impact the next. A movement that finishes moving carries straight on into the next one, as does
+ * a movement whose following pen movement overlaps it.
+ */
+LOCAL void ICACHE_FLASH_ATTR end_motion() {
+	if (!motion_active) {
+		return;
+	}
+	bool overlap = overlap_pen_down ||
+			(get_servo_overlap() && (motion_queue[motion_head].type == MOTION_STEPS) &&
+			(next_motion_type() == MOTION_PEN_UP));
+	os_timer_disarm(&pen_down_timer);
+	overlap_pen_down = false;
+	if ((motion_exit_speed > 0) || overlap) {
+		motion_pause_timer_cb(NULL);
+	} else {
+		os_timer_arm(&motion_pause_timer, get_move_pause_duration(), false);
+	}
+}
+
+/*
+ * Completes the motion at the head of the queue once its pause has finished, and starts the next.
+ */
+LOCAL void ICACHE_FLASH_ATTR motion_pause_timer_cb(void *arg) {
+	if (!motion_active) {
+		return;
+	}
+	motion_head = (motion_head + 1) % MOTION_QUEUE_LEN;
+	motion_count--;
+	start_next_motion();
+	if (motion_complete_cb != NULL) {
+		motion_complete_cb();
+	}
+}
+
+/*
+ * (Re)initialises the motor timer, using the hardware timer when it has a tick interval configured,
+ * and the software timer otherwise. The hardware timer (FRC1) is shared with the servo's PWM, which
+ * owns it once started, so the setting is ignored whilst the PWM is active. The timer only runs
+ * whilst there is a movement to perform.
  */
 void ICACHE_FLASH_ATTR init_motor_timer() {
-	uint32_t interval = get_motor_tick_interval();
+	bool running = motor_timer_running;
+	if (running) {
+		tick_source->stop();
+		motor_timer_running = false;
+	}
+	uint32_t interval = get_hardware_tick_interval();
+	if (custom_tick_source != NULL) {
+		tick_source = custom_tick_source;
+		if (interval <= 0) {
+			interval = get_motor_tick_interval() * 1000;
+		}
+	} else if ((interval > 0) && !servo_pwm_active) {
+		tick_source = &hardware_tick_source;
+	} else {
+		if (interval > 0) {
+			os_printf("The servo PWM owns the hardware timer, using the software timer instead.\n");
+		}
+		tick_source = &software_tick_source;
+		interval = get_motor_tick_interval() * 1000;
+	}
 	if (interval <= 0) {
-		interval = 1;
+		interval = 1000;
 	}
-    os_timer_disarm(&motor_timer);
-    os_timer_setfn(&motor_timer, (os_timer_func_t *)motor_timer_cb, (void *)0);
-    os_timer_arm(&motor_timer, interval, 1);
+	tick_interval = interval;
+	if (running) {
+		start_motor_timer();
+	}
+}
+
+/*
+ * Returns the number of times the motor timer callback has been called.
+ */
+uint32_t ICACHE_FLASH_ATTR get_motor_timer_callbacks() {
+	return motor_timer_callbacks;
+}
+
+#ifdef MOTOR_TRACE
+/*
+ * Retrieves the number of step events recorded in the trace, and the interval of the motor ticks.
+ */
+void ICACHE_FLASH_ATTR get_motor_trace_info(uint32_t *count, uint32_t *interval) {
+	*count = trace_count;
+	*interval = tick_interval;
+}
+
+/*
+ * Copies the step events recorded in the trace from the index'th event up to the end'th.
+ */
+uint32_t ICACHE_FLASH_ATTR read_motor_trace(
+		uint32_t *index, uint32_t end, uint32_t *events, uint32_t length) {
+	// Skip the events that the timer callback has overwritten, or is about to.
+	uint32_t count = trace_count;
+	if ((count - *index) > (MOTOR_TRACE_COUNT - STEP_EVENT_COUNT)) {
+		*index = count - (MOTOR_TRACE_COUNT - STEP_EVENT_COUNT);
+	}
+	uint32_t copied = 0;
+	while ((copied < length) && ((int32_t)(end - *index) > 0)) {
+		events[copied++] = trace_events[(*index)++ % MOTOR_TRACE_COUNT];
+	}
+	return copied;
+}
+#endif
+
+/*
+ * Replaces the source of the motor control's ticks, and restarts the motor timer with it.
+ */
+void ICACHE_FLASH_ATTR set_tick_source(const tick_source_t *source) {
+	custom_tick_source = source;
+	init_motor_timer();
 }
 
 /*
@@ -624,22 +1678,41 @@ void ICACHE_FLASH_ATTR init_motors() {
     PIN_FUNC_SELECT(PERIPHS_IO_MUX_GPIO4_U, FUNC_GPIO4);
     PIN_FUNC_SELECT(PERIPHS_IO_MUX_GPIO0_U, FUNC_GPIO0);
 
+	// Start the servo motor pulse width modulation on GPIO 13. This is done before the motor timer
+	// is chosen, as the PWM takes over the FRC1 hardware timer.
+	uint32_t pwm_info[][3] = {{PERIPHS_IO_MUX_MTCK_U, FUNC_GPIO13, 13}};
+	uint32_t servo_duty[1] = {0};
+	pwm_init(PWM_PERIOD, servo_duty, 1, pwm_info);
+	servo_pwm_active = true;
+
+	// Prepare the task that reports the completion of motor movements, and the motor timers.
+	system_os_task(motor_task, MOTOR_TASK_PRI, motor_task_queue, 1);
+	os_timer_disarm(&power_down_timer);
+	os_timer_setfn(&power_down_timer, (os_timer_func_t *)power_down_timer_cb, (void *)0);
+	init_motor_timer();
+
 	// Run through each step once, so that the motor is now synchronised with our state.
 	total_ticks = 0;
 	next_total_ticks = 0;
 	drive_motors(STEP_SEQUENCE_COUNT, STEP_SEQUENCE_COUNT, STEP_SEQUENCE_COUNT, false, NULL);
 
-	// Start the motor timer.
-	init_motor_timer();
+	// Prepare, but do not start the velocity mode's timeout.
+	os_timer_disarm(&velocity_timer);
+	os_timer_setfn(&velocity_timer, (os_timer_func_t *)velocity_timer_cb, (void *)0);
+
+	// Prepare, but do not start the motion pause timer.
+	os_timer_disarm(&motion_pause_timer);
+	os_timer_setfn(&motion_pause_timer, (os_timer_func_t *)motion_pause_timer_cb, (void *)0);
+
+	// Prepare, but do not start the timer that lowers the pen ahead of the end of a movement.
+	os_timer_disarm(&pen_down_timer);
+	os_timer_setfn(&pen_down_timer, (os_timer_func_t *)pen_down_timer_cb, (void *)0);
 
 	// Prepare, but do not start the servo timer.
 	os_timer_disarm(&servo_timer);
 	os_timer_setfn(&servo_timer, (os_timer_func_t *)servo_timer_cb, (void *)0);
 
-	// Start the servo motor pulse width modulation on GPIO 13.
-	uint32_t pwm_info[][3] = {{PERIPHS_IO_MUX_MTCK_U, FUNC_GPIO13, 13}};
-	uint32_t servo_duty[1] = {0};
-	pwm_init(PWM_PERIOD, servo_duty, 1, pwm_info);
+	// Move the pen up.
 	servo_up(NULL);
 }
 
@@ -0,0 +1,278 @@
+/*
+ * program_image.c: Loading of programs from the binary program image format.
+ *
+ * Author: Ian Marshall
+ * Date: 15/10/2026
+ */
+#include "esp8266.h"
+#include "ets_sys.h"
+#include "osapi.h"
+#include "mem.h"
+#include "spi_flash.h"
+
+#include "udp_debug.h"
+#include "files.h"
+#include "program_image.h"
+
+// The magic value at the start of every program image.
+static uint32_t const PROGRAM_IMAGE_MAGIC = 0x4D545049; // 'MTPI'
+
+// The number of bytes in the image header.
+#define HEADER_LEN 8
+
+// The number of bytes in each function table entry.
+#define FUNCTION_ENTRY_LEN 6
+
+// The number of bytes in the trailing CRC.
+#define CRC_LEN 4
+
+// Reads a big-endian 16-bit value from an array.
+#define BYTES_TO_UINT16(arr, idx) ((uint16_t)(((arr)[(idx)] << 8) | (arr)[(idx) + 1]))
+
+// Reads a big-endian 32-bit value from an array.
+#define BYTES_TO_UINT32(arr, idx) \
+	(((uint32_t)(arr)[(idx)] << 24) | ((uint32_t)(arr)[(idx) + 1] << 16) | \
+	 ((uint32_t)(arr)[(idx) + 2] << 8) | (uint32_t)(arr)[(idx) + 3])
+
+// The number of bytes of a flash image that are checksummed at a time.
+#define CRC_CHUNK_LEN 64
+
+// The largest number of bytes read from the flash memory at a time. This must be a multiple of 4.
+#define FLASH_READ_LEN 64
+
+LOCAL bool ICACHE_FLASH_ATTR read_flash(uint32_t address, uint8_t *data, uint32_t length);
+LOCAL uint32_t ICACHE_FLASH_ATTR update_crc32(uint32_t crc, const uint8_t *data, uint32_t length);
+
+/*
+ * Loads a program from a binary program image, validating the image's structure and checksum.
+ */
+program_t * ICACHE_FLASH_ATTR load_program_image(
+		const uint8_t *image, uint32_t length, const char **error) {
+	// Check the header, and that the image is intact.
+	if ((length < HEADER_LEN + CRC_LEN) || (length > MAX_PROGRAM_IMAGE_SIZE)) {
+		*error = "Invalid program image size.";
+		return NULL;
+	}
+	if (BYTES_TO_UINT32(image, 0) != PROGRAM_IMAGE_MAGIC) {
+		*error = "Not a program image.";
+		return NULL;
+	}
+	if (image[4] != PROGRAM_IMAGE_VERSION) {
+		*error = "Unsupported program image version.";
+		return NULL;
+	}
+	if (crc32(image, length - CRC_LEN) != BYTES_TO_UINT32(image, length - CRC_LEN)) {
+		*error = "Program image checksum mismatch.";
+		return NULL;
+	}
+
+	// Check the function table and code lengths account for the whole image.
+	uint32_t function_count = image[6];
+	uint32_t code_offset = HEADER_LEN + (function_count * FUNCTION_ENTRY_LEN);
+	if (function_count == 0) {
+		*error = "Program image has no functions.";
+		return NULL;
+	}
+	uint32_t expected = code_offset + CRC_LEN;
+	if (expected <= length) {
+		for (uint32_t ii = 0; ii < function_count; ii++) {
+			expected += BYTES_TO_UINT16(image, HEADER_LEN + (ii * FUNCTION_ENTRY_LEN) + 4);
+		}
+	}
+	if (expected != length) {
+		*error = "Program image function table doesn't match its size.";
+		return NULL;
+	}
+
+	// Create the program in a single allocation, copying each function's code into it.
+	program_t *program = create_program(image[5], function_count, length - code_offset - CRC_LEN);
+	if (program == NULL) {
+		*error = "Unable to allocate memory to process program.";
+		return NULL;
+	}
+	for (uint32_t ii = 0; ii < function_count; ii++) {
+		const uint8_t *entry = &image[HEADER_LEN + (ii * FUNCTION_ENTRY_LEN)];
+		function_t *function = &program->functions[ii];
+		function->id = ii;
+		function->argument_count = entry[0];
+		function->local_count = entry[1];
+		function->stack_size = entry[2];
+		uint8_t *code = allocate_function_code(program, function, BYTES_TO_UINT16(entry, 4));
+		os_memcpy(code, &image[code_offset], function->length);
+		code_offset += function->length;
+	}
+	return program;
+}
+
+/*
+ * Loads a program from a binary program image saved in a file, leaving its byte code in flash.
+ */
+program_t * ICACHE_FLASH_ATTR load_program_file(uint8_t file_number, const char **error) {
+	uint32_t length = 0;
+	uint32_t address = get_file_address(file_number, &length);
+	if (address == 0) {
+		*error = "The file is not in use.";
+		return NULL;
+	}
+
+	// Check the header, and that the image is intact.
+	uint8_t header[HEADER_LEN];
+	if ((length < HEADER_LEN + CRC_LEN) || (length > MAX_FILE_SIZE)) {
+		*error = "Invalid program image size.";
+		return NULL;
+	}
+	if (!read_flash(address, header, HEADER_LEN)) {
+		*error = "Unable to read the program image.";
+		return NULL;
+	}
+	if (BYTES_TO_UINT32(header, 0) != PROGRAM_IMAGE_MAGIC) {
+		*error = "Not a program image.";
+		return NULL;
+	}
+	if (header[4] != PROGRAM_IMAGE_VERSION) {
+		*error = "Unsupported program image version.";
+		return NULL;
+	}
+	uint8_t chunk[CRC_CHUNK_LEN];
+	uint32_t crc = 0xFFFFFFFF;
+	for (uint32_t offset = 0; offset < length - CRC_LEN; offset += CRC_CHUNK_LEN) {
+		uint32_t len = length - CRC_LEN - offset;
+		if (len > CRC_CHUNK_LEN) {
+			len = CRC_CHUNK_LEN;
+		}
+		if (!read_flash(address + offset, chunk, len)) {
+			*error = "Unable to read the program image.";
+			return NULL;
+		}
+		crc = update_crc32(crc, chunk, len);
+	}
+	if (!read_flash(address + length - CRC_LEN, chunk, CRC_LEN)) {
+		*error = "Unable to read the program image.";
+		return NULL;
+	}
+	if (~crc != BYTES_TO_UINT32(chunk, 0)) {
+		*error = "Program image checksum mismatch.";
+		return NULL;
+	}
+
+	// Check the function table and code lengths account for the whole image, finding the longest
+	// function, as its code is read into memory a function at a time.
+	uint32_t function_count = header[6];
+	if (function_count == 0) {
+		*error = "Program image has no functions.";
+		return NULL;
+	}
+	uint32_t table = address + HEADER_LEN;
+	uint32_t expected = HEADER_LEN + (function_count * FUNCTION_ENTRY_LEN) + CRC_LEN;
+	uint32_t max_length = 0;
+	uint8_t entry[FUNCTION_ENTRY_LEN];
+	for (uint32_t ii = 0; (ii < function_count) && (expected <= length); ii++) {
+		if (!read_flash(table + (ii * FUNCTION_ENTRY_LEN), entry, FUNCTION_ENTRY_LEN)) {
+			*error = "Unable to read the program image.";
+			return NULL;
+		}
+		uint16_t function_length = BYTES_TO_UINT16(entry, 4);
+		expected += function_length;
+		if (function_length > max_length) {
+			max_length = function_length;
+		}
+	}
+	if (expected != length) {
+		*error = "Program image function table doesn't match its size.";
+		return NULL;
+	}
+
+	// Create the program, with a code area that holds one function at a time.
+	program_t *program = create_program(header[5], function_count, max_length);
+	if (program == NULL) {
+		*error = "Unable to allocate memory to process program.";
+		return NULL;
+	}
+	program->flash_address = address;
+	for (uint32_t ii = 0; ii < function_count; ii++) {
+		if (!read_flash(table + (ii * FUNCTION_ENTRY_LEN), entry, FUNCTION_ENTRY_LEN)) {
+			*error = "Unable to read the program image.";
+			os_free(program);
+			return NULL;
+		}
+		function_t *function = &program->functions[ii];
+		function->id = ii;
+		function->argument_count = entry[0];
+		function->local_count = entry[1];
+		function->stack_size = entry[2];
+		function->length = BYTES_TO_UINT16(entry, 4);
+	}
+	return program;
+}
+
+/*
+ * Reads the byte code of one function of a program loaded by load_program_file into the program's
+ * code area, which follows its function table.
+ */
+bool ICACHE_FLASH_ATTR load_function_code(program_t *prog, uint32_t func) {
+	uint32_t offset = HEADER_LEN + (prog->function_count * FUNCTION_ENTRY_LEN);
+	for (uint32_t ii = 0; ii < prog->function_count; ii++) {
+		// Only one function's code is in the code area at a time.
+		prog->functions[ii].code = NULL;
+		if (ii < func) {
+			offset += prog->functions[ii].length;
+		}
+	}
+	function_t *function = &prog->functions[func];
+	uint8_t *code_area = (uint8_t *)&prog->functions[prog->function_count];
+	if (!read_flash(prog->flash_address + offset, code_area, function->length)) {
+		return false;
+	}
+	function->code = code_area;
+	return true;
+}
+
+/*
+ * Calculates the CRC-32 (IEEE 802.3) of a block of data.
+ */
+uint32_t ICACHE_FLASH_ATTR crc32(const uint8_t *data, uint32_t length) {
+	return ~update_crc32(0xFFFFFFFF, data, length);
+}
+
+/*
+ * Reads a block of data from the flash memory, which may start at any address. The flash memory can
+ * only be read a word at a time, so the data is read through a small aligned buffer.
+ */
+LOCAL bool ICACHE_FLASH_ATTR read_flash(uint32_t address, uint8_t *data, uint32_t length) {
+	uint32_t buffer[FLASH_READ_LEN / 4];
+	while (length > 0) {
+		// Read the words holding the next part of the data.
+		uint32_t read_address = address & ~3;
+		uint32_t offset = address - read_address;
+		uint32_t len = FLASH_READ_LEN - offset;
+		if (len > length) {
+			len = length;
+		}
+		uint32_t read_len = (offset + len + 3) & ~3;
+		SpiFlashOpResult res = spi_flash_read(read_address, buffer, read_len);
+		if (res != SPI_FLASH_RESULT_OK) {
+			debug_print("Unable to read program image at %x: %d.\n", read_address, res);
+			return false;
+		}
+
+		os_memcpy(data, (uint8_t *)buffer + offset, len);
+		data += len;
+		address += len;
+		length -= len;
+	}
+	return true;
+}
+
+/*
+ * Adds a block of data to a running CRC-32 (IEEE 802.3). This is calculated a bit at a time rather
+ * than from a table, as program images are small and RAM is not.
+ */
+LOCAL uint32_t ICACHE_FLASH_ATTR update_crc32(uint32_t crc, const uint8_t *data, uint32_t length) {
+	for (uint32_t ii = 0; ii < length; ii++) {
+		crc ^= data[ii];
+		for (uint8_t bit = 0; bit < 8; bit++) {
+			crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+		}
+	}
+	return crc;
+}
@@ -0,0 +1,542 @@
+/*
+ * program_json.c: Incremental decoding of programs from the JSON program format.
+ *
+ * Author: Ian Marshall
+ * Date: 16/10/2026
+ */
+#include "esp8266.h"
+#include "ets_sys.h"
+#include "osapi.h"
+#include "mem.h"
+
+#include "udp_debug.h"
+#include "program_json.h"
+
+// The length of the shortest function object, {"args":0,"locals":0,"stack":0,"codes":[]}.
+#define MIN_FUNCTION_JSON_LEN 42
+
+// The largest number that may be read, which is well beyond any valid value.
+#define MAX_NUMBER 99999999
+
+// The token read from a key, which is the key's opening double quotation mark.
+#define TOKEN_KEY '"'
+
+// The token read from a number.
+#define TOKEN_NUMBER '0'
+
+// The number held whilst a negative number has no digits yet.
+#define NO_DIGITS -1
+
+// The token used when no key or number is being read.
+#define TOKEN_NONE 0
+
+// The keys, with the flag for each in the decoder's fields being the bit at its index.
+enum {
+	KEY_PROGRAM,
+	KEY_GLOBALS,
+	KEY_FUNCTIONS,
+	KEY_ARGS,
+	KEY_LOCALS,
+	KEY_STACK,
+	KEY_CODES,
+	KEY_COUNT
+};
+
+// The names of the keys.
+LOCAL const char * const key_names[KEY_COUNT] = {
+	"program", "globals", "functions", "args", "locals", "stack", "codes"
+};
+
+// The flags for the keys that every function must hold.
+#define FUNCTION_FIELDS ((1 << KEY_ARGS) | (1 << KEY_LOCALS) | (1 << KEY_STACK) | (1 << KEY_CODES))
+
+// The flags for the keys that the program must hold.
+#define PROGRAM_FIELDS ((1 << KEY_GLOBALS) | (1 << KEY_FUNCTIONS))
+
+// The decoder's states, being the next token that is expected.
+enum {
+	PARSE_ROOT_OPEN,       // The opening brace of the JSON.
+	PARSE_ROOT_KEY,        // The "program" key.
+	PARSE_COLON,           // The colon following a key.
+	PARSE_PROGRAM_OPEN,    // The opening brace of the program.
+	PARSE_PROGRAM_KEY,     // A key of the program.
+	PARSE_NUMBER,          // The number for the current key.
+	PARSE_FUNCTIONS_OPEN,  // The opening bracket of the functions.
+	PARSE_FUNCTION_OPEN,   // The opening brace of a function.
+	PARSE_FUNCTION_KEY,    // A key of the current function.
+	PARSE_CODES_OPEN,      // The opening bracket of the current function's byte code.
+	PARSE_CODE_VALUE,      // A byte code of the current function.
+	PARSE_CODE_NEXT,       // A comma or closing bracket following a byte code.
+	PARSE_FUNCTION_NEXT,   // A comma or closing brace following a value of the current function.
+	PARSE_FUNCTIONS_NEXT,  // A comma or closing bracket following a function.
+	PARSE_PROGRAM_NEXT,    // A comma or closing brace following a value of the program.
+	PARSE_ROOT_CLOSE,      // The closing brace of the JSON.
+	PARSE_DONE,            // Nothing more, other than whitespace.
+	PARSE_STATE_COUNT
+};
+
+// The descriptions of the JSON that was expected, for when something else is found.
+LOCAL const char * const state_errors[PARSE_STATE_COUNT] = {
+	"Invalid \"code\" parameter opening.",
+	"Invalid \"code\" parameter - not a program.",
+	"Invalid \"code\" parameter - missing colon after key.",
+	"Invalid \"code\" parameter - program command must be an object.",
+	"Invalid \"code\" parameter - unknown program field.",
+	"Invalid \"code\" parameter - expected a number.",
+	"Non-array for functions in \"code\" parameter.",
+	"Invalid \"code\" parameter - function object.",
+	"Invalid \"code\" parameter - unknown function field.",
+	"Bytecode for functions must be in an array.",
+	"Bytecode for functions must not hold empty numbers.",
+	"Bytecode for functions must be in a valid array.",
+	"Invalid \"code\" parameter: missing end to function object.",
+	"Invalid \"code\" parameter: missing end to functions array.",
+	"Invalid \"code\" parameter: missing end to program object.",
+	"Invalid \"code\" parameter: missing end to parameter.",
+	"Invalid \"code\" parameter: unexpected data after the program."
+};
+
+// The parts of an HTML form.
+enum {
+	FORM_NAME,   // The name of a field.
+	FORM_SKIP,   // The value of a field other than "code".
+	FORM_CODE,   // The value of the "code" field.
+	FORM_ESCAPE, // A %XX escape in the value of the "code" field.
+	FORM_END     // The rest of the form, following the "code" field.
+};
+
+LOCAL program_json_status_t ICACHE_FLASH_ATTR parse_char(program_json_t *pj, char c);
+LOCAL program_json_status_t ICACHE_FLASH_ATTR parse_token(program_json_t *pj, char token);
+LOCAL program_json_status_t ICACHE_FLASH_ATTR parse_key(program_json_t *pj);
+LOCAL program_json_status_t ICACHE_FLASH_ATTR parse_number(program_json_t *pj);
+LOCAL program_json_status_t ICACHE_FLASH_ATTR parse_error(program_json_t *pj, const char *error);
+LOCAL int8_t ICACHE_FLASH_ATTR hex_value(char c);
+
+/*
+ * Prepares to decode a program from JSON (or an HTML form holding it) of the given length.
+ */
+bool ICACHE_FLASH_ATTR init_program_json(program_json_t *pj, uint32_t length) {
+	os_memset(pj, 0, sizeof(program_json_t));
+
+	// Every byte code needs a digit and a separator, and every function a minimal object. The byte
+	// code is limited to the largest program image, however long the JSON is.
+	uint32_t function_count = (length / MIN_FUNCTION_JSON_LEN) + 1;
+	if (function_count > MAX_FUNC_COUNT) {
+		function_count = MAX_FUNC_COUNT;
+	}
+	uint32_t code_size = length / 2;
+	if (code_size > MAX_PROGRAM_IMAGE_SIZE) {
+		code_size = MAX_PROGRAM_IMAGE_SIZE;
+	}
+	pj->program = create_program(0, function_count, code_size);
+	if (pj->program == NULL) {
+		return false;
+	}
+	pj->status = PROGRAM_JSON_MORE;
+	pj->state = PARSE_ROOT_OPEN;
+	pj->token = TOKEN_NONE;
+	pj->form_state = FORM_NAME;
+	return true;
+}
+
+/*
+ * Decodes the next chunk of a program's JSON.
+ */
+program_json_status_t ICACHE_FLASH_ATTR parse_program_json(
+		program_json_t *pj, const char *data, uint32_t length) {
+	for (uint32_t ii = 0; (ii < length) && (pj->status != PROGRAM_JSON_ERROR); ii++) {
+		pj->status = parse_char(pj, data[ii]);
+	}
+	return pj->status;
+}
+
+/*
+ * Decodes the next chunk of a URL encoded HTML form, passing the "code" field's value to the JSON
+ * decoder.
+ */
+program_json_status_t ICACHE_FLASH_ATTR parse_program_form(
+		program_json_t *pj, const char *data, uint32_t length) {
+	for (uint32_t ii = 0; (ii < length) && (pj->status != PROGRAM_JSON_ERROR); ii++) {
+		char c = data[ii];
+		switch (pj->form_state) {
+			case FORM_NAME:
+				if (c == '=') {
+					pj->form_state = (pj->form_match == 4) ? FORM_CODE : FORM_SKIP;
+				} else if (c == '&') {
+					pj->form_match = 0;
+				} else if ((pj->form_match < 4) && (c == "code"[pj->form_match])) {
+					pj->form_match++;
+				} else {
+					// This field name isn't "code", and can never match.
+					pj->form_match = 0xFF;
+				}
+				break;
+			case FORM_SKIP:
+				if (c == '&') {
+					pj->form_state = FORM_NAME;
+					pj->form_match = 0;
+				}
+				break;
+			case FORM_CODE:
+				if (c == '&') {
+					pj->form_state = FORM_END;
+				} else if (c == '%') {
+					pj->form_state = FORM_ESCAPE;
+					pj->escape_len = 0;
+					pj->escape = 0;
+				} else {
+					pj->status = parse_char(pj, (c == '+') ? ' ' : c);
+				}
+				break;
+			case FORM_ESCAPE: {
+				int8_t value = hex_value(c);
+				if (value == -1) {
+					pj->status = parse_error(pj, "Invalid escape in \"code\" parameter.");
+					break;
+				}
+				pj->escape = (pj->escape << 4) | value;
+				pj->escape_len++;
+				if (pj->escape_len == 2) {
+					pj->form_state = FORM_CODE;
+					pj->status = parse_char(pj, (char)pj->escape);
+				}
+				} break;
+			default:
+				// Ignore the rest of the form.
+				break;
+		}
+	}
+	return pj->status;
+}
+
+/*
+ * Finishes decoding a program, trimming the program to the space it requires.
+ */
+program_t * ICACHE_FLASH_ATTR finish_program_json(program_json_t *pj) {
+	if (pj->status == PROGRAM_JSON_ERROR) {
+		free_program_json(pj);
+		return NULL;
+	}
+	if (pj->state != PARSE_DONE) {
+		if (pj->state == PARSE_ROOT_OPEN) {
+			pj->error = "Missing the \"code\" parameter.";
+		} else {
+			pj->error = "Invalid \"code\" parameter - incomplete program.";
+		}
+		pj->status = PROGRAM_JSON_ERROR;
+		free_program_json(pj);
+		return NULL;
+	}
+	program_t *program = trim_program(pj->program, pj->function_count);
+	pj->program = NULL;
+	debug_print("Decoded program of %d functions and %d bytes of byte code.\n",
+			program->function_count, program->code_used);
+	return program;
+}
+
+/*
+ * Frees the program held by a decoder that has not been finished.
+ */
+void ICACHE_FLASH_ATTR free_program_json(program_json_t *pj) {
+	if (pj->program != NULL) {
+		os_free(pj->program);
+		pj->program = NULL;
+	}
+}
+
+/*
+ * Decodes the next character of the JSON, reading keys and numbers which may span several chunks,
+ * and passing on each complete token.
+ */
+LOCAL program_json_status_t ICACHE_FLASH_ATTR parse_char(program_json_t *pj, char c) {
+	if (pj->token == TOKEN_KEY) {
+		if (c == '"') {
+			pj->token = TOKEN_NONE;
+			return parse_token(pj, TOKEN_KEY);
+		}
+		if (pj->key_len < PROGRAM_JSON_KEY_LEN) {
+			pj->key_buf[pj->key_len] = c;
+		}
+		if (pj->key_len < 0xFF) {
+			pj->key_len++;
+		}
+		return PROGRAM_JSON_MORE;
+	}
+	if (pj->token == TOKEN_NUMBER) {
+		if ((c >= '0') && (c <= '9')) {
+			if (pj->number == NO_DIGITS) {
+				pj->number = 0;
+			}
+			pj->number = (pj->number * 10) + (c - '0');
+			if (pj->number > MAX_NUMBER) {
+				return parse_error(pj, "Invalid \"code\" parameter - number too large.");
+			}
+			return PROGRAM_JSON_MORE;
+		}
+
+		// The number has ended, and this character is the next token.
+		pj->token = TOKEN_NONE;
+		if (pj->number == NO_DIGITS) {
+			return parse_error(pj, state_errors[PARSE_NUMBER]);
+		}
+		if (parse_token(pj, TOKEN_NUMBER) == PROGRAM_JSON_ERROR) {
+			return PROGRAM_JSON_ERROR;
+		}
+	}
+
+	if ((c == ' ') || (c == '\t') || (c == '\r') || (c == '\n')) {
+		return pj->status;
+	} else if (pj->state == PARSE_DONE) {
+		return parse_token(pj, c);
+	} else if (c == '"') {
+		pj->token = TOKEN_KEY;
+		pj->key_len = 0;
+		return PROGRAM_JSON_MORE;
+	} else if ((c == '-') || ((c >= '0') && (c <= '9'))) {
+		pj->token = TOKEN_NUMBER;
+		pj->negative = (c == '-');
+		pj->number = pj->negative ? NO_DIGITS : (c - '0');
+		return PROGRAM_JSON_MORE;
+	}
+	return parse_token(pj, c);
+}
+
+/*
+ * Handles the next token of the JSON, which is either a key, a number or a punctuation character.
+ */
+LOCAL program_json_status_t ICACHE_FLASH_ATTR parse_token(program_json_t *pj, char token) {
+	program_t *program = pj->program;
+	switch (pj->state) {
+		case PARSE_ROOT_OPEN:
+			if (token == '{') {
+				pj->state = PARSE_ROOT_KEY;
+				return PROGRAM_JSON_MORE;
+			}
+			break;
+		case PARSE_ROOT_KEY:
+		case PARSE_PROGRAM_KEY:
+		case PARSE_FUNCTION_KEY:
+			if (token == TOKEN_KEY) {
+				return parse_key(pj);
+			}
+			break;
+		case PARSE_COLON:
+			if (token == ':') {
+				switch (pj->key) {
+					case KEY_PROGRAM:
+						pj->state = PARSE_PROGRAM_OPEN;
+						break;
+					case KEY_FUNCTIONS:
+						pj->state = PARSE_FUNCTIONS_OPEN;
+						break;
+					case KEY_CODES:
+						pj->state = PARSE_CODES_OPEN;
+						break;
+					default:
+						pj->state = PARSE_NUMBER;
+						break;
+				}
+				return PROGRAM_JSON_MORE;
+			}
+			break;
+		case PARSE_PROGRAM_OPEN:
+			if (token == '{') {
+				pj->state = PARSE_PROGRAM_KEY;
+				return PROGRAM_JSON_MORE;
+			}
+			break;
+		case PARSE_NUMBER:
+			if (token == TOKEN_NUMBER) {
+				return parse_number(pj);
+			}
+			break;
+		case PARSE_FUNCTIONS_OPEN:
+			if (token == '[') {
+				pj->state = PARSE_FUNCTION_OPEN;
+				return PROGRAM_JSON_MORE;
+			}
+			break;
+		case PARSE_FUNCTION_OPEN:
+			if (token == '{') {
+				if (pj->function_count == program->function_count) {
+					return parse_error(pj, "Invalid \"code\" parameter - too many functions.");
+				}
+				program->functions[pj->function_count].id = pj->function_count;
+				pj->function_count++;
+				pj->fields &= ~FUNCTION_FIELDS;
+				pj->state = PARSE_FUNCTION_KEY;
+				return PROGRAM_JSON_MORE;
+			}
+			break;
+		case PARSE_CODES_OPEN:
+			if (token == '[') {
+				pj->code_len = 0;
+				pj->state = PARSE_CODE_VALUE;
+				return PROGRAM_JSON_MORE;
+			}
+			break;
+		case PARSE_CODE_VALUE:
+			if (token == TOKEN_NUMBER) {
+				return parse_number(pj);
+			} else if ((token == ']') && (pj->code_len == 0)) {
+				// The function has no byte code.
+				pj->state = PARSE_CODE_NEXT;
+				return parse_token(pj, token);
+			}
+			break;
+		case PARSE_CODE_NEXT:
+			if (token == ',') {
+				pj->state = PARSE_CODE_VALUE;
+				return PROGRAM_JSON_MORE;
+			} else if (token == ']') {
+				// The byte code was written in place, assign it to the function.
+				function_t *function = &program->functions[pj->function_count - 1];
+				allocate_function_code(program, function, pj->code_len);
+				pj->state = PARSE_FUNCTION_NEXT;
+				return PROGRAM_JSON_MORE;
+			}
+			break;
+		case PARSE_FUNCTION_NEXT:
+			if (token == ',') {
+				pj->state = PARSE_FUNCTION_KEY;
+				return PROGRAM_JSON_MORE;
+			} else if (token == '}') {
+				if ((pj->fields & FUNCTION_FIELDS) != FUNCTION_FIELDS) {
+					return parse_error(pj,
+							"Invalid \"code\" parameter: missing required function parameter.");
+				}
+				pj->state = PARSE_FUNCTIONS_NEXT;
+				return PROGRAM_JSON_MORE;
+			}
+			break;
+		case PARSE_FUNCTIONS_NEXT:
+			if (token == ',') {
+				pj->state = PARSE_FUNCTION_OPEN;
+				return PROGRAM_JSON_MORE;
+			} else if (token == ']') {
+				pj->state = PARSE_PROGRAM_NEXT;
+				return PROGRAM_JSON_MORE;
+			}
+			break;
+		case PARSE_PROGRAM_NEXT:
+			if (token == ',') {
+				pj->state = PARSE_PROGRAM_KEY;
+				return PROGRAM_JSON_MORE;
+			} else if (token == '}') {
+				if ((pj->fields & PROGRAM_FIELDS) != PROGRAM_FIELDS) {
+					return parse_error(pj,
+							"Invalid \"code\" parameter, missing globals or functions.");
+				}
+				pj->state = PARSE_ROOT_CLOSE;
+				return PROGRAM_JSON_MORE;
+			}
+			break;
+		case PARSE_ROOT_CLOSE:
+			if (token == '}') {
+				pj->state = PARSE_DONE;
+				return PROGRAM_JSON_DONE;
+			}
+			break;
+		default:
+			break;
+	}
+	return parse_error(pj, state_errors[pj->state]);
+}
+
+/*
+ * Handles a key that has been read, which must be one of those allowed in the current object and
+ * not already seen in it.
+ */
+LOCAL program_json_status_t ICACHE_FLASH_ATTR parse_key(program_json_t *pj) {
+	uint8_t first = KEY_ARGS;
+	uint8_t last = KEY_CODES;
+	if (pj->state == PARSE_ROOT_KEY) {
+		first = KEY_PROGRAM;
+		last = KEY_PROGRAM;
+	} else if (pj->state == PARSE_PROGRAM_KEY) {
+		first = KEY_GLOBALS;
+		last = KEY_FUNCTIONS;
+	}
+	for (uint8_t key = first; key <= last; key++) {
+		if ((pj->key_len == os_strlen(key_names[key])) &&
+				(os_strncmp(pj->key_buf, key_names[key], pj->key_len) == 0)) {
+			if (pj->fields & (1 << key)) {
+				return parse_error(pj, "Invalid \"code\" parameter - duplicate field.");
+			}
+			pj->fields |= (1 << key);
+			pj->key = key;
+			pj->state = PARSE_COLON;
+			return PROGRAM_JSON_MORE;
+		}
+	}
+	return parse_error(pj, state_errors[pj->state]);
+}
+
+/*
+ * Handles a number that has been read, which is the value of the current key or a byte code.
+ */
+LOCAL program_json_status_t ICACHE_FLASH_ATTR parse_number(program_json_t *pj) {
+	program_t *program = pj->program;
+	int32_t number = pj->negative ? -pj->number : pj->number;
+	if (pj->state == PARSE_CODE_VALUE) {
+		// Write the byte code straight into the program's code area.
+		if ((number < 0) || (number > 0xFF)) {
+			return parse_error(pj, "Bytecode for functions must be in a valid array.");
+		}
+		// The byte code may fill the code area exactly.
+		uint8_t *code_area = (uint8_t *)&program->functions[program->function_count];
+		uint32_t code_len = pj->code_len + 1;
+		if ((program->code_used + code_len) > program->code_size) {
+			return parse_error(pj, "Bytecode for functions is larger than the program.");
+		}
+		code_area[program->code_used + pj->code_len] = (uint8_t)number;
+		pj->code_len = code_len;
+		pj->state = PARSE_CODE_NEXT;
+		return PROGRAM_JSON_MORE;
+	}
+
+	if (number < 0) {
+		return parse_error(pj, (pj->key == KEY_GLOBALS) ?
+				"Invalid global count in \"code\" parameter." :
+				"Invalid \"code\" parameter - negative function count.");
+	}
+	if (pj->key == KEY_GLOBALS) {
+		program->global_count = number;
+		pj->state = PARSE_PROGRAM_NEXT;
+		return PROGRAM_JSON_MORE;
+	}
+	function_t *function = &program->functions[pj->function_count - 1];
+	if (pj->key == KEY_ARGS) {
+		function->argument_count = number;
+	} else if (pj->key == KEY_LOCALS) {
+		function->local_count = number;
+	} else {
+		function->stack_size = number;
+	}
+	pj->state = PARSE_FUNCTION_NEXT;
+	return PROGRAM_JSON_MORE;
+}
+
+/*
+ * Records the reason the JSON is invalid.
+ */
+LOCAL program_json_status_t ICACHE_FLASH_ATTR parse_error(program_json_t *pj, const char *error) {
+	debug_print("Program JSON rejected: %s\n", error);
+	pj->error = error;
+	pj->status = PROGRAM_JSON_ERROR;
+	return PROGRAM_JSON_ERROR;
+}
+
+/*
+ * Returns the value of a hexadecimal digit, or -1 if the character isn't one.
+ */
+LOCAL int8_t ICACHE_FLASH_ATTR hex_value(char c) {
+	if ((c >= '0') && (c <= '9')) {
+		return c - '0';
+	} else if ((c >= 'a') && (c <= 'f')) {
+		return c - 'a' + 10;
+	} else if ((c >= 'A') && (c <= 'F')) {
+		return c - 'A' + 10;
+	}
+	return -1;
+}
@@ -11,6 +11,7 @@
 #include "cgiwebsocket.h"
 
 #include "vm.h"
+#include "program_image.h"
 #include "udp_debug.h"
 #include "http.h"
 #include "string_builder.h"
@@ -18,7 +19,7 @@
 #include "motors.h"
 
 // Helper macro to convert 4 bytes from an array into a 32-bit integer.
-#define BYTES_TO_INT32(arr, idx) (((arr)[(idx)]     << 24) + \
+#define BYTES_TO_INT32(arr, idx) (((uint32_t)(arr)[(idx)] << 24) + \
                                   ((arr)[(idx) + 1] << 16) + \
 								  ((arr)[(idx) + 2] << 8) + \
 								  ((arr)[(idx) + 3]))
@@ -32,12 +33,22 @@
 // The maximum number of variables in the operand stack for a function.
 #define MAX_STACK_SIZE 32
 
-// The maximum number of functions allowed in the program (including main).
-#define MAX_FUNC_COUNT 64
-
 // The maximum number of bytes allowed in a function's code.
 #define MAX_FUNC_LEN 2048
 
+// The maximum depth of nested function calls, including the main function.
+#define MAX_CALL_DEPTH 32
+
+// The maximum length of a program error description, including the terminator.
+#define MAX_ERROR_LEN 96
+
+// Helper macro to round a size up to a whole number of words.
+#define WORD_ALIGN(size) (((size) + 3) & ~3)
+
+// Helper macro to round a frame size up to a whole number of pointers, so that each frame in the
+// arena is aligned. This is the same as WORD_ALIGN on the ESP8266.
+#define FRAME_ALIGN(size) (((size) + sizeof(void *) - 1) & ~(sizeof(void *) - 1))
+
 // The priority for the task used to execute the next program instruction.
 // This is performed in a task to ensure long running programs don't overload the ESP8266.
 #define EXEC_INSTR_PRI 1
@@ -45,6 +56,25 @@
 // The queue length for the task used to execute the next program instruction.
 #define EXEC_INSTR_QUEUE_LEN 2
 
+// The longest total time that estimating a program's duration may execute it for, in us. The time
+// is spread over batches of the execution time budget, and programs that don't finish within it,
+// such as those that loop forever, are not estimated.
+#define ESTIMATE_TIME_BUDGET 50000
+
+// Set to 1 to print a trace of every executed instruction. This slows execution considerably, as
+// each instruction then waits on the serial port.
+#define VM_TRACE 0
+
+// Prints a debug message only when instruction tracing is enabled.
+#define trace_print(fmt, ...) \
+	do { if (VM_TRACE) debug_print(fmt, ##__VA_ARGS__); } while (0)
+
+// Use threaded dispatch (computed goto) in the interpreter when the compiler supports it. Define
+// VM_SWITCH_DISPATCH to use the portable switch based dispatch instead.
+#if defined(__GNUC__) && !defined(VM_SWITCH_DISPATCH)
+#define VM_THREADED_DISPATCH
+#endif
+
 // Byte code instruction definitions
 #define INSTR_FD         1
 #define INSTR_BK         2
@@ -94,20 +124,54 @@
 #define INSTR_LTRAW     46
 #define INSTR_RTRAW     47
 #define INSTR_WAIT      48
+#define INSTR_ARC       49
 
 // The lengths of each instruction in bytes, including the instruction itself.
 const uint8_t INSTR_LEN[] = {
 	0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 5,
 	1, 1, 1, 5, 1, 1, 1, 5, 1, 1, 1, 5, 1, 1, 1, 5,
 	1, 1, 1, 1, 1, 1, 5, 1, 1, 5, 5, 5, 1, 1, 1, 1, 
-	1};
+	1, 1};
+
+// The number of opcodes, including the unused opcode zero.
+#define INSTR_COUNT sizeof(INSTR_LEN)
+
+// Internal opcodes for the superinstructions that byte code sequences are fused into when a program
+// is loaded. These follow the byte code instructions, in the order of fusion_t.
+#define INSTR_ADD_LOCAL  (INSTR_COUNT + FUSE_ADD_LOCAL)
+#define INSTR_BR_LOCALS  (INSTR_COUNT + FUSE_BR_LOCALS)
+#define INSTR_BR_CONST   (INSTR_COUNT + FUSE_BR_CONST)
+#define INSTR_MOVE_CONST (INSTR_COUNT + FUSE_MOVE_CONST)
+
+// The maximum number of byte code instructions fused into a superinstruction.
+#define MAX_FUSED_LEN 4
+
+// The flag in a cell index marking an instruction as a branch target.
+#define BRANCH_TARGET 0x8000
+
+/*
+ * The type for a pre-decoded instruction. Each function's byte code is translated into an array of
+ * cells when the program is loaded, so that the interpreter does not need to decode the byte code.
+ */
+typedef struct cell_t {
+	const void *handler;         // The address of the instruction's handler (threaded dispatch).
+	union {
+		int32_t value;           // The constant, variable index or function ID for the instruction.
+		struct cell_t *target;   // The resolved target of a branch instruction.
+	} operand;
+	int32_t constant;            // The constant or second local variable of a superinstruction.
+	uint16_t offset;             // The offset of the instruction in the function's byte code.
+	uint8_t opcode;              // The instruction's opcode.
+	uint8_t local;               // The local variable of a superinstruction.
+	uint8_t arg;                 // The comparison or movement instruction of a superinstruction.
+} cell_t;
 
 /*
  * The type for the program counter.
  */
 typedef struct pc_t {
 	uint32_t func;  // Function ID.
-	uint32_t idx;   // Index in function's code.
+	cell_t *cell;   // The next cell to execute in the function's decoded code.
 } pc_t;
 
 /*
@@ -120,10 +184,20 @@ typedef struct stack_frame_t {
 	uint32_t stack_size;        // The number of entries currently in this frame's operand stack.
 	uint32_t max_stack_size;    // The maximum number of stack entries for this frame.
 	int32_t *stack;             // The operand stack for this frame.
+	uint32_t frame_size;        // The number of arena bytes used by this frame.
 	struct stack_frame_t *prev; // Pointer to the previous frame (if any).
-	struct stack_frame_t *next; // Pointer to the next frame (if any).
 } stack_frame_t;
 
+/*
+ * Type for the arena from which stack frames are allocated. Frames are allocated from the start of
+ * the arena and released in the reverse order, so the arena is managed as a simple stack.
+ */
+typedef struct frame_arena_t {
+	uint8_t *base; // The start of the arena's memory.
+	uint32_t size; // The size of the arena, in bytes.
+	uint32_t used; // The number of bytes currently allocated to frames.
+} frame_arena_t;
+
 /*
  * Type for storing the global variables.
  */
@@ -134,13 +208,34 @@ typedef struct global_t {
 
 // Forward definitions.
 LOCAL void ICACHE_FLASH_ATTR free_program(program_t *prog);
+LOCAL bool ICACHE_FLASH_ATTR verify_program(program_t *prog);
+LOCAL bool ICACHE_FLASH_ATTR verify_function(program_t *prog, uint32_t func);
+LOCAL bool ICACHE_FLASH_ATTR read_function_code(program_t *prog, uint32_t func);
+LOCAL uint32_t ICACHE_FLASH_ATTR frame_size(function_t *function);
 LOCAL stack_frame_t * ICACHE_FLASH_ATTR create_stack_frame(function_t *function);
+LOCAL void ICACHE_FLASH_ATTR release_stack_frame(stack_frame_t *sf);
+LOCAL bool ICACHE_FLASH_ATTR decode_program(program_t *prog);
+LOCAL uint32_t ICACHE_FLASH_ATTR index_function(function_t *function, uint16_t *cell_index);
+LOCAL uint32_t ICACHE_FLASH_ATTR fuse_instructions(
+		function_t *function, uint32_t idx, uint16_t *cell_index, cell_t *cell);
+LOCAL void ICACHE_FLASH_ATTR decode_instruction(uint8_t *code, uint32_t idx, cell_t *cell);
+LOCAL uint8_t ICACHE_FLASH_ATTR invert_comparison(uint8_t instr);
+LOCAL inline bool compare(uint8_t instr, int32_t value1, int32_t value2);
 LOCAL void ICACHE_FLASH_ATTR execute_instruction();
+LOCAL bool ICACHE_FLASH_ATTR execute_cells(
+		uint32_t start, uint32_t budget, uint32_t *count, const cell_t **current);
+LOCAL bool ICACHE_FLASH_ATTR drive_distance(uint8_t instr, int32_t value, uint16_t offset);
+LOCAL bool ICACHE_FLASH_ATTR drive_steps(
+		uint8_t instr, int32_t left, int32_t right, uint16_t offset);
+LOCAL bool ICACHE_FLASH_ATTR drive_arc(int32_t radius, int32_t angle, uint16_t offset);
+LOCAL bool ICACHE_FLASH_ATTR queue_action(motion_type_t type, uint32_t duration, uint16_t offset);
+LOCAL bool ICACHE_FLASH_ATTR queue_program_motion(const motion_t *motion);
+LOCAL void ICACHE_FLASH_ATTR start_estimate();
+LOCAL void ICACHE_FLASH_ATTR estimate_batch();
+LOCAL void ICACHE_FLASH_ATTR motion_started(const motion_t *motion);
+LOCAL void ICACHE_FLASH_ATTR motion_completed();
+LOCAL void ICACHE_FLASH_ATTR print_vm_stats();
 void ICACHE_FLASH_ATTR program_error(char *message);
-void ICACHE_FLASH_ATTR end_move_pause();
-void ICACHE_FLASH_ATTR pause(uint32_t duration);
-LOCAL inline bool stack_push(int32_t val);
-LOCAL inline int32_t stack_pop();
 
 // The status of the program execution.
 LOCAL prog_status_t program_status = IDLE;
@@ -148,8 +243,19 @@ LOCAL prog_status_t program_status = IDLE;
 // The program being executed.
 LOCAL program_t *program;
 
-// The head of the stack.
-LOCAL stack_frame_t *stack = NULL;
+// The decoded cells for all of the program's functions.
+LOCAL cell_t *cells = NULL;
+
+// The first decoded cell of each function.
+LOCAL cell_t *function_cells[MAX_FUNC_COUNT];
+
+#ifdef VM_THREADED_DISPATCH
+// The addresses of the instruction handlers, indexed by opcode.
+LOCAL const void * const *dispatch_handlers = NULL;
+#endif
+
+// The arena holding the stack frames.
+LOCAL frame_arena_t arena;
 
 // The stack pointer, pointing to the current stack frame.
 LOCAL stack_frame_t *sp = NULL;
@@ -160,8 +266,102 @@ LOCAL global_t globals;
 // The queue used for posting events to the instruction execution queue.
 LOCAL os_event_t vm_exec_queue[EXEC_INSTR_QUEUE_LEN];
 
-// Timer for post movement pauses.
-LOCAL os_timer_t move_pause_timer;
+// The execution statistics for the current program.
+LOCAL vm_stats_t vm_stats;
+
+// Whether the instruction execution task has been posted and has not yet run.
+LOCAL bool exec_task_posted = false;
+
+// Flag set whilst the program is being executed to estimate its duration, without moving.
+LOCAL bool dry_run = false;
+
+// Flag set if the program had an error whilst estimating its duration.
+LOCAL bool dry_run_error = false;
+
+// The time spent executing the program to estimate its duration, in us.
+LOCAL uint32_t dry_run_time = 0;
+
+// The position of the pen whilst estimating the program's duration.
+LOCAL servo_position_t dry_run_pen = UP;
+
+// The estimated progress of the current program.
+LOCAL program_progress_t progress;
+
+// The estimated duration of the motion in progress, in ms.
+LOCAL uint32_t motion_estimate_ms = 0;
+
+// The reason the most recent program was rejected or halted with an error.
+LOCAL char vm_error[MAX_ERROR_LEN];
+
+/*
+ * Creates an empty program in a single allocation holding the program, its function table and
+ * code_size bytes for the functions' byte code, so loading a program does not fragment the heap.
+ */
+program_t * ICACHE_FLASH_ATTR create_program(
+		uint32_t global_count, uint32_t function_count, uint32_t code_size) {
+	uint32_t table_size = function_count * sizeof(function_t);
+	uint32_t size = sizeof(program_t) + table_size + code_size;
+	program_t *prog = (program_t *)os_malloc(size);
+	if (prog == NULL) {
+		os_printf("Unable to allocate %d bytes for a program.\n", size);
+		return NULL;
+	}
+	prog->global_count = global_count;
+	prog->function_count = function_count;
+	prog->functions = (function_t *)(prog + 1);
+	os_memset(prog->functions, 0, table_size);
+	prog->size = size;
+	prog->code_used = 0;
+	prog->code_size = code_size;
+	prog->flash_address = 0;
+	return prog;
+}
+
+/*
+ * Assigns length bytes of a program's code area, which follows its function table, to a function.
+ */
+uint8_t * ICACHE_FLASH_ATTR allocate_function_code(
+		program_t *prog, function_t *function, uint32_t length) {
+	if (length > (prog->code_size - prog->code_used)) {
+		os_printf("Program code area exhausted, %d bytes requested.\n", length);
+		return NULL;
+	}
+	uint8_t *code_area = (uint8_t *)&prog->functions[prog->function_count];
+	function->code = code_area + prog->code_used;
+	function->length = length;
+	prog->code_used += length;
+	return function->code;
+}
+
+/*
+ * Reduces a program's function table to its first function_count functions and its code area to the
+ * code assigned to them, moving the code down to follow the function table.
+ */
+program_t * ICACHE_FLASH_ATTR trim_program(program_t *prog, uint32_t function_count) {
+	uint8_t *old_area = (uint8_t *)&prog->functions[prog->function_count];
+	uint8_t *new_area = (uint8_t *)&prog->functions[function_count];
+	os_memmove(new_area, old_area, prog->code_used);
+	prog->function_count = function_count;
+	prog->code_size = prog->code_used;
+	uint32_t size = sizeof(program_t) + (function_count * sizeof(function_t)) + prog->code_used;
+
+	// Shrinking the allocation shouldn't fail, but the program is still valid at its old size.
+	program_t *trimmed = (program_t *)os_realloc(prog, size);
+	if (trimmed == NULL) {
+		trimmed = prog;
+	} else {
+		trimmed->size = size;
+	}
+
+	// Point the functions at their moved code, which was assigned to them in order.
+	trimmed->functions = (function_t *)(trimmed + 1);
+	uint8_t *code = (uint8_t *)&trimmed->functions[function_count];
+	for (uint32_t ii = 0; ii < function_count; ii++) {
+		trimmed->functions[ii].code = code;
+		code += trimmed->functions[ii].length;
+	}
+	return trimmed;
+}
 
 /*
  * Runs a program on the micro-turtle in the background. The supplied program information is used
@@ -175,88 +375,697 @@ bool ICACHE_FLASH_ATTR run_program(program_t *prog) {
 	}
 	program_status = IDLE;
 
-	// Check the program's validity - basic checks only.
+	// Check the program's validity before anything is executed.
 	if (prog == NULL) {
-		os_printf("NULL program received.\n");
+		os_sprintf(vm_error, "NULL program received");
+		os_printf("%s.\n", vm_error);
 		return false;
 	}
-	if (prog->global_count > MAX_VAR_COUNT) {
-		os_printf("Too many global variables - %d.\n", prog->global_count);
+	if (!verify_program(prog)) {
+		os_printf("Program rejected - %s.\n", vm_error);
 		free_program(prog);
 		return false;
 	}
+
+	// Delete any old program information.
+	free_program(NULL);
+
+	// Copy the program pointer locally.
+	program = prog;
+
+	// Reset the execution statistics.
+	os_memset(&vm_stats, 0, sizeof(vm_stats_t));
+	vm_stats.program_size = prog->size;
+
+	// Translate the byte code into decoded cells for execution.
+	if (!decode_program(prog)) {
+		os_printf("%s.\n", vm_error);
+		free_program(NULL);
+		return false;
+	}
+
+	// Allocate the stack frame arena, large enough for the main function's frame plus the deepest
+	// permitted call chain of the largest other function.
+	uint32_t largest_frame = 0;
+	for (uint32_t ii = 1; ii < prog->function_count; ii++) {
+		uint32_t size = frame_size(&prog->functions[ii]);
+		if (size > largest_frame) {
+			largest_frame = size;
+		}
+	}
+	arena.size = frame_size(&prog->functions[0]) + ((MAX_CALL_DEPTH - 1) * largest_frame);
+	arena.used = 0;
+	arena.base = (uint8_t *)os_malloc(arena.size);
+	if (arena.base == NULL) {
+		os_sprintf(vm_error, "Unable to allocate %d bytes for the stack frames", arena.size);
+		os_printf("%s.\n", vm_error);
+		free_program(NULL);
+		return false;
+	}
+	vm_stats.arena_size = arena.size;
+
+	// Initialise the stack.
+	sp = create_stack_frame(&program->functions[0]);
+
+	// Initialise the globals.
+	globals.global_count = prog->global_count;
+	if (globals.global_count > 0) {
+		globals.values = (int32_t *)os_malloc(globals.global_count * sizeof(int32_t));
+		if (globals.values == NULL) {
+			os_sprintf(vm_error, "Unable to allocate global memory");
+			os_printf("%s.\n", vm_error);
+			free_program(NULL);
+			return false;
+		}
+		os_memset(globals.values, 0, globals.global_count * sizeof(int32_t));
+	} else {
+		globals.values = NULL;
+	}
+
+	// Estimate how long the program takes, then start it by executing the first instuction. The
+	// first batch of the estimate is executed now, so a short program's estimate is available
+	// immediately, and the rest of the estimate is executed by the execution task.
+	vm_error[0] = '\0';
+	program_status = RUNNING;
+	start_estimate();
+	estimate_batch();
+	execute_instruction();
+	return true;
+}
+
+/*
+ * Starts estimating the duration of the program's motions, by executing the program without moving
+ * the turtle and summing the estimated duration of each motion that it queues. The program is
+ * executed in batches by estimate_batch, until it finishes or ESTIMATE_TIME_BUDGET has been used.
+ */
+LOCAL void ICACHE_FLASH_ATTR start_estimate() {
+	os_memset(&progress, 0, sizeof(program_progress_t));
+	progress.estimating = true;
+	motion_estimate_ms = 0;
+	dry_run = true;
+	dry_run_error = false;
+	dry_run_time = 0;
+	dry_run_pen = get_servo();
+}
+
+/*
+ * Executes the next batch of the program to estimate its duration, within the execution time
+ * budget. Once the estimate is complete, the program's stack and globals are reset, ready for it to
+ * be run. The estimate is not available if the program doesn't finish within ESTIMATE_TIME_BUDGET,
+ * or has an error.
+ */
+LOCAL void ICACHE_FLASH_ATTR estimate_batch() {
+	uint32_t start = system_get_time();
+	uint32_t budget = get_exec_time_budget();
+	if (budget > ESTIMATE_TIME_BUDGET - dry_run_time) {
+		budget = ESTIMATE_TIME_BUDGET - dry_run_time;
+	}
+	uint32_t count;
+	const cell_t *current;
+	bool unfinished = execute_cells(start, budget, &count, &current);
+	dry_run_time += system_get_time() - start;
+	if (unfinished && !dry_run_error && (dry_run_time < ESTIMATE_TIME_BUDGET)) {
+		// Continue the estimate in the next batch.
+		return;
+	}
+	dry_run = false;
+	progress.estimating = false;
+	progress.estimated = !unfinished && !dry_run_error;
+	if (!progress.estimated) {
+		progress.total_ms = 0;
+	}
+	os_printf("Program estimate: %s, %d ms.\n", progress.estimated ? "complete" : "unavailable",
+			progress.total_ms);
+
+	// Reset the program's state, and the statistics that the estimate contributed to.
+	arena.used = 0;
+	vm_stats.arena_peak = 0;
+	os_memset(vm_stats.fusion_hits, 0, sizeof(vm_stats.fusion_hits));
+	sp = create_stack_frame(&program->functions[0]);
+	if (globals.values != NULL) {
+		os_memset(globals.values, 0, globals.global_count * sizeof(int32_t));
+	}
+}
+
+/*
+ * Verifies that a program is safe to execute without run-time checks. The program's size limits are
+ * checked, then each function's byte code is verified. Returns false with the reason in vm_error if
+ * the program cannot be executed.
+ */
+LOCAL bool ICACHE_FLASH_ATTR verify_program(program_t *prog) {
+	if (prog->global_count > MAX_VAR_COUNT) {
+		os_sprintf(vm_error, "Too many global variables - %d", prog->global_count);
+		return false;
+	}
 	if (prog->function_count > MAX_FUNC_COUNT) {
-		os_printf("Too many functions - %d.\n", prog->function_count);
-		free_program(prog);
+		os_sprintf(vm_error, "Too many functions - %d", prog->function_count);
 		return false;
 	}
 	if (prog->function_count == 0) {
-		os_printf("No functions defined.\n");
-		free_program(prog);
+		os_sprintf(vm_error, "No functions defined");
 		return false;
 	}
 	for (uint32_t ii = 0; ii < prog->function_count; ii++) {
+		if (prog->functions[ii].id != ii) {
+			os_sprintf(vm_error, "Function %d has mismatched ID %d", ii, prog->functions[ii].id);
+			return false;
+		}
 		if (prog->functions[ii].argument_count > MAX_VAR_COUNT) {
-			os_printf("Too many arguments for function %d - %d.\n",
+			os_sprintf(vm_error, "Too many arguments for function %d - %d",
 					ii, prog->functions[ii].argument_count);
-			free_program(prog);
 			return false;
 		}
 		if (prog->functions[ii].local_count > MAX_VAR_COUNT) {
-			os_printf("Too many local variables for function %d - %d.\n",
+			os_sprintf(vm_error, "Too many local variables for function %d - %d",
 					ii, prog->functions[ii].local_count);
-			free_program(prog);
 			return false;
 		}
 		if (prog->functions[ii].stack_size > MAX_STACK_SIZE) {
-			os_printf("Stack size too large for function %d - %d.\n",
+			os_sprintf(vm_error, "Stack size too large for function %d - %d",
 					ii, prog->functions[ii].stack_size);
-			free_program(prog);
 			return false;
 		}
 		if (prog->functions[ii].length > MAX_FUNC_LEN) {
-			os_printf("Function %d is too long - %d bytes.\n",
+			os_sprintf(vm_error, "Function %d is too long - %d bytes",
 					ii, prog->functions[ii].length);
-			free_program(prog);
 			return false;
 		}
 		if (prog->functions[ii].length == 0) {
-			os_printf("Function %d has no contents.\n", ii);
-			free_program(prog);
+			os_sprintf(vm_error, "Function %d has no contents", ii);
 			return false;
 		}
 	}
 
-	// Delete any old program information.
-	free_program(NULL);
+	// Verify the byte code of every function.
+	for (uint32_t ii = 0; ii < prog->function_count; ii++) {
+		if (!read_function_code(prog, ii) || !verify_function(prog, ii)) {
+			return false;
+		}
+	}
+	return true;
+}
 
-	// Copy the program pointer locally.
-	program = prog;
+/*
+ * Ensures a function's byte code is available in memory. The code of a program that is executed
+ * from flash is read a function at a time, as it is only needed when verifying and decoding it.
+ * Returns false with the reason in vm_error if the code could not be read.
+ */
+LOCAL bool ICACHE_FLASH_ATTR read_function_code(program_t *prog, uint32_t func) {
+	if (prog->flash_address == 0) {
+		// The code is already in memory.
+		return true;
+	}
+	if (!load_function_code(prog, func)) {
+		os_sprintf(vm_error, "Unable to read function %d from flash", func);
+		return false;
+	}
+	return true;
+}
 
-	// Initialise the stack.
-	stack = create_stack_frame(&program->functions[0]);
-	if (stack == NULL) {
-		free_program(NULL);
+/*
+ * Verifies a function's byte code by abstract interpretation, following every path through the
+ * function while tracking the operand stack depth. This proves that:
+ *  - every instruction is known and complete, and every branch (even one that can't be reached)
+ *    targets the start of an instruction, as decode_program resolves them all,
+ *  - the stack never underflows or exceeds the function's stack size, and has the same depth
+ *    whenever paths join,
+ *  - every local and global variable index, and every called function ID, is valid,
+ *  - every path ends with a RET or STOP instruction, and the main function never RETurns.
+ * Returns false with the reason and location in vm_error if the function fails verification.
+ */
+LOCAL bool ICACHE_FLASH_ATTR verify_function(program_t *prog, uint32_t func) {
+	function_t *function = &prog->functions[func];
+	uint32_t length = function->length;
+	uint8_t *code = function->code;
+	uint32_t var_count = function->argument_count + function->local_count;
+
+	// The stack depth on entry to each byte of code, using NOT_INSTR for bytes that are not the start
+	// of an instruction and NOT_VISITED for instructions not yet reached. Instruction offsets still
+	// to be followed are held in the work list.
+	const int8_t NOT_INSTR = -2;
+	const int8_t NOT_VISITED = -1;
+	uint8_t *buf = (uint8_t *)os_malloc(WORD_ALIGN(length) + (length * sizeof(uint16_t)));
+	if (buf == NULL) {
+		os_sprintf(vm_error, "Unable to allocate memory to verify function %d", func);
 		return false;
 	}
-	sp = stack;
+	int8_t *depths = (int8_t *)buf;
+	uint16_t *work = (uint16_t *)(buf + WORD_ALIGN(length));
+	uint32_t work_count = 0;
+	os_memset(depths, NOT_INSTR, length);
+
+	// Find the start of each instruction.
+	uint32_t idx = 0;
+	while (idx < length) {
+		if ((code[idx] == 0) || (code[idx] >= sizeof(INSTR_LEN))) {
+			os_sprintf(vm_error, "Function %d, offset %d: unknown instruction %d", func, idx, code[idx]);
+			os_free(buf);
+			return false;
+		}
+		if ((idx + INSTR_LEN[code[idx]]) > length) {
+			os_sprintf(vm_error, "Function %d, offset %d: incomplete instruction", func, idx);
+			os_free(buf);
+			return false;
+		}
+		depths[idx] = NOT_VISITED;
+		idx += INSTR_LEN[code[idx]];
+	}
 
-	// Initialise the globals.
-	globals.global_count = prog->global_count;
-	if (globals.global_count > 0) {
-		globals.values = (int32_t *)os_malloc(globals.global_count * sizeof(int32_t));
-		if (globals.values == NULL) {
-			os_printf("Unable to allocate global memory.\n");
-			free_program(NULL);
+	// Check the target of every branch, including those on paths that are never followed.
+	for (idx = 0; idx < length; idx += INSTR_LEN[code[idx]]) {
+		if ((code[idx] == INSTR_BR) || (code[idx] == INSTR_BRT) || (code[idx] == INSTR_BRF)) {
+			uint32_t target = BYTES_TO_INT32(code, idx + 1);
+			if ((target >= length) || (depths[target] == NOT_INSTR)) {
+				os_sprintf(vm_error, "Function %d, offset %d: invalid branch target", func, idx);
+				os_free(buf);
+				return false;
+			}
+		}
+	}
+
+	// Follow each path through the function from the first instruction.
+	depths[0] = 0;
+	work[work_count++] = 0;
+	while (work_count > 0) {
+		idx = work[--work_count];
+		uint8_t instr = code[idx];
+		int32_t depth = depths[idx];
+		uint32_t operand = (INSTR_LEN[instr] == 5) ? BYTES_TO_INT32(code, idx + 1) : 0;
+		int32_t pops = 0;
+		int32_t pushes = 0;
+		bool falls_through = true;
+		bool branches = false;
+		char *error = NULL;
+
+		switch (instr) {
+			case INSTR_FD:
+			case INSTR_BK:
+			case INSTR_LT:
+			case INSTR_RT:
+			case INSTR_WAIT:
+				pops = 1;
+				break;
+			case INSTR_FDRAW:
+			case INSTR_BKRAW:
+			case INSTR_LTRAW:
+			case INSTR_RTRAW:
+			case INSTR_ARC:
+				pops = 2;
+				break;
+			case INSTR_PU:
+			case INSTR_PD:
+				break;
+			case INSTR_IADD:
+			case INSTR_ISUB:
+			case INSTR_IMUL:
+			case INSTR_IDIV:
+			case INSTR_ILT:
+			case INSTR_ILE:
+			case INSTR_IGT:
+			case INSTR_IGE:
+			case INSTR_IEQ:
+			case INSTR_INE:
+				pops = 2;
+				pushes = 1;
+				break;
+			case INSTR_ICONST_0:
+			case INSTR_ICONST_1:
+			case INSTR_ICONST_45:
+			case INSTR_ICONST_90:
+			case INSTR_ICONST:
+				pushes = 1;
+				break;
+			case INSTR_ILOAD_0:
+			case INSTR_ILOAD_1:
+			case INSTR_ILOAD_2:
+			case INSTR_ILOAD:
+				if (instr != INSTR_ILOAD) {
+					operand = instr - INSTR_ILOAD_0;
+				}
+				if (operand >= var_count) {
+					error = "invalid local variable";
+				}
+				pushes = 1;
+				break;
+			case INSTR_ISTORE_0:
+			case INSTR_ISTORE_1:
+			case INSTR_ISTORE_2:
+			case INSTR_ISTORE:
+				if (instr != INSTR_ISTORE) {
+					operand = instr - INSTR_ISTORE_0;
+				}
+				if (operand >= var_count) {
+					error = "invalid local variable";
+				}
+				pops = 1;
+				break;
+			case INSTR_GLOAD_0:
+			case INSTR_GLOAD_1:
+			case INSTR_GLOAD_2:
+			case INSTR_GLOAD:
+				if (instr != INSTR_GLOAD) {
+					operand = instr - INSTR_GLOAD_0;
+				}
+				if (operand >= prog->global_count) {
+					error = "invalid global variable";
+				}
+				pushes = 1;
+				break;
+			case INSTR_GSTORE_0:
+			case INSTR_GSTORE_1:
+			case INSTR_GSTORE_2:
+			case INSTR_GSTORE:
+				if (instr != INSTR_GSTORE) {
+					operand = instr - INSTR_GSTORE_0;
+				}
+				if (operand >= prog->global_count) {
+					error = "invalid global variable";
+				}
+				pops = 1;
+				break;
+			case INSTR_CALL:
+				if ((operand == 0) || (operand >= prog->function_count)) {
+					error = "invalid function ID for CALL";
+				} else {
+					pops = prog->functions[operand].argument_count;
+				}
+				break;
+			case INSTR_RET:
+				if (func == 0) {
+					error = "RET from the main function";
+				}
+				falls_through = false;
+				break;
+			case INSTR_STOP:
+				falls_through = false;
+				break;
+			case INSTR_BR:
+				branches = true;
+				falls_through = false;
+				break;
+			case INSTR_BRT:
+			case INSTR_BRF:
+				branches = true;
+				pops = 1;
+				break;
+			default:
+				error = "unknown instruction";
+				break;
+		}
+
+		// Check the instruction's effect on the stack.
+		if ((error == NULL) && (depth < pops)) {
+			error = "stack underflow";
+		}
+		depth = depth - pops + pushes;
+		if ((error == NULL) && (depth > (int32_t)function->stack_size)) {
+			error = "stack overflow";
+		}
+
+		// Queue the instructions that follow this one, the next instruction first, then any branch.
+		for (uint32_t jj = 0; (jj < 2) && (error == NULL); jj++) {
+			uint32_t succ = (jj == 0) ? idx + INSTR_LEN[instr] : operand;
+			if (((jj == 0) && !falls_through) || ((jj == 1) && !branches)) {
+				continue;
+			}
+			if (succ >= length) {
+				error = (jj == 0) ? "end of function without RET/STOP" : "invalid branch target";
+			} else if (depths[succ] == NOT_INSTR) {
+				error = "invalid branch target";
+			} else if (depths[succ] == NOT_VISITED) {
+				depths[succ] = depth;
+				work[work_count++] = succ;
+			} else if (depths[succ] != depth) {
+				error = "inconsistent stack depth";
+			}
+		}
+
+		if (error != NULL) {
+			os_sprintf(vm_error, "Function %d, offset %d: %s", func, idx, error);
+			os_free(buf);
 			return false;
 		}
-	} else {
-		globals.values = NULL;
 	}
 
-	// Start the program by executing the first instuction.
-	program_status = RUNNING;
-	execute_instruction();
+	os_free(buf);
+	return true;
+}
+
+/*
+ * Translates the verified byte code of every function into pre-decoded cells. Each cell holds the
+ * instruction's handler and decoded operand, with branch targets resolved to the target cell.
+ * Common byte code sequences are fused into a single superinstruction cell.
+ * Returns false with the reason in vm_error if the memory for the cells could not be allocated.
+ */
+LOCAL bool ICACHE_FLASH_ATTR decode_program(program_t *prog) {
+	uint32_t max_length = 0;
+	for (uint32_t func = 0; func < prog->function_count; func++) {
+		if (prog->functions[func].length > max_length) {
+			max_length = prog->functions[func].length;
+		}
+	}
+	uint16_t *cell_index = (uint16_t *)os_malloc(max_length * sizeof(uint16_t));
+	if (cell_index == NULL) {
+		os_sprintf(vm_error, "Unable to allocate memory for decoding the program");
+		return false;
+	}
+
+	// Count the cells, so the cells for all functions can be allocated together.
+	uint32_t cell_count = 0;
+	for (uint32_t func = 0; func < prog->function_count; func++) {
+		if (!read_function_code(prog, func)) {
+			os_free(cell_index);
+			return false;
+		}
+		cell_count += index_function(&prog->functions[func], cell_index);
+	}
+	cells = (cell_t *)os_malloc(cell_count * sizeof(cell_t));
+	if (cells == NULL) {
+		os_sprintf(vm_error, "Unable to allocate memory for %d decoded instructions", cell_count);
+		os_free(cell_index);
+		return false;
+	}
+	vm_stats.cells_size = cell_count * sizeof(cell_t);
+
+	cell_t *cell = cells;
+	for (uint32_t func = 0; func < prog->function_count; func++) {
+		function_t *function = &prog->functions[func];
+		function_cells[func] = cell;
+		if (!read_function_code(prog, func)) {
+			os_free(cell_index);
+			return false;
+		}
+		index_function(function, cell_index);
+
+		// Decode the instructions, fusing them where possible.
+		uint32_t idx = 0;
+		while (idx < function->length) {
+			uint32_t length = fuse_instructions(function, idx, cell_index, cell);
+			if (length > 0) {
+				vm_stats.fusion_sites[cell->opcode - INSTR_COUNT]++;
+			} else {
+				decode_instruction(function->code, idx, cell);
+				length = INSTR_LEN[function->code[idx]];
+			}
+
+			// Resolve the branch target to its cell.
+			switch (cell->opcode) {
+				case INSTR_BR:
+				case INSTR_BRT:
+				case INSTR_BRF:
+				case INSTR_BR_LOCALS:
+				case INSTR_BR_CONST:
+					cell->operand.target =
+							function_cells[func] + (cell_index[cell->operand.value] & ~BRANCH_TARGET);
+					break;
+			}
+#ifdef VM_THREADED_DISPATCH
+			cell->handler = dispatch_handlers[cell->opcode];
+#else
+			cell->handler = NULL;
+#endif
+			idx += length;
+			cell++;
+		}
+	}
+
+	os_free(cell_index);
+	return true;
+}
+
+/*
+ * Finds the index of the cell for each instruction that starts a cell in the function, with fused
+ * sequences taking a single cell. Every branch target also has the BRANCH_TARGET flag set in
+ * cell_index, as sequences including a branch target aren't fused.
+ * Returns the number of cells for the function.
+ */
+LOCAL uint32_t ICACHE_FLASH_ATTR index_function(function_t *function, uint16_t *cell_index) {
+	uint8_t *code = function->code;
+
+	// Mark the branch targets.
+	os_memset(cell_index, 0, function->length * sizeof(uint16_t));
+	for (uint32_t idx = 0; idx < function->length; idx += INSTR_LEN[code[idx]]) {
+		if ((code[idx] == INSTR_BR) || (code[idx] == INSTR_BRT) || (code[idx] == INSTR_BRF)) {
+			cell_index[BYTES_TO_INT32(code, idx + 1)] = BRANCH_TARGET;
+		}
+	}
+
+	// Assign the cell indices.
+	cell_t cell;
+	uint32_t count = 0;
+	uint32_t idx = 0;
+	while (idx < function->length) {
+		uint32_t length = fuse_instructions(function, idx, cell_index, &cell);
+		cell_index[idx] |= count++;
+		idx += (length > 0) ? length : INSTR_LEN[code[idx]];
+	}
+	return count;
+}
+
+/*
+ * Fuses the byte code sequence starting at idx into a superinstruction cell, if it matches one of:
+ *   ILOAD x; ICONST n; IADD/ISUB; ISTORE x  -> ADD_LOCAL (x += n)
+ *   ILOAD x; ILOAD y; <compare>; BRT/BRF    -> BR_LOCALS
+ *   ILOAD x; ICONST n; <compare>; BRT/BRF   -> BR_CONST
+ *   ICONST n; FD/BK/LT/RT                   -> MOVE_CONST
+ * A sequence is not fused if any instruction after its first is a branch target.
+ * Returns the length of the fused byte code, or 0 if the sequence can't be fused.
+ */
+LOCAL uint32_t ICACHE_FLASH_ATTR fuse_instructions(
+		function_t *function, uint32_t idx, uint16_t *cell_index, cell_t *cell) {
+	// Decode the instructions that could be fused.
+	cell_t seq[MAX_FUSED_LEN];
+	uint32_t end[MAX_FUSED_LEN];
+	uint32_t count = 0;
+	uint32_t offset = idx;
+	while ((count < MAX_FUSED_LEN) && (offset < function->length) &&
+			((count == 0) || !(cell_index[offset] & BRANCH_TARGET))) {
+		decode_instruction(function->code, offset, &seq[count]);
+		offset += INSTR_LEN[function->code[offset]];
+		end[count++] = offset;
+	}
+
+	cell->offset = idx;
+	if ((count == 4) && (seq[0].opcode == INSTR_ILOAD) && (seq[1].opcode == INSTR_ICONST) &&
+			((seq[2].opcode == INSTR_IADD) || (seq[2].opcode == INSTR_ISUB)) &&
+			(seq[3].opcode == INSTR_ISTORE) && (seq[3].operand.value == seq[0].operand.value)) {
+		cell->opcode = INSTR_ADD_LOCAL;
+		cell->local = seq[0].operand.value;
+		cell->constant =
+				(seq[2].opcode == INSTR_IADD) ? seq[1].operand.value : -seq[1].operand.value;
+		return end[3] - idx;
+	}
+	if ((count == 4) && (seq[0].opcode == INSTR_ILOAD) &&
+			((seq[1].opcode == INSTR_ILOAD) || (seq[1].opcode == INSTR_ICONST)) &&
+			(seq[2].opcode >= INSTR_ILT) && (seq[2].opcode <= INSTR_INE) &&
+			((seq[3].opcode == INSTR_BRT) || (seq[3].opcode == INSTR_BRF))) {
+		// Branch if the comparison is true, inverting it for BRF.
+		cell->opcode = (seq[1].opcode == INSTR_ILOAD) ? INSTR_BR_LOCALS : INSTR_BR_CONST;
+		cell->local = seq[0].operand.value;
+		cell->constant = seq[1].operand.value;
+		cell->arg =
+				(seq[3].opcode == INSTR_BRT) ? seq[2].opcode : invert_comparison(seq[2].opcode);
+		cell->operand.value = seq[3].operand.value;
+		return end[3] - idx;
+	}
+	if ((count >= 2) && (seq[0].opcode == INSTR_ICONST) &&
+			(seq[1].opcode >= INSTR_FD) && (seq[1].opcode <= INSTR_RT)) {
+		// Report the movement instruction's offset whilst the turtle is moving.
+		cell->opcode = INSTR_MOVE_CONST;
+		cell->arg = seq[1].opcode;
+		cell->constant = seq[0].operand.value;
+		cell->offset = seq[1].offset;
+		return end[1] - idx;
+	}
+	return 0;
+}
+
+/*
+ * Decodes the single byte code instruction at idx into a cell. Instructions with implied operands
+ * (such as ICONST_1 or ILOAD_0) are translated to the general form of the instruction, with the
+ * operand in the cell. Branch operands are left as byte code offsets.
+ */
+LOCAL void ICACHE_FLASH_ATTR decode_instruction(uint8_t *code, uint32_t idx, cell_t *cell) {
+	uint8_t instr = code[idx];
+	cell->offset = idx;
+	cell->opcode = instr;
+	cell->operand.value = (INSTR_LEN[instr] == 5) ? BYTES_TO_INT32(code, idx + 1) : 0;
+	switch (instr) {
+		case INSTR_ICONST_0:
+		case INSTR_ICONST_1:
+			cell->opcode = INSTR_ICONST;
+			cell->operand.value = instr - INSTR_ICONST_0;
+			break;
+		case INSTR_ICONST_45:
+		case INSTR_ICONST_90:
+			cell->opcode = INSTR_ICONST;
+			cell->operand.value = (instr == INSTR_ICONST_45) ? 45 : 90;
+			break;
+		case INSTR_ILOAD_0:
+		case INSTR_ILOAD_1:
+		case INSTR_ILOAD_2:
+			cell->opcode = INSTR_ILOAD;
+			cell->operand.value = instr - INSTR_ILOAD_0;
+			break;
+		case INSTR_ISTORE_0:
+		case INSTR_ISTORE_1:
+		case INSTR_ISTORE_2:
+			cell->opcode = INSTR_ISTORE;
+			cell->operand.value = instr - INSTR_ISTORE_0;
+			break;
+		case INSTR_GLOAD_0:
+		case INSTR_GLOAD_1:
+		case INSTR_GLOAD_2:
+			cell->opcode = INSTR_GLOAD;
+			cell->operand.value = instr - INSTR_GLOAD_0;
+			break;
+		case INSTR_GSTORE_0:
+		case INSTR_GSTORE_1:
+		case INSTR_GSTORE_2:
+			cell->opcode = INSTR_GSTORE;
+			cell->operand.value = instr - INSTR_GSTORE_0;
+			break;
+	}
+}
+
+/*
+ * Returns the comparison instruction giving the opposite result to the given one.
+ */
+LOCAL uint8_t ICACHE_FLASH_ATTR invert_comparison(uint8_t instr) {
+	switch (instr) {
+		case INSTR_ILT:
+			return INSTR_IGE;
+		case INSTR_ILE:
+			return INSTR_IGT;
+		case INSTR_IGT:
+			return INSTR_ILE;
+		case INSTR_IGE:
+			return INSTR_ILT;
+		case INSTR_IEQ:
+			return INSTR_INE;
+		default:
+			return INSTR_IEQ;
+	}
+}
+
+/*
+ * Performs the comparison for a comparison instruction on two values.
+ */
+LOCAL inline bool compare(uint8_t instr, int32_t value1, int32_t value2) {
+	switch (instr) {
+		case INSTR_ILT:
+			return value1 < value2;
+		case INSTR_ILE:
+			return value1 <= value2;
+		case INSTR_IGT:
+			return value1 > value2;
+		case INSTR_IGE:
+			return value1 >= value2;
+		case INSTR_IEQ:
+			return value1 == value2;
+		default:
+			return value1 != value2;
+	}
 }
 
 /*
@@ -267,37 +1076,31 @@ LOCAL void ICACHE_FLASH_ATTR free_program(program_t *prog) {
 	program_t *ptr = prog;
 	bool global_program = false;
 	if (prog == NULL) {
-		ptr = prog;
+		ptr = program;
 		global_program = true;
 	}
 
 	if (ptr != NULL) {
-		// Free the functions within the program.
-		if (ptr->functions != NULL) {
-			for (uint32_t ii = 0; ii < ptr->function_count; ii++) {
-				if (ptr->functions[ii].code != NULL) {
-					os_free(ptr->functions[ii].code);
-				}
-			}
-			os_free(ptr->functions);
-		}
-
-		// Free the program itself.
+		// The program, its functions and their code are a single allocation.
 		os_free(ptr);
 	}
 
 	if (global_program) {
 		program = NULL;
 
+		// Free the decoded cells.
+		if (cells != NULL) {
+			os_free(cells);
+		}
+		cells = NULL;
+
 		// Free the stack memory.
-		while (stack != NULL) {
-			stack_frame_t *s = stack;
-			stack = s->next;
-			os_free(s->locals);
-			os_free(s->stack);
-			os_free(s);
-			stack = NULL;
+		if (arena.base != NULL) {
+			os_free(arena.base);
 		}
+		arena.base = NULL;
+		arena.size = 0;
+		arena.used = 0;
 		sp = NULL;
 
 		// Free the global memory.
@@ -317,8 +1120,8 @@ void ICACHE_FLASH_ATTR stop_program() {
 	os_printf("Stopping program.\n");
 	program_status = IDLE;
 
-	// Stop the motors.
-	drive_motors(0, 0, 1, false, NULL);
+	// Stop the motors, discarding any queued motions.
+	clear_motion_queue();
 
 	// Call to execute the next instruction, which will safely free the memory.
 	execute_instruction();
@@ -333,595 +1136,699 @@ void ICACHE_FLASH_ATTR stop_program() {
  * a watchdog timeout in the ESP8266.
  */
 LOCAL void ICACHE_FLASH_ATTR execute_instruction() {
-	// Post the request to the execution task queue to execute the next instruction.
-	system_os_post(EXEC_INSTR_PRI, 0, 0);
+	// Post the request to the execution task queue to execute the next instruction. Only one
+	// request is kept outstanding, so there is only ever one chain of execution.
+	if (!exec_task_posted) {
+		exec_task_posted = system_os_post(EXEC_INSTR_PRI, 0, 0);
+	}
 }
 
 /*
- * Task that executes the next instruction pointed to by the program counter.
+ * Task that executes the instructions pointed to by the program counter. Instructions are executed
+ * in a batch until one has to wait for the motors, servo or a pause, or until the configured time
+ * budget is used, at which point the task is posted again to let the rest of the system run.
  */
 LOCAL void ICACHE_FLASH_ATTR vm_execute_task(os_event_t *event) {
+	exec_task_posted = false;
+
 	// Ensure we're still running the program.
 	if ((program_status != RUNNING) || (program == NULL)) {
 		if (program != NULL) {
+			print_vm_stats();
 			free_program(NULL);
 		}
 		program_status = IDLE;
+		dry_run = false;
+		progress.estimating = false;
 		os_printf("Not executing instruction as program status is not running.\n");
 		return;
 	}
 
-	// Check we have enough space for this instruction.
-	if ((sp->pc.idx + INSTR_LEN[sp->pc.func]) > program->functions[sp->pc.func].length) {
-		os_printf("End of function reached without RET/STOP instruction.\n");
-		os_printf("pc: %d, instr len: %d, func: %d, func len: %d.\n",
-				sp->pc.idx, INSTR_LEN[sp->pc.func],
-				sp->pc.func, program->functions[sp->pc.func].length);
-		stop_program();
+	// Continue estimating the program's duration before it's run, which it then starts in the next
+	// task invocation.
+	if (dry_run) {
+		estimate_batch();
+		execute_instruction();
+		return;
+	}
+
+	// Execute the batch of instructions.
+	uint32_t start = system_get_time();
+	uint32_t count = 0;
+	const cell_t *current = NULL;
+	bool run_next = execute_cells(start, get_exec_time_budget(), &count, &current);
+	uint32_t elapsed = system_get_time() - start;
+
+	// Update the statistics.
+	vm_stats.instruction_count += count;
+	vm_stats.execution_time += elapsed;
+	vm_stats.batch_count++;
+
+	if (program_status != RUNNING) {
+		// The program has finished. A stopped program's statistics are printed when it is freed by
+		// the next task invocation, but a program with an error has already been freed.
+		if (program == NULL) {
+			print_vm_stats();
+		}
+	} else {
+		// Notify any listeners of the instruction being executed, unless the turtle is moving, in
+		// which case the instruction for each motion is notified as it starts.
+		if (is_motion_queue_empty()) {
+			notify_program_status(program_status, sp->pc.func, current->offset);
+		}
+
+		if (run_next) {
+			// The budget has been used, continue in the next task invocation.
+			execute_instruction();
+		}
 	}
+}
 
-	// Get the code at the current program counter.
-	uint8_t *code = &program->functions[sp->pc.func].code[sp->pc.idx];
-	debug_print("Executing instruction at function %d, index %d: %d.\n",
-			sp->pc.func, sp->pc.idx, code[0]);
+// Helper macros for the interpreter in execute_cells, which operate on its copy of the frame state.
+#define PUSH(val)     (*top++ = (val))
+#define POP()         (*--top)
+#define SAVE_FRAME()  (sp->stack_size = top - sp->stack)
+#define LOAD_FRAME()  do { locals = sp->locals; top = sp->stack + sp->stack_size; } while (0)
+#define NEXT()        do { cell++; DISPATCH(); } while (0)
+#define CHECK_BUDGET() \
+	do { if ((system_get_time() - start) >= budget) { goto yield; } } while (0)
+#define TRACE_CELL() \
+	trace_print("Executing instruction at function %d, offset %d: %d.\n", \
+			sp->pc.func, cell->offset, cell->opcode)
+#define FUSED(fusion, length) \
+	do { executed += (length) - 1; vm_stats.fusion_hits[fusion]++; } while (0)
+#ifdef VM_THREADED_DISPATCH
+#define HANDLER(instr) do_##instr:
+#define DISPATCH()     do { executed++; TRACE_CELL(); goto *cell->handler; } while (0)
+#else
+#define HANDLER(instr) case instr:
+#define DISPATCH()     do { executed++; TRACE_CELL(); goto dispatch; } while (0)
+#endif
 
-	// Notify any listeners.
-	notify_program_status(program_status, sp->pc.func, sp->pc.idx);
+/*
+ * Executes the decoded instructions from the current frame's program counter. Execution continues
+ * until an instruction has to wait for the motors, servo or a pause, the program halts, or the time
+ * budget since start has been used. The budget is checked whenever a branch, call or return
+ * transfers control, as every loop passes through one of these.
+ * The number of instructions executed is written to count, and the instruction being performed (or
+ * next to be executed) is written to current.
+ * Returns true if the next instruction can be executed immediately.
+ * If count is NULL, the handler addresses are published for decode_program, and nothing is executed.
+ */
+LOCAL bool ICACHE_FLASH_ATTR execute_cells(
+		uint32_t start, uint32_t budget, uint32_t *count, const cell_t **current) {
+#ifdef VM_THREADED_DISPATCH
+	static const void * const handlers[INSTR_COUNT + FUSION_COUNT] = {
+		[INSTR_FD]     = &&do_INSTR_FD,     [INSTR_BK]     = &&do_INSTR_BK,
+		[INSTR_LT]     = &&do_INSTR_LT,     [INSTR_RT]     = &&do_INSTR_RT,
+		[INSTR_PU]     = &&do_INSTR_PU,     [INSTR_PD]     = &&do_INSTR_PD,
+		[INSTR_IADD]   = &&do_INSTR_IADD,   [INSTR_ISUB]   = &&do_INSTR_ISUB,
+		[INSTR_IMUL]   = &&do_INSTR_IMUL,   [INSTR_IDIV]   = &&do_INSTR_IDIV,
+		[INSTR_ICONST] = &&do_INSTR_ICONST, [INSTR_ILOAD]  = &&do_INSTR_ILOAD,
+		[INSTR_ISTORE] = &&do_INSTR_ISTORE, [INSTR_GLOAD]  = &&do_INSTR_GLOAD,
+		[INSTR_GSTORE] = &&do_INSTR_GSTORE, [INSTR_ILT]    = &&do_INSTR_ILT,
+		[INSTR_ILE]    = &&do_INSTR_ILE,    [INSTR_IGT]    = &&do_INSTR_IGT,
+		[INSTR_IGE]    = &&do_INSTR_IGE,    [INSTR_IEQ]    = &&do_INSTR_IEQ,
+		[INSTR_INE]    = &&do_INSTR_INE,    [INSTR_CALL]   = &&do_INSTR_CALL,
+		[INSTR_RET]    = &&do_INSTR_RET,    [INSTR_STOP]   = &&do_INSTR_STOP,
+		[INSTR_BR]     = &&do_INSTR_BR,     [INSTR_BRT]    = &&do_INSTR_BRT,
+		[INSTR_BRF]    = &&do_INSTR_BRF,    [INSTR_FDRAW]  = &&do_INSTR_FDRAW,
+		[INSTR_BKRAW]  = &&do_INSTR_BKRAW,  [INSTR_LTRAW]  = &&do_INSTR_LTRAW,
+		[INSTR_RTRAW]  = &&do_INSTR_RTRAW,  [INSTR_WAIT]   = &&do_INSTR_WAIT,
+		[INSTR_ARC]    = &&do_INSTR_ARC,
+		[INSTR_ADD_LOCAL]  = &&do_INSTR_ADD_LOCAL,  [INSTR_BR_LOCALS]  = &&do_INSTR_BR_LOCALS,
+		[INSTR_BR_CONST]   = &&do_INSTR_BR_CONST,   [INSTR_MOVE_CONST] = &&do_INSTR_MOVE_CONST
+	};
+#endif
+	if (count == NULL) {
+#ifdef VM_THREADED_DISPATCH
+		dispatch_handlers = handlers;
+#endif
+		return false;
+	}
 
-	// Define variables for use within the below switch block.
+	// Take a copy of the current frame's state, so it can be held in registers.
+	cell_t *cell = sp->pc.cell;
+	int32_t *locals = sp->locals;
+	int32_t *top = sp->stack + sp->stack_size;
+	uint32_t executed = 0;
 	int32_t operand1;
 	int32_t operand2;
+	uint32_t id;
+	uint32_t ii;
+	stack_frame_t *sf;
+
+	// Execute the first instruction.
+	DISPATCH();
+#ifndef VM_THREADED_DISPATCH
+dispatch:
+	switch (cell->opcode) {
+#endif
+	HANDLER(INSTR_FD)
+	HANDLER(INSTR_BK)
+	HANDLER(INSTR_LT)
+	HANDLER(INSTR_RT)
+		// Move by the number of mm, or turn by the number of degrees, at the end of the stack.
+		if (!drive_distance(cell->opcode, top[-1], cell->offset)) {
+			goto block;
+		}
+		top--;
+		NEXT();
+	HANDLER(INSTR_FDRAW)
+	HANDLER(INSTR_BKRAW)
+	HANDLER(INSTR_LTRAW)
+	HANDLER(INSTR_RTRAW)
+		// Move or turn by the number of steps at the end of the stack, right then left.
+		if (!drive_steps(cell->opcode, top[-2], top[-1], cell->offset)) {
+			goto block;
+		}
+		top -= 2;
+		NEXT();
+	HANDLER(INSTR_ARC)
+		// Move along an arc, popping the angle from the top of the stack and then the radius below it.
+		if (!drive_arc(top[-2], top[-1], cell->offset)) {
+			goto block;
+		}
+		top -= 2;
+		NEXT();
+	HANDLER(INSTR_PU)
+		// Raise the pen.
+		if (!queue_action(MOTION_PEN_UP, 0, cell->offset)) {
+			goto block;
+		}
+		NEXT();
+	HANDLER(INSTR_PD)
+		// Lower the pen.
+		if (!queue_action(MOTION_PEN_DOWN, 0, cell->offset)) {
+			goto block;
+		}
+		NEXT();
+	HANDLER(INSTR_WAIT)
+		// Performs a wait operation for the specified number of seconds.
+		operand1 = top[-1];
+		if ((operand1 > 0) &&
+				!queue_action(MOTION_PAUSE, (uint32_t)(operand1 * 1000), cell->offset)) {
+			goto block;
+		}
+		top--;
+		NEXT();
+	HANDLER(INSTR_IADD)
+		// Add the topmost two values on the stack and add it to the stack.
+		operand2 = POP();
+		operand1 = POP();
+		PUSH(operand1 + operand2);
+		NEXT();
+	HANDLER(INSTR_ISUB)
+		// Subtract the topmost two values on the stack from each other and add it to the stack.
+		operand2 = POP();
+		operand1 = POP();
+		PUSH(operand1 - operand2);
+		NEXT();
+	HANDLER(INSTR_IMUL)
+		// Multiply the topmost two values on the stack and add it to the stack.
+		operand2 = POP();
+		operand1 = POP();
+		PUSH(operand1 * operand2);
+		NEXT();
+	HANDLER(INSTR_IDIV)
+		// Divide the topmost two values on the stack from each other and add it to the stack.
+		operand2 = POP();
+		operand1 = POP();
+		if (operand2 == 0) {
+			program_error("Division by zero.\n");
+			goto halt;
+		}
+		PUSH(operand1 / operand2);
+		NEXT();
+	HANDLER(INSTR_ICONST)
+		// Store the constant from the instruction on the stack.
+		PUSH(cell->operand.value);
+		NEXT();
+	HANDLER(INSTR_ILOAD)
+		// Load the value from the variable in the instruction on to the stack.
+		PUSH(locals[cell->operand.value]);
+		NEXT();
+	HANDLER(INSTR_ISTORE)
+		// Store the value from the stack in the variable in the instruction.
+		locals[cell->operand.value] = POP();
+		NEXT();
+	HANDLER(INSTR_GLOAD)
+		// Load the value from the global variable in the instruction on to the stack.
+		PUSH(globals.values[cell->operand.value]);
+		NEXT();
+	HANDLER(INSTR_GSTORE)
+		// Store the value from the stack in the global variable in the instruction.
+		globals.values[cell->operand.value] = POP();
+		NEXT();
+	HANDLER(INSTR_ILT)
+		// Performs a < comparison on the topmost two values from the stack.
+		operand2 = POP();
+		operand1 = POP();
+		PUSH((operand1 < operand2) ? 1 : 0);
+		NEXT();
+	HANDLER(INSTR_ILE)
+		// Performs a <= comparison on the topmost two values from the stack.
+		operand2 = POP();
+		operand1 = POP();
+		PUSH((operand1 <= operand2) ? 1 : 0);
+		NEXT();
+	HANDLER(INSTR_IGT)
+		// Performs a > comparison on the topmost two values from the stack.
+		operand2 = POP();
+		operand1 = POP();
+		PUSH((operand1 > operand2) ? 1 : 0);
+		NEXT();
+	HANDLER(INSTR_IGE)
+		// Performs a >= comparison on the topmost two values from the stack.
+		operand2 = POP();
+		operand1 = POP();
+		PUSH((operand1 >= operand2) ? 1 : 0);
+		NEXT();
+	HANDLER(INSTR_IEQ)
+		// Performs an equality comparison on the topmost two values from the stack.
+		operand2 = POP();
+		operand1 = POP();
+		PUSH((operand1 == operand2) ? 1 : 0);
+		NEXT();
+	HANDLER(INSTR_INE)
+		// Performs an inequality comparison on the topmost two values from the stack.
+		operand2 = POP();
+		operand1 = POP();
+		PUSH((operand1 != operand2) ? 1 : 0);
+		NEXT();
+	HANDLER(INSTR_CALL)
+		// Calls a function, passing it the arguments at the end of the stack.
+		id = cell->operand.value;
+		trace_print("Calling to function %d with %d arguments and %d stack.\n",
+				id, program->functions[id].argument_count, program->functions[id].stack_size);
+
+		// Remove the arguments from the stack, and store the instruction to return to.
+		top -= program->functions[id].argument_count;
+		SAVE_FRAME();
+		sp->pc.cell = cell + 1;
+
+		// Create a new stack frame, and copy the arguments to its local variables.
+		sf = create_stack_frame(&program->functions[id]);
+		if (sf == NULL) {
+			program_error("Unable to create stack frame for CALL instruction.");
+			goto halt;
+		}
+		for (ii = 0; ii < program->functions[id].argument_count; ii++) {
+			sf->locals[ii] = top[ii];
+		}
+
+		// Add the stack frame to the end of the stack and point to it.
+		sf->prev = sp;
+		sp = sf;
+		cell = sp->pc.cell;
+		LOAD_FRAME();
+		CHECK_BUDGET();
+		DISPATCH();
+	HANDLER(INSTR_RET)
+		// Ends the execution of a function, returning to the previous stack frame.
+		sf = sp;
+		sp = sp->prev;
+		release_stack_frame(sf);
+		cell = sp->pc.cell;
+		LOAD_FRAME();
+		CHECK_BUDGET();
+		DISPATCH();
+	HANDLER(INSTR_STOP)
+		// Stops the execution of this program, once the queued motions have completed.
+		if (dry_run) {
+			goto halt;
+		}
+		if (!is_motion_queue_empty()) {
+			goto block;
+		}
+		stop_program();
+		goto halt;
+	HANDLER(INSTR_BR)
+		// Performs an unconditional branch.
+		cell = cell->operand.target;
+		CHECK_BUDGET();
+		DISPATCH();
+	HANDLER(INSTR_BRT)
+		// Performs a conditional branch, if the stack value is true.
+		if (POP() != 0) {
+			cell = cell->operand.target;
+			CHECK_BUDGET();
+			DISPATCH();
+		}
+		NEXT();
+	HANDLER(INSTR_BRF)
+		// Performs a conditional branch, if the stack value is false.
+		if (POP() == 0) {
+			cell = cell->operand.target;
+			CHECK_BUDGET();
+			DISPATCH();
+		}
+		NEXT();
+	HANDLER(INSTR_ADD_LOCAL)
+		// Adds a constant to a local variable.
+		FUSED(FUSE_ADD_LOCAL, 4);
+		locals[cell->local] += cell->constant;
+		NEXT();
+	HANDLER(INSTR_BR_LOCALS)
+		// Compares two local variables, branching if the comparison is true.
+		FUSED(FUSE_BR_LOCALS, 4);
+		if (compare(cell->arg, locals[cell->local], locals[cell->constant])) {
+			cell = cell->operand.target;
+			CHECK_BUDGET();
+			DISPATCH();
+		}
+		NEXT();
+	HANDLER(INSTR_BR_CONST)
+		// Compares a local variable with a constant, branching if the comparison is true.
+		FUSED(FUSE_BR_CONST, 4);
+		if (compare(cell->arg, locals[cell->local], cell->constant)) {
+			cell = cell->operand.target;
+			CHECK_BUDGET();
+			DISPATCH();
+		}
+		NEXT();
+	HANDLER(INSTR_MOVE_CONST)
+		// Moves or turns by a constant number of mm or degrees.
+		if (!drive_distance(cell->arg, cell->constant, cell->offset)) {
+			goto block;
+		}
+		FUSED(FUSE_MOVE_CONST, 2);
+		NEXT();
+#ifndef VM_THREADED_DISPATCH
+	default:
+		// Unknown instruction (the verifier prevents this).
+		program_error("Unknown instruction in program.");
+		goto halt;
+	}
+#endif
+
+block:
+	// The motion queue is full, or must empty before the program stops. This instruction is
+	// executed again once a queued motion has completed.
+	*current = cell;
+	sp->pc.cell = cell;
+	SAVE_FRAME();
+	*count = executed - 1;
+	return false;
+
+yield:
+	// The time budget has been used, the next instruction can be executed in the next batch.
+	*current = cell;
+	sp->pc.cell = cell;
+	SAVE_FRAME();
+	*count = executed;
+	return true;
+
+halt:
+	// The program has stopped, or has had an error and been freed.
+	*count = executed;
+	return false;
+}
+
+/*
+ * Queues a movement of the turtle forwards or backwards by a number of mm (FD/BK), or a turn left
+ * or right by a number of degrees (LT/RT), using the configured step counts for each motor.
+ * Returns false if the motion queue is full.
+ */
+LOCAL bool ICACHE_FLASH_ATTR drive_distance(uint8_t instr, int32_t value, uint16_t offset) {
 	uint32_t left_scale;
 	uint32_t right_scale;
-	uint32_t addr;
-	stack_frame_t *sf;
-	int32_t id;
-	int32_t ii;
-
-	// Execute the code instruction.
-	bool auto_update_pc = true;
-	bool defer_next_instr = false;
-	switch (code[0]) {
-		case INSTR_FD:
-			// Move forward by the number of mm at the end of the stack.
-			operand1 = stack_pop();
-			get_straight_steps(&left_scale, &right_scale);
-			operand2 = operand1 * right_scale / 100; 
-			operand1 = operand1 * left_scale  / 100;
-			os_printf("Moving forward by %d, %d steps.\n", operand1, operand2);
-			drive_motors(operand1, operand2, MAX(operand1, operand2), true, end_move_pause);
-			defer_next_instr = true;
-			break;
+	if ((instr == INSTR_FD) || (instr == INSTR_BK)) {
+		get_straight_steps(&left_scale, &right_scale);
+		return drive_steps(instr, value * (int32_t)left_scale / 100,
+				value * (int32_t)right_scale / 100, offset);
+	} else {
+		get_turn_steps(&left_scale, &right_scale);
+		return drive_steps(instr, value * (int32_t)left_scale / 180,
+				value * (int32_t)right_scale / 180, offset);
+	}
+}
+
+/*
+ * Queues a movement of the motors by a number of steps, in the directions for the movement
+ * instruction (either the scaled or raw version of FD, BK, LT or RT).
+ * Returns false if the motion queue is full.
+ */
+LOCAL bool ICACHE_FLASH_ATTR drive_steps(
+		uint8_t instr, int32_t left, int32_t right, uint16_t offset) {
+	motion_t motion = {MOTION_STEPS, left, right, 0, sp->pc.func, offset};
+	char *description = "Moving forward";
+	switch (instr) {
 		case INSTR_BK:
-			// Move backwards by the number of mm at the end of the stack.
-			operand1 = stack_pop();
-			get_straight_steps(&left_scale, &right_scale);
-			operand2 = operand1 * right_scale / 100; 
-			operand1 = operand1 * left_scale  / 100;
-			os_printf("Moving backward by %d, %d steps.\n", operand1, operand2);
-			drive_motors(-1 * operand1, -1 * operand2, MAX(operand1, operand2), true, end_move_pause);
-			defer_next_instr = true;
-			break;
-		case INSTR_LT:
-			// Turn left by the number of degrees at the end of the stack.
-			operand1 = stack_pop();
-			get_turn_steps(&left_scale, &right_scale);
-			operand2 = operand1 * right_scale / 180; 
-			operand1 = operand1 * left_scale  / 180;
-			os_printf("Turning left by %d, %d steps.\n", operand1, operand2);
-			drive_motors(-1 * operand1, operand2, MAX(operand1, operand2), true, end_move_pause);
-			defer_next_instr = true;
-			break;
-		case INSTR_RT:
-			// Turn right by the number of degrees at the end of the stack.
-			operand1 = stack_pop();
-			get_turn_steps(&left_scale, &right_scale);
-			operand2 = operand1 * right_scale / 180; 
-			operand1 = operand1 * left_scale  / 180;
-			os_printf("Turning right by %d, %d steps.\n", operand1, operand2);
-			drive_motors(operand1, -1 * operand2, MAX(operand1, operand2), true, end_move_pause);
-			defer_next_instr = true;
-			break;
-		case INSTR_FDRAW:
-			// Move forward by the number of steps at the end of the stack, right then left.
-			operand2 = stack_pop();
-			operand1 = stack_pop();
-			os_printf("Moving forward by %d, %d steps.\n", operand1, operand2);
-			drive_motors(operand1, operand2, MAX(operand1, operand2), true, end_move_pause);
-			defer_next_instr = true;
-			break;
 		case INSTR_BKRAW:
-			// Move backwards by the number of steps at the end of the stack, right then left.
-			operand2 = stack_pop();
-			operand1 = stack_pop();
-			os_printf("Moving backward by %d, %d steps.\n", operand1, operand2);
-			drive_motors(-1 * operand1, -1 * operand2, MAX(operand1, operand2), true, end_move_pause);
-			defer_next_instr = true;
+			description = "Moving backward";
+			motion.left_steps = -left;
+			motion.right_steps = -right;
 			break;
+		case INSTR_LT:
 		case INSTR_LTRAW:
-			// Turn left by the number of steps at the end of the stack, right then left.
-			operand2 = stack_pop();
-			operand1 = stack_pop();
-			os_printf("Turning left by %d, %d steps.\n", operand1, operand2);
-			drive_motors(-1 * operand1, operand2, MAX(operand1, operand2), true, end_move_pause);
-			defer_next_instr = true;
+			description = "Turning left";
+			motion.left_steps = -left;
 			break;
+		case INSTR_RT:
 		case INSTR_RTRAW:
-			// Turn right by the number of steps at the end of the stack, right then left.
-			operand2 = stack_pop();
-			operand1 = stack_pop();
-			os_printf("Turning right by %d, %d steps.\n", operand1, operand2);
-			drive_motors(operand1, -1 * operand2, MAX(operand1, operand2), true, end_move_pause);
-			defer_next_instr = true;
-			break;
-		case INSTR_PU:
-			// Raise the pen, and wait for it to finish moving.
-			servo_up(end_move_pause);
-			defer_next_instr = true;
-			break;
-		case INSTR_PD:
-			// Lower the pen, and wait for it to finish moving.
-			servo_down(end_move_pause);
-			defer_next_instr = true;
-			break;
-		case INSTR_IADD:
-			// Add the topmost two values on the stack and add it to the stack.
-			operand2 = stack_pop();
-			operand1 = stack_pop();
-			stack_push(operand1 + operand2);
-			break;
-		case INSTR_ISUB:
-			// Subtract the topmost two values on the stack from each other and add it to the stack.
-			operand2 = stack_pop();
-			operand1 = stack_pop();
-			stack_push(operand1 - operand2);
-			break;
-		case INSTR_IMUL:
-			// Multiply the topmost two values on the stack and add it to the stack.
-			operand2 = stack_pop();
-			operand1 = stack_pop();
-			stack_push(operand1 * operand2);
-			break;
-		case INSTR_IDIV:
-			// Divide the topmost two values on the stack from each other and add it to the stack.
-			operand2 = stack_pop();
-			operand1 = stack_pop();
-			stack_push(operand1 / operand2);
-			break;
-		case INSTR_ICONST_0:
-			// Store the constant zero on the stack.
-			stack_push(0);
-			break;
-		case INSTR_ICONST_1:
-			// Store the constant one on the stack.
-			stack_push(1);
-			break;
-		case INSTR_ICONST_45:
-			// Store the constant 45 on the stack.
-			stack_push(45);
-			break;
-		case INSTR_ICONST_90:
-			// Store the constant 90 on the stack.
-			stack_push(90);
-			break;
-		case INSTR_ICONST:
-			// Store the constant from the byte code on the stack.
-			stack_push(BYTES_TO_INT32(code, 1));
-			break;
-		case INSTR_ILOAD_0:
-			// Load the value from the first variable on to the stack.
-			if (sp->locals != NULL) {
-				stack_push(sp->locals[0]);
-			} else {
-				program_error("Invalid local variable - 0");
-			}
-			break;
-		case INSTR_ILOAD_1:
-			// Load the value from the second variable on to the stack.
-			if ((sp->locals != NULL) && (sp->local_count >= 1)) {
-				stack_push(sp->locals[1]);
-			} else {
-				program_error("Invalid local variable - 1");
-			}
-			break;
-		case INSTR_ILOAD_2:
-			// Load the value from the third variable on to the stack.
-			if ((sp->locals != NULL) && (sp->local_count >= 2)) {
-				stack_push(sp->locals[2]);
-			} else {
-				program_error("Invalid local variable - 2");
-			}
-			break;
-		case INSTR_ILOAD:
-			// Load the value from the variable in the byte code on to the stack.
-			operand1 = BYTES_TO_INT32(code, 1);
-			if ((sp->locals != NULL) && (sp->local_count >= operand1)) {
-				stack_push(sp->locals[operand1]);
-			} else {
-				program_error("Invalid local variable");
-			}
-			break;
-		case INSTR_ISTORE_0:
-			// Store the value from the stack in the first variable.
-			if (sp->locals != NULL) {
-				sp->locals[0] = stack_pop();
-			} else {
-				program_error("Invalid local variable - 0");
-			}
-			break;
-		case INSTR_ISTORE_1:
-			// Store the value from the stack in the second variable.
-			if ((sp->locals != NULL) && (sp->local_count >= 1)) {
-				sp->locals[1] = stack_pop();
-			} else {
-				program_error("Invalid local variable - 1");
-			}
-			break;
-		case INSTR_ISTORE_2:
-			// Store the value from the stack in the third variable.
-			if ((sp->locals != NULL) && (sp->local_count >= 2)) {
-				sp->locals[2] = stack_pop();
-			} else {
-				program_error("Invalid local variable - 2");
-			}
-			break;
-		case INSTR_ISTORE:
-			// Store the value from the stack in the variable in the byte code.
-			operand1 = BYTES_TO_INT32(code, 1);
-			if ((sp->locals != NULL) && (sp->local_count >= operand1)) {
-				sp->locals[operand1] = stack_pop();
-			} else {
-				program_error("Invalid local variable");
-			}
-			break;
-		case INSTR_GLOAD_0:
-			// Load the value from the first global variable on to the stack.
-			if (globals.values != NULL) {
-				stack_push(globals.values[0]);
-			} else {
-				program_error("Invalid global variable - 0");
-			}
-			break;
-		case INSTR_GLOAD_1:
-			// Load the value from the second global variable on to the stack.
-			if ((globals.values != NULL) && (globals.global_count >= 1)) {
-				stack_push(globals.values[1]);
-			} else {
-				program_error("Invalid global variable - 1");
-			}
-			break;
-		case INSTR_GLOAD_2:
-			// Load the value from the third global variable on to the stack.
-			if ((globals.values != NULL) && (globals.global_count >= 2)) {
-				stack_push(globals.values[2]);
-			} else {
-				program_error("Invalid global variable - 2");
-			}
+			description = "Turning right";
+			motion.right_steps = -right;
 			break;
-		case INSTR_GLOAD:
-			// Load the value from the global variable in the byte code on to the stack.
-			operand1 = BYTES_TO_INT32(code, 1);
-			if ((globals.values != NULL) && (globals.global_count >= operand1)) {
-				stack_push(globals.values[operand1]);
-			} else {
-				program_error("Invalid global variable");
-			}
-			break;
-		case INSTR_GSTORE_0:
-			// Store the value from the stack in the first global variable.
-			if (globals.values != NULL) {
-				globals.values[0] = stack_pop();
-			} else {
-				program_error("Invalid global variable - 0");
-			}
-			break;
-		case INSTR_GSTORE_1:
-			// Store the value from the stack in the second global variable.
-			if ((globals.values != NULL) && (globals.global_count >= 1)) {
-				globals.values[1] = stack_pop();
-			} else {
-				program_error("Invalid global variable - 1");
-			}
-			break;
-		case INSTR_GSTORE_2:
-			// Store the value from the stack in the third global variable.
-			if ((globals.values != NULL) && (globals.global_count >= 2)) {
-				globals.values[2] = stack_pop();
-			} else {
-				program_error("Invalid global variable - 2");
-			}
-			break;
-		case INSTR_GSTORE:
-			// Store the value from the stack in the global variable in the byte code.
-			operand1 = BYTES_TO_INT32(code, 1);
-			if ((globals.values != NULL) && (globals.global_count >= operand1)) {
-				globals.values[operand1] = stack_pop();
-			} else {
-				program_error("Invalid global variable");
-			}
-			break;
-		case INSTR_ILT:
-			// Performs a < comparison on the topmost two values from the stack.
-			operand2 = stack_pop();
-			operand1 = stack_pop();
-			stack_push((operand1 < operand2) ? 1 : 0);
-			break;
-		case INSTR_ILE:
-			// Performs a <= comparison on the topmost two values from the stack.
-			operand2 = stack_pop();
-			operand1 = stack_pop();
-			stack_push((operand1 <= operand2) ? 1 : 0);
-			break;
-		case INSTR_IGT:
-			// Performs a > comparison on the topmost two values from the stack.
-			operand2 = stack_pop();
-			operand1 = stack_pop();
-			stack_push((operand1 > operand2) ? 1 : 0);
-			break;
-		case INSTR_IGE:
-			// Performs a >= comparison on the topmost two values from the stack.
-			operand2 = stack_pop();
-			operand1 = stack_pop();
-			stack_push((operand1 >= operand2) ? 1 : 0);
-			break;
-		case INSTR_IEQ:
-			// Performs an equality comparison on the topmost two values from the stack.
-			operand2 = stack_pop();
-			operand1 = stack_pop();
-			stack_push((operand1 == operand2) ? 1 : 0);
-			break;
-		case INSTR_INE:
-			// Performs an inequality comparison on the topmost two values from the stack.
-			operand2 = stack_pop();
-			operand1 = stack_pop();
-			stack_push((operand1 != operand2) ? 1 : 0);
-			break;
-		case INSTR_CALL:
-			// Calls a function. First, check the function ID is valid.
-			id = BYTES_TO_INT32(code, 1);
-			if ((id <= 0) || (id >= program->function_count)) {
-				program_error("Invalid function ID for CALL instruction.\n");
-				return;
-			}
-			os_printf("Calling to function %d with %d arguments and %d stack.\n",
-					id, program->functions[id].argument_count, program->functions[id].stack_size);
-
-			// Update this stack frame's program counter to the instruction to be called upon 
-			// returning from this call.
-			sp->pc.idx += INSTR_LEN[code[0]];
-
-			// Create a new stack frame.
-			sf = create_stack_frame(&program->functions[id]);
-			if (sf == NULL) {
-				// Could not create the stack frame.
-				program_error("Unable to create stack frame for CALL instruction.");
-				return;
-			}
-
-			// Copy any parameters to the new stack frame's local variables.
-			for (ii = program->functions[id].argument_count - 1; ii >= 0; ii--) {
-				sf->locals[ii] = stack_pop();
-			}
-
-			// Add the stack frame to the end of the stack and point to it.
-			sf->prev = sp;
-			sp->next = sf;
-			sp = sf;
-			auto_update_pc = false;
-			break;
-		case INSTR_RET:
-			// Ends the execution of a function.
-			// Move to the previous stack frame.
-			sf = sp;
-			if (sp->prev == NULL) {
-				program_error("Attempt to RETurn from <main> function.");
-				return;
-			}
-			sp = sp->prev;
-			sp->next = NULL;
-
-			// Deallocate the memory for the old stack frame.
-			if (sf->locals != NULL) {
-				os_free(sf->locals);
-			}
-			if (sf->stack != NULL) {
-				os_free(sf->stack);
-			}
-			os_free(sf);
-			auto_update_pc = false;
-			break;
-		case INSTR_STOP:
-			// Stops the execution of this program.
-			stop_program();
-			auto_update_pc = false;
-			defer_next_instr = true;
-			break;
-		case INSTR_BR:
-			// Performs an unconditional branch.
-			addr = BYTES_TO_INT32(code, 1);
-			if (addr > program->functions[sp->pc.func].length) {
-				program_error("Cannot branch beyond function boundary.");
-				return;
-			}
-			sp->pc.idx = addr;
-			auto_update_pc = false;
-			break;
-		case INSTR_BRT:
-			// Performs a conditional branch, if the stack value is true.
-			if (stack_pop() != 0) {
-				addr = BYTES_TO_INT32(code, 1);
-				if (addr > program->functions[sp->pc.func].length) {
-					program_error("Cannot branch beyond function boundary.");
-					return;
-				}
-				sp->pc.idx = addr;
-				auto_update_pc = false;
-			}
-			break;
-		case INSTR_BRF:
-			// Performs a conditional branch, if the stack value is false.
-			if (stack_pop() == 0) {
-				addr = BYTES_TO_INT32(code, 1);
-				if (addr > program->functions[sp->pc.func].length) {
-					program_error("Cannot branch beyond function boundary.");
-					return;
-				}
-				sp->pc.idx = addr;
-				auto_update_pc = false;
-			}
-			break;
-		case INSTR_WAIT:
-			// Performs a wait operation for the specified number of seconds.
-			operand1 = stack_pop();
-			if (operand1 > 0) {
-				pause((uint32_t)(operand1 * 1000));
-				defer_next_instr = true;
-			}
-			break;
-		default:
-			// Unknown instruction.
-			program_error("Unknown instruction in program.");
-			return;
 	}
-
-	if (auto_update_pc) {
-		// Update the program counter.
-		sp->pc.idx += INSTR_LEN[code[0]];
+	if (!queue_program_motion(&motion)) {
+		return false;
 	}
-	if (defer_next_instr == false) {
-		// Run the next instruction.
-		execute_instruction();
+	if (!dry_run) {
+		os_printf("%s by %d, %d steps.\n", description, left, right);
 	}
+	return true;
 }
 
 /*
- * Handles an error in the program. This will stop the program's execution, and free its' memory.
+ * Queues a movement of the turtle along an arc with a radius in mm, turning right by a number of
+ * degrees (or left, if the angle is negative), as a single movement of both motors. Each motor's
+ * steps are the sum of its steps for the distance along the arc and for the turn, using the
+ * configured step counts for each motor. A negative radius moves backwards along the arc.
+ * Returns false if the motion queue is full.
  */
-void ICACHE_FLASH_ATTR program_error(char *message) {
-	os_printf(message);
-	program_status = ERROR;
-	free_program(NULL);
-
-	// Notify any listeners.
-	notify_program_status(program_status, 0, 0);
+LOCAL bool ICACHE_FLASH_ATTR drive_arc(int32_t radius, int32_t angle, uint16_t offset) {
+	uint32_t straight_left;
+	uint32_t straight_right;
+	uint32_t turn_left;
+	uint32_t turn_right;
+	get_straight_steps(&straight_left, &straight_right);
+	get_turn_steps(&turn_left, &turn_right);
+
+	// The distance along the arc is radius * angle * pi / 180 mm, with pi approximated as 355/113.
+	int64_t distance = (int64_t)radius * ((angle < 0) ? -angle : angle) * 355;
+	int64_t scale = 113 * 180 * 100;
+	int32_t left = (distance * straight_left / scale) + ((int64_t)angle * turn_left / 180);
+	int32_t right = (distance * straight_right / scale) - ((int64_t)angle * turn_right / 180);
+
+	motion_t motion = {MOTION_STEPS, left, right, 0, sp->pc.func, offset};
+	if (!queue_program_motion(&motion)) {
+		return false;
+	}
+	if (!dry_run) {
+		os_printf("Moving along an arc of %d mm by %d degrees, %d, %d steps.\n",
+				radius, angle, left, right);
+	}
+	return true;
 }
 
 /*
- * Waits for a period of time before invoking the next program instruction. This is designed to 
- * ensure that one movement command doesn't impact the next movement.
+ * Queues a pen movement or a pause of duration ms.
+ * Returns false if the motion queue is full.
  */
-void ICACHE_FLASH_ATTR end_move_pause() {
-	// Trigger the post movement pause timer.
-    os_timer_arm(&move_pause_timer, get_move_pause_duration(), false);
+LOCAL bool ICACHE_FLASH_ATTR queue_action(motion_type_t type, uint32_t duration, uint16_t offset) {
+	motion_t motion = {type, 0, 0, duration, sp->pc.func, offset};
+	return queue_program_motion(&motion);
 }
 
 /*
- * Waits for a period of time before invoking the next program instruction.
+ * Queues a motion for the program. Whilst estimating the program's duration, the motion's estimated
+ * duration is added to the total instead, and the queue is never full.
+ * Returns false if the motion queue is full.
  */
-void ICACHE_FLASH_ATTR pause(uint32_t duration) {
-	// Trigger the post movement pause timer to perform this delay.
-    os_timer_arm(&move_pause_timer, duration, false);
+LOCAL bool ICACHE_FLASH_ATTR queue_program_motion(const motion_t *motion) {
+	if (!dry_run) {
+		return queue_motion(motion);
+	}
+	motion_estimate_t estimate;
+	estimate_motion(motion, dry_run_pen, &estimate);
+	progress.total_ms += estimate.ms;
+	if (motion->type == MOTION_PEN_UP) {
+		dry_run_pen = UP;
+	} else if (motion->type == MOTION_PEN_DOWN) {
+		dry_run_pen = DOWN;
+	}
+	return true;
 }
 
 /*
- * Invokes the next instruction after a movement pause.
+ * Notifies any listeners of the instruction whose motion the turtle has started.
  */
-void ICACHE_FLASH_ATTR move_pause_timer_cb(void *arg) {
-	execute_instruction();
+LOCAL void ICACHE_FLASH_ATTR motion_started(const motion_t *motion) {
+	if (program_status == RUNNING) {
+		// Track the progress through the estimate, with all the motions before this one complete.
+		if (progress.estimated) {
+			progress.completed_ms += motion_estimate_ms;
+			motion_estimate_t estimate;
+			estimate_motion(motion, get_servo(), &estimate);
+			motion_estimate_ms = estimate.ms;
+		}
+		notify_program_status(program_status, motion->func, motion->offset);
+	}
 }
 
 /*
- * Adds a value to the end of the stack.
- * Returns true if the value could be stored on the stack.
+ * Resumes the program after a queued motion has completed, in case it was waiting for space in the
+ * motion queue or for the queue to empty.
  */
-LOCAL inline bool ICACHE_FLASH_ATTR stack_push(int32_t val) {
-	// Ensure we have a stack.
-	if (sp == NULL) {
-		os_printf("ERROR: No current stack to push to.\n");
-		return false;
-	}
-
-	// Ensure we're not going to exceed the stack's size.
-	if (sp->stack_size >= sp->max_stack_size) {
-		os_printf("ERROR: Stack overflow (%d of %d).\n", sp->stack_size, sp->max_stack_size);
-		return false;
+LOCAL void ICACHE_FLASH_ATTR motion_completed() {
+	if (program_status == RUNNING) {
+		execute_instruction();
 	}
-
-	// Store the value at the end of the stack.
-	sp->stack[sp->stack_size++] = val;
 }
 
 /*
- * Removes and retrieves the newest value from the end of the stack.
- * If there are no values on the stack, a zero is returned instead.
+ * Handles an error in the program. This will stop the program's execution, and free its' memory.
  */
-LOCAL inline int32_t ICACHE_FLASH_ATTR stack_pop() {
-	// Ensure we have a stack.
-	if (sp == NULL) {
-		os_printf("ERROR: No current stack to pull from.\n");
-		return 0;
+void ICACHE_FLASH_ATTR program_error(char *message) {
+	if (dry_run) {
+		// The error is reported when the program is run.
+		dry_run_error = true;
+		return;
 	}
+	os_printf(message);
+	os_strncpy(vm_error, message, MAX_ERROR_LEN - 1);
+	vm_error[MAX_ERROR_LEN - 1] = '\0';
+	program_status = ERROR;
+	free_program(NULL);
 
-	// Ensure there is something on the stack to be popped.
-	if (sp->stack_size == 0) {
-		os_printf("ERROR: Stack underflow.\n");
-		return 0;
-	}
+	// Stop the motors, discarding any queued motions.
+	clear_motion_queue();
+
+	// Notify any listeners.
+	notify_program_status(program_status, 0, 0);
+}
 
-	// Retrieve the item from the stack.
-	return sp->stack[--sp->stack_size];
+/*
+ * Returns the number of arena bytes required for a stack frame for the given function.
+ */
+LOCAL uint32_t ICACHE_FLASH_ATTR frame_size(function_t *function) {
+	uint32_t values = function->argument_count + function->local_count + function->stack_size;
+	return FRAME_ALIGN(sizeof(stack_frame_t) + (values * sizeof(int32_t)));
 }
 
 /*
- * Creates a stack frame ready to hold information for a given function.
- * The created stack frame is isolated, as both the prev and next pointers are set to NULL.
- * Callers to this function should set these as appropriate.
+ * Creates a stack frame ready to hold information for a given function. The frame is allocated
+ * from the end of the frame arena, and must be released with release_stack_frame before any frame
+ * created before it.
+ * The created stack frame is isolated, as the prev pointer is set to NULL. Callers to this function
+ * should set this as appropriate.
  */
 LOCAL stack_frame_t * ICACHE_FLASH_ATTR create_stack_frame(function_t *function) {
 	// Allocate the memory for the stack frame.
-	os_printf("Allocating stack frame with %d arguments, %d locals, %d stack.\n", 
+	trace_print("Allocating stack frame with %d arguments, %d locals, %d stack.\n", 
 			function->argument_count, function->local_count, function->stack_size);
-	stack_frame_t *sf = (stack_frame_t *)os_malloc(sizeof(stack_frame_t));
-	if (sf == NULL) {
-		os_printf("Unable to allocate stack frame.\n");
+	uint32_t size = frame_size(function);
+	if ((arena.used + size) > arena.size) {
+		os_printf("Unable to allocate stack frame - call stack full.\n");
 		return NULL;
 	}
+	stack_frame_t *sf = (stack_frame_t *)(arena.base + arena.used);
+	arena.used += size;
+	if (arena.used > vm_stats.arena_peak) {
+		vm_stats.arena_peak = arena.used;
+	}
 
 	// Set the non-array values.
 	sf->pc.func = function->id;
-	sf->pc.idx = 0;
+	sf->pc.cell = function_cells[function->id];
 	sf->local_count = function->argument_count + function->local_count;
 	sf->max_stack_size = function->stack_size;
 	sf->stack_size = 0;
+	sf->frame_size = size;
 	sf->prev = NULL;
-	sf->next = NULL;
 
-	// Allocate memory for the locals, if any.
+	// The locals and the operand stack follow the frame in the arena.
+	int32_t *values = (int32_t *)(sf + 1);
 	if (sf->local_count > 0) {
-		sf->locals = os_malloc(sf->local_count * sizeof(int32_t));
-		if (sf->locals == NULL) {
-			os_printf("Unable to allocate stack frame locals.\n");
-			os_free(sf);
-			return NULL;
-		}
+		sf->locals = values;
+		os_memset(sf->locals, 0, sf->local_count * sizeof(int32_t));
 	} else {
 		sf->locals = NULL;
 	}
+	sf->stack = values + sf->local_count;
 
-	// Allocate memory for the stack, if any.
-	if (sf->max_stack_size > 0) {
-		sf->stack = os_malloc(sf->max_stack_size * sizeof(int32_t));
-		if (sf->stack == NULL) {
-			os_printf("Unable to allocate stack frame stack.\n");
-			os_free(sf->locals);
-			os_free(sf);
-			return NULL;
-		}
-	} else {
-		sf->stack = NULL;
+	return sf;
+}
+
+/*
+ * Releases a stack frame's memory back to the frame arena. This must be the most recently created
+ * frame.
+ */
+LOCAL void ICACHE_FLASH_ATTR release_stack_frame(stack_frame_t *sf) {
+	arena.used -= sf->frame_size;
+}
+
+/*
+ * Retrieves a description of why the most recent program was rejected or halted with an error. The
+ * description is empty if the program was accepted and has not had an error.
+ */
+const char * ICACHE_FLASH_ATTR get_vm_error() {
+	return vm_error;
+}
+
+/*
+ * Retrieves the execution statistics for the current (or most recent) program.
+ */
+void ICACHE_FLASH_ATTR get_vm_stats(vm_stats_t *stats) {
+	os_memcpy(stats, &vm_stats, sizeof(vm_stats_t));
+	if (vm_stats.execution_time > 0) {
+		stats->instructions_per_second =
+				(uint32_t)(((uint64_t)vm_stats.instruction_count * 1000000) / vm_stats.execution_time);
 	}
+}
 
-	return sf;
+/*
+ * Retrieves the estimated progress of the current (or most recent) program.
+ */
+void ICACHE_FLASH_ATTR get_program_progress(program_progress_t *prog_progress) {
+	os_memcpy(prog_progress, &progress, sizeof(program_progress_t));
+	if (prog_progress->completed_ms > prog_progress->total_ms) {
+		prog_progress->completed_ms = prog_progress->total_ms;
+	}
+}
+
+/*
+ * Retrieves the name of a superinstruction, for reporting its statistics.
+ */
+const char * ICACHE_FLASH_ATTR get_fusion_name(fusion_t fusion) {
+	switch (fusion) {
+		case FUSE_ADD_LOCAL:
+			return "addLocal";
+		case FUSE_BR_LOCALS:
+			return "branchLocals";
+		case FUSE_BR_CONST:
+			return "branchConstant";
+		case FUSE_MOVE_CONST:
+			return "moveConstant";
+		default:
+			return "unknown";
+	}
+}
+
+/*
+ * Prints the execution statistics for the current program.
+ */
+LOCAL void ICACHE_FLASH_ATTR print_vm_stats() {
+	vm_stats_t stats;
+	get_vm_stats(&stats);
+	os_printf("Executed %d instructions in %d batches, taking %dus (%d instructions/s).\n",
+			stats.instruction_count, stats.batch_count, stats.execution_time,
+			stats.instructions_per_second);
+	for (uint32_t ii = 0; ii < FUSION_COUNT; ii++) {
+		os_printf("Superinstruction %s: fused %d times, executed %d times.\n",
+				get_fusion_name(ii), stats.fusion_sites[ii], stats.fusion_hits[ii]);
+	}
 }
 
 /*
@@ -935,17 +1842,22 @@ void ICACHE_FLASH_ATTR init_vm() {
 	program = NULL;
 
 	// Initialise the stack to be empty.
-	stack = NULL;
+	arena.base = NULL;
+	arena.size = 0;
+	arena.used = 0;
 	sp = NULL;
 
 	// Initialise the globals to be empty.
 	globals.global_count = 0;
 	globals.values = NULL;
+	vm_error[0] = '\0';
+
+	// Publish the instruction handler addresses for decoding programs.
+	execute_cells(0, 0, NULL, NULL);
 
 	// Set up the task for executing the next program instruction.
 	system_os_task(vm_execute_task, EXEC_INSTR_PRI, vm_exec_queue, EXEC_INSTR_QUEUE_LEN);
 
-	// Set up the timer for post-movement delays.
-    os_timer_disarm(&move_pause_timer);
-    os_timer_setfn(&move_pause_timer, (os_timer_func_t *)move_pause_timer_cb, (void *)0);
+	// Follow the progress of the motions queued by programs.
+	set_motion_callbacks(motion_started, motion_completed);
 }
@@ -0,0 +1,193 @@
+/*
+ * bench_json_writer.c: Host benchmarks of formatting the websocket notifications and status JSON
+ * with the JSON writer, into a buffer on the stack, against the heap allocated string builder that
+ * they were formatted with before.
+ *
+ * The host's heap is much faster than the ESP8266's, and isn't shared with the WiFi stack, so these
+ * understate what avoiding the heap saves on the turtle. They show the relative cost, and catch the
+ * writer becoming slower.
+ *
+ * Author: Ian Marshall
+ * Date: 16/10/2026
+ */
+#include "esp8266.h"
+#include "json_writer.h"
+#include "string_builder.h"
+#include "test.h"
+
+// The number of times each message is formatted.
+#define REPEATS 1000000
+
+// Sink for the benchmarks' results, and source of their inputs, so that the work isn't optimised
+// away or moved out of the loops.
+LOCAL volatile uint32_t sink;
+LOCAL volatile uint32_t bench_function = 3;
+LOCAL volatile uint32_t bench_index = 1234;
+
+// The WiFi settings for the WiFi status, which aren't escaped by the string builder.
+LOCAL const char ssid[] = "micro-turtle";
+LOCAL const char password[] = "secret password";
+
+/*
+ * Formats the servo position notification with the JSON writer. Returns its length.
+ */
+LOCAL uint32_t servo_with_writer() {
+	char buf[48];
+	json_writer jw;
+	init_json_writer(&jw, buf, sizeof(buf));
+	json_write_raw(&jw, "{\"servo\":{\"position\":\"");
+	json_write_raw(&jw, "down\"}}");
+	return jw.overflow ? 0 : jw.len;
+}
+
+/*
+ * Formats the servo position notification with a string builder, as notify_servo_position did.
+ * Returns its length.
+ */
+LOCAL uint32_t servo_with_builder() {
+	string_builder *sb = create_string_builder(32);
+	if (sb == NULL) {
+		return 0;
+	}
+	append_string_builder(sb, "{\"servo\":{\"position\":\"");
+	append_string_builder(sb, "down\"}}");
+	uint32_t len = sb->len;
+	free_string_builder(sb);
+	return len;
+}
+
+/*
+ * Formats a running program status notification with the JSON writer. Returns its length.
+ */
+LOCAL uint32_t status_with_writer() {
+	char buf[128];
+	json_writer jw;
+	init_json_writer(&jw, buf, sizeof(buf));
+	json_write_raw(&jw, "{\"program\":{\"status\":\"");
+	json_write_raw(&jw, "running\",\"function\":");
+	json_write_uint32(&jw, bench_function);
+	json_write_raw(&jw, ", \"index\": ");
+	json_write_uint32(&jw, bench_index);
+	json_write_raw(&jw, "}}");
+	return jw.overflow ? 0 : jw.len;
+}
+
+/*
+ * Formats a running program status notification with a string builder, as notify_program_status
+ * did. Returns its length.
+ */
+LOCAL uint32_t status_with_builder() {
+	string_builder *sb = create_string_builder(64);
+	if (sb == NULL) {
+		return 0;
+	}
+	append_string_builder(sb, "{\"program\":{\"status\":\"");
+	append_string_builder(sb, "running\",\"function\":");
+	append_int32_string_builder(sb, bench_function);
+	append_string_builder(sb, ", \"index\": ");
+	append_int32_string_builder(sb, bench_index);
+	append_string_builder(sb, "}}");
+	uint32_t len = sb->len;
+	free_string_builder(sb);
+	return len;
+}
+
+/*
+ * Formats the access point part of the WiFi status with the JSON writer. Returns its length.
+ */
+LOCAL uint32_t wifi_with_writer() {
+	char buf[512];
+	json_writer jw;
+	init_json_writer(&jw, buf, sizeof(buf));
+	json_write_raw(&jw, "{\"opmode\": \"");
+	json_write_raw(&jw, "Station and Access Point");
+	json_write_raw(&jw, "\", \"ap\": { ");
+	json_write_raw(&jw, "\"ssid\": ");
+	json_write_string(&jw, ssid);
+	json_write_raw(&jw, ", \"ssidHidden\": \"");
+	json_write_raw(&jw, "No");
+	json_write_raw(&jw, "\", \"password\": ");
+	json_write_string(&jw, password);
+	json_write_raw(&jw, ", \"channel\": ");
+	json_write_int32(&jw, (int32_t)bench_function);
+	json_write_raw(&jw, ", \"auth\": \"");
+	json_write_raw(&jw, "WPA/WPA2 PSK");
+	json_write_raw(&jw, "\", ");
+	json_write_raw(&jw, "\"ip\": \"");
+	json_write_raw(&jw, "192.168.4.1");
+	json_write_raw(&jw, "\", ");
+	json_write_raw(&jw, "\"mac\": \"");
+	json_write_raw(&jw, "5e:cf:7f:01:02:03");
+	json_write_raw(&jw, "\", \"clientCount\": ");
+	json_write_int32(&jw, (int32_t)bench_function);
+	json_write_raw(&jw, "}}");
+	return jw.overflow ? 0 : jw.len;
+}
+
+/*
+ * Formats the access point part of the WiFi status with a string builder, as cgiWifiStatus did,
+ * growing it from its initial size. Returns its length.
+ */
+LOCAL uint32_t wifi_with_builder() {
+	string_builder *sb = create_string_builder(128);
+	if (sb == NULL) {
+		return 0;
+	}
+	append_string_builder(sb, "{\"opmode\": \"");
+	append_string_builder(sb, "Station and Access Point");
+	append_string_builder(sb, "\", \"ap\": { ");
+	append_string_builder(sb, "\"ssid\": \"");
+	append_string_builder(sb, ssid);
+	append_string_builder(sb, "\", \"ssidHidden\": \"");
+	append_string_builder(sb, "No");
+	append_string_builder(sb, "\", \"password\": \"");
+	append_string_builder(sb, password);
+	append_string_builder(sb, "\", \"channel\": ");
+	append_int32_string_builder(sb, (int32_t)bench_function);
+	append_string_builder(sb, ", \"auth\": \"");
+	append_string_builder(sb, "WPA/WPA2 PSK");
+	append_string_builder(sb, "\", ");
+	append_string_builder(sb, "\"ip\": \"");
+	append_string_builder(sb, "192.168.4.1");
+	append_string_builder(sb, "\", ");
+	append_string_builder(sb, "\"mac\": \"");
+	append_string_builder(sb, "5e:cf:7f:01:02:03");
+	append_string_builder(sb, "\", \"clientCount\": ");
+	append_int32_string_builder(sb, (int32_t)bench_function);
+	append_string_builder(sb, "}}");
+	uint32_t len = sb->len;
+	free_string_builder(sb);
+	return len;
+}
+
+/*
+ * Times formatting a message both ways, after checking that they format the same length.
+ */
+LOCAL void bench_message(const char *name, uint32_t (*writer)(), uint32_t (*builder)()) {
+	if (writer() != builder()) {
+		printf("%s: the writer formatted %u characters, the builder %u.\n", name, writer(),
+				builder());
+	}
+
+	uint64_t start = host_time_ns();
+	for (uint32_t ii = 0; ii < REPEATS; ii++) {
+		sink += writer();
+	}
+	uint64_t writer_time = host_time_ns() - start;
+
+	start = host_time_ns();
+	for (uint32_t ii = 0; ii < REPEATS; ii++) {
+		sink += builder();
+	}
+	uint64_t builder_time = host_time_ns() - start;
+
+	printf("%-16s %3u characters: writer %6.1f ns/message, string builder %6.1f ns/message.\n",
+			name, writer(), (double)writer_time / REPEATS, (double)builder_time / REPEATS);
+}
+
+int main() {
+	bench_message("Servo position", servo_with_writer, servo_with_builder);
+	bench_message("Program status", status_with_writer, status_with_builder);
+	bench_message("WiFi status", wifi_with_writer, wifi_with_builder);
+	return 0;
+}
@@ -0,0 +1,225 @@
+/*
+ * bench_motors.c: Host benchmarks of the stepper motor control's planning. The motor control is
+ * included directly, so that its planning functions can be timed.
+ *
+ * The host has a floating point unit, where the ESP8266 calculates floating point in software, so
+ * these understate how much the integer planning saves on the turtle. They show the relative cost,
+ * and catch the planning becoming slower.
+ *
+ * Author: Ian Marshall
+ * Date: 16/10/2026
+ */
+#include "../src/motors.c"
+#include "test.h"
+#include "fake_config.h"
+
+// The number of times each benchmark is repeated.
+#define REPEATS 200
+
+// Sink for the benchmarks' results, and source of their inputs, so that the work isn't optimised
+// away or moved out of the loops.
+LOCAL volatile uint32_t sink;
+LOCAL volatile uint32_t bench_duration;
+LOCAL volatile int16_t bench_steps;
+
+/*
+ * Plans the steps of an accelerated movement from the acceleration table, a buffer of step events
+ * at a time, as the motor task does. Returns the number of ticks planned.
+ */
+LOCAL uint32_t plan_with_table(int16_t steps) {
+	drive_motors(steps, steps, 0, true, NULL);
+	uint32_t ticks = 0;
+	while (total_ticks > 0) {
+		// Empty the step event buffer, as the motor timer callback would.
+		while (step_read != step_write) {
+			ticks += step_events[step_read++ % STEP_EVENT_COUNT].ticks;
+		}
+		plan_steps();
+	}
+	while (step_read != step_write) {
+		ticks += step_events[step_read++ % STEP_EVENT_COUNT].ticks;
+	}
+	return ticks;
+}
+
+/*
+ * Looks up the acceleration table on every tick of an accelerated movement, as the step planner
+ * does, with deceleration mirroring it. Only the curve is looked up, without the rest of the work
+ * of each tick. Returns the number of steps taken.
+ */
+LOCAL uint32_t plan_with_table_curve(uint32_t steps) {
+	uint32_t accel_steps = accel_table_steps;
+	uint32_t total = steps + (2 * accel_steps);
+	uint32_t taken = 0;
+	for (uint32_t tick = 1; tick <= total; tick++) {
+		bool step;
+		if (tick <= 2 * accel_steps) {
+			step = (taken < accel_steps) && (tick >= accel_table[taken]);
+		} else if (tick <= steps) {
+			step = true;
+		} else {
+			uint32_t remaining = steps - taken;
+			step = (remaining > 0) && ((total - tick) < accel_table[remaining - 1]);
+		}
+		if (step) {
+			taken++;
+		}
+	}
+	return taken;
+}
+
+/*
+ * The position along the floating point acceleration curve after a number of ticks, as the motor
+ * timer callback calculated it on every tick before the acceleration table.
+ */
+LOCAL float float_curve_position(
+		uint32_t accel_duration, float scale, float crossover, float tick) {
+	if (tick <= accel_duration) {
+		return (tick * tick * tick) / scale;
+	}
+	tick -= accel_duration;
+	return -((tick * tick * tick) / scale) + ((tick * tick) / (2 * accel_duration)) + (tick / 2) +
+			crossover;
+}
+
+/*
+ * Evaluates the floating point acceleration curve on every tick of an accelerated movement, as the
+ * motor timer callback did before the acceleration table, with deceleration mirroring it. Only the
+ * curve is evaluated, without the rest of the work of each tick. Returns the number of steps taken.
+ */
+LOCAL uint32_t plan_with_floats(uint32_t duration, uint32_t steps) {
+	uint32_t accel_duration = duration / 2;
+	float scale = 6 * accel_duration * accel_duration;
+	float crossover = accel_duration;
+	crossover = (crossover * crossover * crossover) / scale;
+	uint32_t total = steps + (2 * accel_duration);
+	float last_position = 0;
+	uint32_t taken = 0;
+	for (uint32_t tick = 1; tick <= total; tick++) {
+		float position;
+		if (tick <= 2 * accel_duration) {
+			position = float_curve_position(accel_duration, scale, crossover, tick);
+		} else if (tick <= steps) {
+			position = last_position + 1;
+		} else {
+			position = steps - float_curve_position(accel_duration, scale, crossover, total - tick);
+		}
+		if (position - last_position >= 1.0f) {
+			last_position += 1.0f;
+			taken++;
+		}
+	}
+	return taken;
+}
+
+/*
+ * Times the planning of an accelerated movement: the acceleration curve alone, from the
+ * acceleration table and from the floating point curve, and then the whole of each tick's planning.
+ */
+LOCAL void bench_acceleration(uint32_t duration, int16_t steps) {
+	acceleration_duration = duration;
+	bench_duration = duration;
+	bench_steps = steps;
+	uint32_t ticks = plan_with_table(steps);
+	if ((plan_with_table_curve(steps) != steps) || (plan_with_floats(duration, steps) != steps)) {
+		printf("The curves took %u and %u steps, not %d.\n", plan_with_table_curve(steps),
+				plan_with_floats(duration, steps), steps);
+	}
+
+	uint64_t start = host_time_ns();
+	for (uint32_t ii = 0; ii < REPEATS; ii++) {
+		sink += plan_with_table_curve(bench_steps);
+	}
+	uint64_t table_time = host_time_ns() - start;
+
+	start = host_time_ns();
+	for (uint32_t ii = 0; ii < REPEATS; ii++) {
+		sink += plan_with_floats(bench_duration, bench_steps);
+	}
+	uint64_t float_time = host_time_ns() - start;
+
+	start = host_time_ns();
+	for (uint32_t ii = 0; ii < REPEATS; ii++) {
+		sink += plan_with_table(bench_steps);
+	}
+	uint64_t planner_time = host_time_ns() - start;
+
+	printf("Duration %5u, %5d steps: curve from table %5.2f ns/tick, from floats %5.2f ns/tick; "
+			"whole tick %5.2f ns.\n", duration, steps, (double)table_time / (REPEATS * ticks),
+			(double)float_time / (REPEATS * ticks), (double)planner_time / (REPEATS * ticks));
+}
+
+/*
+ * Finds the acceleration limit of a movement too short to reach full speed by the binary search
+ * over the floating point acceleration curve that the acceleration table replaced, without its
+ * logging.
+ */
+LOCAL uint32_t search_acceleration_limit(uint32_t duration, uint32_t steps) {
+	uint32_t accel_duration = duration / 2;
+	uint32_t target = steps / 2;
+	uint32_t left = 0;
+	uint32_t right = duration;
+	float crossover = accel_duration;
+	crossover = (crossover * crossover * crossover) / (6 * accel_duration * accel_duration);
+	while (left < right) {
+		uint32_t mid = (left + right) / 2;
+		float m_value = (float)mid;
+		if (mid <= accel_duration) {
+			m_value = (m_value * m_value * m_value) / (6 * accel_duration * accel_duration);
+		} else {
+			m_value -= accel_duration;
+			m_value = -((m_value * m_value * m_value) / (6 * accel_duration * accel_duration)) +
+					((m_value * m_value) / (2 * accel_duration)) + (m_value / 2) + crossover;
+		}
+		if (((uint32_t)m_value) < target) {
+			left = mid + 1;
+		} else {
+			right = mid;
+		}
+	}
+	return left;
+}
+
+/*
+ * Times the planning of the phases of every movement too short to reach full speed, from the
+ * acceleration table and by the binary search.
+ */
+LOCAL void bench_short_movements(uint32_t duration) {
+	acceleration_duration = duration;
+	bench_duration = duration;
+	build_acceleration_table(duration);
+	uint32_t count = duration - 1;
+
+	uint64_t start = host_time_ns();
+	for (uint32_t ii = 0; ii < REPEATS; ii++) {
+		for (uint32_t steps = 1; steps <= count; steps++) {
+			phase_data_t phases;
+			plan_phases(steps, 0, true, 0, 0, &phases);
+			sink += phases.accel_limit;
+		}
+	}
+	uint64_t table_time = host_time_ns() - start;
+
+	start = host_time_ns();
+	for (uint32_t ii = 0; ii < REPEATS; ii++) {
+		for (uint32_t steps = 1; steps <= count; steps++) {
+			sink += search_acceleration_limit(bench_duration, steps);
+		}
+	}
+	uint64_t search_time = host_time_ns() - start;
+
+	printf("Duration %5u, short movements: table %6.1f ns/movement, search %6.1f ns/movement.\n",
+			duration, (double)table_time / (REPEATS * count),
+			(double)search_time / (REPEATS * count));
+}
+
+int main() {
+	bench_acceleration(100, 200);
+	bench_acceleration(1000, 2000);
+	bench_acceleration(1000, 10000);
+	bench_acceleration(6000, 12000);
+	bench_short_movements(100);
+	bench_short_movements(1000);
+	bench_short_movements(6000);
+	return 0;
+}
@@ -0,0 +1,23 @@
+/*
+ * byte_code.h: The byte code instructions, for writing the programs used by the host tests.
+ *
+ * Author: Ian Marshall
+ * Date: 16/10/2026
+ */
+#ifndef __BYTE_CODE_H
+#define __BYTE_CODE_H
+
+// The byte code instructions, as numbered by vm.c.
+enum {
+	FD = 1, BK, LT, RT, PU, PD, IADD, ISUB, IMUL, IDIV, ICONST_0, ICONST_1, ICONST_45, ICONST_90,
+	ICONST, ILOAD_0, ILOAD_1, ILOAD_2, ILOAD, ISTORE_0, ISTORE_1, ISTORE_2, ISTORE, GLOAD_0,
+	GLOAD_1, GLOAD_2, GLOAD, GSTORE_0, GSTORE_1, GSTORE_2, GSTORE, ILT, ILE, IGT, IGE, IEQ, INE,
+	CALL, RET, STOP, BR, BRT, BRF, FDRAW, BKRAW, LTRAW, RTRAW, WAIT, ARC
+};
+
+// The four big endian bytes of an instruction's operand.
+#define OPERAND(n) \
+	(uint8_t)((uint32_t)(n) >> 24), (uint8_t)((uint32_t)(n) >> 16), \
+	(uint8_t)((uint32_t)(n) >> 8), (uint8_t)(n)
+
+#endif
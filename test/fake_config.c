@@ -0,0 +1,58 @@
+/*
+ * fake_config.c: The configuration, and the notifications, used by the motor control in the host
+ * tests.
+ *
+ * Author: Ian Marshall
+ * Date: 16/10/2026
+ */
+#include "esp8266.h"
+#include "config.h"
+#include "motors.h"
+#include "fake_config.h"
+
+uint32_t acceleration_duration = 1000;
+uint32_t hardware_tick_interval = 0;
+uint32_t move_pause_duration = 0;
+
+int8_t get_servo_up_angle() {
+	return 30;
+}
+
+int8_t get_servo_down_angle() {
+	return -30;
+}
+
+uint8_t get_servo_move_steps() {
+	return 10;
+}
+
+uint32_t get_servo_tick_interval() {
+	return 20;
+}
+
+uint32_t get_motor_tick_interval() {
+	return 1;
+}
+
+uint32_t get_acceleration_duration() {
+	return acceleration_duration;
+}
+
+uint32_t get_move_pause_duration() {
+	return move_pause_duration;
+}
+
+uint32_t get_hardware_tick_interval() {
+	return hardware_tick_interval;
+}
+
+bool get_full_step_travel() {
+	return false;
+}
+
+bool get_servo_overlap() {
+	return false;
+}
+
+void notify_servo_position(servo_position_t pos) {
+}
@@ -0,0 +1,22 @@
+/*
+ * fake_config.h: The configuration used by the motor control in the host tests, which the tests may
+ * change.
+ *
+ * Author: Ian Marshall
+ * Date: 16/10/2026
+ */
+#ifndef __FAKE_CONFIG_H
+#define __FAKE_CONFIG_H
+
+#include "c_types.h"
+
+// The acceleration duration, in ticks.
+extern uint32_t acceleration_duration;
+
+// The hardware timer's tick interval, in µs, or 0 to use the software timer.
+extern uint32_t hardware_tick_interval;
+
+// The pause after each stepper or servo movement, in ms.
+extern uint32_t move_pause_duration;
+
+#endif
@@ -0,0 +1,109 @@
+/*
+ * fake_motion.c: The motion queue, configuration and notifications used by the VM, for the host
+ * tests of the VM. Queued motions are recorded, and only complete when a test completes them.
+ *
+ * Author: Ian Marshall
+ * Date: 16/10/2026
+ */
+#include "esp8266.h"
+#include "config.h"
+#include "http.h"
+#include "fake_motion.h"
+
+motion_t queued_motions[MAX_RECORDED_MOTIONS];
+uint32_t queued_motion_count = 0;
+
+// The number of motions in the queue that haven't completed.
+LOCAL uint32_t pending_motions = 0;
+
+// The callbacks for when a queued motion starts, and when one completes.
+LOCAL motion_callback_t *start_cb = NULL;
+LOCAL motor_callback_t *complete_cb = NULL;
+
+bool queue_motion(const motion_t *motion) {
+	if (pending_motions >= FAKE_QUEUE_LEN) {
+		return false;
+	}
+	if (queued_motion_count < MAX_RECORDED_MOTIONS) {
+		queued_motions[queued_motion_count] = *motion;
+	}
+	queued_motion_count++;
+	pending_motions++;
+	if ((pending_motions == 1) && (start_cb != NULL)) {
+		start_cb(motion);
+	}
+	return true;
+}
+
+bool is_motion_queue_empty() {
+	return pending_motions == 0;
+}
+
+void clear_motion_queue() {
+	pending_motions = 0;
+}
+
+void set_motion_callbacks(motion_callback_t *started, motor_callback_t *completed) {
+	start_cb = started;
+	complete_cb = completed;
+}
+
+/*
+ * Completes the oldest queued motion.
+ */
+bool complete_motion() {
+	if (pending_motions == 0) {
+		return false;
+	}
+	pending_motions--;
+	if (complete_cb != NULL) {
+		complete_cb();
+	}
+	return true;
+}
+
+/*
+ * Runs the VM until it's idle, completing each queued motion once the posted tasks have run.
+ */
+void run_until_idle() {
+	for (uint32_t ii = 0; ii < 10000000; ii++) {
+		if (!run_next_task() && !complete_motion()) {
+			return;
+		}
+	}
+}
+
+/*
+ * Clears the record of the queued motions.
+ */
+void reset_motions() {
+	queued_motion_count = 0;
+	pending_motions = 0;
+}
+
+servo_position_t get_servo() {
+	return UP;
+}
+
+void estimate_motion(const motion_t *motion, servo_position_t pen, motion_estimate_t *estimate) {
+	estimate->ticks = 0;
+	estimate->ms = 100;
+}
+
+// One step per mm, and per degree of turn, so the steps of each motion are easy to check.
+void get_straight_steps(uint32_t *left, uint32_t *right) {
+	*left = 100;
+	*right = 100;
+}
+
+void get_turn_steps(uint32_t *left, uint32_t *right) {
+	*left = 180;
+	*right = 180;
+}
+
+uint32_t get_exec_time_budget() {
+	return 2000;
+}
+
+void notify_program_status(prog_status_t status, uint32_t function, uint32_t index) {
+}
@@ -0,0 +1,38 @@
+/*
+ * fake_motion.h: The fake motion queue used by the host tests of the VM.
+ *
+ * Author: Ian Marshall
+ * Date: 16/10/2026
+ */
+#ifndef __FAKE_MOTION_H
+#define __FAKE_MOTION_H
+
+#include "motors.h"
+#include "test.h"
+
+// The number of motions that the fake queue holds before it's full.
+#define FAKE_QUEUE_LEN 4
+
+// The most queued motions that are recorded.
+#define MAX_RECORDED_MOTIONS 256
+
+// The motions queued since the record was last reset, and the number of them.
+extern motion_t queued_motions[MAX_RECORDED_MOTIONS];
+extern uint32_t queued_motion_count;
+
+/*
+ * Completes the oldest queued motion. Returns false if the queue is empty.
+ */
+bool complete_motion();
+
+/*
+ * Runs the VM until it's idle, completing each queued motion once the posted tasks have run.
+ */
+void run_until_idle();
+
+/*
+ * Clears the record of the queued motions.
+ */
+void reset_motions();
+
+#endif
@@ -0,0 +1,281 @@
+/*
+ * fake_platform.c: The platform functions of the ESP8266 SDK for the host tests. Tasks and timers
+ * only run when a test asks for them, so each test controls the order that events happen in.
+ *
+ * Author: Ian Marshall
+ * Date: 16/10/2026
+ */
+#include <time.h>
+#include "esp8266.h"
+#include "spi_flash.h"
+#include "test.h"
+
+// The number of task priorities supported by the SDK.
+#define TASK_PRIORITIES 3
+
+// The most timers that may be armed at once.
+#define MAX_TIMERS 16
+
+int test_failures = 0;
+
+uint32_t host_registers[64];
+
+uint8_t host_flash[HOST_FLASH_SIZE];
+
+// Flag set once the fake flash has been erased.
+LOCAL bool flash_erased = false;
+
+// The task for each priority, and the number of times it has been posted.
+LOCAL os_task_t tasks[TASK_PRIORITIES];
+LOCAL uint32_t task_posts[TASK_PRIORITIES];
+
+// The armed timers, oldest first.
+LOCAL os_timer_t *timers[MAX_TIMERS];
+LOCAL uint32_t timer_count = 0;
+
+// The simulated time that the timers have run to, in µs.
+LOCAL uint32_t timer_time = 0;
+
+/*
+ * Records a failed check.
+ */
+void test_fail(const char *file, int line, const char *check) {
+	printf("%s:%d: check failed: %s\n", file, line, check);
+	test_failures++;
+}
+
+/*
+ * Prints the outcome of a test program's checks.
+ */
+int test_summary(const char *name) {
+	if (test_failures > 0) {
+		printf("%s: %d check(s) failed.\n", name, test_failures);
+		return 1;
+	}
+	printf("%s: all checks passed.\n", name);
+	return 0;
+}
+
+bool system_os_task(os_task_t task, uint8_t prio, os_event_t *queue, uint8_t qlen) {
+	if (prio >= TASK_PRIORITIES) {
+		return false;
+	}
+	tasks[prio] = task;
+	task_posts[prio] = 0;
+	return true;
+}
+
+bool system_os_post(uint8_t prio, os_signal_t sig, os_param_t par) {
+	if ((prio >= TASK_PRIORITIES) || (tasks[prio] == NULL)) {
+		return false;
+	}
+	task_posts[prio]++;
+	return true;
+}
+
+/*
+ * Runs the next posted task, highest priority first.
+ */
+bool run_next_task() {
+	for (int prio = TASK_PRIORITIES - 1; prio >= 0; prio--) {
+		if (task_posts[prio] > 0) {
+			task_posts[prio]--;
+			os_event_t event = {0, 0};
+			tasks[prio](&event);
+			return true;
+		}
+	}
+	return false;
+}
+
+uint32_t system_get_time(void) {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint32_t)((now.tv_sec * 1000000ULL) + (now.tv_nsec / 1000));
+}
+
+uint64_t host_time_ns() {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (now.tv_sec * 1000000000ULL) + now.tv_nsec;
+}
+
+uint32_t system_get_free_heap_size(void) {
+	return 40000;
+}
+
+void system_soft_wdt_feed(void) {
+}
+
+// The parameters are kept in their first sector, without the SDK's backup sectors.
+bool system_param_save_with_protect(uint16_t start_sec, void *param, uint16_t len) {
+	if ((spi_flash_erase_sector(start_sec) != SPI_FLASH_RESULT_OK) ||
+			(spi_flash_write(start_sec * SPI_FLASH_SEC_SIZE, param, len) != SPI_FLASH_RESULT_OK)) {
+		return false;
+	}
+	return true;
+}
+
+bool system_param_load(uint16_t start_sec, uint16_t offset, void *param, uint16_t len) {
+	return spi_flash_read((start_sec * SPI_FLASH_SEC_SIZE) + offset, param, len)
+			== SPI_FLASH_RESULT_OK;
+}
+
+void os_timer_setfn(os_timer_t *ptimer, os_timer_func_t *pfunction, void *parg) {
+	ptimer->timer_func = pfunction;
+	ptimer->timer_arg = parg;
+}
+
+void os_timer_disarm(os_timer_t *ptimer) {
+	for (uint32_t ii = 0; ii < timer_count; ii++) {
+		if (timers[ii] == ptimer) {
+			os_memmove(&timers[ii], &timers[ii + 1], (timer_count - ii - 1) * sizeof(os_timer_t *));
+			timer_count--;
+			return;
+		}
+	}
+}
+
+void os_timer_arm_us(os_timer_t *ptimer, uint32_t microseconds, bool repeat_flag) {
+	os_timer_disarm(ptimer);
+	ptimer->timer_period = repeat_flag ? microseconds : 0;
+	ptimer->timer_expire = timer_time + microseconds;
+	if (timer_count < MAX_TIMERS) {
+		timers[timer_count++] = ptimer;
+	}
+}
+
+void os_timer_arm(os_timer_t *ptimer, uint32_t milliseconds, bool repeat_flag) {
+	os_timer_arm_us(ptimer, milliseconds * 1000, repeat_flag);
+}
+
+/*
+ * Returns the armed timer that expires first, or NULL if there are none.
+ */
+LOCAL os_timer_t *next_timer() {
+	os_timer_t *next = NULL;
+	for (uint32_t ii = 0; ii < timer_count; ii++) {
+		if ((next == NULL) || (timers[ii]->timer_expire < next->timer_expire)) {
+			next = timers[ii];
+		}
+	}
+	return next;
+}
+
+/*
+ * Fires the armed timer that expires first, moving the simulated time on to its expiry, and
+ * re-arming it if it repeats.
+ */
+bool fire_next_timer() {
+	os_timer_t *timer = next_timer();
+	if (timer == NULL) {
+		return false;
+	}
+	if (timer->timer_expire > timer_time) {
+		timer_time = timer->timer_expire;
+	}
+	os_timer_disarm(timer);
+	if (timer->timer_period > 0) {
+		os_timer_arm_us(timer, timer->timer_period, true);
+	}
+	timer->timer_func(timer->timer_arg);
+	return true;
+}
+
+/*
+ * Moves the simulated time on, firing the timers that expire on the way.
+ */
+void advance_timers(uint32_t microseconds) {
+	uint32_t end = timer_time + microseconds;
+	os_timer_t *timer;
+	while (((timer = next_timer()) != NULL) && (timer->timer_expire <= end)) {
+		fire_next_timer();
+	}
+	timer_time = end;
+}
+
+/*
+ * Returns true if a timer is armed.
+ */
+bool is_timer_armed() {
+	return timer_count > 0;
+}
+
+void ets_isr_attach(int intr, void *handler, void *arg) {
+}
+
+void ets_isr_mask(unsigned intr) {
+}
+
+void ets_isr_unmask(unsigned intr) {
+}
+
+void ets_intr_lock(void) {
+}
+
+void ets_intr_unlock(void) {
+}
+
+/*
+ * Erases the fake flash the first time that it's used.
+ */
+LOCAL void erase_flash() {
+	if (!flash_erased) {
+		os_memset(host_flash, 0xFF, HOST_FLASH_SIZE);
+		flash_erased = true;
+	}
+}
+
+SpiFlashOpResult spi_flash_erase_sector(uint16 sec) {
+	erase_flash();
+	if ((sec + 1) * SPI_FLASH_SEC_SIZE > HOST_FLASH_SIZE) {
+		return SPI_FLASH_RESULT_ERR;
+	}
+	os_memset(host_flash + (sec * SPI_FLASH_SEC_SIZE), 0xFF, SPI_FLASH_SEC_SIZE);
+	return SPI_FLASH_RESULT_OK;
+}
+
+SpiFlashOpResult spi_flash_write(uint32 des_addr, uint32 *src_addr, uint32 size) {
+	erase_flash();
+	if (((des_addr | size) & 3) || (des_addr + size > HOST_FLASH_SIZE)) {
+		return SPI_FLASH_RESULT_ERR;
+	}
+	// Flash bits can only be cleared by a write.
+	uint8_t *src = (uint8_t *)src_addr;
+	for (uint32 ii = 0; ii < size; ii++) {
+		host_flash[des_addr + ii] &= src[ii];
+	}
+	return SPI_FLASH_RESULT_OK;
+}
+
+SpiFlashOpResult spi_flash_read(uint32 src_addr, uint32 *des_addr, uint32 size) {
+	erase_flash();
+	if (((src_addr | size | (uintptr_t)des_addr) & 3) || (src_addr + size > HOST_FLASH_SIZE)) {
+		return SPI_FLASH_RESULT_ERR;
+	}
+	os_memcpy(des_addr, host_flash + src_addr, size);
+	return SPI_FLASH_RESULT_OK;
+}
+
+void gpio_init(void) {
+}
+
+void gpio_output_set(uint32 set_mask, uint32 clear_mask, uint32 enable_mask, uint32 disable_mask) {
+}
+
+void pwm_init(uint32 period, uint32 *duty, uint32 pwm_channel_num, uint32 (*pin_info_list)[3]) {
+}
+
+void pwm_start(void) {
+}
+
+void pwm_set_duty(uint32 duty, uint8 channel) {
+}
+
+uint32 pwm_get_duty(uint8 channel) {
+	return 0;
+}
+
+int cgiWebsockBroadcast(char *resource, char *data, int len, int flags) {
+	return 0;
+}
@@ -0,0 +1,46 @@
+/*
+ * c_types.h: Host stand-in for the ESP8266 SDK's basic types, for the host tests.
+ *
+ * Author: Ian Marshall
+ * Date: 16/10/2026
+ */
+#ifndef _C_TYPES_H_
+#define _C_TYPES_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef uint8_t uint8;
+typedef int8_t sint8;
+typedef int8_t int8;
+typedef uint16_t uint16;
+typedef int16_t sint16;
+typedef int16_t int16;
+typedef uint32_t uint32;
+typedef int32_t sint32;
+typedef int32_t int32;
+
+#define LOCAL static
+#define ICACHE_FLASH_ATTR
+#define ICACHE_RODATA_ATTR
+#define IRAM_ATTR
+
+#define BIT(nr) (1UL << (nr))
+#define BIT0 BIT(0)
+#define BIT1 BIT(1)
+#define BIT2 BIT(2)
+#define BIT3 BIT(3)
+#define BIT4 BIT(4)
+#define BIT5 BIT(5)
+#define BIT6 BIT(6)
+#define BIT7 BIT(7)
+#define BIT8 BIT(8)
+#define BIT12 BIT(12)
+#define BIT13 BIT(13)
+#define BIT14 BIT(14)
+#define BIT15 BIT(15)
+
+#endif
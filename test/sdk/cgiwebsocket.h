@@ -0,0 +1,16 @@
+/*
+ * cgiwebsocket.h: Host stand-in for the libesphttpd web socket types, for the host tests.
+ *
+ * Author: Ian Marshall
+ * Date: 16/10/2026
+ */
+#ifndef CGIWEBSOCKET_H
+#define CGIWEBSOCKET_H
+
+#include "httpd.h"
+
+typedef struct Websock Websock;
+
+int cgiWebsockBroadcast(char *resource, char *data, int len, int flags);
+
+#endif
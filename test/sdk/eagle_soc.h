@@ -0,0 +1,53 @@
+/*
+ * eagle_soc.h: Host stand-in for the ESP8266 SDK's register definitions, for the host tests. The
+ * registers are held in an array of host memory, which the tests may inspect.
+ *
+ * Author: Ian Marshall
+ * Date: 16/10/2026
+ */
+#ifndef _EAGLE_SOC_H_
+#define _EAGLE_SOC_H_
+
+#include "c_types.h"
+
+// The host memory standing in for the peripheral registers, indexed by register address.
+extern uint32_t host_registers[64];
+
+#define READ_PERI_REG(addr) (host_registers[((uint32_t)(addr) / 4) % 64])
+#define WRITE_PERI_REG(addr, val) (host_registers[((uint32_t)(addr) / 4) % 64] = (val))
+#define RTC_REG_WRITE(addr, val) WRITE_PERI_REG(addr, val)
+#define RTC_CLR_REG_MASK(addr, mask) WRITE_PERI_REG(addr, READ_PERI_REG(addr) & ~(mask))
+
+#define PERIPHS_TIMER_BASEDDR 0x00
+#define FRC1_LOAD_ADDRESS 0x00
+#define FRC1_CTRL_ADDRESS 0x08
+#define FRC1_INT_ADDRESS 0x0c
+#define FRC1_INT_CLR_MASK BIT0
+#define FRC1_ENABLE_TIMER BIT7
+#define FRC1_AUTO_LOAD BIT6
+#define DIVDED_BY_16 4
+#define TM_EDGE_INT 0
+
+#define PERIPHS_IO_MUX_FUNC 0x13
+#define PERIPHS_IO_MUX_FUNC_S 4
+#define PERIPHS_IO_MUX_MTDI_U 0x20
+#define PERIPHS_IO_MUX_MTCK_U 0x24
+#define PERIPHS_IO_MUX_MTMS_U 0x28
+#define PERIPHS_IO_MUX_MTDO_U 0x2c
+#define PERIPHS_IO_MUX_U0RXD_U 0x30
+#define PERIPHS_IO_MUX_GPIO0_U 0x34
+#define PERIPHS_IO_MUX_GPIO2_U 0x38
+#define PERIPHS_IO_MUX_GPIO4_U 0x3c
+#define PERIPHS_IO_MUX_GPIO5_U 0x40
+#define FUNC_GPIO0 0
+#define FUNC_GPIO2 0
+#define FUNC_GPIO3 3
+#define FUNC_GPIO4 0
+#define FUNC_GPIO5 0
+#define FUNC_GPIO12 3
+#define FUNC_GPIO13 3
+#define FUNC_GPIO14 3
+#define FUNC_GPIO15 3
+#define PIN_FUNC_SELECT(pin, func) WRITE_PERI_REG(pin, func)
+
+#endif
@@ -0,0 +1,15 @@
+/*
+ * esp8266.h: Host stand-in for the ESP8266 SDK's combined header, for the host tests.
+ *
+ * Author: Ian Marshall
+ * Date: 16/10/2026
+ */
+#ifndef _ESP8266_H_
+#define _ESP8266_H_
+
+#include "c_types.h"
+#include "ets_sys.h"
+#include "osapi.h"
+#include "espmissingincludes.h"
+
+#endif
@@ -0,0 +1,31 @@
+/*
+ * ets_sys.h: Host stand-in for the ESP8266 SDK's interrupt functions, for the host tests.
+ *
+ * Author: Ian Marshall
+ * Date: 16/10/2026
+ */
+#ifndef _ETS_SYS_H
+#define _ETS_SYS_H
+
+#include "c_types.h"
+#include "os_type.h"
+#include "eagle_soc.h"
+
+#define ETS_FRC_TIMER1_INUM 9
+
+void ets_isr_attach(int intr, void *handler, void *arg);
+void ets_isr_mask(unsigned intr);
+void ets_isr_unmask(unsigned intr);
+void ets_intr_lock(void);
+void ets_intr_unlock(void);
+
+#define ETS_INTR_LOCK() ets_intr_lock()
+#define ETS_INTR_UNLOCK() ets_intr_unlock()
+#define ETS_FRC_TIMER1_INTR_ATTACH(func, arg) \
+	ets_isr_attach(ETS_FRC_TIMER1_INUM, (func), (void *)(arg))
+#define ETS_FRC1_INTR_ENABLE() ets_isr_unmask(1 << ETS_FRC_TIMER1_INUM)
+#define ETS_FRC1_INTR_DISABLE() ets_isr_mask(1 << ETS_FRC_TIMER1_INUM)
+#define TM1_EDGE_INT_ENABLE()
+#define TM1_EDGE_INT_DISABLE()
+
+#endif
@@ -0,0 +1,15 @@
+/*
+ * gpio.h: Host stand-in for the ESP8266 SDK's GPIO functions, for the host tests.
+ *
+ * Author: Ian Marshall
+ * Date: 16/10/2026
+ */
+#ifndef _GPIO_H_
+#define _GPIO_H_
+
+#include "c_types.h"
+
+void gpio_init(void);
+void gpio_output_set(uint32 set_mask, uint32 clear_mask, uint32 enable_mask, uint32 disable_mask);
+
+#endif
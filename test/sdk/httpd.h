@@ -0,0 +1,24 @@
+/*
+ * httpd.h: Host stand-in for the libesphttpd connection types, for the host tests.
+ *
+ * Author: Ian Marshall
+ * Date: 16/10/2026
+ */
+#ifndef HTTPD_H
+#define HTTPD_H
+
+#include "c_types.h"
+
+#define HTTPD_CGI_MORE 0
+#define HTTPD_CGI_DONE 1
+
+typedef struct HttpdConnData HttpdConnData;
+typedef int (*cgiSendCallback)(HttpdConnData *connData);
+
+struct HttpdConnData {
+	void *conn;
+	void *cgiData;
+	cgiSendCallback cgi;
+};
+
+#endif
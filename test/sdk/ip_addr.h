@@ -0,0 +1,18 @@
+/*
+ * ip_addr.h: Host stand-in for the ESP8266 SDK's IP address type, for the host tests.
+ *
+ * Author: Ian Marshall
+ * Date: 16/10/2026
+ */
+#ifndef __IP_ADDR_H__
+#define __IP_ADDR_H__
+
+#include "c_types.h"
+
+struct ip_addr {
+	uint32 addr;
+};
+
+typedef struct ip_addr ip_addr_t;
+
+#endif
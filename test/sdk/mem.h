@@ -0,0 +1,17 @@
+/*
+ * mem.h: Host stand-in for the ESP8266 SDK's heap functions, for the host tests.
+ *
+ * Author: Ian Marshall
+ * Date: 16/10/2026
+ */
+#ifndef _MEM_H_
+#define _MEM_H_
+
+#include <stdlib.h>
+
+#define os_malloc malloc
+#define os_zalloc(size) calloc(1, size)
+#define os_realloc realloc
+#define os_free free
+
+#endif
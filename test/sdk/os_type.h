@@ -0,0 +1,35 @@
+/*
+ * os_type.h: Host stand-in for the ESP8266 SDK's timer and task types, for the host tests.
+ *
+ * Author: Ian Marshall
+ * Date: 16/10/2026
+ */
+#ifndef _OS_TYPE_H_
+#define _OS_TYPE_H_
+
+#include "c_types.h"
+
+typedef void ETSTimerFunc(void *timer_arg);
+typedef void os_timer_func_t(void *timer_arg);
+
+typedef struct _ETSTIMER_ {
+	struct _ETSTIMER_ *timer_next;
+	uint32_t timer_expire;
+	uint32_t timer_period;
+	ETSTimerFunc *timer_func;
+	void *timer_arg;
+} os_timer_t;
+
+typedef os_timer_t ETSTimer;
+
+typedef uint32_t os_signal_t;
+typedef uint32_t os_param_t;
+
+typedef struct ETSEventTag {
+	os_signal_t sig;
+	os_param_t par;
+} os_event_t;
+
+typedef void (*os_task_t)(os_event_t *e);
+
+#endif
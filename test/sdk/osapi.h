@@ -0,0 +1,42 @@
+/*
+ * osapi.h: Host stand-in for the ESP8266 SDK's OS functions, for the host tests. The timer, task
+ * and clock functions are provided by the tests' fake platform.
+ *
+ * Author: Ian Marshall
+ * Date: 16/10/2026
+ */
+#ifndef _OSAPI_H_
+#define _OSAPI_H_
+
+#include <stdio.h>
+#include "c_types.h"
+#include "os_type.h"
+#include "spi_flash.h"
+
+#define os_printf printf
+#define os_sprintf sprintf
+#define os_memcmp memcmp
+#define os_memcpy memcpy
+#define os_memmove memmove
+#define os_memset memset
+#define os_strcmp strcmp
+#define os_strcpy strcpy
+#define os_strlen strlen
+#define os_strncmp strncmp
+#define os_strncpy strncpy
+#define os_strstr strstr
+
+void os_timer_arm(os_timer_t *ptimer, uint32_t milliseconds, bool repeat_flag);
+void os_timer_arm_us(os_timer_t *ptimer, uint32_t microseconds, bool repeat_flag);
+void os_timer_disarm(os_timer_t *ptimer);
+void os_timer_setfn(os_timer_t *ptimer, os_timer_func_t *pfunction, void *parg);
+
+bool system_os_task(os_task_t task, uint8_t prio, os_event_t *queue, uint8_t qlen);
+bool system_os_post(uint8_t prio, os_signal_t sig, os_param_t par);
+uint32_t system_get_time(void);
+uint32_t system_get_free_heap_size(void);
+void system_soft_wdt_feed(void);
+bool system_param_save_with_protect(uint16_t start_sec, void *param, uint16_t len);
+bool system_param_load(uint16_t start_sec, uint16_t offset, void *param, uint16_t len);
+
+#endif
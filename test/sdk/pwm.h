@@ -0,0 +1,17 @@
+/*
+ * pwm.h: Host stand-in for the ESP8266 SDK's PWM driver, for the host tests.
+ *
+ * Author: Ian Marshall
+ * Date: 16/10/2026
+ */
+#ifndef __PWM_H__
+#define __PWM_H__
+
+#include "c_types.h"
+
+void pwm_init(uint32 period, uint32 *duty, uint32 pwm_channel_num, uint32 (*pin_info_list)[3]);
+void pwm_start(void);
+void pwm_set_duty(uint32 duty, uint8 channel);
+uint32 pwm_get_duty(uint8 channel);
+
+#endif
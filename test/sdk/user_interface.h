@@ -0,0 +1,13 @@
+/*
+ * user_interface.h: Host stand-in for the ESP8266 SDK's system interface, for the host tests. The
+ * system functions that the tested modules use are declared with the OS functions in osapi.h.
+ *
+ * Author: Ian Marshall
+ * Date: 16/10/2026
+ */
+#ifndef _USER_INTERFACE_H_
+#define _USER_INTERFACE_H_
+
+#include "osapi.h"
+
+#endif
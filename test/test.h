@@ -0,0 +1,86 @@
+/*
+ * test.h: Checks for the host tests, and the fake platform that the tested modules run on.
+ *
+ * The host tests build the firmware's modules against the stand-in SDK headers in sdk/, with the
+ * platform functions (tasks, timers, the clock, interrupts and the flash) provided by
+ * fake_platform.c. Each test program exits with a non-zero status if any of its checks failed.
+ *
+ * Author: Ian Marshall
+ * Date: 16/10/2026
+ */
+#ifndef __TEST_H
+#define __TEST_H
+
+#include <stdio.h>
+#include "c_types.h"
+
+// The size of the fake flash memory, in bytes.
+#define HOST_FLASH_SIZE (4 * 1024 * 1024)
+
+// The number of checks that have failed.
+extern int test_failures;
+
+// Checks that a condition holds, reporting the location if it doesn't.
+#define CHECK(cond) \
+	do { if (!(cond)) { test_fail(__FILE__, __LINE__, #cond); } } while (0)
+
+// Checks that two integers are equal, reporting both values if they aren't.
+#define CHECK_INT(actual, expected) \
+	do { \
+		long long _a = (long long)(actual), _e = (long long)(expected); \
+		if (_a != _e) { \
+			test_fail(__FILE__, __LINE__, #actual " == " #expected); \
+			printf("    got %lld, expected %lld\n", _a, _e); \
+		} \
+	} while (0)
+
+// Checks that a string contains the expected text, reporting the string if it doesn't.
+#define CHECK_STR(actual, expected) \
+	do { \
+		const char *_a = (actual), *_e = (expected); \
+		if ((_a == NULL) || (strstr(_a, _e) == NULL)) { \
+			test_fail(__FILE__, __LINE__, #actual " contains " #expected); \
+			printf("    got \"%s\", expected \"%s\"\n", (_a != NULL) ? _a : "(null)", _e); \
+		} \
+	} while (0)
+
+/*
+ * Records a failed check.
+ */
+void test_fail(const char *file, int line, const char *check);
+
+/*
+ * Prints the outcome of a test program's checks. Returns the exit status for the test program.
+ */
+int test_summary(const char *name);
+
+/*
+ * Runs the next posted task, highest priority first. Returns false if no task was posted.
+ */
+bool run_next_task();
+
+/*
+ * Fires the armed timer that expires first, moving the timers' simulated time on to its expiry, and
+ * re-arming it if it repeats. Returns false if no timer is armed.
+ */
+bool fire_next_timer();
+
+/*
+ * Moves the timers' simulated time on by a number of µs, firing the timers that expire on the way.
+ */
+void advance_timers(uint32_t microseconds);
+
+/*
+ * Returns true if any timer is armed.
+ */
+bool is_timer_armed();
+
+/*
+ * Returns the host's monotonic time in ns, for the benchmarks.
+ */
+uint64_t host_time_ns();
+
+// The fake flash memory, which is erased (all 0xFF) when the first test starts.
+extern uint8_t host_flash[HOST_FLASH_SIZE];
+
+#endif
@@ -0,0 +1,129 @@
+/*
+ * test_json_writer.c: Host tests of the JSON writer's formatting and escaping, and of its overflow
+ * detection at every buffer size.
+ *
+ * Author: Ian Marshall
+ * Date: 16/10/2026
+ */
+#include "esp8266.h"
+#include "json_writer.h"
+#include "test.h"
+
+// The byte that fills the buffers beyond their given size, to catch writes past the end.
+#define GUARD 0x5A
+
+// The size of the buffers, including the guard bytes beyond the size given to the writer.
+#define BUF_LEN 256
+
+/*
+ * Writes a program status notification, with a string holding every kind of escaped character.
+ * Returns the result of the last write.
+ */
+LOCAL bool write_message(json_writer *jw) {
+	json_write_raw(jw, "{\"program\":{\"status\":\"running\",\"function\":");
+	json_write_uint32(jw, 4294967295U);
+	json_write_raw(jw, ", \"index\": ");
+	json_write_int32(jw, -2147483647 - 1);
+	json_write_raw(jw, ", \"name\": ");
+	json_write_string(jw, "a \"b\" \\ c\n\r\t\x01\x1f \xc2\xb5s");
+	return json_write_raw(jw, "}}");
+}
+
+// The message, as it should be written.
+LOCAL const char expected_message[] =
+		"{\"program\":{\"status\":\"running\",\"function\":4294967295, \"index\": -2147483648, "
+		"\"name\": \"a \\\"b\\\" \\\\ c\\n\\r\\t\\u0001\\u001f \xc2\xb5s\"}}";
+
+/*
+ * Checks that the writer holds exactly the expected text.
+ */
+LOCAL void check_written(const json_writer *jw, const char *expected) {
+	CHECK(!jw->overflow);
+	CHECK_INT(jw->len, strlen(expected));
+	CHECK_STR(jw->buf, expected);
+}
+
+/*
+ * Checks that values are formatted, and strings quoted and escaped, as JSON requires.
+ */
+LOCAL void test_values() {
+	char buf[BUF_LEN];
+	json_writer jw;
+	init_json_writer(&jw, buf, sizeof(buf));
+	check_written(&jw, "");
+	CHECK(write_message(&jw));
+	check_written(&jw, expected_message);
+
+	const int32_t values[] = {0, 7, -7, 10, -10, 2147483647};
+	const char *formatted[] = {"0", "7", "-7", "10", "-10", "2147483647"};
+	for (uint32_t ii = 0; ii < sizeof(values) / sizeof(values[0]); ii++) {
+		init_json_writer(&jw, buf, sizeof(buf));
+		CHECK(json_write_int32(&jw, values[ii]));
+		check_written(&jw, formatted[ii]);
+	}
+	init_json_writer(&jw, buf, sizeof(buf));
+	CHECK(json_write_uint32(&jw, 0));
+	check_written(&jw, "0");
+
+	init_json_writer(&jw, buf, sizeof(buf));
+	CHECK(json_write_string(&jw, ""));
+	check_written(&jw, "\"\"");
+}
+
+/*
+ * Checks that the message is written into every size of buffer up to the one that it fits,
+ * leaving a valid C string of the start of the message, dropping everything from the first write
+ * that doesn't fit, and never writing past the end of the buffer.
+ */
+LOCAL void test_overflow() {
+	int full_len = strlen(expected_message);
+	CHECK(full_len + 2 < BUF_LEN);
+	char buf[BUF_LEN];
+	for (int size = 1; size <= full_len + 2; size++) {
+		os_memset(buf, GUARD, sizeof(buf));
+		json_writer jw;
+		init_json_writer(&jw, buf, size);
+		bool fitted = write_message(&jw);
+
+		bool fits = size > full_len;
+		CHECK_INT(fitted, fits);
+		CHECK_INT(jw.overflow, !fits);
+		CHECK_INT(strlen(buf), jw.len);
+		CHECK(jw.len < size);
+		CHECK(strncmp(buf, expected_message, jw.len) == 0);
+		for (int ii = size; ii < BUF_LEN; ii++) {
+			if (buf[ii] != GUARD) {
+				printf("Size %d: written past the end of the buffer at %d.\n", size, ii);
+				CHECK(buf[ii] == GUARD);
+				break;
+			}
+		}
+
+		// Once overflowed, even writes that would fit are dropped.
+		if (!fits) {
+			int len = jw.len;
+			CHECK(!json_write_raw(&jw, ""));
+			CHECK(!json_write_uint32(&jw, 1));
+			CHECK_INT(jw.len, len);
+			CHECK(jw.overflow);
+		}
+	}
+
+	// A string value is dropped from the first character that doesn't fit, escaped or not.
+	char small[8];
+	json_writer jw;
+	init_json_writer(&jw, small, sizeof(small));
+	CHECK(!json_write_string(&jw, "abc\n\x01"));
+	CHECK_STR(small, "\"abc\\n");
+	CHECK_INT(jw.len, 6);
+	init_json_writer(&jw, small, sizeof(small));
+	CHECK(json_write_string(&jw, "ab\\c"));
+	check_written(&jw, "\"ab\\\\c\"");
+	CHECK(!json_write_raw(&jw, "}"));
+}
+
+int main() {
+	test_values();
+	test_overflow();
+	return test_summary("test_json_writer");
+}
@@ -0,0 +1,420 @@
+/*
+ * test_motors.c: Host tests of the stepper motor control. The motor control is included directly,
+ * so that its planning functions can be tested, and it is driven by a tick source that the tests
+ * tick by hand.
+ *
+ * Author: Ian Marshall
+ * Date: 16/10/2026
+ */
+#include "../src/motors.c"
+#include "test.h"
+#include "fake_config.h"
+
+// The tick function of the test tick source, which is NULL whilst it's stopped.
+LOCAL motor_tick_t *test_tick = NULL;
+
+// The interval that the test tick source was last started with, in µs.
+LOCAL uint32_t test_tick_interval = 0;
+
+// The number of ticks when the last movement's callback was called.
+LOCAL uint32_t completed_tick = 0;
+
+// The number of ticks since the test tick source was last started.
+LOCAL uint32_t tick_count = 0;
+
+/*
+ * Starts the test tick source.
+ */
+LOCAL void test_ticks_start(uint32_t interval, motor_tick_t *tick) {
+	test_tick = tick;
+	test_tick_interval = interval;
+	tick_count = 0;
+}
+
+/*
+ * Stops the test tick source.
+ */
+LOCAL void test_ticks_stop() {
+	test_tick = NULL;
+}
+
+// The tick source for the tests.
+LOCAL const tick_source_t test_tick_source = {test_ticks_start, test_ticks_stop};
+
+/*
+ * Ticks the motor control once, then runs the tasks that it posts.
+ */
+LOCAL void tick() {
+	if (test_tick != NULL) {
+		tick_count++;
+		test_tick(NULL);
+	}
+	while (run_next_task()) {
+	}
+}
+
+/*
+ * Records the tick that a movement completed on.
+ */
+LOCAL void movement_complete() {
+	completed_tick = tick_count;
+}
+
+/*
+ * Ticks the motor control until its tick source stops.
+ */
+LOCAL void tick_until_stopped() {
+	for (uint32_t ii = 0; (ii < 1000000) && (test_tick != NULL); ii++) {
+		tick();
+	}
+	CHECK(test_tick == NULL);
+}
+
+/*
+ * The position along the acceleration curve after a number of ticks, as the motor timer callback
+ * calculated it in floating point on every tick before the acceleration table replaced it.
+ */
+LOCAL float float_curve_position(uint32_t duration, uint32_t ticks) {
+	uint32_t accel_duration = duration / 2;
+	float tick = ticks;
+	if (ticks <= accel_duration) {
+		return (tick * tick * tick) / (6 * accel_duration * accel_duration);
+	}
+	float crossover = accel_duration;
+	crossover = (crossover * crossover * crossover) / (6 * accel_duration * accel_duration);
+	tick -= accel_duration;
+	return -((tick * tick * tick) / (6 * accel_duration * accel_duration)) +
+			((tick * tick) / (2 * accel_duration)) + (tick / 2) + crossover;
+}
+
+/*
+ * Checks that an accelerated movement long enough to reach full speed steps, on every tick, within
+ * one step of the floating point acceleration curve (and its mirror image when decelerating), and
+ * that it takes every step and completes on the expected tick.
+ */
+LOCAL void check_accelerated_movement(uint32_t duration, int16_t steps) {
+	acceleration_duration = duration;
+	int32_t start_left;
+	int32_t start_right;
+	get_odometry(&start_left, &start_right);
+
+	drive_motors(steps, steps, 0, true, movement_complete);
+	uint32_t a = duration / 2;
+	uint32_t total = steps + (2 * a);
+	uint32_t worst = 0;
+	while (test_tick != NULL) {
+		tick();
+		int32_t left;
+		int32_t right;
+		get_odometry(&left, &right);
+		int32_t position = left - start_left;
+		CHECK_INT(right - start_right, position);
+
+		int32_t expected;
+		if (tick_count <= 2 * a) {
+			expected = (int32_t)float_curve_position(duration, tick_count);
+		} else if (tick_count <= (uint32_t)steps) {
+			expected = a + (tick_count - (2 * a));
+		} else if (tick_count <= total) {
+			expected = steps - (int32_t)float_curve_position(duration, total - tick_count);
+		} else {
+			expected = steps;
+		}
+		uint32_t error = ABS(position - expected);
+		if (error > worst) {
+			worst = error;
+		}
+		if (error > 1) {
+			printf("Duration %u, %d steps: %d steps after %u ticks, expected %d.\n",
+					duration, steps, position, tick_count, expected);
+			CHECK(error <= 1);
+			break;
+		}
+	}
+	tick_until_stopped();
+
+	int32_t left;
+	int32_t right;
+	get_odometry(&left, &right);
+	CHECK_INT(left - start_left, steps);
+	CHECK_INT(right - start_right, steps);
+	CHECK_INT(completed_tick, total);
+	printf("Duration %u, %d steps: within %u step(s) of the floating point curve.\n",
+			duration, steps, worst);
+}
+
+/*
+ * Checks that the acceleration table's step sequence matches the floating point curve that it
+ * replaced, for a range of acceleration durations.
+ */
+LOCAL void test_acceleration_table() {
+	const uint32_t durations[] = {2, 3, 10, 11, 100, 250, 999, 1000, 2000, 6000};
+	for (uint32_t ii = 0; ii < sizeof(durations) / sizeof(durations[0]); ii++) {
+		check_accelerated_movement(durations[ii], durations[ii] + 37);
+	}
+	check_accelerated_movement(1000, 1000);
+	check_accelerated_movement(1000, 20000);
+
+	// The table is only rebuilt when the duration changes.
+	acceleration_duration = 500;
+	CHECK(build_acceleration_table(500));
+	uint16_t *table = accel_table;
+	CHECK(build_acceleration_table(500));
+	CHECK(accel_table == table);
+	CHECK_INT(accel_table_steps, 250);
+	CHECK_INT(accel_table[249], 500);
+}
+
+/*
+ * The acceleration limit of a movement too short to reach full speed, found by the binary search
+ * over the floating point acceleration curve that the lookup from the acceleration table replaced.
+ */
+LOCAL uint32_t search_acceleration_limit(uint32_t duration, uint32_t steps) {
+	uint32_t accel_duration = duration / 2;
+	uint32_t target = steps / 2;
+	uint32_t left = 0;
+	uint32_t right = duration;
+	float crossover = accel_duration;
+	crossover = (crossover * crossover * crossover) / (6 * accel_duration * accel_duration);
+	while (left < right) {
+		uint32_t mid = (left + right) / 2;
+		float m_value = (float)mid;
+		if (mid <= accel_duration) {
+			m_value = (m_value * m_value * m_value) / (6 * accel_duration * accel_duration);
+		} else {
+			m_value -= accel_duration;
+			m_value = -((m_value * m_value * m_value) / (6 * accel_duration * accel_duration)) +
+					((m_value * m_value) / (2 * accel_duration)) + (m_value / 2) + crossover;
+		}
+		if (((uint32_t)m_value) < target) {
+			left = mid + 1;
+		} else {
+			right = mid;
+		}
+	}
+	return left;
+}
+
+/*
+ * Checks that the acceleration limit of every movement too short to reach full speed, up to a few
+ * thousand steps, is the one that the binary search found.
+ */
+LOCAL void test_short_movements() {
+	const uint32_t durations[] = {2, 3, 4, 10, 11, 100, 101, 250, 999, 1000, 2000, 4000, 6001};
+	for (uint32_t ii = 0; ii < sizeof(durations) / sizeof(durations[0]); ii++) {
+		uint32_t duration = durations[ii];
+		CHECK(build_acceleration_table(duration));
+		uint32_t mismatches = 0;
+		for (uint32_t steps = 1; ((duration / 2) > (steps / 2)) && (steps <= 3000); steps++) {
+			phase_data_t phases;
+			plan_phases(steps, 0, true, 0, 0, &phases);
+			uint32_t expected = search_acceleration_limit(duration, steps);
+			if ((phases.accel_limit != expected) || (phases.decel_limit != expected) ||
+					(phases.accel_steps != steps / 2) || (phases.decel_steps != steps / 2)) {
+				if (mismatches++ == 0) {
+					printf("Duration %u, %u steps: acceleration limit %u, expected %u.\n",
+							duration, steps, phases.accel_limit, expected);
+				}
+			}
+		}
+		CHECK_INT(mismatches, 0);
+	}
+
+	// A short movement is driven within its planned duration, taking every step.
+	acceleration_duration = 1000;
+	for (int16_t steps = 1; steps < 1000; steps += 37) {
+		int32_t start_left;
+		int32_t start_right;
+		get_odometry(&start_left, &start_right);
+		drive_motors(steps, -steps, 0, true, movement_complete);
+		uint32_t expected_ticks = phase_data.accel_limit + phase_data.cruise_duration +
+				phase_data.decel_limit;
+		tick_until_stopped();
+		int32_t left;
+		int32_t right;
+		get_odometry(&left, &right);
+		CHECK_INT(left - start_left, steps);
+		CHECK_INT(right - start_right, -steps);
+		CHECK_INT(completed_tick, expected_ticks);
+	}
+}
+
+// The longest drawing that the simulation can perform, in motions.
+#define MAX_DRAWING_LEN 200
+
+// The drawing being performed by the simulation, and the number of its motions queued so far.
+LOCAL motion_t drawing[MAX_DRAWING_LEN];
+LOCAL uint32_t drawing_len = 0;
+LOCAL uint32_t drawing_queued = 0;
+
+// True if the simulation queues the drawing's motions as far ahead as the queue allows, and false
+// if it only queues each motion once the one before it has completed.
+LOCAL bool queue_ahead = false;
+
+/*
+ * Adds a motion to the drawing.
+ */
+LOCAL void add_motion(motion_type_t type, int32_t left_steps, int32_t right_steps) {
+	CHECK(drawing_len < MAX_DRAWING_LEN);
+	if (drawing_len < MAX_DRAWING_LEN) {
+		motion_t *motion = &drawing[drawing_len++];
+		os_memset(motion, 0, sizeof(motion_t));
+		motion->type = type;
+		motion->left_steps = left_steps;
+		motion->right_steps = right_steps;
+		motion->offset = drawing_len;
+	}
+}
+
+/*
+ * Queues the drawing's next motions: as many as the queue will take, or just the next one once the
+ * queue has emptied.
+ */
+LOCAL void queue_drawing() {
+	while ((drawing_queued < drawing_len) && (queue_ahead || is_motion_queue_empty()) &&
+			queue_motion(&drawing[drawing_queued])) {
+		drawing_queued++;
+	}
+}
+
+/*
+ * Performs the drawing in simulated time, with the motor control ticking every ms. Returns the time
+ * the drawing took, in ms, after checking that every step was taken.
+ */
+LOCAL uint32_t perform_drawing(bool ahead) {
+	int32_t start_left;
+	int32_t start_right;
+	get_odometry(&start_left, &start_right);
+	queue_ahead = ahead;
+	drawing_queued = 0;
+	set_motion_callbacks(NULL, queue_drawing);
+	queue_drawing();
+
+	uint32_t ms = 0;
+	while (((drawing_queued < drawing_len) || !is_motion_queue_empty()) && (ms < 1000000)) {
+		tick();
+		advance_timers(1000);
+		ms++;
+	}
+	set_motion_callbacks(NULL, NULL);
+	CHECK(is_motion_queue_empty());
+
+	int32_t left_steps = 0;
+	int32_t right_steps = 0;
+	for (uint32_t ii = 0; ii < drawing_len; ii++) {
+		left_steps += drawing[ii].left_steps;
+		right_steps += drawing[ii].right_steps;
+	}
+	int32_t left;
+	int32_t right;
+	get_odometry(&left, &right);
+	CHECK_INT(left - start_left, left_steps);
+	CHECK_INT(right - start_right, right_steps);
+	return ms;
+}
+
+/*
+ * Performs the drawing with the motions queued ahead, so that the planner can carry speed between
+ * them, and one at a time, so that every movement starts and stops stationary as it did before the
+ * planner. Checks that the planner takes no longer, and returns its saving as a percentage.
+ */
+LOCAL uint32_t compare_drawing(const char *name) {
+	uint32_t stop_start = perform_drawing(false);
+	uint32_t planned = perform_drawing(true);
+	printf("%-28s %3u motions: %6u ms stop-start, %6u ms planned.\n", name, drawing_len,
+			stop_start, planned);
+	CHECK(planned <= stop_start);
+	drawing_len = 0;
+	return (stop_start - planned) * 100 / stop_start;
+}
+
+/*
+ * Simulates the time taken by standard drawings with and without the planner carrying speed across
+ * the queued movements, using the default acceleration and post movement pause.
+ */
+LOCAL void test_drawing_time() {
+	acceleration_duration = 200;
+	move_pause_duration = 200;
+
+	// A long line drawn in short collinear segments, as a loop of FDs draws it.
+	add_motion(MOTION_PEN_DOWN, 0, 0);
+	for (uint32_t ii = 0; ii < 100; ii++) {
+		add_motion(MOTION_STEPS, 50, 50);
+	}
+	add_motion(MOTION_PEN_UP, 0, 0);
+	CHECK(compare_drawing("Segmented line") > 50);
+
+	// A curve drawn in segments that each steer slightly, and back again.
+	add_motion(MOTION_PEN_DOWN, 0, 0);
+	for (uint32_t ii = 0; ii < 100; ii++) {
+		int32_t steer = ((ii / 25) % 2 == 0) ? ii % 25 : 25 - (ii % 25);
+		add_motion(MOTION_STEPS, 60, 60 - steer);
+	}
+	add_motion(MOTION_PEN_UP, 0, 0);
+	CHECK(compare_drawing("Gently curving line") > 50);
+
+	// Squares, which turn on the spot at every corner and so stop there either way, with a move to
+	// the next square between them.
+	for (uint32_t square = 0; square < 4; square++) {
+		add_motion(MOTION_PEN_DOWN, 0, 0);
+		for (uint32_t side = 0; side < 4; side++) {
+			add_motion(MOTION_STEPS, 400, 400);
+			add_motion(MOTION_STEPS, 500, -500);
+		}
+		add_motion(MOTION_PEN_UP, 0, 0);
+		add_motion(MOTION_STEPS, 600, 600);
+	}
+	compare_drawing("Squares");
+
+	// A dashed line, which stops at every pen movement.
+	for (uint32_t ii = 0; ii < 20; ii++) {
+		add_motion(MOTION_PEN_DOWN, 0, 0);
+		add_motion(MOTION_STEPS, 100, 100);
+		add_motion(MOTION_STEPS, 100, 100);
+		add_motion(MOTION_PEN_UP, 0, 0);
+		add_motion(MOTION_STEPS, 100, 100);
+	}
+	CHECK(compare_drawing("Dashed line") > 0);
+
+	move_pause_duration = 0;
+	acceleration_duration = 1000;
+}
+
+/*
+ * Checks that the hardware timer is only chosen as the tick source when the servo's PWM isn't using
+ * it.
+ */
+LOCAL void test_hardware_timer() {
+	CHECK(servo_pwm_active);
+	hardware_tick_interval = 200;
+	set_tick_source(NULL);
+	CHECK(tick_source == &software_tick_source);
+	CHECK_INT(tick_interval, 1000);
+
+	servo_pwm_active = false;
+	init_motor_timer();
+	CHECK(tick_source == &hardware_tick_source);
+	CHECK_INT(tick_interval, 200);
+	servo_pwm_active = true;
+
+	// A replacement tick source is still given the hardware timer's interval.
+	set_tick_source(&test_tick_source);
+	CHECK(tick_source == &test_tick_source);
+	CHECK_INT(tick_interval, 200);
+	hardware_tick_interval = 0;
+	init_motor_timer();
+	CHECK_INT(tick_interval, 1000);
+}
+
+int main() {
+	set_tick_source(&test_tick_source);
+	init_motors();
+	tick_until_stopped();
+	CHECK_INT(test_tick_interval, 1000);
+
+	test_acceleration_table();
+	test_short_movements();
+	test_drawing_time();
+	test_hardware_timer();
+	return test_summary("test_motors");
+}
@@ -0,0 +1,248 @@
+/*
+ * test_program_image.c: Host tests of loading programs from binary program images, both from memory
+ * and from the flash file store.
+ *
+ * Author: Ian Marshall
+ * Date: 16/10/2026
+ */
+#include "esp8266.h"
+#include "files.h"
+#include "program_image.h"
+#include "fake_motion.h"
+#include "byte_code.h"
+
+// The offset of the function table, and the size of each entry.
+#define TABLE_OFFSET 8
+#define ENTRY_LEN 6
+
+// A function for a test program image, with its byte code in an array.
+typedef struct image_function_t {
+	uint8_t args;
+	uint8_t locals;
+	uint8_t stack;
+	const uint8_t *code;
+	uint16_t length;
+} image_function_t;
+
+// A program that calls a function, which starts at an odd offset in the image. It moves forward 7
+// then turns left 90 degrees.
+LOCAL const uint8_t small_main[] = {ICONST, OPERAND(7), CALL, OPERAND(1), STOP};
+LOCAL const uint8_t small_function[] = {ILOAD_0, FD, ICONST_90, LT, RET};
+LOCAL const image_function_t small_program[] = {
+	{0, 0, 1, small_main, sizeof(small_main)},
+	{1, 0, 1, small_function, sizeof(small_function)}
+};
+
+// The size of the small program's image.
+#define SMALL_IMAGE_LEN (TABLE_OFFSET + (2 * ENTRY_LEN) + sizeof(small_main) + \
+	sizeof(small_function) + 4)
+
+// The image buffer, aligned for writing to flash.
+LOCAL uint32_t image_words[MAX_PROGRAM_IMAGE_SIZE / 4 + 1];
+LOCAL uint8_t *image = (uint8_t *)image_words;
+
+/*
+ * Writes a value to an image as big endian bytes.
+ */
+LOCAL void put_bytes(uint8_t *dest, uint32_t value, uint32_t length) {
+	for (uint32_t ii = 0; ii < length; ii++) {
+		dest[ii] = (uint8_t)(value >> (8 * (length - ii - 1)));
+	}
+}
+
+/*
+ * Recalculates the CRC at the end of an image, after it has been changed.
+ */
+LOCAL void seal_image(uint32_t length) {
+	put_bytes(&image[length - 4], crc32(image, length - 4), 4);
+}
+
+/*
+ * Builds a program image in the image buffer. Returns its length.
+ */
+LOCAL uint32_t build_image(
+		uint8_t global_count, const image_function_t *functions, uint8_t function_count) {
+	put_bytes(image, 0x4D545049, 4);
+	image[4] = PROGRAM_IMAGE_VERSION;
+	image[5] = global_count;
+	image[6] = function_count;
+	image[7] = 0;
+	uint32_t offset = TABLE_OFFSET + (function_count * ENTRY_LEN);
+	for (uint8_t ii = 0; ii < function_count; ii++) {
+		uint8_t *entry = &image[TABLE_OFFSET + (ii * ENTRY_LEN)];
+		entry[0] = functions[ii].args;
+		entry[1] = functions[ii].locals;
+		entry[2] = functions[ii].stack;
+		entry[3] = 0;
+		put_bytes(&entry[4], functions[ii].length, 2);
+		os_memcpy(&image[offset], functions[ii].code, functions[ii].length);
+		offset += functions[ii].length;
+	}
+	seal_image(offset + 4);
+	return offset + 4;
+}
+
+/*
+ * Saves the image buffer to a file.
+ */
+LOCAL void save_image(uint8_t file_number, uint32_t length) {
+	file_t file;
+	os_memset(&file, 0, sizeof(file));
+	os_strcpy(file.name, "image");
+	file.size = length;
+	CHECK(save_file(file_number, file, (char *)image));
+}
+
+/*
+ * Runs a program to completion, completing each motion that it queues.
+ */
+LOCAL void run_to_completion(program_t *program) {
+	reset_motions();
+	CHECK(program != NULL);
+	if (program != NULL) {
+		CHECK(run_program(program));
+		run_until_idle();
+	}
+}
+
+/*
+ * Checks that the small program queued its motions.
+ */
+LOCAL void check_small_program() {
+	CHECK_INT(queued_motion_count, 2);
+	CHECK_INT(queued_motions[0].left_steps, 7);
+	CHECK_INT(queued_motions[0].func, 1);
+	CHECK_INT(queued_motions[0].offset, 1);
+	CHECK_INT(queued_motions[1].left_steps, -90);
+	CHECK_INT(queued_motions[1].func, 1);
+	CHECK_INT(queued_motions[1].offset, 3);
+}
+
+/*
+ * Checks the reason that a program image in memory is rejected.
+ */
+LOCAL void check_image_rejected(uint32_t length, const char *expected) {
+	const char *error = NULL;
+	CHECK(load_program_image(image, length, &error) == NULL);
+	CHECK_STR(error, expected);
+}
+
+/*
+ * Checks the reason that a program image saved in a file is rejected.
+ */
+LOCAL void check_file_rejected(uint32_t length, const char *expected) {
+	const char *error = NULL;
+	save_image(2, length);
+	CHECK(load_program_file(2, &error) == NULL);
+	CHECK_STR(error, expected);
+}
+
+/*
+ * Checks that a program image is loaded from memory and runs.
+ */
+LOCAL void test_load_image() {
+	uint32_t length = build_image(0, small_program, 2);
+	CHECK_INT(length, SMALL_IMAGE_LEN);
+	const char *error = NULL;
+	run_to_completion(load_program_image(image, length, &error));
+	check_small_program();
+}
+
+/*
+ * Checks that invalid program images are rejected, whether they are in memory or in a file. Each
+ * image is sealed with a good CRC when the problem is in its structure.
+ */
+LOCAL void test_image_rejected() {
+	uint32_t length = build_image(0, small_program, 2);
+	check_image_rejected(11, "Invalid program image size.");
+	check_image_rejected(MAX_PROGRAM_IMAGE_SIZE + 1, "Invalid program image size.");
+	check_file_rejected(8, "Invalid program image size.");
+
+	image[0] = 'X';
+	check_image_rejected(length, "Not a program image.");
+	check_file_rejected(length, "Not a program image.");
+
+	build_image(0, small_program, 2);
+	image[4] = PROGRAM_IMAGE_VERSION + 1;
+	check_image_rejected(length, "Unsupported program image version.");
+	check_file_rejected(length, "Unsupported program image version.");
+
+	// A damaged byte of code, header or CRC.
+	for (uint32_t offset = 5; offset < length; offset += 7) {
+		build_image(0, small_program, 2);
+		image[offset] ^= 0x10;
+		check_image_rejected(length, "Program image checksum mismatch.");
+		check_file_rejected(length, "Program image checksum mismatch.");
+	}
+
+	build_image(0, small_program, 2);
+	image[6] = 0;
+	seal_image(length);
+	check_image_rejected(length, "Program image has no functions.");
+	check_file_rejected(length, "Program image has no functions.");
+
+	// Function tables that account for more or less than the image, or that run past its end.
+	for (int8_t change = -1; change <= 1; change += 2) {
+		build_image(0, small_program, 2);
+		image[TABLE_OFFSET + ENTRY_LEN + 5] += change;
+		seal_image(length);
+		check_image_rejected(length, "function table doesn't match its size");
+		check_file_rejected(length, "function table doesn't match its size");
+	}
+	build_image(0, small_program, 2);
+	image[6] = 40;
+	seal_image(length);
+	check_image_rejected(length, "function table doesn't match its size");
+	check_file_rejected(length, "function table doesn't match its size");
+
+	const char *error = NULL;
+	CHECK(load_program_file(7, &error) == NULL);
+	CHECK_STR(error, "The file is not in use.");
+}
+
+/*
+ * Checks that a program image saved in a file runs from the flash memory, with each function's code
+ * read from any offset in the image.
+ */
+LOCAL void test_run_from_file() {
+	uint32_t length = build_image(0, small_program, 2);
+	save_image(3, length);
+	const char *error = NULL;
+	program_t *program = load_program_file(3, &error);
+	CHECK(program != NULL);
+	if (program != NULL) {
+		CHECK(program->flash_address != 0);
+		CHECK_INT(program->function_count, 2);
+		CHECK_INT(program->functions[1].argument_count, 1);
+		CHECK_INT(program->functions[1].length, sizeof(small_function));
+	}
+	run_to_completion(program);
+	check_small_program();
+
+	// A function longer than a single flash read, starting at an unaligned offset, with its motions
+	// spread through it: REPEAT 100 [FD 1, a = 1 + 1].
+	uint8_t long_main[602];
+	for (uint32_t ii = 0; ii < 100; ii++) {
+		const uint8_t block[] = {ICONST_1, FD, ICONST_1, ICONST_1, IADD, ISTORE_0};
+		os_memcpy(&long_main[ii * sizeof(block)], block, sizeof(block));
+	}
+	long_main[600] = STOP;
+	long_main[601] = STOP;
+	const image_function_t long_program[] = {{0, 1, 2, long_main, sizeof(long_main)}};
+	length = build_image(0, long_program, 1);
+	CHECK_INT(length % 4, 0);
+	save_image(3, length);
+	run_to_completion(load_program_file(3, &error));
+	CHECK_INT(queued_motion_count, 100);
+	for (uint32_t ii = 0; ii < queued_motion_count; ii++) {
+		CHECK_INT(queued_motions[ii].offset, ii * 6 + 1);
+	}
+}
+
+int main() {
+	init_vm();
+	test_load_image();
+	test_image_rejected();
+	test_run_from_file();
+	return test_summary("test_program_image");
+}
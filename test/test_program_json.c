@@ -0,0 +1,222 @@
+/*
+ * test_program_json.c: Host tests of the incremental decoding of programs from JSON, and from the
+ * HTML forms holding it, split into chunks at every possible boundary.
+ *
+ * Author: Ian Marshall
+ * Date: 16/10/2026
+ */
+#include "esp8266.h"
+#include "mem.h"
+#include "program_json.h"
+#include "test.h"
+
+// Decode the whole of the data in a single chunk.
+#define NO_SPLIT 0xFFFFFFFF
+
+// Decode the data a character at a time.
+#define EVERY_CHAR 0xFFFFFFFE
+
+// A program with two functions, the second having its keys out of order and no byte code, and with
+// multi-digit numbers and whitespace throughout.
+LOCAL const char program_json[] =
+		" {\"program\": {\"globals\": 3, \"functions\": [\n"
+		"\t{\"args\": 0, \"locals\": 2, \"stack\": 12, \"codes\": [15, 0, 0, 1, 44, 1 ,40, 255]},\n"
+		"\t{\"stack\":1,\"codes\":[ ],\"args\":1,\"locals\":0}\n"
+		"]}} ";
+
+// The first function's byte code.
+LOCAL const uint8_t first_codes[] = {15, 0, 0, 1, 44, 1, 40, 255};
+
+// The buffer for the HTML form holding the program, and for the largest programs.
+LOCAL char buf[4 * MAX_PROGRAM_IMAGE_SIZE];
+
+/*
+ * Decodes a program from JSON, or from an HTML form holding it, in two chunks split at the given
+ * offset (or as NO_SPLIT or EVERY_CHAR describe). Returns the program, which the caller must free,
+ * or NULL with the reason it was rejected.
+ */
+LOCAL program_t *decode(const char *data, bool form, uint32_t split, const char **error) {
+	uint32_t length = strlen(data);
+	program_json_t pj;
+	CHECK(init_program_json(&pj, length));
+	uint32_t chunk = (split == EVERY_CHAR) ? 1 : ((split == NO_SPLIT) ? length : split);
+	uint32_t offset = 0;
+	do {
+		if (chunk > length - offset) {
+			chunk = length - offset;
+		}
+		if (form) {
+			parse_program_form(&pj, &data[offset], chunk);
+		} else {
+			parse_program_json(&pj, &data[offset], chunk);
+		}
+		offset += chunk;
+		if (split != EVERY_CHAR) {
+			chunk = length;
+		}
+	} while (offset < length);
+	program_t *program = finish_program_json(&pj);
+	*error = pj.error;
+	return program;
+}
+
+/*
+ * Checks that the program was decoded, and frees it.
+ */
+LOCAL void check_program(program_t *program, uint32_t split) {
+	CHECK(program != NULL);
+	if (program == NULL) {
+		printf("Split at %u: program rejected.\n", split);
+		return;
+	}
+	CHECK_INT(program->global_count, 3);
+	CHECK_INT(program->function_count, 2);
+	CHECK_INT(program->code_used, sizeof(first_codes));
+	CHECK_INT(program->code_size, sizeof(first_codes));
+	if (program->function_count == 2) {
+		function_t *first = &program->functions[0];
+		CHECK_INT(first->id, 0);
+		CHECK_INT(first->argument_count, 0);
+		CHECK_INT(first->local_count, 2);
+		CHECK_INT(first->stack_size, 12);
+		CHECK_INT(first->length, sizeof(first_codes));
+		CHECK(memcmp(first->code, first_codes, sizeof(first_codes)) == 0);
+		function_t *second = &program->functions[1];
+		CHECK_INT(second->id, 1);
+		CHECK_INT(second->argument_count, 1);
+		CHECK_INT(second->local_count, 0);
+		CHECK_INT(second->stack_size, 1);
+		CHECK_INT(second->length, 0);
+	}
+	os_free(program);
+}
+
+/*
+ * Checks that data is rejected for the expected reason wherever it is split into chunks.
+ */
+LOCAL void check_rejected(const char *data, bool form, const char *expected) {
+	uint32_t length = strlen(data);
+	for (uint32_t split = 0; split <= length; split++) {
+		const char *error = NULL;
+		CHECK(decode(data, form, split, &error) == NULL);
+		CHECK_STR(error, expected);
+	}
+	const char *error = NULL;
+	CHECK(decode(data, form, EVERY_CHAR, &error) == NULL);
+	CHECK_STR(error, expected);
+}
+
+/*
+ * Writes the program's JSON into the buffer as the "code" field of a URL encoded HTML form, between
+ * other fields, escaping its punctuation with upper and lower case %XX escapes and its spaces with
+ * pluses.
+ */
+LOCAL void build_form() {
+	char *p = buf;
+	p += sprintf(p, "name=co%%64e&codex=1&code=");
+	for (const char *c = program_json; *c != '\0'; c++) {
+		if (*c == ' ') {
+			*p++ = '+';
+		} else if ((*c == '"') || (*c == ',') || (*c == '{')) {
+			p += sprintf(p, "%%%02X", *c);
+		} else if ((*c == ':') || (*c == '\n') || (*c == ']')) {
+			p += sprintf(p, "%%%02x", *c);
+		} else {
+			*p++ = *c;
+		}
+	}
+	sprintf(p, "&code=x%%20y");
+}
+
+/*
+ * Checks that the program's JSON decodes the same wherever it is split into chunks, including
+ * within keys and numbers.
+ */
+LOCAL void test_json_chunks() {
+	const char *error = NULL;
+	check_program(decode(program_json, false, NO_SPLIT, &error), NO_SPLIT);
+	check_program(decode(program_json, false, EVERY_CHAR, &error), EVERY_CHAR);
+	for (uint32_t split = 0; split <= strlen(program_json); split++) {
+		check_program(decode(program_json, false, split, &error), split);
+	}
+}
+
+/*
+ * Checks that the program's JSON decodes the same from an HTML form wherever it is split into
+ * chunks, including within the field names and %XX escapes.
+ */
+LOCAL void test_form_chunks() {
+	build_form();
+	const char *error = NULL;
+	check_program(decode(buf, true, NO_SPLIT, &error), NO_SPLIT);
+	check_program(decode(buf, true, EVERY_CHAR, &error), EVERY_CHAR);
+	for (uint32_t split = 0; split <= strlen(buf); split++) {
+		check_program(decode(buf, true, split, &error), split);
+	}
+}
+
+/*
+ * Checks that invalid JSON and forms are rejected wherever they are split into chunks.
+ */
+LOCAL void test_rejected() {
+	check_rejected("{\"program\":{\"globalz\":1}}", false, "unknown program field");
+	check_rejected("{\"program\":{\"globals\":1000000000}}", false, "number too large");
+	check_rejected("{\"program\":{\"globals\":-}}", false, "expected a number");
+	check_rejected("{\"program\":{\"globals\":-1,\"functions\":[]}}", false,
+			"Invalid global count");
+	check_rejected("{\"program\":{\"globals\":0,\"functions\":[{\"args\":0,\"locals\":0,"
+			"\"stack\":0,\"codes\":[1,256]}]}}", false, "must be in a valid array");
+	check_rejected("{\"program\":{\"globals\":0,\"functions\":[{\"args\":0,\"locals\":0,"
+			"\"stack\":0,\"codes\":[1,,2]}]}}", false, "must not hold empty numbers");
+	check_rejected("{\"program\":{\"globals\":0,\"globals\":0}}", false, "duplicate field");
+	check_rejected("{\"program\":{\"globals\":0,\"functions\":[{\"args\":0}]}}", false,
+			"missing required function parameter");
+	check_rejected("{\"program\":{\"globals\":1", false, "incomplete program");
+	check_rejected("{\"program\":{\"globals\":0,\"functions\":[{\"args\":0,\"locals\":0,"
+			"\"stack\":0,\"codes\":[]}]}} x", false, "unexpected data");
+	check_rejected("code=%7B%22program%2G", true, "Invalid escape");
+	check_rejected("name=code&other=1", true, "Missing the \"code\" parameter");
+}
+
+/*
+ * Writes a program with a single function of the given number of byte codes into the buffer.
+ */
+LOCAL void build_large_program(uint32_t code_len) {
+	char *p = buf;
+	p += sprintf(p, "{\"program\":{\"globals\":0,\"functions\":[{\"args\":0,\"locals\":0,"
+			"\"stack\":0,\"codes\":[");
+	for (uint32_t ii = 0; ii < code_len; ii++) {
+		p += sprintf(p, (ii == 0) ? "%u" : ",%u", ii % 10);
+	}
+	sprintf(p, "]}]}}");
+}
+
+/*
+ * Checks that a program's byte code may fill the largest program's code area exactly, but not go
+ * beyond it.
+ */
+LOCAL void test_code_size() {
+	build_large_program(MAX_PROGRAM_IMAGE_SIZE);
+	const char *error = NULL;
+	program_t *program = decode(buf, false, NO_SPLIT, &error);
+	CHECK(program != NULL);
+	if (program != NULL) {
+		CHECK_INT(program->code_used, MAX_PROGRAM_IMAGE_SIZE);
+		CHECK_INT(program->functions[0].length, MAX_PROGRAM_IMAGE_SIZE);
+		CHECK_INT(program->functions[0].code[MAX_PROGRAM_IMAGE_SIZE - 1],
+				(MAX_PROGRAM_IMAGE_SIZE - 1) % 10);
+		os_free(program);
+	}
+
+	build_large_program(MAX_PROGRAM_IMAGE_SIZE + 1);
+	CHECK(decode(buf, false, NO_SPLIT, &error) == NULL);
+	CHECK_STR(error, "Bytecode for functions is larger than the program.");
+}
+
+int main() {
+	test_json_chunks();
+	test_form_chunks();
+	test_rejected();
+	test_code_size();
+	return test_summary("test_program_json");
+}
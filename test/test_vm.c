@@ -0,0 +1,256 @@
+/*
+ * test_vm.c: Host tests of the VM's verifier, and of the superinstructions that byte code sequences
+ * are fused into when a program is decoded.
+ *
+ * Author: Ian Marshall
+ * Date: 16/10/2026
+ */
+#include "esp8266.h"
+#include "vm.h"
+#include "fake_motion.h"
+#include "byte_code.h"
+
+// A function for a test program, with its byte code in an array.
+typedef struct test_function_t {
+	uint32_t args;
+	uint32_t locals;
+	uint32_t stack;
+	const uint8_t *code;
+	uint32_t length;
+} test_function_t;
+
+#define FUNCTION(args, locals, stack, code) {args, locals, stack, code, sizeof(code)}
+
+/*
+ * Creates a program from its functions.
+ */
+LOCAL program_t *build_program(uint32_t global_count, const test_function_t *functions,
+		uint32_t function_count) {
+	uint32_t code_size = 0;
+	for (uint32_t ii = 0; ii < function_count; ii++) {
+		code_size += functions[ii].length;
+	}
+	program_t *prog = create_program(global_count, function_count, code_size);
+	for (uint32_t ii = 0; ii < function_count; ii++) {
+		function_t *function = &prog->functions[ii];
+		function->id = ii;
+		function->argument_count = functions[ii].args;
+		function->local_count = functions[ii].locals;
+		function->stack_size = functions[ii].stack;
+		uint8_t *code = allocate_function_code(prog, function, functions[ii].length);
+		os_memcpy(code, functions[ii].code, functions[ii].length);
+	}
+	return prog;
+}
+
+/*
+ * Runs a program to completion, completing each motion that it queues.
+ * Returns false if the program was rejected.
+ */
+LOCAL bool run_to_completion(uint32_t global_count, const test_function_t *functions,
+		uint32_t function_count) {
+	reset_motions();
+	if (!run_program(build_program(global_count, functions, function_count))) {
+		return false;
+	}
+	run_until_idle();
+	return true;
+}
+
+/*
+ * Runs a program consisting of just a main function, expecting it to be rejected by the verifier.
+ * Returns the reason it was rejected, or NULL if it was accepted.
+ */
+LOCAL const char *rejection(uint32_t stack, const uint8_t *code, uint32_t length) {
+	test_function_t main = {0, 1, stack, code, length};
+	if (run_to_completion(1, &main, 1)) {
+		return NULL;
+	}
+	return get_vm_error();
+}
+
+#define REJECTION(stack, code) rejection(stack, code, sizeof(code))
+
+/*
+ * Checks that well formed programs are accepted, and run.
+ */
+LOCAL void test_accepted() {
+	static const uint8_t code[] = {ICONST, OPERAND(25), FD, ICONST_90, RT, STOP};
+	CHECK(REJECTION(1, code) == NULL);
+	CHECK_INT(queued_motion_count, 2);
+	CHECK_INT(queued_motions[0].left_steps, 25);
+	CHECK_INT(queued_motions[1].left_steps, 90);
+	CHECK_INT(queued_motions[1].right_steps, -90);
+}
+
+/*
+ * Checks that unknown and incomplete instructions are rejected.
+ */
+LOCAL void test_bad_instructions() {
+	static const uint8_t unknown[] = {ICONST_1, FD, 200, STOP};
+	CHECK_STR(REJECTION(1, unknown), "offset 2: unknown instruction 200");
+	static const uint8_t zero[] = {0, STOP};
+	CHECK_STR(REJECTION(1, zero), "offset 0: unknown instruction 0");
+	static const uint8_t incomplete[] = {STOP, ICONST, 0, 0};
+	CHECK_STR(REJECTION(1, incomplete), "offset 1: incomplete instruction");
+}
+
+/*
+ * Checks that programs which would underflow or overflow the stack, or reach a point with two
+ * different stack depths, are rejected.
+ */
+LOCAL void test_bad_stack() {
+	static const uint8_t underflow[] = {FD, STOP};
+	CHECK_STR(REJECTION(1, underflow), "offset 0: stack underflow");
+	static const uint8_t add_underflow[] = {ICONST_1, IADD, STOP};
+	CHECK_STR(REJECTION(2, add_underflow), "offset 1: stack underflow");
+	static const uint8_t overflow[] = {ICONST_1, ICONST_1, ICONST_1, IADD, IADD, FD, STOP};
+	CHECK_STR(REJECTION(2, overflow), "offset 2: stack overflow");
+
+	// A loop that leaves a value on the stack each time around.
+	static const uint8_t growing_loop[] = {ICONST_1, BR, OPERAND(0)};
+	CHECK_STR(REJECTION(8, growing_loop), "inconsistent stack depth");
+
+	// A branch that skips a push, so the paths join with different depths.
+	static const uint8_t join[] = {ICONST_1, ICONST_1, BRT, OPERAND(8), ICONST_1, STOP};
+	CHECK_STR(REJECTION(2, join), "offset 7: inconsistent stack depth");
+
+	// A call with fewer arguments on the stack than the function takes.
+	static const uint8_t caller[] = {ICONST_1, CALL, OPERAND(1), STOP};
+	static const uint8_t callee[] = {ILOAD_0, ILOAD_1, IADD, FD, RET};
+	const test_function_t functions[] = {FUNCTION(0, 0, 1, caller), FUNCTION(2, 0, 2, callee)};
+	CHECK(!run_to_completion(0, functions, 2));
+	CHECK_STR(get_vm_error(), "Function 0, offset 1: stack underflow");
+}
+
+/*
+ * Checks that branches to anywhere other than the start of an instruction within the function are
+ * rejected, whether or not the branch can be reached. Unreachable branches are still decoded, so
+ * a bad target must not be followed when the program is decoded either.
+ */
+LOCAL void test_bad_branches() {
+	static const uint8_t beyond[] = {ICONST_1, BRT, OPERAND(7), STOP};
+	CHECK_STR(REJECTION(1, beyond), "offset 1: invalid branch target");
+	static const uint8_t mid_instr[] = {ICONST, OPERAND(1), BRT, OPERAND(2), STOP};
+	CHECK_STR(REJECTION(1, mid_instr), "offset 5: invalid branch target");
+	static const uint8_t far[] = {BR, OPERAND(0x7FFFFFF0)};
+	CHECK_STR(REJECTION(1, far), "offset 0: invalid branch target");
+
+	// Branches that can never be reached, as they follow a STOP.
+	static const uint8_t unreachable_far[] = {STOP, BR, OPERAND(0x7FFFFFF0)};
+	CHECK_STR(REJECTION(1, unreachable_far), "offset 1: invalid branch target");
+	static const uint8_t unreachable_huge[] = {STOP, ICONST_0, BRF, OPERAND(0xFFFFFFFF), STOP};
+	CHECK_STR(REJECTION(1, unreachable_huge), "offset 2: invalid branch target");
+	static const uint8_t unreachable_end[] = {STOP, ICONST_1, BRT, OPERAND(8), STOP};
+	CHECK_STR(REJECTION(1, unreachable_end), "offset 2: invalid branch target");
+	static const uint8_t unreachable_mid[] = {STOP, ICONST, OPERAND(5), BR, OPERAND(3), STOP};
+	CHECK_STR(REJECTION(1, unreachable_mid), "offset 6: invalid branch target");
+
+	// An unreachable branch with a good target is fine.
+	static const uint8_t unreachable_good[] = {ICONST_1, FD, STOP, BR, OPERAND(0)};
+	CHECK(REJECTION(1, unreachable_good) == NULL);
+	CHECK_INT(queued_motion_count, 1);
+}
+
+/*
+ * Checks that the other invalid programs are rejected.
+ */
+LOCAL void test_bad_programs() {
+	static const uint8_t no_end[] = {ICONST_1, FD};
+	CHECK_STR(REJECTION(1, no_end), "offset 1: end of function without RET/STOP");
+	static const uint8_t ret_main[] = {RET};
+	CHECK_STR(REJECTION(1, ret_main), "offset 0: RET from the main function");
+	static const uint8_t bad_local[] = {ILOAD, OPERAND(1), FD, STOP};
+	CHECK_STR(REJECTION(1, bad_local), "offset 0: invalid local variable");
+	static const uint8_t bad_global[] = {ICONST_1, GSTORE_1, STOP};
+	CHECK_STR(REJECTION(1, bad_global), "offset 1: invalid global variable");
+	static const uint8_t bad_call[] = {CALL, OPERAND(1), STOP};
+	CHECK_STR(REJECTION(1, bad_call), "offset 0: invalid function ID for CALL");
+	static const uint8_t empty[] = {};
+	CHECK_STR(rejection(1, empty, 0), "Function 0 has no contents");
+}
+
+/*
+ * Checks that a loop whose sequences are fused into superinstructions runs as the byte code does,
+ * and reports the superinstructions in its statistics.
+ */
+LOCAL void test_fusion() {
+	// REPEAT 5 [FD 10, i = i + 1, FD i]
+	static const uint8_t code[] = {
+		ICONST_0, ISTORE_0,                    // 0:  i = 0
+		ILOAD_0, ICONST, OPERAND(5), ILT,      // 2:  BR_CONST (i >= 5) -> 31
+		BRF, OPERAND(31),
+		ICONST, OPERAND(10), FD,               // 14: MOVE_CONST FD 10
+		ILOAD_0, ICONST_1, IADD, ISTORE_0,     // 20: ADD_LOCAL i += 1
+		ILOAD_0, FD,                           // 24: FD i
+		BR, OPERAND(2),                        // 26: loop
+		STOP                                   // 31
+	};
+	const test_function_t main = FUNCTION(0, 1, 2, code);
+	CHECK(run_to_completion(0, &main, 1));
+	CHECK_INT(queued_motion_count, 10);
+	for (uint32_t ii = 0; (ii < 5) && (ii * 2 + 1 < queued_motion_count); ii++) {
+		CHECK_INT(queued_motions[ii * 2].left_steps, 10);
+		CHECK_INT(queued_motions[ii * 2].offset, 19);
+		CHECK_INT(queued_motions[ii * 2 + 1].left_steps, ii + 1);
+		CHECK_INT(queued_motions[ii * 2 + 1].offset, 25);
+	}
+
+	vm_stats_t stats;
+	get_vm_stats(&stats);
+	CHECK_INT(stats.fusion_sites[FUSE_BR_CONST], 1);
+	CHECK_INT(stats.fusion_sites[FUSE_MOVE_CONST], 1);
+	CHECK_INT(stats.fusion_sites[FUSE_ADD_LOCAL], 1);
+	CHECK_INT(stats.fusion_sites[FUSE_BR_LOCALS], 0);
+	CHECK_INT(stats.fusion_hits[FUSE_BR_CONST], 6);
+	CHECK_INT(stats.fusion_hits[FUSE_MOVE_CONST], 5);
+	CHECK_INT(stats.fusion_hits[FUSE_ADD_LOCAL], 5);
+}
+
+/*
+ * Checks that a sequence is not fused when a branch targets an instruction after its first, and
+ * that both paths to the branch target still run correctly.
+ */
+LOCAL void test_fusion_branch_target() {
+	for (uint8_t taken = 0; taken <= 1; taken++) {
+		// FD 9, unless the branch is taken, when FD 8 follows.
+		const uint8_t code[] = {
+			ICONST, OPERAND(9),                    // 0
+			taken ? ICONST_1 : ICONST_0,           // 5
+			BRT, OPERAND(17),                      // 6
+			FD,                                    // 11
+			ICONST, OPERAND(8),                    // 12: not fused with the FD at 17
+			FD,                                    // 17: branch target
+			STOP                                   // 18
+		};
+		const test_function_t main = FUNCTION(0, 0, 2, code);
+		CHECK(run_to_completion(0, &main, 1));
+
+		vm_stats_t stats;
+		get_vm_stats(&stats);
+		CHECK_INT(stats.fusion_sites[FUSE_MOVE_CONST], 0);
+		if (taken) {
+			CHECK_INT(queued_motion_count, 1);
+			CHECK_INT(queued_motions[0].left_steps, 9);
+			CHECK_INT(queued_motions[0].offset, 17);
+		} else {
+			CHECK_INT(queued_motion_count, 2);
+			CHECK_INT(queued_motions[0].left_steps, 9);
+			CHECK_INT(queued_motions[0].offset, 11);
+			CHECK_INT(queued_motions[1].left_steps, 8);
+			CHECK_INT(queued_motions[1].offset, 17);
+		}
+	}
+}
+
+int main() {
+	init_vm();
+	test_accepted();
+	test_bad_instructions();
+	test_bad_stack();
+	test_bad_branches();
+	test_bad_programs();
+	test_fusion();
+	test_fusion_branch_target();
+	return test_summary("test_vm");
+}
@@ -0,0 +1,152 @@
+#!/usr/bin/env python3
+#
+# trace_decode.py - decodes the step event trace recorded by the micro-turtle's motors, and renders
+# the velocity profile of each motor.
+#
+# Usage:
+#   trace_decode.py <host|IP|file> [--csv] [--window <ticks>]
+#
+# Where:
+#   <host|IP|file>    the hostname or IP address of the micro-turtle to download the trace from
+#                     (/trace.cgi), or a file holding a previously downloaded trace.
+#   --csv             prints each step event as CSV, rather than plotting the velocity profile.
+#   --window <ticks>  the number of ticks over which the velocities are averaged (default 20).
+#
+# The trace holds the most recent step events written to the motors. Each event records the ticks
+# since the previous event, the step sequence position of each motor and the phase of the movement.
+# The ticks whilst the motors are stopped between movements aren't recorded, and gaps of 65535 ticks
+# or more (after a pause or a slow start) are recorded as 65535 ticks.
+#
+# The trace is only recorded when the firmware is built with MOTOR_TRACE defined.
+#
+
+import os
+import struct
+import sys
+import urllib.request
+
+# The number of positions in each motor's step sequence.
+STEP_SEQUENCE_COUNT = 8
+
+# The ticks recorded for a gap too long to be held in an event.
+SATURATED_TICKS = 0xFFFF
+
+# The names of the movement phases held in each event's flags.
+PHASES = ['steady', 'accelerating', 'cruising', 'decelerating']
+
+def load_trace(source):
+	"""Returns the trace's bytes, from a file or downloaded from the micro-turtle."""
+	if os.path.exists(source):
+		with open(source, 'rb') as f:
+			return f.read()
+	with urllib.request.urlopen('http://{}/trace.cgi'.format(source), timeout=10) as response:
+		return response.read()
+
+def decode_trace(data):
+	"""Decodes the trace's header and events, returning the tick interval and the events."""
+	if (len(data) < 16) or (data[0:4] != b'MTRC'):
+		raise ValueError('Not a motor trace')
+	version, tick_interval, recorded = struct.unpack('>III', data[4:16])
+	if version != 1:
+		raise ValueError('Unknown motor trace version {}'.format(version))
+	events = []
+	tick = 0
+	saturated = 0
+	positions = None
+	for (value,) in struct.iter_unpack('>I', data[16:len(data) - (len(data) % 4)]):
+		ticks = value >> 16
+		flags = value & 0xFF
+		new_positions = [(value >> 8) & 0x0F, (value >> 12) & 0x0F]
+
+		# The number of half steps each motor moved by, from the change in its step sequence
+		# position. The first event's movement is unknown, so it is taken to be a single step.
+		half_steps = [0, 0]
+		for motor in range(2):
+			if flags & (1 << motor):
+				if positions is None:
+					moved = 1
+				else:
+					moved = (positions[motor] - new_positions[motor]) % STEP_SEQUENCE_COUNT
+					if moved > STEP_SEQUENCE_COUNT // 2:
+						moved = STEP_SEQUENCE_COUNT - moved
+				reverse = flags & (1 << (motor + 2))
+				half_steps[motor] = -moved if reverse else moved
+		positions = new_positions
+
+		if ticks == SATURATED_TICKS:
+			saturated += 1
+		tick += ticks
+		events.append({
+			'tick': tick,
+			'left': half_steps[0],
+			'right': half_steps[1],
+			'phase': PHASES[(flags >> 5) & 0x03],
+			'command': bool(flags & 0x10),
+			'last': bool(flags & 0x80),
+			'saturated': ticks == SATURATED_TICKS})
+	print('Decoded {} of {} recorded events, {} us per tick'.format(
+			len(events), recorded, tick_interval), file=sys.stderr)
+	if saturated:
+		print('{} gaps were too long to record, and are shortened to {} ticks'.format(
+				saturated, SATURATED_TICKS), file=sys.stderr)
+	return tick_interval, events
+
+def velocity_profile(events, tick_interval, window):
+	"""Returns the time (s) and each motor's velocity (half steps/s), averaged over each window."""
+	times = []
+	left = []
+	right = []
+	if not events:
+		return times, left, right
+	end = events[-1]['tick']
+	index = 0
+	for start in range(0, end + 1, window):
+		moved = [0, 0]
+		while (index < len(events)) and (events[index]['tick'] < start + window):
+			moved[0] += events[index]['left']
+			moved[1] += events[index]['right']
+			index += 1
+		seconds = window * tick_interval / 1000000.0
+		times.append((start + window / 2.0) * tick_interval / 1000000.0)
+		left.append(moved[0] / seconds)
+		right.append(moved[1] / seconds)
+	return times, left, right
+
+def main(argv):
+	if len(argv) < 2:
+		print('Usage:')
+		print('  trace_decode.py <host|IP|file> [--csv] [--window <ticks>]')
+		return 1
+	csv = '--csv' in argv
+	window = int(argv[argv.index('--window') + 1]) if '--window' in argv else 20
+	tick_interval, events = decode_trace(load_trace(argv[1]))
+
+	if csv:
+		print('tick,left,right,phase,command,last,saturated')
+		for event in events:
+			print('{tick},{left},{right},{phase},{command:d},{last:d},{saturated:d}'.format(**event))
+		return 0
+
+	times, left, right = velocity_profile(events, tick_interval, window)
+	try:
+		import matplotlib.pyplot as plt
+	except ImportError:
+		# Render the profile as text instead.
+		top = max([abs(v) for v in left + right] + [1])
+		for t, l, r in zip(times, left, right):
+			print('{:8.3f}s L {:7.0f} {:<30} R {:7.0f} {:<30}'.format(
+					t, l, '#' * int(30 * abs(l) / top), r, '#' * int(30 * abs(r) / top)))
+		return 0
+	plt.plot(times, left, label='Left motor')
+	plt.plot(times, right, label='Right motor')
+	for event in events:
+		if event['last']:
+			plt.axvline(event['tick'] * tick_interval / 1000000.0, color='grey', linewidth=0.5)
+	plt.xlabel('Time whilst moving (s)')
+	plt.ylabel('Velocity (half steps/s)')
+	plt.legend()
+	plt.show()
+	return 0
+
+if __name__ == '__main__':
+	sys.exit(main(sys.argv))